@@ -1,8 +1,19 @@
-cbuffer constants : register(b0)
+// FInstanceGPUData (InstanceBatcher.h)와 같은 레이아웃
+struct FInstanceData
 {
 	row_major float4x4 World;
+	float4 Color;
 	uint UUID;
-	float3 Pad;
+	uint3 Pad;
+};
+
+StructuredBuffer<FInstanceData> Instances : register(t0);
+
+// 메시 구조화 버퍼 안에서 이 드로우의 시작 위치
+cbuffer InstanceBatch : register(b3)
+{
+	uint InstanceOffset;
+	uint3 InstanceBatchPad;
 };
 
 cbuffer PerFrame : register(b1)
@@ -47,13 +58,12 @@ PS_INPUT MainVS(VS_INPUT Input, uint InstanceId : SV_InstanceID)
 {
 	PS_INPUT Output;
 
-	float4 Position = Input.Position;
-	float4 ShadeColor = Input.Color;
-
+	FInstanceData Instance = Instances[InstanceOffset + InstanceId];
 
+	float4 Position = Input.Position;
+	float4 ShadeColor = Input.Color * Instance.Color;
 
-	
-	Position = mul(Position, World);
+	Position = mul(Position, Instance.World);
 		
 	Position = mul(Position, ViewMatrix);
 	Position = mul(Position, ProjectionMatrix);
@@ -61,7 +71,7 @@ PS_INPUT MainVS(VS_INPUT Input, uint InstanceId : SV_InstanceID)
 	Output.Position = Position;
 	Output.Color = ShadeColor;
 	Output.UV = Input.BaseUV;
-	Output.UUID = UUID;
+	Output.UUID = Instance.UUID;
 	return Output;
 }
 
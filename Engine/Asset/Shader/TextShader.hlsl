@@ -1,9 +1,24 @@
-cbuffer Model : register(b0)
+// 라벨 한 개의 월드 행렬/UUID (FInstanceGPUData와 같은 레이아웃)
+struct FLabelData
 {
-	row_major float4x4 ModelMatrix;
+	row_major float4x4 World;
+	float4 Color;
 	uint UUID;
-	float3 Pad;
-}
+	uint3 Pad;
+};
+
+StructuredBuffer<FLabelData> Labels : register(t1);
+
+// 글자 한 개 (FTextGlyphInstance와 같은 레이아웃). 라벨마다 고정 구간에 있고 바뀐 구간만 CPU가 다시 올린다
+struct FGlyphData
+{
+	float2 Offset;
+	uint CharID;
+	float4 Color;
+	uint LabelIndex;
+};
+
+StructuredBuffer<FGlyphData> Glyphs : register(t2);
 
 cbuffer PerFrame : register(b1)
 {
@@ -29,11 +44,17 @@ Texture2D FontAtlas : register(t0);
 SamplerState Sampler : register(s0);
 
 
+// 인스턴스 = 뒤→앞으로 정렬된 글자 표 번호
 struct VS_INPUT
 {
-	float3 Position : POSITION;
-	float2 UV : TEXCOORD0;
-	uint CharID : TEXCOORD1;
+	uint GlyphSlot : TEXCOORD0;
+};
+
+// 글자 사각형 6개 정점의 UV: 좌상, 우하, 좌하 / 우하, 좌상, 우상
+static const float2 QuadUV[6] =
+{
+	float2(0, 0), float2(1, 1), float2(0, 1),
+	float2(1, 1), float2(0, 0), float2(1, 0)
 };
 
 struct PS_INPUT
@@ -52,21 +73,28 @@ struct PS_OUTPUT
 
 float3 GetCameraForward();
 
-PS_INPUT mainVS(VS_INPUT Input)
+PS_INPUT mainVS(VS_INPUT Input, uint VertexId : SV_VertexID)
 {
 	PS_INPUT Output;
 
+	FGlyphData Glyph = Glyphs[Input.GlyphSlot];
+	FLabelData Label = Labels[Glyph.LabelIndex];
+	float2 CornerUV = QuadUV[VertexId];
+
+	// 글자는 라벨 로컬 YZ 평면에서 Y: Offset.x ~ +1, Z: Offset.y - 0.5 ~ +0.5 (V는 아래로 증가)
+	float3 Position = float3(0.0f, Glyph.Offset.x + CornerUV.x, Glyph.Offset.y + 0.5f - CornerUV.y);
+
 	float FontScale = 1 / 3.0f;
-	float3 BasePos = float3(Input.Position.x, Input.Position.y, Input.Position.z) * FontScale;
+	float3 BasePos = Position * FontScale;
 
-	float4 world= mul(float4(BasePos, 1), ModelMatrix);
+	float4 world= mul(float4(BasePos, 1), Label.World);
 	float4 view = mul(world, ViewMatrix);
 	float4 clip = mul(view, ProjectionMatrix);
 
 	Output.WorldPos = clip;
-	Output.Color = float4(1, 1, 1, 1);
-	Output.UV = UvTable[Input.CharID].UvSize * Input.UV + UvTable[Input.CharID].UvOffset;
-	Output.UUID = UUID;
+	Output.Color = Glyph.Color;
+	Output.UV = UvTable[Glyph.CharID].UvSize * CornerUV + UvTable[Glyph.CharID].UvOffset;
+	Output.UUID = Label.UUID;
 
 	return Output;
 }
@@ -81,7 +109,7 @@ PS_OUTPUT mainPS(PS_INPUT Input)
 		return Result;
 	}
 	float4 TextureColor = FontAtlas.Sample(Sampler, Input.UV);
-	Result.FinalColor = TextureColor;
+	Result.FinalColor = TextureColor * Input.Color;
 	Result.UUID = Input.UUID;
 	return Result;
 }
@@ -1,10 +1,3 @@
-cbuffer Model : register(b0)
-{
-	row_major float4x4 ModelMatrix;
-	uint UUID;
-	float3 Pad0;
-};
-
 cbuffer PerFrame : register(b1)
 {
 	row_major float4x4 ViewMatrix;
@@ -13,20 +6,15 @@ cbuffer PerFrame : register(b1)
 	float3 Pad1;
 };
 
-// Billboard용: UVRect.xy = Offset, UVRect.zw = Size
-cbuffer BillboardCB : register(b4)
-{
-	float4 UVRect; // (U, V, UL, VL)
-	float4 SpriteColor; // (r,g,b,a)
-}
-
 Texture2D SpriteTex : register(t0);
 SamplerState SpriteSamp : register(s0);
 
 struct VS_INPUT
 {
-	float3 Position : POSITION; // CPU가 만들어준 월드 좌표 or 카메라-빌보드 변환 전 좌표
-	float2 UV : TEXCOORD0;
+	float3 Position : POSITION; // CPU가 카메라를 향하게 펼친 월드 좌표
+	float2 UV : TEXCOORD0;      // 스프라이트 UV 사각형이 이미 적용된 값
+	float4 Color : COLOR;
+	uint UUID : UUID;
 };
 
 struct PS_INPUT
@@ -49,9 +37,9 @@ PS_INPUT mainVS(VS_INPUT In)
 	float4 wp = mul(float4(In.Position, 1.0), ViewMatrix);
 	Out.HPos = mul(wp, ProjectionMatrix);
 
-	Out.UV = UVRect.xy + In.UV * UVRect.zw;
-	Out.Color = SpriteColor;
-	Out.UUID = UUID;
+	Out.UV = In.UV;
+	Out.Color = In.Color;
+	Out.UUID = In.UUID;
 	return Out;
 }
 
@@ -0,0 +1,155 @@
+#include "pch.h"
+#include "Global/CPUFeatures.h"
+
+#include <atomic>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+namespace
+{
+	void QueryCPUID(int32 InLeaf, int32 InSubLeaf, uint32 OutRegisters[4])
+	{
+#if defined(_MSC_VER)
+		int Registers[4];
+		__cpuidex(Registers, InLeaf, InSubLeaf);
+		for (int i = 0; i < 4; ++i) OutRegisters[i] = static_cast<uint32>(Registers[i]);
+#else
+		__cpuid_count(InLeaf, InSubLeaf, OutRegisters[0], OutRegisters[1], OutRegisters[2], OutRegisters[3]);
+#endif
+	}
+
+	// OS가 저장/복원해 주는 레지스터 상태 (XCR0)
+	uint64 QueryXCR0()
+	{
+#if defined(_MSC_VER)
+		return _xgetbv(0);
+#else
+		uint32 Low, High;
+		__asm__ volatile("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+		return (static_cast<uint64>(High) << 32) | Low;
+#endif
+	}
+
+	FCPUFeatures DetectFeatures()
+	{
+		FCPUFeatures Features;
+
+		uint32 Registers[4];
+		QueryCPUID(0, 0, Registers);
+		const uint32 MaxLeaf = Registers[0];
+		if (MaxLeaf < 1)
+		{
+			return Features;
+		}
+
+		QueryCPUID(1, 0, Registers);
+		const uint32 Leaf1ECX = Registers[2];
+		Features.bSSE41 = (Leaf1ECX & (1u << 19)) != 0;
+		Features.bFMA = (Leaf1ECX & (1u << 12)) != 0;
+
+		const bool bOSXSave = (Leaf1ECX & (1u << 27)) != 0;
+		const uint64 XCR0 = bOSXSave ? QueryXCR0() : 0;
+		// XMM | YMM
+		const bool bOSSupportsYMM = (XCR0 & 0x6) == 0x6;
+		// XMM | YMM | Opmask | ZMM_Hi256 | Hi16_ZMM
+		const bool bOSSupportsZMM = (XCR0 & 0xE6) == 0xE6;
+
+		Features.bAVX = bOSSupportsYMM && (Leaf1ECX & (1u << 28)) != 0;
+		Features.bFMA = Features.bFMA && Features.bAVX;
+
+		if (MaxLeaf >= 7)
+		{
+			QueryCPUID(7, 0, Registers);
+			const uint32 Leaf7EBX = Registers[1];
+			Features.bAVX2 = Features.bAVX && (Leaf7EBX & (1u << 5)) != 0;
+			Features.bAVX512F = bOSSupportsZMM && (Leaf7EBX & (1u << 16)) != 0;
+		}
+
+		if (Features.bAVX512F && Features.bAVX2 && Features.bFMA)
+		{
+			Features.MaxLevel = ESIMDLevel::AVX512;
+		}
+		else if (Features.bAVX2 && Features.bFMA)
+		{
+			Features.MaxLevel = ESIMDLevel::AVX2;
+		}
+		else if (Features.bSSE41)
+		{
+			Features.MaxLevel = ESIMDLevel::SSE41;
+		}
+
+		return Features;
+	}
+
+	std::atomic<uint8>& ActiveLevelStorage()
+	{
+		static std::atomic<uint8> ActiveLevel(static_cast<uint8>(FCPUFeatures::Get().MaxLevel));
+		return ActiveLevel;
+	}
+}
+
+const FCPUFeatures& FCPUFeatures::Get()
+{
+	static const FCPUFeatures Features = DetectFeatures();
+	return Features;
+}
+
+ESIMDLevel FCPUFeatures::GetActiveLevel()
+{
+	return static_cast<ESIMDLevel>(ActiveLevelStorage().load(std::memory_order_relaxed));
+}
+
+ESIMDLevel FCPUFeatures::SetActiveLevel(ESIMDLevel InLevel)
+{
+	const ESIMDLevel Applied = std::min(InLevel, Get().MaxLevel);
+	ActiveLevelStorage().store(static_cast<uint8>(Applied), std::memory_order_relaxed);
+	return Applied;
+}
+
+const char* FCPUFeatures::ToString(ESIMDLevel InLevel)
+{
+	switch (InLevel)
+	{
+	case ESIMDLevel::Scalar:
+		return "Scalar";
+	case ESIMDLevel::SSE41:
+		return "SSE4.1";
+	case ESIMDLevel::AVX2:
+		return "AVX2";
+	case ESIMDLevel::AVX512:
+		return "AVX-512";
+	default:
+		return "Unknown";
+	}
+}
+
+bool FCPUFeatures::FromString(const FString& InName, ESIMDLevel& OutLevel)
+{
+	FString Lower = InName;
+	std::transform(Lower.begin(), Lower.end(), Lower.begin(), ::tolower);
+
+	if (Lower == "scalar")
+	{
+		OutLevel = ESIMDLevel::Scalar;
+	}
+	else if (Lower == "sse41" || Lower == "sse4.1")
+	{
+		OutLevel = ESIMDLevel::SSE41;
+	}
+	else if (Lower == "avx2")
+	{
+		OutLevel = ESIMDLevel::AVX2;
+	}
+	else if (Lower == "avx512" || Lower == "avx-512")
+	{
+		OutLevel = ESIMDLevel::AVX512;
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+/**
+ * @brief 런타임 SIMD 경로
+ * 커널 테이블(MSOC, 행렬 배치 연산)은 이 값으로 인덱싱된다.
+ * 엔진은 기본 명령어 집합(SSE2)으로 빌드되고, 상위 경로 커널만 이름이 SSE41, AVX2, AVX512로 끝나는 TU에서 해당 플래그로 컴파일된다.
+ */
+enum class ESIMDLevel : uint8
+{
+	Scalar,
+	SSE41,
+	AVX2,
+	AVX512,
+
+	End
+};
+
+/**
+ * @brief 시작 시 1회 CPUID/XGETBV로 지원 명령어를 검사하고 사용할 SIMD 경로를 고른다
+ * OS가 YMM/ZMM 상태 저장을 지원하지 않으면 해당 경로는 사용하지 않는다.
+ */
+struct FCPUFeatures
+{
+	bool bSSE41 = false;
+	bool bAVX = false;
+	bool bAVX2 = false;
+	bool bFMA = false;
+	bool bAVX512F = false;
+
+	/** CPU가 지원하는 최고 경로 */
+	ESIMDLevel MaxLevel = ESIMDLevel::Scalar;
+
+	static const FCPUFeatures& Get();
+
+	/** 현재 선택된 경로 (기본값 = MaxLevel) */
+	static ESIMDLevel GetActiveLevel();
+
+	/**
+	 * @brief 벤치마크/디버깅용 경로 강제 지정, MaxLevel보다 높게는 설정되지 않는다
+	 * @return 실제로 적용된 경로
+	 */
+	static ESIMDLevel SetActiveLevel(ESIMDLevel InLevel);
+
+	static const char* ToString(ESIMDLevel InLevel);
+	static bool FromString(const FString& InName, ESIMDLevel& OutLevel);
+};
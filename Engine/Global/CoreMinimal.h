@@ -0,0 +1,63 @@
+#pragma once
+
+/**
+ * @brief 플랫폼/그래픽스 API에 의존하지 않는 엔진 공용 헤더 묶음
+ * pch.h가 Windows/D3D 헤더 다음에 포함하며, 헤드리스 테스트(Tests/)는 이것만으로 엔진 코드를 빌드한다.
+ */
+
+// Standard Library
+#include <cmath>
+#include <cfloat>
+#include <cassert>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <functional>
+#include <filesystem>
+#include <iterator>
+#include <sstream>
+
+// Global Included
+#include "Global/Types.h"
+#include "Global/CPUFeatures.h"
+#include "Global/Memory.h"
+#include "Global/Constant.h"
+#include "Global/Enum.h"
+#include "Global/Matrix.h"
+#include "Global/Quat.h"
+#include "Global/Vector.h"
+#include "Global/Macro.h"
+#include "Global/Name.h"
+#include "Global/NameTable.h"
+#include "Math/AABB.h"
+#include "Math/Math.h"
+#include "Global/Traits.h"
+#include "Manager/Time/Week05TimeClass.h"
+
+
+using std::clamp;
+using std::unordered_map;
+using std::to_string;
+using std::function;
+using std::wstring;
+using std::cout;
+using std::cerr;
+using std::min;
+using std::max;
+using std::exception;
+using std::stoul;
+using std::ofstream;
+using std::ifstream;
+using std::setw;
+using std::sort;
+using std::shared_ptr;
+using std::unique_ptr;
+using std::streamsize;
+
+// File System
+namespace filesystem = std::filesystem;
+using filesystem::path;
+using filesystem::exists;
+using filesystem::create_directories;
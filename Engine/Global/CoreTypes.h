@@ -330,15 +330,6 @@ inline bool HasFlag(EEngineShowFlags flags, EEngineShowFlags flag)
 	return (flags & flag) == flag;
 }
 
-/**
- * @brief Render State Settings for Actor's Component
- */
-struct FRenderState
-{
-	D3D11_CULL_MODE CullMode = D3D11_CULL_NONE;
-	D3D11_FILL_MODE FillMode = D3D11_FILL_SOLID;
-};
-
 enum EWorldType
 {
 	Editor,
@@ -381,11 +372,11 @@ private:
  */
 struct FPoint
 {
-	INT X, Y;
+	int32 X, Y;
 
 	FPoint() = default;
 
-	constexpr FPoint(LONG InX, LONG InY) : X(InX), Y(InY)
+	constexpr FPoint(long InX, long InY) : X(InX), Y(InY)
 	{
 	}
 };
@@ -395,11 +386,11 @@ struct FPoint
  */
 struct FRect
 {
-	LONG X, Y, W, H;
+	long X, Y, W, H;
 
 	FRect() = default;
 
-	constexpr FRect(LONG InX, LONG InY, LONG InW, LONG InH) : X(InX), Y(InY), W(InW), H(InH)
+	constexpr FRect(long InX, long InY, long InW, long InH) : X(InX), Y(InY), W(InW), H(InH)
 	{
 	}
 };
@@ -95,7 +95,9 @@ return Instance; \
 #include <iostream>
 #include <sstream>
 #include <string>
+#if defined(_WIN32)
 #include <windows.h>
+#endif
 
 /**
  * @brief Handles assertion failure by showing a message box and allowing user action.
@@ -123,6 +125,7 @@ inline void HandleAssertionFailure(const char* Expression, const char* File, uin
 
 	FString FormattedMessage = Formatter.str();
 
+#if defined(_WIN32)
 	auto Result = MessageBoxA(
 		nullptr,
 		FormattedMessage.c_str(),
@@ -141,6 +144,12 @@ inline void HandleAssertionFailure(const char* Expression, const char* File, uin
 	case IDIGNORE:
 		break;
 	}
+#else
+	// 메시지 박스가 없는 헤드리스 빌드(테스트)에서는 출력 후 바로 멈춘다
+	std::cerr << FormattedMessage << std::endl;
+	PLATFORM_BREAK();
+	std::exit(1);
+#endif
 }
 
 /**
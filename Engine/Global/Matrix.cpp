@@ -35,7 +35,6 @@ FMatrix::FMatrix(
  */
 FMatrix FMatrix::Transpose(const FMatrix& InOtherMatrix)
 {
-#if defined(__AVX2__)
 	__m128 r0 = LoadRow(InOtherMatrix.Data[0]); // [a00 a01 a02 a03]
 	__m128 r1 = LoadRow(InOtherMatrix.Data[1]); // [a10 a11 a12 a13]
 	__m128 r2 = LoadRow(InOtherMatrix.Data[2]); // [a20 a21 a22 a23]
@@ -49,14 +48,6 @@ FMatrix FMatrix::Transpose(const FMatrix& InOtherMatrix)
 	StoreRow(B.Data[2], r2);
 	StoreRow(B.Data[3], r3);
 	return B;
-#else
-	return {
-		InOtherMatrix.Data[0][0], InOtherMatrix.Data[1][0], InOtherMatrix.Data[2][0], InOtherMatrix.Data[3][0],
-		InOtherMatrix.Data[0][1], InOtherMatrix.Data[1][1], InOtherMatrix.Data[2][1], InOtherMatrix.Data[3][1],
-		InOtherMatrix.Data[0][2], InOtherMatrix.Data[1][2], InOtherMatrix.Data[2][2], InOtherMatrix.Data[3][2],
-		InOtherMatrix.Data[0][3], InOtherMatrix.Data[1][3], InOtherMatrix.Data[2][3], InOtherMatrix.Data[3][3]
-	};
-#endif
 }
 
 
@@ -65,28 +56,13 @@ FMatrix FMatrix::Transpose(const FMatrix& InOtherMatrix)
 */
 FMatrix FMatrix::operator*(const FMatrix& InOtherMatrix) const
 {
-#if defined(__AVX2__)
-	// B의 열 4개 미리 준비
-	__m128 bc0 = LoadCol(InOtherMatrix.Data, 0);
-	__m128 bc1 = LoadCol(InOtherMatrix.Data, 1);
-	__m128 bc2 = LoadCol(InOtherMatrix.Data, 2);
-	__m128 bc3 = LoadCol(InOtherMatrix.Data, 3);
-
+	// Out의 i행 = A의 i행 * B (B 행들의 선형 결합)
 	FMatrix Out = FMatrix::Zero;
 	for (int i = 0; i < 4; ++i)
 	{
-		__m128 ar = LoadRow(this->Data[i]);
-		DotRowByCols_4x(ar, bc0, bc1, bc2, bc3, Out.Data[i]);
+		StoreRow(Out.Data[i], MulRowByMatrix(LoadRow(this->Data[i]), InOtherMatrix.Data));
 	}
 	return Out;
-#else
-	FMatrix Result = FMatrix::Zero;
-	for (int32 i = 0; i < 4; ++i)
-		for (int32 j = 0; j < 4; ++j)
-			for (int32 k = 0; k < 4; ++k)
-				Result.Data[i][j] += Data[i][k] * InOtherMatrix.Data[k][j];
-	return Result;
-#endif
 }
 
 void FMatrix::operator*=(const FMatrix& InOtherMatrix)
@@ -99,31 +75,19 @@ void FMatrix::operator*=(const FMatrix& InOtherMatrix)
 */
 FMatrix FMatrix::TranslationMatrix(const FVector& InOtherVector)
 {
-#if defined(__AVX2__)
 	FMatrix M = FMatrix::Identity;
 	// 마지막 행: [tx, ty, tz, 1]
 	__m128 r3 = _mm_set_ps(1.0f, InOtherVector.Z, InOtherVector.Y, InOtherVector.X);
 	StoreRow(M.Data[3], r3);
 	return M;
-#else
-	FMatrix M = FMatrix::Identity;
-	M.Data[3][0] = InOtherVector.X; M.Data[3][1] = InOtherVector.Y; M.Data[3][2] = InOtherVector.Z; M.Data[3][3] = 1;
-	return M;
-#endif
 }
 
 FMatrix FMatrix::TranslationMatrixInverse(const FVector& InOtherVector)
 {
-#if defined(__AVX2__)
 	FMatrix M = FMatrix::Identity;
 	__m128 r3 = _mm_set_ps(1.0f, -InOtherVector.Z, -InOtherVector.Y, -InOtherVector.X);
 	StoreRow(M.Data[3], r3);
 	return M;
-#else
-	FMatrix M = FMatrix::Identity;
-	M.Data[3][0] = -InOtherVector.X; M.Data[3][1] = -InOtherVector.Y; M.Data[3][2] = -InOtherVector.Z; M.Data[3][3] = 1;
-	return M;
-#endif
 }
 
 /**
@@ -131,23 +95,16 @@ FMatrix FMatrix::TranslationMatrixInverse(const FVector& InOtherVector)
 */
 FMatrix FMatrix::ScaleMatrix(const FVector& InOtherVector)
 {
-#if defined(__AVX2__)
 	FMatrix M = FMatrix::Zero;
 	StoreRow(M.Data[0], _mm_set_ps(0.0f, 0.0f, 0.0f, InOtherVector.X));
 	StoreRow(M.Data[1], _mm_set_ps(0.0f, 0.0f, InOtherVector.Y, 0.0f));
 	StoreRow(M.Data[2], _mm_set_ps(0.0f, InOtherVector.Z, 0.0f, 0.0f));
 	StoreRow(M.Data[3], _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
 	return M;
-#else
-	FMatrix M = FMatrix::Identity;
-	M.Data[0][0] = InOtherVector.X; M.Data[1][1] = InOtherVector.Y; M.Data[2][2] = InOtherVector.Z;
-	return M;
-#endif
 }
 
 FMatrix FMatrix::ScaleMatrixInverse(const FVector& InOtherVector)
 {
-#if defined(__AVX2__)
 	const float ix = 1.0f / InOtherVector.X, iy = 1.0f / InOtherVector.Y, iz = 1.0f / InOtherVector.Z;
 	FMatrix M = FMatrix::Zero;
 	StoreRow(M.Data[0], _mm_set_ps(0.0f, 0.0f, 0.0f, ix));
@@ -155,11 +112,6 @@ FMatrix FMatrix::ScaleMatrixInverse(const FVector& InOtherVector)
 	StoreRow(M.Data[2], _mm_set_ps(0.0f, iz, 0.0f, 0.0f));
 	StoreRow(M.Data[3], _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f));
 	return M;
-#else
-	FMatrix M = FMatrix::Identity;
-	M.Data[0][0] = 1 / InOtherVector.X; M.Data[1][1] = 1 / InOtherVector.Y; M.Data[2][2] = 1 / InOtherVector.Z;
-	return M;
-#endif
 }
 
 /**
@@ -198,18 +150,12 @@ FMatrix FMatrix::RotationMatrixInverseCamera(const FVector& InOtherVector)
 */
 FMatrix FMatrix::RotationX(float Radian)
 {
-#if defined(__AVX2__)
-	float C = std::cosf(Radian), S = std::sinf(Radian);
+	float C = std::cos(Radian), S = std::sin(Radian);
 	FMatrix M = FMatrix::Identity;
 	// row1: [0,C,S,0], row2: [0,-S,C,0]
 	StoreRow(M.Data[1], _mm_set_ps(0.0f, S, C, 0.0f));
 	StoreRow(M.Data[2], _mm_set_ps(0.0f, C, -S, 0.0f));
 	return M;
-#else
-	FMatrix M = FMatrix::Identity;
-	const float C = std::cosf(Radian), S = std::sinf(Radian);
-	M.Data[1][1] = C; M.Data[1][2] = S; M.Data[2][1] = -S; M.Data[2][2] = C; return M;
-#endif
 }
 
 /**
@@ -217,18 +163,12 @@ FMatrix FMatrix::RotationX(float Radian)
 */
 FMatrix FMatrix::RotationY(float Radian)
 {
-#if defined(__AVX2__)
-	float C = std::cosf(Radian), S = std::sinf(Radian);
+	float C = std::cos(Radian), S = std::sin(Radian);
 	FMatrix M = FMatrix::Identity;
 	// row0: [C,0,-S,0], row2: [S,0,C,0]
 	StoreRow(M.Data[0], _mm_set_ps(0.0f, -S, 0.0f, C));
 	StoreRow(M.Data[2], _mm_set_ps(0.0f, C, 0.0f, S));
 	return M;
-#else
-	FMatrix M = FMatrix::Identity;
-	const float C = std::cosf(Radian), S = std::sinf(Radian);
-	M.Data[0][0] = C; M.Data[0][2] = -S; M.Data[2][0] = S; M.Data[2][2] = C; return M;
-#endif
 }
 
 /**
@@ -236,18 +176,12 @@ FMatrix FMatrix::RotationY(float Radian)
 */
 FMatrix FMatrix::RotationZ(float Radian)
 {
-#if defined(__AVX2__)
-	float C = std::cosf(Radian), S = std::sinf(Radian);
+	float C = std::cos(Radian), S = std::sin(Radian);
 	FMatrix M = FMatrix::Identity;
 	// row0: [C,S,0,0], row1: [-S,C,0,0]
 	StoreRow(M.Data[0], _mm_set_ps(0.0f, 0.0f, S, C));
 	StoreRow(M.Data[1], _mm_set_ps(0.0f, 0.0f, C, -S));
 	return M;
-#else
-	FMatrix M = FMatrix::Identity;
-	const float C = std::cosf(Radian), S = std::sinf(Radian);
-	M.Data[0][0] = C; M.Data[0][1] = S; M.Data[1][0] = -S; M.Data[1][1] = C; return M;
-#endif
 }
 
 // Quaternion 기반 회전행렬 (row-major)
@@ -1,33 +1,18 @@
 #pragma once
-#include <immintrin.h>
+#include <emmintrin.h>
 
 static inline __m128 LoadRow(const float* r4) { return _mm_loadu_ps(r4); }
-static inline __m128 LoadCol(const float m[4][4], int j)
-{
-	// 열 j를 [m00,m10,m20,m30] 순서로 로드
-	return _mm_set_ps(m[3][j], m[2][j], m[1][j], m[0][j]);
-}
 
-static inline void DotRowByCols_4x(__m128 row, __m128 c0, __m128 c1, __m128 c2, __m128 c3, float* dst4)
+// 행 벡터 * 행렬 = 행렬 행들의 선형 결합 ((x*r0 + y*r1) + (z*r2 + w*r3), _mm_dp_ps와 같은 덧셈 순서)
+static inline __m128 MulRowByMatrix(__m128 row, const float m[4][4])
 {
-#if defined(__AVX2__)
-	__m128 d0 = _mm_dp_ps(row, c0, 0xF1);
-	__m128 d1 = _mm_dp_ps(row, c1, 0xF1);
-	__m128 d2 = _mm_dp_ps(row, c2, 0xF1);
-	__m128 d3 = _mm_dp_ps(row, c3, 0xF1);
-	dst4[0] = _mm_cvtss_f32(d0);
-	dst4[1] = _mm_cvtss_f32(d1);
-	dst4[2] = _mm_cvtss_f32(d2);
-	dst4[3] = _mm_cvtss_f32(d3);
-#else
-	dst4[0] = dst4[1] = dst4[2] = dst4[3] = 0.0f;
-	for (int k = 0;k < 4;++k) {
-		dst4[0] += row.m128_f32[k] * c0.m128_f32[k];
-		dst4[1] += row.m128_f32[k] * c1.m128_f32[k];
-		dst4[2] += row.m128_f32[k] * c2.m128_f32[k];
-		dst4[3] += row.m128_f32[k] * c3.m128_f32[k];
-	}
-#endif
+	const __m128 x = _mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0));
+	const __m128 y = _mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1));
+	const __m128 z = _mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2));
+	const __m128 w = _mm_shuffle_ps(row, row, _MM_SHUFFLE(3, 3, 3, 3));
+	return _mm_add_ps(
+		_mm_add_ps(_mm_mul_ps(x, LoadRow(m[0])), _mm_mul_ps(y, LoadRow(m[1]))),
+		_mm_add_ps(_mm_mul_ps(z, LoadRow(m[2])), _mm_mul_ps(w, LoadRow(m[3]))));
 }
 
 
@@ -69,6 +54,22 @@ struct FMatrix
 	FMatrix operator*(const FMatrix& InOtherMatrix) const;
 	void operator*=(const FMatrix& InOtherMatrix);
 
+	/**
+	* @brief OutResult[i] = InA[i] * InB 를 일괄 계산 (FCPUFeatures가 고른 SIMD 경로 사용)
+	* InA와 OutResult는 같은 배열이어도 된다.
+	*/
+	static void MultiplyArray(const FMatrix* InA, const FMatrix& InB, FMatrix* OutResult, int32 InCount);
+	static void MultiplyArray(const FMatrix* InA, const FMatrix& InB, FMatrix* OutResult, int32 InCount, ESIMDLevel InLevel);
+
+	/**
+	* @brief OutResult[i] = GetModelMatrix(InLocations[i], InRotations[i], InScales[i]) (S * R * T)를 일괄 계산
+	* 쿼터니언은 커널 안에서 정규화한다. SIMD 경로는 레인 하나가 변환 하나를 맡는다 (SSE 4개, AVX2 8개).
+	*/
+	static void ComposeTRSArray(const FVector* InLocations, const struct FQuat* InRotations, const FVector* InScales,
+		FMatrix* OutResult, int32 InCount);
+	static void ComposeTRSArray(const FVector* InLocations, const struct FQuat* InRotations, const FVector* InScales,
+		FMatrix* OutResult, int32 InCount, ESIMDLevel InLevel);
+
 	/**
 	* @brief Position의 정보를 행렬로 변환하여 제공하는 함수
 	*/
@@ -0,0 +1,111 @@
+#include "pch.h"
+#include "Global/MatrixKernels.h"
+
+// ─────────────────────────────────────────────────────────────
+// FMatrix::MultiplyArray 커널
+//   행 벡터 규칙: Out.row(i) = Σk A[i][k] * B.row(k)
+//   SIMD 경로는 A의 원소를 128비트 lane 안에서 브로드캐스트(shuffle)하므로
+//   SSE = 1행, AVX2 = 2행, AVX-512 = 4행(행렬 1개)을 한 번에 처리한다.
+//   Scalar 외 경로는 MatrixKernelsSSE41/AVX2/AVX512.cpp
+// ─────────────────────────────────────────────────────────────
+using FMatrixArrayKernel = void (*)(const FMatrix* InA, const FMatrix& InB, FMatrix* OutResult, int32 InCount);
+
+static void MultiplyArray_Scalar(const FMatrix* InA, const FMatrix& InB, FMatrix* OutResult, int32 InCount)
+{
+	for (int32 Index = 0; Index < InCount; ++Index)
+	{
+		const FMatrix& A = InA[Index];
+		FMatrix Result;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			for (int32 j = 0; j < 4; ++j)
+			{
+				Result.Data[i][j] = A.Data[i][0] * InB.Data[0][j] + A.Data[i][1] * InB.Data[1][j]
+					+ A.Data[i][2] * InB.Data[2][j] + A.Data[i][3] * InB.Data[3][j];
+			}
+		}
+		// InA와 OutResult가 같은 배열이어도 안전하도록 임시에 계산 후 기록
+		OutResult[Index] = Result;
+	}
+}
+
+static const FMatrixArrayKernel GMatrixArrayKernels[static_cast<int>(ESIMDLevel::End)] =
+{
+	&MultiplyArray_Scalar,
+	&MultiplyArray_SSE41,
+	&MultiplyArray_AVX2,
+	&MultiplyArray_AVX512,
+};
+
+void FMatrix::MultiplyArray(const FMatrix* InA, const FMatrix& InB, FMatrix* OutResult, int32 InCount)
+{
+	MultiplyArray(InA, InB, OutResult, InCount, FCPUFeatures::GetActiveLevel());
+}
+
+void FMatrix::MultiplyArray(const FMatrix* InA, const FMatrix& InB, FMatrix* OutResult, int32 InCount, ESIMDLevel InLevel)
+{
+	if (InCount <= 0)
+	{
+		return;
+	}
+
+	// InB가 출력 배열 안에 있으면 SIMD 경로가 덮어쓴 값을 다시 읽으므로 복사해서 사용
+	const FMatrix B = InB;
+	const ESIMDLevel Level = std::min(InLevel, FCPUFeatures::Get().MaxLevel);
+	GMatrixArrayKernels[static_cast<int>(Level)](InA, B, OutResult, InCount);
+}
+
+// ─────────────────────────────────────────────────────────────
+// FMatrix::ComposeTRSArray 커널
+//   Out = S * R(q) * T (행 벡터 규칙): 0~2행 = 축별 스케일 × 회전 행, 3행 = (T, 1)
+//   SIMD 경로는 레인마다 변환 하나를 SoA로 계산한 뒤 행렬 단위로 풀어서 기록한다.
+// ─────────────────────────────────────────────────────────────
+using FComposeTRSKernel = void (*)(const FVector* InLocations, const FQuat* InRotations, const FVector* InScales,
+	FMatrix* OutResult, int32 InCount);
+
+void ComposeTRSArray_Scalar(const FVector* InLocations, const FQuat* InRotations, const FVector* InScales,
+	FMatrix* OutResult, int32 InCount)
+{
+	for (int32 Index = 0; Index < InCount; ++Index)
+	{
+		FQuat Q = InRotations[Index];
+		Q.Normalize();
+		const float XX = Q.X + Q.X, YY = Q.Y + Q.Y, ZZ = Q.Z + Q.Z;
+		const float WX = Q.W * XX, WY = Q.W * YY, WZ = Q.W * ZZ;
+		const FVector& S = InScales[Index];
+		const FVector& T = InLocations[Index];
+
+		float(&M)[4][4] = OutResult[Index].Data;
+		M[0][0] = (1.0f - (Q.Y * YY + Q.Z * ZZ)) * S.X; M[0][1] = (Q.X * YY + WZ) * S.X; M[0][2] = (Q.X * ZZ - WY) * S.X; M[0][3] = 0.0f;
+		M[1][0] = (Q.X * YY - WZ) * S.Y; M[1][1] = (1.0f - (Q.X * XX + Q.Z * ZZ)) * S.Y; M[1][2] = (Q.Y * ZZ + WX) * S.Y; M[1][3] = 0.0f;
+		M[2][0] = (Q.X * ZZ + WY) * S.Z; M[2][1] = (Q.Y * ZZ - WX) * S.Z; M[2][2] = (1.0f - (Q.X * XX + Q.Y * YY)) * S.Z; M[2][3] = 0.0f;
+		M[3][0] = T.X; M[3][1] = T.Y; M[3][2] = T.Z; M[3][3] = 1.0f;
+	}
+}
+
+// AVX-512는 행렬 쓰기가 병목이라 AVX2 경로를 그대로 쓴다
+static const FComposeTRSKernel GComposeTRSKernels[static_cast<int>(ESIMDLevel::End)] =
+{
+	&ComposeTRSArray_Scalar,
+	&ComposeTRSArray_SSE41,
+	&ComposeTRSArray_AVX2,
+	&ComposeTRSArray_AVX2,
+};
+
+void FMatrix::ComposeTRSArray(const FVector* InLocations, const FQuat* InRotations, const FVector* InScales,
+	FMatrix* OutResult, int32 InCount)
+{
+	ComposeTRSArray(InLocations, InRotations, InScales, OutResult, InCount, FCPUFeatures::GetActiveLevel());
+}
+
+void FMatrix::ComposeTRSArray(const FVector* InLocations, const FQuat* InRotations, const FVector* InScales,
+	FMatrix* OutResult, int32 InCount, ESIMDLevel InLevel)
+{
+	if (InCount <= 0)
+	{
+		return;
+	}
+
+	const ESIMDLevel Level = std::min(InLevel, FCPUFeatures::Get().MaxLevel);
+	GComposeTRSKernels[static_cast<int>(Level)](InLocations, InRotations, InScales, OutResult, InCount);
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "Global/Matrix.h"
+
+#include <immintrin.h>
+
+struct FVector;
+struct FQuat;
+
+/**
+ * FMatrix 배치 연산(MultiplyArray, ComposeTRSArray)의 명령어 집합별 커널
+ * SSE4.1/AVX2/AVX-512 커널은 해당 플래그로만 컴파일되는 MatrixKernels*.cpp에 있고, 테이블은 MatrixKernels.cpp에 있다.
+ * 커널 TU는 pch 없이 빌드한다 (MSOCKernelsCommon.h 참고).
+ */
+
+void MultiplyArray_SSE41(const FMatrix* InA, const FMatrix& InB, FMatrix* OutResult, int32 InCount);
+void MultiplyArray_AVX2(const FMatrix* InA, const FMatrix& InB, FMatrix* OutResult, int32 InCount);
+void MultiplyArray_AVX512(const FMatrix* InA, const FMatrix& InB, FMatrix* OutResult, int32 InCount);
+
+/** 상위 경로의 나머지(꼬리) 처리에도 쓴다 */
+void ComposeTRSArray_Scalar(const FVector* InLocations, const FQuat* InRotations, const FVector* InScales,
+	FMatrix* OutResult, int32 InCount);
+void ComposeTRSArray_SSE41(const FVector* InLocations, const FQuat* InRotations, const FVector* InScales,
+	FMatrix* OutResult, int32 InCount);
+void ComposeTRSArray_AVX2(const FVector* InLocations, const FQuat* InRotations, const FVector* InScales,
+	FMatrix* OutResult, int32 InCount);
+
+/** 레인별로 계산한 회전×스케일 9항과 이동 3항 (Terms[항][레인]) */
+template <int32 NumLanes>
+static void WriteComposedLanes(const float (&InTerms)[12][NumLanes], FMatrix* OutResult, int32 InCount)
+{
+	for (int32 Lane = 0; Lane < InCount; ++Lane)
+	{
+		float(&M)[4][4] = OutResult[Lane].Data;
+		M[0][0] = InTerms[0][Lane]; M[0][1] = InTerms[1][Lane]; M[0][2] = InTerms[2][Lane]; M[0][3] = 0.0f;
+		M[1][0] = InTerms[3][Lane]; M[1][1] = InTerms[4][Lane]; M[1][2] = InTerms[5][Lane]; M[1][3] = 0.0f;
+		M[2][0] = InTerms[6][Lane]; M[2][1] = InTerms[7][Lane]; M[2][2] = InTerms[8][Lane]; M[2][3] = 0.0f;
+		M[3][0] = InTerms[9][Lane]; M[3][1] = InTerms[10][Lane]; M[3][2] = InTerms[11][Lane]; M[3][3] = 1.0f;
+	}
+}
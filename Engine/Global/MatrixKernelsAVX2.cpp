@@ -0,0 +1,85 @@
+#include "Global/CoreMinimal.h"
+#include "Global/MatrixKernels.h"
+
+void MultiplyArray_AVX2(const FMatrix* InA, const FMatrix& InB, FMatrix* OutResult, int32 InCount)
+{
+	// B의 각 행을 두 lane에 복제
+	const __m256 B0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(InB.Data[0]));
+	const __m256 B1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(InB.Data[1]));
+	const __m256 B2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(InB.Data[2]));
+	const __m256 B3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(InB.Data[3]));
+
+	for (int32 Index = 0; Index < InCount; ++Index)
+	{
+		const float* A = &InA[Index].Data[0][0];
+		const __m256 A01 = _mm256_loadu_ps(A);
+		const __m256 A23 = _mm256_loadu_ps(A + 8);
+
+		__m256 R01 = _mm256_mul_ps(_mm256_shuffle_ps(A01, A01, _MM_SHUFFLE(0, 0, 0, 0)), B0);
+		R01 = _mm256_fmadd_ps(_mm256_shuffle_ps(A01, A01, _MM_SHUFFLE(1, 1, 1, 1)), B1, R01);
+		R01 = _mm256_fmadd_ps(_mm256_shuffle_ps(A01, A01, _MM_SHUFFLE(2, 2, 2, 2)), B2, R01);
+		R01 = _mm256_fmadd_ps(_mm256_shuffle_ps(A01, A01, _MM_SHUFFLE(3, 3, 3, 3)), B3, R01);
+
+		__m256 R23 = _mm256_mul_ps(_mm256_shuffle_ps(A23, A23, _MM_SHUFFLE(0, 0, 0, 0)), B0);
+		R23 = _mm256_fmadd_ps(_mm256_shuffle_ps(A23, A23, _MM_SHUFFLE(1, 1, 1, 1)), B1, R23);
+		R23 = _mm256_fmadd_ps(_mm256_shuffle_ps(A23, A23, _MM_SHUFFLE(2, 2, 2, 2)), B2, R23);
+		R23 = _mm256_fmadd_ps(_mm256_shuffle_ps(A23, A23, _MM_SHUFFLE(3, 3, 3, 3)), B3, R23);
+
+		float* Out = &OutResult[Index].Data[0][0];
+		_mm256_storeu_ps(Out, R01);
+		_mm256_storeu_ps(Out + 8, R23);
+	}
+	_mm256_zeroupper();
+}
+
+void ComposeTRSArray_AVX2(const FVector* InLocations, const FQuat* InRotations, const FVector* InScales,
+	FMatrix* OutResult, int32 InCount)
+{
+	const __m256 One = _mm256_set1_ps(1.0f);
+	const __m256 Zero = _mm256_setzero_ps();
+	// 배열 원소 간격(float 단위): FQuat 4개, FVector 3개
+	const __m256i QuatStride = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+	const __m256i VectorStride = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+
+	int32 Index = 0;
+	for (; Index + 8 <= InCount; Index += 8)
+	{
+		const float* R = &InRotations[Index].X;
+		const float* S = &InScales[Index].X;
+		const float* T = &InLocations[Index].X;
+
+		__m256 X = _mm256_i32gather_ps(R + 0, QuatStride, 4);
+		__m256 Y = _mm256_i32gather_ps(R + 1, QuatStride, 4);
+		__m256 Z = _mm256_i32gather_ps(R + 2, QuatStride, 4);
+		__m256 W = _mm256_i32gather_ps(R + 3, QuatStride, 4);
+
+		const __m256 Len2 = _mm256_fmadd_ps(X, X, _mm256_fmadd_ps(Y, Y, _mm256_fmadd_ps(Z, Z, _mm256_mul_ps(W, W))));
+		const __m256 Inv = _mm256_blendv_ps(One, _mm256_div_ps(One, _mm256_sqrt_ps(Len2)), _mm256_cmp_ps(Len2, Zero, _CMP_GT_OQ));
+		X = _mm256_mul_ps(X, Inv); Y = _mm256_mul_ps(Y, Inv); Z = _mm256_mul_ps(Z, Inv); W = _mm256_mul_ps(W, Inv);
+
+		const __m256 XX = _mm256_add_ps(X, X), YY = _mm256_add_ps(Y, Y), ZZ = _mm256_add_ps(Z, Z);
+		const __m256 WX = _mm256_mul_ps(W, XX), WY = _mm256_mul_ps(W, YY), WZ = _mm256_mul_ps(W, ZZ);
+		const __m256 SX = _mm256_i32gather_ps(S + 0, VectorStride, 4);
+		const __m256 SY = _mm256_i32gather_ps(S + 1, VectorStride, 4);
+		const __m256 SZ = _mm256_i32gather_ps(S + 2, VectorStride, 4);
+
+		alignas(32) float Terms[12][8];
+		_mm256_store_ps(Terms[0], _mm256_mul_ps(_mm256_sub_ps(One, _mm256_fmadd_ps(Y, YY, _mm256_mul_ps(Z, ZZ))), SX));
+		_mm256_store_ps(Terms[1], _mm256_mul_ps(_mm256_fmadd_ps(X, YY, WZ), SX));
+		_mm256_store_ps(Terms[2], _mm256_mul_ps(_mm256_fmsub_ps(X, ZZ, WY), SX));
+		_mm256_store_ps(Terms[3], _mm256_mul_ps(_mm256_fmsub_ps(X, YY, WZ), SY));
+		_mm256_store_ps(Terms[4], _mm256_mul_ps(_mm256_sub_ps(One, _mm256_fmadd_ps(X, XX, _mm256_mul_ps(Z, ZZ))), SY));
+		_mm256_store_ps(Terms[5], _mm256_mul_ps(_mm256_fmadd_ps(Y, ZZ, WX), SY));
+		_mm256_store_ps(Terms[6], _mm256_mul_ps(_mm256_fmadd_ps(X, ZZ, WY), SZ));
+		_mm256_store_ps(Terms[7], _mm256_mul_ps(_mm256_fmsub_ps(Y, ZZ, WX), SZ));
+		_mm256_store_ps(Terms[8], _mm256_mul_ps(_mm256_sub_ps(One, _mm256_fmadd_ps(X, XX, _mm256_mul_ps(Y, YY))), SZ));
+		_mm256_store_ps(Terms[9], _mm256_i32gather_ps(T + 0, VectorStride, 4));
+		_mm256_store_ps(Terms[10], _mm256_i32gather_ps(T + 1, VectorStride, 4));
+		_mm256_store_ps(Terms[11], _mm256_i32gather_ps(T + 2, VectorStride, 4));
+
+		WriteComposedLanes<8>(Terms, OutResult + Index, 8);
+	}
+	_mm256_zeroupper();
+
+	ComposeTRSArray_SSE41(InLocations + Index, InRotations + Index, InScales + Index, OutResult + Index, InCount - Index);
+}
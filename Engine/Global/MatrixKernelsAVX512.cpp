@@ -0,0 +1,24 @@
+#include "Global/CoreMinimal.h"
+#include "Global/MatrixKernels.h"
+
+void MultiplyArray_AVX512(const FMatrix* InA, const FMatrix& InB, FMatrix* OutResult, int32 InCount)
+{
+	// B의 각 행을 네 lane에 복제
+	const __m512 B0 = _mm512_broadcast_f32x4(_mm_loadu_ps(InB.Data[0]));
+	const __m512 B1 = _mm512_broadcast_f32x4(_mm_loadu_ps(InB.Data[1]));
+	const __m512 B2 = _mm512_broadcast_f32x4(_mm_loadu_ps(InB.Data[2]));
+	const __m512 B3 = _mm512_broadcast_f32x4(_mm_loadu_ps(InB.Data[3]));
+
+	for (int32 Index = 0; Index < InCount; ++Index)
+	{
+		const __m512 A = _mm512_loadu_ps(&InA[Index].Data[0][0]);
+
+		__m512 R = _mm512_mul_ps(_mm512_shuffle_ps(A, A, _MM_SHUFFLE(0, 0, 0, 0)), B0);
+		R = _mm512_fmadd_ps(_mm512_shuffle_ps(A, A, _MM_SHUFFLE(1, 1, 1, 1)), B1, R);
+		R = _mm512_fmadd_ps(_mm512_shuffle_ps(A, A, _MM_SHUFFLE(2, 2, 2, 2)), B2, R);
+		R = _mm512_fmadd_ps(_mm512_shuffle_ps(A, A, _MM_SHUFFLE(3, 3, 3, 3)), B3, R);
+
+		_mm512_storeu_ps(&OutResult[Index].Data[0][0], R);
+	}
+	_mm256_zeroupper();
+}
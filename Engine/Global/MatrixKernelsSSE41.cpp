@@ -0,0 +1,77 @@
+#include "Global/CoreMinimal.h"
+#include "Global/MatrixKernels.h"
+
+void MultiplyArray_SSE41(const FMatrix* InA, const FMatrix& InB, FMatrix* OutResult, int32 InCount)
+{
+	const __m128 B0 = _mm_loadu_ps(InB.Data[0]);
+	const __m128 B1 = _mm_loadu_ps(InB.Data[1]);
+	const __m128 B2 = _mm_loadu_ps(InB.Data[2]);
+	const __m128 B3 = _mm_loadu_ps(InB.Data[3]);
+
+	for (int32 Index = 0; Index < InCount; ++Index)
+	{
+		__m128 Rows[4];
+		for (int32 i = 0; i < 4; ++i)
+		{
+			const __m128 A = _mm_loadu_ps(InA[Index].Data[i]);
+			__m128 R = _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(0, 0, 0, 0)), B0);
+			R = _mm_add_ps(R, _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(1, 1, 1, 1)), B1));
+			R = _mm_add_ps(R, _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 2, 2, 2)), B2));
+			R = _mm_add_ps(R, _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 3, 3, 3)), B3));
+			Rows[i] = R;
+		}
+		for (int32 i = 0; i < 4; ++i)
+		{
+			_mm_storeu_ps(OutResult[Index].Data[i], Rows[i]);
+		}
+	}
+}
+
+void ComposeTRSArray_SSE41(const FVector* InLocations, const FQuat* InRotations, const FVector* InScales,
+	FMatrix* OutResult, int32 InCount)
+{
+	const __m128 One = _mm_set1_ps(1.0f);
+	const __m128 Zero = _mm_setzero_ps();
+
+	int32 Index = 0;
+	for (; Index + 4 <= InCount; Index += 4)
+	{
+		const FQuat* R = InRotations + Index;
+		const FVector* S = InScales + Index;
+		const FVector* T = InLocations + Index;
+
+		__m128 X = _mm_setr_ps(R[0].X, R[1].X, R[2].X, R[3].X);
+		__m128 Y = _mm_setr_ps(R[0].Y, R[1].Y, R[2].Y, R[3].Y);
+		__m128 Z = _mm_setr_ps(R[0].Z, R[1].Z, R[2].Z, R[3].Z);
+		__m128 W = _mm_setr_ps(R[0].W, R[1].W, R[2].W, R[3].W);
+
+		// FQuat::Normalize와 같이 길이 0이면 그대로 둔다
+		const __m128 Len2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, X), _mm_mul_ps(Y, Y)), _mm_add_ps(_mm_mul_ps(Z, Z), _mm_mul_ps(W, W)));
+		const __m128 Inv = _mm_blendv_ps(One, _mm_div_ps(One, _mm_sqrt_ps(Len2)), _mm_cmpgt_ps(Len2, Zero));
+		X = _mm_mul_ps(X, Inv); Y = _mm_mul_ps(Y, Inv); Z = _mm_mul_ps(Z, Inv); W = _mm_mul_ps(W, Inv);
+
+		const __m128 XX = _mm_add_ps(X, X), YY = _mm_add_ps(Y, Y), ZZ = _mm_add_ps(Z, Z);
+		const __m128 WX = _mm_mul_ps(W, XX), WY = _mm_mul_ps(W, YY), WZ = _mm_mul_ps(W, ZZ);
+		const __m128 SX = _mm_setr_ps(S[0].X, S[1].X, S[2].X, S[3].X);
+		const __m128 SY = _mm_setr_ps(S[0].Y, S[1].Y, S[2].Y, S[3].Y);
+		const __m128 SZ = _mm_setr_ps(S[0].Z, S[1].Z, S[2].Z, S[3].Z);
+
+		alignas(16) float Terms[12][4];
+		_mm_store_ps(Terms[0], _mm_mul_ps(_mm_sub_ps(One, _mm_add_ps(_mm_mul_ps(Y, YY), _mm_mul_ps(Z, ZZ))), SX));
+		_mm_store_ps(Terms[1], _mm_mul_ps(_mm_add_ps(_mm_mul_ps(X, YY), WZ), SX));
+		_mm_store_ps(Terms[2], _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(X, ZZ), WY), SX));
+		_mm_store_ps(Terms[3], _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(X, YY), WZ), SY));
+		_mm_store_ps(Terms[4], _mm_mul_ps(_mm_sub_ps(One, _mm_add_ps(_mm_mul_ps(X, XX), _mm_mul_ps(Z, ZZ))), SY));
+		_mm_store_ps(Terms[5], _mm_mul_ps(_mm_add_ps(_mm_mul_ps(Y, ZZ), WX), SY));
+		_mm_store_ps(Terms[6], _mm_mul_ps(_mm_add_ps(_mm_mul_ps(X, ZZ), WY), SZ));
+		_mm_store_ps(Terms[7], _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(Y, ZZ), WX), SZ));
+		_mm_store_ps(Terms[8], _mm_mul_ps(_mm_sub_ps(One, _mm_add_ps(_mm_mul_ps(X, XX), _mm_mul_ps(Y, YY))), SZ));
+		_mm_store_ps(Terms[9], _mm_setr_ps(T[0].X, T[1].X, T[2].X, T[3].X));
+		_mm_store_ps(Terms[10], _mm_setr_ps(T[0].Y, T[1].Y, T[2].Y, T[3].Y));
+		_mm_store_ps(Terms[11], _mm_setr_ps(T[0].Z, T[1].Z, T[2].Z, T[3].Z));
+
+		WriteComposedLanes<4>(Terms, OutResult + Index, 4);
+	}
+
+	ComposeTRSArray_Scalar(InLocations + Index, InRotations + Index, InScales + Index, OutResult + Index, InCount - Index);
+}
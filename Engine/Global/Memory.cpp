@@ -1,35 +1,447 @@
 #include "pch.h"
 #include "Global/Memory.h"
 
-uint32 TotalAllocationBytes = 0;
-uint32 TotalAllocationCount = 0;
+#include <atomic>
+#include <cstdlib>
+#include <new>
 
-void* operator new(size_t size)
+namespace
 {
-	TotalAllocationCount++;
-	TotalAllocationBytes += static_cast<uint32>(size);
-	AllocHeader* header = (AllocHeader*)malloc(sizeof(AllocHeader) + size);
-	header->size = size;
-	return (void*)(header + 1);
+	constexpr uint8 NumTags = static_cast<uint8>(EMemoryTag::Num);
+
+	thread_local EMemoryTag CurrentTag = EMemoryTag::Untagged;
+
+	// MarkFrame()이 남긴 지난 프레임 값 (게임 스레드에서만 쓴다)
+	uint64 FrameStartAllocCount[NumTags] = {};
+	uint64 FrameStartAllocBytes[NumTags] = {};
+	uint64 LastFrameAllocCount[NumTags] = {};
+	uint64 LastFrameAllocBytes[NumTags] = {};
+
+#if WITH_MEMORY_TRACKING
+	/**
+	 * @brief 한 스레드의 카운터 블록. 주인 스레드만 쓰고 다른 스레드는 읽기만 한다
+	 * 그래서 증가는 relaxed load + store로 충분하다 (lock 접두 RMW 없음).
+	 * 스레드가 끝나도 누적 값이 필요하므로 블록은 해제하지 않는다.
+	 */
+	struct FThreadMemoryCounters
+	{
+		std::atomic<uint64> AllocBytes[NumTags] = {};
+		std::atomic<uint64> FreeBytes[NumTags] = {};
+		std::atomic<uint64> AllocCount[NumTags] = {};
+		std::atomic<uint64> FreeCount[NumTags] = {};
+		FThreadMemoryCounters* Next = nullptr;
+	};
+
+	std::atomic<FThreadMemoryCounters*> CounterListHead{ nullptr };
+	std::atomic<uint32> NumCounterBlocks{ 0 };
+	thread_local FThreadMemoryCounters* ThreadCounters = nullptr;
+
+	/** 기본 정렬 할당의 사용자 메모리 바로 앞 16바이트. 16바이트 정렬을 유지한다 */
+	struct alignas(16) FAllocHeader
+	{
+		uint64 Size;
+		uint8 Tag;
+	};
+	static_assert(sizeof(FAllocHeader) == 16, "FAllocHeader는 16바이트여야 합니다");
+
+	/**
+	 * @brief 16바이트보다 큰 정렬 할당의 크기/태그를 블록 밖에 두는 표 (포인터 → 기록)
+	 * 블록 앞에 헤더를 붙이면 정렬만큼 앞을 비워야 해서, 64KB 정렬 슬랩은 메모리를 두 배로 쓴다.
+	 * 이런 할당은 드물어서(풀 슬랩, alignas 타입) 스핀락 하나로 보호하는 선형 탐사 해시로 충분하다.
+	 * 표 자체는 operator new를 다시 타지 않도록 malloc으로 키운다.
+	 */
+	class FAlignedAllocTable
+	{
+	public:
+		struct FEntry
+		{
+			void* Memory;		// nullptr = 빈 칸, Tombstone = 지운 칸
+			uint64 Size;
+			uint8 Tag;
+			bool bVirtual;		// VirtualAlloc으로 받은 블록 (Windows)
+		};
+
+		void Add(const FEntry& InEntry)
+		{
+			FScopedSpinLock Lock(SpinLock);
+			if ((NumUsed + 1) * 2 > Capacity)
+			{
+				Grow();
+			}
+			for (size_t Index = Hash(InEntry.Memory);; Index = (Index + 1) & (Capacity - 1))
+			{
+				if (!Entries[Index].Memory || Entries[Index].Memory == Tombstone())
+				{
+					NumUsed += Entries[Index].Memory ? 0 : 1;
+					++NumLive;
+					Entries[Index] = InEntry;
+					return;
+				}
+			}
+		}
+
+		bool Remove(void* InMemory, FEntry& OutEntry)
+		{
+			FScopedSpinLock Lock(SpinLock);
+			if (!Capacity)
+			{
+				return false;
+			}
+			for (size_t Index = Hash(InMemory); Entries[Index].Memory; Index = (Index + 1) & (Capacity - 1))
+			{
+				if (Entries[Index].Memory == InMemory)
+				{
+					OutEntry = Entries[Index];
+					Entries[Index].Memory = Tombstone();
+					--NumLive;
+					return true;
+				}
+			}
+			return false;
+		}
+
+	private:
+		struct FScopedSpinLock
+		{
+			explicit FScopedSpinLock(std::atomic_flag& InFlag) : Flag(InFlag)
+			{
+				while (Flag.test_and_set(std::memory_order_acquire))
+				{
+				}
+			}
+			~FScopedSpinLock() { Flag.clear(std::memory_order_release); }
+			std::atomic_flag& Flag;
+		};
+
+		static void* Tombstone() { return reinterpret_cast<void*>(static_cast<uintptr_t>(1)); }
+
+		size_t Hash(const void* InMemory) const
+		{
+			// 정렬 블록이라 하위 비트는 0이다
+			const uint64 Key = reinterpret_cast<uintptr_t>(InMemory) >> 4;
+			return static_cast<size_t>((Key * 0x9E3779B97F4A7C15ull) >> 20) & (Capacity - 1);
+		}
+
+		/** 지운 칸을 걷어내고, 살아 있는 항목이 많을 때만 두 배로 늘린다 (할당/해제 반복으로 커지지 않게) */
+		void Grow()
+		{
+			FEntry* OldEntries = Entries;
+			const size_t OldCapacity = Capacity;
+
+			Capacity = !OldCapacity ? 256 : (NumLive + 1) * 4 > OldCapacity ? OldCapacity * 2 : OldCapacity;
+			Entries = static_cast<FEntry*>(calloc(Capacity, sizeof(FEntry)));
+			if (!Entries)
+			{
+				throw std::bad_alloc();
+			}
+			NumUsed = 0;
+			for (size_t Old = 0; Old < OldCapacity; ++Old)
+			{
+				void* Memory = OldEntries[Old].Memory;
+				if (!Memory || Memory == Tombstone())
+				{
+					continue;
+				}
+				size_t Index = Hash(Memory);
+				while (Entries[Index].Memory)
+				{
+					Index = (Index + 1) & (Capacity - 1);
+				}
+				Entries[Index] = OldEntries[Old];
+				++NumUsed;
+			}
+			free(OldEntries);
+		}
+
+		std::atomic_flag SpinLock = ATOMIC_FLAG_INIT;
+		FEntry* Entries = nullptr;
+		size_t Capacity = 0;
+		size_t NumUsed = 0;		// 빈 칸이 아닌 칸 (지운 칸 포함)
+		size_t NumLive = 0;
+	};
+
+	FAlignedAllocTable& GetAlignedAllocTable()
+	{
+		// 정적 초기화 순서와 무관하게 첫 정렬 할당에서 쓸 수 있도록 함수 안 정적 객체로 둔다 (소멸자 없음)
+		static FAlignedAllocTable* Table = new (malloc(sizeof(FAlignedAllocTable))) FAlignedAllocTable();
+		return *Table;
+	}
+
+	FThreadMemoryCounters& GetThreadCounters()
+	{
+		if (!ThreadCounters)
+		{
+			// operator new를 다시 타지 않도록 malloc으로 만든다
+			FThreadMemoryCounters* Counters = new (malloc(sizeof(FThreadMemoryCounters))) FThreadMemoryCounters();
+			FThreadMemoryCounters* Head = CounterListHead.load(std::memory_order_relaxed);
+			do
+			{
+				Counters->Next = Head;
+			} while (!CounterListHead.compare_exchange_weak(Head, Counters, std::memory_order_release, std::memory_order_relaxed));
+			NumCounterBlocks.fetch_add(1, std::memory_order_relaxed);
+			ThreadCounters = Counters;
+		}
+		return *ThreadCounters;
+	}
+
+	void AddOwned(std::atomic<uint64>& InCounter, uint64 InValue)
+	{
+		InCounter.store(InCounter.load(std::memory_order_relaxed) + InValue, std::memory_order_relaxed);
+	}
+
+	void ChargeAlloc(uint8 InTag, uint64 InSize)
+	{
+		FThreadMemoryCounters& Counters = GetThreadCounters();
+		AddOwned(Counters.AllocBytes[InTag], InSize);
+		AddOwned(Counters.AllocCount[InTag], 1);
+	}
+
+	void ChargeFree(uint8 InTag, uint64 InSize)
+	{
+		// 할당한 태그로 되돌린다 (해제한 스레드의 블록에 기록)
+		FThreadMemoryCounters& Counters = GetThreadCounters();
+		AddOwned(Counters.FreeBytes[InTag], InSize);
+		AddOwned(Counters.FreeCount[InTag], 1);
+	}
+
+	void* TrackedAlloc(size_t InSize)
+	{
+		uint8* Raw = static_cast<uint8*>(malloc(sizeof(FAllocHeader) + (InSize ? InSize : 1)));
+		if (!Raw)
+		{
+			throw std::bad_alloc();
+		}
+
+		FAllocHeader* Header = reinterpret_cast<FAllocHeader*>(Raw);
+		Header->Size = InSize;
+		Header->Tag = static_cast<uint8>(CurrentTag);
+		ChargeAlloc(Header->Tag, InSize);
+		return Raw + sizeof(FAllocHeader);
+	}
+
+	void TrackedFree(void* InMemory)
+	{
+		if (!InMemory)
+		{
+			return;
+		}
+
+		const FAllocHeader* Header = reinterpret_cast<const FAllocHeader*>(InMemory) - 1;
+		ChargeFree(Header->Tag, Header->Size);
+		free(const_cast<FAllocHeader*>(Header));
+	}
+
+	/**
+	 * @brief 16바이트보다 큰 정렬 할당. 블록은 시스템 정렬 할당으로 받아 앞을 비우지 않는다
+	 * Windows의 _aligned_malloc도 내부에서 정렬만큼 더 잡으므로, 페이지~64KB 정렬(할당 단위)은 VirtualAlloc으로 받는다.
+	 */
+	void* TrackedAllocAligned(size_t InSize, size_t InAlignment)
+	{
+		if (InAlignment <= sizeof(FAllocHeader))
+		{
+			return TrackedAlloc(InSize);
+		}
+
+		const size_t Size = InSize ? InSize : 1;
+		void* Memory = nullptr;
+		bool bVirtual = false;
+#ifdef _WIN32
+		if (InAlignment >= 4096 && InAlignment <= 64 * 1024)
+		{
+			Memory = VirtualAlloc(nullptr, Size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+			bVirtual = true;
+		}
+		else
+		{
+			Memory = _aligned_malloc(Size, InAlignment);
+		}
+#else
+		// aligned_alloc은 크기가 정렬의 배수여야 한다
+		Memory = std::aligned_alloc(InAlignment, (Size + InAlignment - 1) & ~(InAlignment - 1));
+#endif
+		if (!Memory)
+		{
+			throw std::bad_alloc();
+		}
+
+		const uint8 Tag = static_cast<uint8>(CurrentTag);
+		GetAlignedAllocTable().Add({ Memory, InSize, Tag, bVirtual });
+		ChargeAlloc(Tag, InSize);
+		return Memory;
+	}
+
+	void TrackedFreeAligned(void* InMemory, size_t InAlignment)
+	{
+		if (InAlignment <= sizeof(FAllocHeader))
+		{
+			TrackedFree(InMemory);
+			return;
+		}
+		if (!InMemory)
+		{
+			return;
+		}
+
+		FAlignedAllocTable::FEntry Entry;
+		if (!GetAlignedAllocTable().Remove(InMemory, Entry))
+		{
+			assert(false && "정렬 new로 받지 않은 메모리를 정렬 delete로 해제했습니다");
+			return;
+		}
+		ChargeFree(Entry.Tag, Entry.Size);
+#ifdef _WIN32
+		if (Entry.bVirtual)
+		{
+			VirtualFree(InMemory, 0, MEM_RELEASE);
+		}
+		else
+		{
+			_aligned_free(InMemory);
+		}
+#else
+		std::free(InMemory);
+#endif
+	}
+#endif
+}
+
+#if WITH_MEMORY_TRACKING
+void* operator new(size_t InSize)
+{
+	return TrackedAlloc(InSize);
+}
+
+void operator delete(void* InMemory) noexcept
+{
+	TrackedFree(InMemory);
 }
 
-void operator delete(void* memory) noexcept
+void* operator new(size_t InSize, std::align_val_t InAlignment)
 {
-	if (!memory) return;
+	return TrackedAllocAligned(InSize, static_cast<size_t>(InAlignment));
+}
+
+void operator delete(void* InMemory, std::align_val_t InAlignment) noexcept
+{
+	TrackedFreeAligned(InMemory, static_cast<size_t>(InAlignment));
+}
+#endif
+
+void FMemoryTracker::GetStats(FMemoryStats& OutStats)
+{
+	OutStats = FMemoryStats();
+
+#if WITH_MEMORY_TRACKING
+	uint64 AllocBytes[NumTags] = {};
+	uint64 FreeBytes[NumTags] = {};
+	uint64 AllocCount[NumTags] = {};
+	uint64 FreeCount[NumTags] = {};
+
+	for (FThreadMemoryCounters* Counters = CounterListHead.load(std::memory_order_acquire); Counters; Counters = Counters->Next)
+	{
+		for (uint8 Tag = 0; Tag < NumTags; ++Tag)
+		{
+			AllocBytes[Tag] += Counters->AllocBytes[Tag].load(std::memory_order_relaxed);
+			FreeBytes[Tag] += Counters->FreeBytes[Tag].load(std::memory_order_relaxed);
+			AllocCount[Tag] += Counters->AllocCount[Tag].load(std::memory_order_relaxed);
+			FreeCount[Tag] += Counters->FreeCount[Tag].load(std::memory_order_relaxed);
+		}
+	}
+
+	for (uint8 Tag = 0; Tag < NumTags; ++Tag)
+	{
+		// 다른 스레드가 쓰는 중에 읽으면 해제가 할당보다 먼저 보일 수 있다
+		FMemoryTagStats& Stats = OutStats.Tags[Tag];
+		Stats.LiveBytes = AllocBytes[Tag] > FreeBytes[Tag] ? AllocBytes[Tag] - FreeBytes[Tag] : 0;
+		Stats.LiveCount = AllocCount[Tag] > FreeCount[Tag] ? AllocCount[Tag] - FreeCount[Tag] : 0;
+		Stats.TotalAllocCount = AllocCount[Tag];
+		Stats.FrameAllocCount = LastFrameAllocCount[Tag];
+		Stats.FrameAllocBytes = LastFrameAllocBytes[Tag];
 
-	AllocHeader* header = ((AllocHeader*)memory) - 1;
-	size_t size = header->size;
+		OutStats.Total.LiveBytes += Stats.LiveBytes;
+		OutStats.Total.LiveCount += Stats.LiveCount;
+		OutStats.Total.TotalAllocCount += Stats.TotalAllocCount;
+		OutStats.Total.FrameAllocCount += Stats.FrameAllocCount;
+		OutStats.Total.FrameAllocBytes += Stats.FrameAllocBytes;
+	}
+	OutStats.NumThreads = NumCounterBlocks.load(std::memory_order_relaxed);
+#endif
+}
 
-	if (TotalAllocationCount > 0)
+void FMemoryTracker::MarkFrame()
+{
+#if WITH_MEMORY_TRACKING
+	uint64 AllocCount[NumTags] = {};
+	uint64 AllocBytes[NumTags] = {};
+	for (FThreadMemoryCounters* Counters = CounterListHead.load(std::memory_order_acquire); Counters; Counters = Counters->Next)
 	{
-		--TotalAllocationCount;
+		for (uint8 Tag = 0; Tag < NumTags; ++Tag)
+		{
+			AllocCount[Tag] += Counters->AllocCount[Tag].load(std::memory_order_relaxed);
+			AllocBytes[Tag] += Counters->AllocBytes[Tag].load(std::memory_order_relaxed);
+		}
 	}
 
-	if (TotalAllocationBytes >= size)
+	for (uint8 Tag = 0; Tag < NumTags; ++Tag)
 	{
-		TotalAllocationBytes -= static_cast<uint32>(size);
+		LastFrameAllocCount[Tag] = AllocCount[Tag] - FrameStartAllocCount[Tag];
+		LastFrameAllocBytes[Tag] = AllocBytes[Tag] - FrameStartAllocBytes[Tag];
+		FrameStartAllocCount[Tag] = AllocCount[Tag];
+		FrameStartAllocBytes[Tag] = AllocBytes[Tag];
 	}
+#endif
+}
+
+EMemoryTag FMemoryTracker::GetCurrentTag()
+{
+	return CurrentTag;
+}
+
+EMemoryTag FMemoryTracker::SetCurrentTag(EMemoryTag InTag)
+{
+	const EMemoryTag PreviousTag = CurrentTag;
+	CurrentTag = InTag;
+	return PreviousTag;
+}
 
-	free(header);
+const char* FMemoryTracker::GetTagName(EMemoryTag InTag)
+{
+	switch (InTag)
+	{
+	case EMemoryTag::Untagged:	return "Untagged";
+	case EMemoryTag::Renderer:	return "Renderer";
+	case EMemoryTag::Assets:	return "Assets";
+	case EMemoryTag::Level:		return "Level";
+	case EMemoryTag::UI:		return "UI";
+	case EMemoryTag::Octree:	return "Octree";
+	default:					return "?";
+	}
 }
 
+void FMemoryTracker::FormatLines(const FMemoryStats& InStats, TArray<FString>& OutLines)
+{
+	OutLines.clear();
+	if (!IsEnabled())
+	{
+		OutLines.push_back("Memory tracking disabled (WITH_MEMORY_TRACKING=0)");
+		return;
+	}
+
+	char Line[256];
+	(void)snprintf(Line, sizeof(Line), "Heap %.2f MB  Live %llu  Frame %llu allocs (%.1f KB)  Threads %u",
+		static_cast<double>(InStats.Total.LiveBytes) / (1024.0 * 1024.0),
+		static_cast<unsigned long long>(InStats.Total.LiveCount),
+		static_cast<unsigned long long>(InStats.Total.FrameAllocCount),
+		static_cast<double>(InStats.Total.FrameAllocBytes) / 1024.0, InStats.NumThreads);
+	OutLines.push_back(Line);
+
+	for (uint8 Tag = 0; Tag < NumTags; ++Tag)
+	{
+		const FMemoryTagStats& Stats = InStats.Tags[Tag];
+		(void)snprintf(Line, sizeof(Line), "  %-9s %9.1f KB  live %7llu  frame %5llu  total %llu",
+			GetTagName(static_cast<EMemoryTag>(Tag)), static_cast<double>(Stats.LiveBytes) / 1024.0,
+			static_cast<unsigned long long>(Stats.LiveCount), static_cast<unsigned long long>(Stats.FrameAllocCount),
+			static_cast<unsigned long long>(Stats.TotalAllocCount));
+		OutLines.push_back(Line);
+	}
+}
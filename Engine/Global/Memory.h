@@ -1,10 +1,91 @@
 #pragma once
 
-extern uint32 TotalAllocationBytes;
-extern uint32 TotalAllocationCount;
+/**
+ * 전역 operator new/delete 추적 스위치
+ * 배포 빌드는 전처리기 정의에 WITH_MEMORY_TRACKING=0을 넣으면 오버라이드와 태그 스코프가 모두 빠진다.
+ */
+#ifndef WITH_MEMORY_TRACKING
+	#define WITH_MEMORY_TRACKING 1
+#endif
 
-struct AllocHeader
+/**
+ * @brief 할당을 나눠 세는 분류. 스코프(MEMORY_TAG_SCOPE)로 스레드별 현재 태그를 정한다
+ */
+enum class EMemoryTag : uint8
 {
-	size_t size;
+	Untagged,
+	Renderer,
+	Assets,
+	Level,
+	UI,
+	Octree,
+	Num
 };
 
+struct FMemoryTagStats
+{
+	uint64 LiveBytes = 0;
+	uint64 LiveCount = 0;
+	uint64 TotalAllocCount = 0;		// 누적
+	uint64 FrameAllocCount = 0;		// 지난 프레임(MarkFrame 사이)
+	uint64 FrameAllocBytes = 0;
+};
+
+struct FMemoryStats
+{
+	FMemoryTagStats Tags[static_cast<uint8>(EMemoryTag::Num)];
+	FMemoryTagStats Total;
+	uint32 NumThreads = 0;
+};
+
+/**
+ * @brief 전역 operator new/delete 카운터
+ *
+ * 스레드마다 자기 카운터 블록에만 쓰고(잠금/원자적 RMW 없음), 읽을 때 모든 블록을 합산한다.
+ * 해제는 할당한 태그로 되돌리기 위해 크기와 태그를 기록해 둔다: 기본 정렬은 블록 앞 16바이트 헤더,
+ * 16바이트보다 큰 정렬은 블록 밖의 표(정렬만큼 앞을 비우지 않도록).
+ * 다른 스레드가 해제하면 그 스레드 블록의 해제 카운터가 올라가므로 합산해야 정확한 값이 된다.
+ */
+class FMemoryTracker
+{
+public:
+	static constexpr bool IsEnabled() { return WITH_MEMORY_TRACKING != 0; }
+
+	/** 모든 스레드를 합산한다. 비활성 빌드면 0 */
+	static void GetStats(FMemoryStats& OutStats);
+
+	/** 프레임 경계에서 한 번 호출: 직전 호출 이후의 할당 수/바이트를 FrameAlloc*으로 만든다 */
+	static void MarkFrame();
+
+	static EMemoryTag GetCurrentTag();
+	static EMemoryTag SetCurrentTag(EMemoryTag InTag);
+
+	static const char* GetTagName(EMemoryTag InTag);
+
+	/** stat memory 표시용 문자열 */
+	static void FormatLines(const FMemoryStats& InStats, TArray<FString>& OutLines);
+};
+
+/**
+ * @brief 스코프 동안 이 스레드의 할당을 InTag로 센다 (중첩 가능, 끝나면 이전 태그로 복원)
+ */
+class FMemoryTagScope
+{
+public:
+	explicit FMemoryTagScope(EMemoryTag InTag) : PreviousTag(FMemoryTracker::SetCurrentTag(InTag)) {}
+	~FMemoryTagScope() { FMemoryTracker::SetCurrentTag(PreviousTag); }
+
+	FMemoryTagScope(const FMemoryTagScope&) = delete;
+	FMemoryTagScope& operator=(const FMemoryTagScope&) = delete;
+
+private:
+	EMemoryTag PreviousTag;
+};
+
+#if WITH_MEMORY_TRACKING
+	#define MEMORY_TAG_SCOPE_CONCAT_INNER(A, B) A##B
+	#define MEMORY_TAG_SCOPE_CONCAT(A, B) MEMORY_TAG_SCOPE_CONCAT_INNER(A, B)
+	#define MEMORY_TAG_SCOPE(Tag) FMemoryTagScope MEMORY_TAG_SCOPE_CONCAT(MemoryTagScope_, __LINE__)(EMemoryTag::Tag)
+#else
+	#define MEMORY_TAG_SCOPE(Tag)
+#endif
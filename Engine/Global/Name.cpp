@@ -6,7 +6,11 @@ FName::FName() : DisplayIndex(0), ComparisonIndex(0), Number(0)
 {
 }
 
-FName::FName(const FString& Str)
+FName::FName(const FString& Str) : FName(std::string_view(Str)) { }
+
+FName::FName(const char* Str) : FName(std::string_view(Str)) { }
+
+FName::FName(std::string_view Str)
 {
 	TPair<int32, int32> Indices = FNameTable::GetInstance().FindOrAddName(Str);
 	ComparisonIndex = Indices.first;
@@ -14,8 +18,6 @@ FName::FName(const FString& Str)
 	Number = -1;
 }
 
-FName::FName(const char* Str) : FName(FString(Str)) { }
-
 /**
 * @brief NameTable에서 UniqueName을 만들 때 사용하는 생성자
 * 
@@ -6,6 +6,7 @@ public:
 	FName();
 	FName(const FString& Str);
 	FName(const char* Str);
+	FName(std::string_view Str);
 	FName(int32 InDisplayIndex, int32 InComparisonIndex, int32 InNumber);
 
 	bool operator==(const FName& Other) const;
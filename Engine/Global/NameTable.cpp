@@ -1,121 +1,299 @@
 #include "pch.h"
 #include "Global/NameTable.h"
-#include "Core/ObjectIterator.h"
-#include "Actor/Actor.h"
+
+#include <cstring>
+
 IMPLEMENT_SINGLETON(FNameTable);
 
+namespace
+{
+	// 'A'~'Z'만 접는다 (기존 std::tolower의 "C" 로캘 동작과 같음)
+	char FoldCase(char C)
+	{
+		return (C >= 'A' && C <= 'Z') ? static_cast<char>(C | 0x20) : C;
+	}
+
+	uint32 FinalizeHash(uint32 Hash)
+	{
+		Hash ^= Hash >> 16;
+		Hash *= 0x85ebca6bu;
+		Hash ^= Hash >> 13;
+		Hash *= 0xc2b2ae35u;
+		Hash ^= Hash >> 16;
+		return Hash;
+	}
+
+	uint64 MakeSlot(uint32 InHash, uint32 InIndex)
+	{
+		return (static_cast<uint64>(InHash) << 32) | (static_cast<uint64>(InIndex) + 1);
+	}
+}
+
+FNameTable::FSlotArray::FSlotArray(uint32 InCapacity)
+	: Mask(InCapacity - 1), Slots(new std::atomic<uint64>[InCapacity])
+{
+	for (uint32 Index = 0; Index < InCapacity; ++Index)
+	{
+		Slots[Index].store(0, std::memory_order_relaxed);
+	}
+}
+
 FNameTable::FNameTable()
 {
+	SlotArrays.push_back(std::make_unique<FSlotArray>(InitialSlots));
+	ExactSlots.store(SlotArrays.back().get(), std::memory_order_release);
+	SlotArrays.push_back(std::make_unique<FSlotArray>(InitialSlots));
+	FoldedSlots.store(SlotArrays.back().get(), std::memory_order_release);
+
 	FindOrAddName("");
 }
-FNameTable::~FNameTable() = default;
+
+FNameTable::~FNameTable()
+{
+	const uint32 Count = NumEntries.load(std::memory_order_relaxed);
+	for (uint32 ChunkIndex = 0; ChunkIndex * EntriesPerChunk < Count; ++ChunkIndex)
+	{
+		delete[] Chunks[ChunkIndex].load(std::memory_order_relaxed);
+	}
+}
 
 /**
-* @brief FString 객체를 받아 풀에 없으면 반환
-* @param Str FName으로 등록되었는지 확인할 FString
-* @return DisplayIndex, ComparisonIndex
-*/
-TPair<int32, int32> FNameTable::FindOrAddName(const FString& Str)
+ * @brief 입력을 한 번 훑으며 원문 해시와 대소문자를 접은 해시를 함께 구한다 (FNV-1a + 마무리 섞기)
+ */
+void FNameTable::HashName(std::string_view Str, uint32& OutExactHash, uint32& OutFoldedHash)
 {
-	FString LowerStr = ToLower(Str);
+	uint32 ExactHash = 2166136261u;
+	uint32 FoldedHash = 2166136261u;
+	for (const char C : Str)
+	{
+		ExactHash = (ExactHash ^ static_cast<uint8>(C)) * 16777619u;
+		FoldedHash = (FoldedHash ^ static_cast<uint8>(FoldCase(C))) * 16777619u;
+	}
+	OutExactHash = FinalizeHash(ExactHash);
+	OutFoldedHash = FinalizeHash(FoldedHash);
+}
 
-	int32 ComparisonIndex;
-	auto ItComparison = ComparisonMap.find(LowerStr);
-	if (ItComparison != ComparisonMap.end())
+bool FNameTable::EqualsIgnoreCase(const FNameEntry& Entry, std::string_view Str)
+{
+	if (Entry.Length != Str.size())
 	{
-		ComparisonIndex = ItComparison->second;
+		return false;
 	}
-	else
+	for (uint32 Index = 0; Index < Entry.Length; ++Index)
 	{
-		if (!FreeComparisonIndices.Dequeue(ComparisonIndex))
-		{
-			ComparisonIndex = ComparisonStringPool.size();
-			ComparisonStringPool.push_back(LowerStr);
-		}
-		else
+		if (FoldCase(Entry.Chars[Index]) != FoldCase(Str[Index]))
 		{
-			ComparisonStringPool[ComparisonIndex] = LowerStr;
+			return false;
 		}
-		ComparisonMap[LowerStr] = ComparisonIndex;
 	}
+	return true;
+}
 
-	int32 DisplayIndex;
-	auto ItDisplay = DisplayMap.find(Str);
-	if (ItDisplay != DisplayMap.end())
+int32 FNameTable::FindExact(std::string_view Str, uint32 InExactHash) const
+{
+	const FSlotArray* Table = ExactSlots.load(std::memory_order_acquire);
+	for (uint32 Probe = InExactHash & Table->Mask;; Probe = (Probe + 1) & Table->Mask)
 	{
-		DisplayIndex = ItDisplay->second;
+		const uint64 Slot = Table->Slots[Probe].load(std::memory_order_acquire);
+		if (Slot == 0)
+		{
+			return -1;
+		}
+		if (static_cast<uint32>(Slot >> 32) == InExactHash)
+		{
+			const uint32 Index = static_cast<uint32>(Slot) - 1;
+			const FNameEntry& Entry = GetEntry(Index);
+			if (Entry.Length == Str.size() && memcmp(Entry.Chars, Str.data(), Str.size()) == 0)
+			{
+				return static_cast<int32>(Index);
+			}
+		}
 	}
-	else
+}
+
+int32 FNameTable::FindFolded(std::string_view Str, uint32 InFoldedHash) const
+{
+	const FSlotArray* Table = FoldedSlots.load(std::memory_order_acquire);
+	for (uint32 Probe = InFoldedHash & Table->Mask;; Probe = (Probe + 1) & Table->Mask)
 	{
-		if (!FreeDisplayIndices.Dequeue(DisplayIndex))
+		const uint64 Slot = Table->Slots[Probe].load(std::memory_order_acquire);
+		if (Slot == 0)
+		{
+			return -1;
+		}
+		if (static_cast<uint32>(Slot >> 32) == InFoldedHash)
 		{
-			DisplayIndex = DisplayStringPool.size();
-			DisplayStringPool.push_back(Str);
+			const uint32 Index = static_cast<uint32>(Slot) - 1;
+			if (EqualsIgnoreCase(GetEntry(Index), Str))
+			{
+				return static_cast<int32>(Index);
+			}
 		}
-		else
+	}
+}
+
+/**
+* @brief 문자열을 받아 테이블에 없으면 추가
+* @param Str FName으로 등록되었는지 확인할 문자열
+* @return ComparisonIndex, DisplayIndex
+*/
+TPair<int32, int32> FNameTable::FindOrAddName(std::string_view Str)
+{
+	uint32 ExactHash;
+	uint32 FoldedHash;
+	HashName(Str, ExactHash, FoldedHash);
+
+	// 이미 있는 이름은 잠그지 않는다
+	int32 DisplayIndex = FindExact(Str, ExactHash);
+	if (DisplayIndex < 0)
+	{
+		std::lock_guard<std::mutex> Lock(WriteLock);
+
+		// 잠그는 사이 다른 스레드가 추가했을 수 있다
+		DisplayIndex = FindExact(Str, ExactHash);
+		if (DisplayIndex < 0)
 		{
-			DisplayStringPool[DisplayIndex] = Str;
+			DisplayIndex = AddEntry(Str, ExactHash, FoldedHash);
 		}
-		DisplayMap[Str] = DisplayIndex;
 	}
 
-	return { ComparisonIndex, DisplayIndex };
+	return { GetEntry(DisplayIndex).ComparisonIndex, DisplayIndex };
 }
 
-FName FNameTable::GetUniqueName(const FString& BaseStr)
+FName FNameTable::GetUniqueName(std::string_view BaseStr)
 {
 	TPair<int32, int32> Indices = FindOrAddName(BaseStr);
 	int32 DisplayIndex = Indices.second;
 	int32 ComparisonIndex = Indices.first;
 
-	int32 Number = NextNumberMap[BaseStr];
-	NextNumberMap[BaseStr]++;
+	int32 Number = GetEntry(DisplayIndex).NextNumber.fetch_add(1, std::memory_order_relaxed);
 
 	return FName(DisplayIndex, ComparisonIndex, Number);
 }
 
 FString FNameTable::GetDisplayString(int32 Idx) const
 {
-	if (Idx >= 0 && Idx < DisplayStringPool.size())
+	if (Idx >= 0 && static_cast<uint32>(Idx) < NumEntries.load(std::memory_order_acquire))
 	{
-		return DisplayStringPool[Idx];
+		const FNameEntry& Entry = GetEntry(Idx);
+		return FString(Entry.Chars, Entry.Length);
 	}
 	static const FString EmptyString = "";
 	return EmptyString;
 }
 
-FString FNameTable::ToLower(const FString& Str) const
+int32 FNameTable::AddEntry(std::string_view Str, uint32 InExactHash, uint32 InFoldedHash)
 {
-	FString LowerStr = Str;
-	std::transform(LowerStr.begin(), LowerStr.end(), LowerStr.begin(),
-		[](unsigned char C) { return std::tolower(C); });
-	return LowerStr;
+	const uint32 Index = NumEntries.load(std::memory_order_relaxed);
+	assert(Index < EntriesPerChunk * MaxChunks && "FNameTable: 이름 개수 한도 초과");
+
+	const uint32 ChunkIndex = Index / EntriesPerChunk;
+	if (!Chunks[ChunkIndex].load(std::memory_order_relaxed))
+	{
+		Chunks[ChunkIndex].store(new FNameEntry[EntriesPerChunk], std::memory_order_release);
+	}
+
+	FNameEntry& Entry = GetEntry(Index);
+	Entry.Chars = CopyString(Str);
+	Entry.Length = static_cast<uint32>(Str.size());
+	Entry.ExactHash = InExactHash;
+	Entry.FoldedHash = InFoldedHash;
+
+	// 대소문자만 다른 이름이 있으면 그 엔트리와 같은 ComparisonIndex를 쓴다
+	const int32 ComparisonIndex = FindFolded(Str, InFoldedHash);
+	Entry.ComparisonIndex = ComparisonIndex >= 0 ? ComparisonIndex : static_cast<int32>(Index);
+
+	// 엔트리를 다 쓴 뒤에 슬롯을 공개한다 (조회 스레드는 슬롯 acquire로 엔트리를 본다)
+	NumEntries.store(Index + 1, std::memory_order_release);
+	if (ComparisonIndex < 0)
+	{
+		InsertSlot(FoldedSlots, NumFoldedSlotsUsed, InFoldedHash, Index);
+	}
+	InsertSlot(ExactSlots, NumExactSlotsUsed, InExactHash, Index);
+
+	return static_cast<int32>(Index);
 }
-// 이터레이터로 돌아서 액터 목록 순회해서, 액터 이름 빼옴.
-// 액터 이름갖고 Pool에서 찾음. -> 인덱스 나와서
-// 해당 인덱스만 지움
-void FNameTable::Reset()
+
+const char* FNameTable::CopyString(std::string_view Str)
 {
-	for (TObjectIterator<AActor> It; It; ++It)
+	const size_t Size = Str.size() + 1;
+	if (Size > StringBytesLeft)
 	{
-		AActor* Actor = *It;
-		if (Actor)
+		// 블록보다 긴 이름은 전용 블록에 담고, 남은 공간이 있는 현재 블록은 계속 쓴다
+		const size_t BlockSize = Size > StringBlockSize / 4 ? Size : StringBlockSize;
+		StringBlocks.push_back(std::make_unique<char[]>(BlockSize));
+		if (BlockSize != StringBlockSize)
 		{
-			FString ActorName = Actor->GetClass()->GetName();
-			FString LowerName = ToLower(ActorName);
+			memcpy(StringBlocks.back().get(), Str.data(), Str.size());
+			StringBlocks.back()[Str.size()] = '\0';
+			return StringBlocks.back().get();
+		}
+		StringCursor = StringBlocks.back().get();
+		StringBytesLeft = BlockSize;
+	}
+
+	char* Chars = StringCursor;
+	memcpy(Chars, Str.data(), Str.size());
+	Chars[Str.size()] = '\0';
+	StringCursor += Size;
+	StringBytesLeft -= Size;
+	return Chars;
+}
 
-			int32* ComparisonIndex = ComparisonMap.Find(LowerName);
-			int32* DisplayIndex = DisplayMap.Find(ActorName);
-			if (ComparisonIndex == nullptr)
+void FNameTable::InsertSlot(std::atomic<FSlotArray*>& InTable, uint32& InOutNumUsed, uint32 InHash, uint32 InIndex)
+{
+	FSlotArray* Table = InTable.load(std::memory_order_relaxed);
+
+	// 절반 넘게 차면 두 배 배열로 옮겨 공개한다. 옛 배열을 보던 조회는 못 찾으면 잠금 경로에서 다시 찾는다
+	if ((InOutNumUsed + 1) * 2 > Table->Mask + 1)
+	{
+		auto NewTable = std::make_unique<FSlotArray>((Table->Mask + 1) * 2);
+		for (uint32 Index = 0; Index <= Table->Mask; ++Index)
+		{
+			const uint64 Slot = Table->Slots[Index].load(std::memory_order_relaxed);
+			if (Slot != 0)
 			{
-				continue;
+				uint32 Probe = static_cast<uint32>(Slot >> 32) & NewTable->Mask;
+				while (NewTable->Slots[Probe].load(std::memory_order_relaxed) != 0)
+				{
+					Probe = (Probe + 1) & NewTable->Mask;
+				}
+				NewTable->Slots[Probe].store(Slot, std::memory_order_relaxed);
 			}
-			FreeComparisonIndices.Enqueue(*ComparisonIndex);
-			FreeDisplayIndices.Enqueue(*DisplayIndex);
-
-			ComparisonMap.erase(LowerName);
-			DisplayMap.erase(ActorName);
-			NextNumberMap.erase(ActorName);
 		}
+		Table = NewTable.get();
+		SlotArrays.push_back(std::move(NewTable));
+		InTable.store(Table, std::memory_order_release);
+	}
+
+	uint32 Probe = InHash & Table->Mask;
+	while (Table->Slots[Probe].load(std::memory_order_relaxed) != 0)
+	{
+		Probe = (Probe + 1) & Table->Mask;
+	}
+	Table->Slots[Probe].store(MakeSlot(InHash, InIndex), std::memory_order_release);
+	++InOutNumUsed;
+}
+
+// 엔트리는 지우지 않는다 (다른 스레드가 같은 인덱스를 보고 있을 수 있고, 다시 쓰일 이름이다)
+void FNameTable::ResetNumber(std::string_view BaseStr)
+{
+	uint32 ExactHash;
+	uint32 FoldedHash;
+	HashName(BaseStr, ExactHash, FoldedHash);
+
+	const int32 DisplayIndex = FindExact(BaseStr, ExactHash);
+	if (DisplayIndex >= 0)
+	{
+		GetEntry(DisplayIndex).NextNumber.store(0, std::memory_order_relaxed);
+	}
+}
+
+void FNameTable::ClearNumMap()
+{
+	const uint32 Count = NumEntries.load(std::memory_order_acquire);
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		GetEntry(Index).NextNumber.store(0, std::memory_order_relaxed);
 	}
 }
@@ -1,36 +1,93 @@
 #pragma once
 
+#include <atomic>
+#include <mutex>
+#include <string_view>
+
+/**
+ * @brief FName 문자열 테이블
+ *
+ * 문자열은 블록 풀에 한 번만 복사해 두고 엔트리 인덱스로 가리킨다. DisplayIndex는 대소문자까지 같은 문자열,
+ * ComparisonIndex는 대소문자를 무시했을 때 처음 등록된 엔트리의 인덱스다 (두 인덱스는 같은 번호 공간을 쓴다).
+ *
+ * 조회는 입력을 한 번 훑으며 원문 해시와 대소문자 접은 해시를 같이 구하고, 개방 주소법 슬롯 배열을 탐색한다.
+ * 이미 있는 이름의 조회와 GetUniqueName의 번호 증가는 잠그지 않으므로 워커 스레드에서도 이름을 만들 수 있다.
+ * 새 이름 추가만 뮤텍스를 잡는다. 슬롯 배열이 커질 때는 새 배열을 만들어 교체하고, 옛 배열은 읽는 스레드가
+ * 남아 있을 수 있으므로 테이블이 소멸할 때까지 지우지 않는다.
+ */
 class FNameTable
 {
 	DECLARE_SINGLETON(FNameTable);
 
 public:
-	TPair<int32, int32> FindOrAddName(const FString& Str);
-	FName GetUniqueName(const FString& BaseStr);
+	/** @return ComparisonIndex, DisplayIndex */
+	TPair<int32, int32> FindOrAddName(std::string_view Str);
+	FName GetUniqueName(std::string_view BaseStr);
 
 	FString GetDisplayString(int32 Idx) const;
 
-	void Reset();
-	void ClearNumMap() { NextNumberMap.clear();  }
+	/** BaseStr(원문 그대로)의 GetUniqueName 넘버링을 0부터 다시 시작한다. 없는 이름이면 아무것도 하지 않는다 */
+	void ResetNumber(std::string_view BaseStr);
+	void ClearNumMap();
+
+	int32 Num() const { return static_cast<int32>(NumEntries.load(std::memory_order_acquire)); }
+
 private:
-	FString ToLower(const FString& Str) const;
-	// TODO - 현재는 Resize가 없고, 지워진 인덱스는 재사용하는 방식임
-	// 
-	// 만약에 이 엔진을 계속 사용한다면
-	// TArray로 문자열 정보를 저장하는 것이 아닌
-	// TMap<int32, FString> 으로 저장해서 인덱스가 비어있는 경우를
-	// 체크하는 방법도 고려하는 것이 좋아보입니다.
-
-	TArray<FString> ComparisonStringPool; // 아래 맵의 인덱스로 액터만 지우도록
-	TArray<FString> DisplayStringPool;
-
-	TQueue<int32> FreeComparisonIndices;
-	TQueue<int32> FreeDisplayIndices;
-
-	// 이름, 인덱스
-	TMap<FString, int32> ComparisonMap;
-	TMap<FString, int32> DisplayMap;
-
-	// 이름, 중복된 base string에 대한 넘버링
-	TMap<FString, int32> NextNumberMap;
+	struct FNameEntry
+	{
+		const char* Chars = nullptr;	// 블록 풀 안의 원문 (널 종료)
+		uint32 Length = 0;
+		uint32 ExactHash = 0;
+		uint32 FoldedHash = 0;
+		int32 ComparisonIndex = 0;
+		std::atomic<int32> NextNumber{ 0 };	// GetUniqueName 넘버링 (원문 기준)
+	};
+
+	/** 슬롯 = 해시 상위 32비트 | (엔트리 인덱스 + 1). 0은 빈 슬롯 */
+	struct FSlotArray
+	{
+		explicit FSlotArray(uint32 InCapacity);
+
+		uint32 Mask;
+		std::unique_ptr<std::atomic<uint64>[]> Slots;
+	};
+
+	static constexpr uint32 EntriesPerChunk = 16 * 1024;
+	static constexpr uint32 MaxChunks = 1024;
+	static constexpr uint32 InitialSlots = 1024;
+	static constexpr size_t StringBlockSize = 64 * 1024;
+
+	static void HashName(std::string_view Str, uint32& OutExactHash, uint32& OutFoldedHash);
+	static bool EqualsIgnoreCase(const FNameEntry& Entry, std::string_view Str);
+
+	const FNameEntry& GetEntry(uint32 InIndex) const
+	{
+		return Chunks[InIndex / EntriesPerChunk].load(std::memory_order_acquire)[InIndex % EntriesPerChunk];
+	}
+	FNameEntry& GetEntry(uint32 InIndex)
+	{
+		return Chunks[InIndex / EntriesPerChunk].load(std::memory_order_acquire)[InIndex % EntriesPerChunk];
+	}
+
+	int32 FindExact(std::string_view Str, uint32 InExactHash) const;
+	int32 FindFolded(std::string_view Str, uint32 InFoldedHash) const;
+
+	// 아래는 WriteLock을 잡은 상태에서만 호출한다
+	int32 AddEntry(std::string_view Str, uint32 InExactHash, uint32 InFoldedHash);
+	const char* CopyString(std::string_view Str);
+	void InsertSlot(std::atomic<FSlotArray*>& InTable, uint32& InOutNumUsed, uint32 InHash, uint32 InIndex);
+
+	std::atomic<FNameEntry*> Chunks[MaxChunks] = {};
+	std::atomic<uint32> NumEntries{ 0 };
+
+	std::atomic<FSlotArray*> ExactSlots{ nullptr };		// 원문 → 엔트리
+	std::atomic<FSlotArray*> FoldedSlots{ nullptr };	// 대소문자 무시 → 처음 등록된 엔트리
+	uint32 NumExactSlotsUsed = 0;
+	uint32 NumFoldedSlotsUsed = 0;
+
+	std::mutex WriteLock;
+	TArray<std::unique_ptr<FSlotArray>> SlotArrays;		// 교체된 배열 포함 전부 (소멸 시 해제)
+	TArray<std::unique_ptr<char[]>> StringBlocks;
+	char* StringCursor = nullptr;
+	size_t StringBytesLeft = 0;
 };
@@ -0,0 +1,176 @@
+#include "pch.h"
+#include "Global/ParallelFor.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	thread_local bool bInsideParallelFor = false;
+
+	/**
+	 * @brief ParallelFor 전용 상주 워커 풀
+	 * 한 번에 하나의 작업만 받는다 (동시 호출은 Dispatch 뮤텍스로 직렬화).
+	 */
+	class FParallelForPool
+	{
+	public:
+		FParallelForPool()
+		{
+			const uint32 HardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+			// 메인(호출) 스레드 몫을 하나 빼고, 렌더/입력 스레드와 다툴 정도로 많이 만들지는 않는다
+			const uint32 NumWorkers = std::min(HardwareThreads - 1, 15u);
+			Workers.reserve(NumWorkers);
+			for (uint32 Index = 0; Index < NumWorkers; ++Index)
+			{
+				Workers.emplace_back([this]() { WorkerLoop(); });
+			}
+		}
+
+		~FParallelForPool()
+		{
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				bStop = true;
+			}
+			WakeCondition.notify_all();
+			for (std::thread& Worker : Workers)
+			{
+				Worker.join();
+			}
+		}
+
+		int32 GetThreadCount() const { return static_cast<int32>(Workers.size()) + 1; }
+
+		void Run(int32 InNum, const function<void(int32)>& InBody)
+		{
+			std::lock_guard<std::mutex> DispatchLock(DispatchMutex);
+
+			uint32 RunGeneration;
+			{
+				std::lock_guard<std::mutex> Lock(Mutex);
+				Body = &InBody;
+				Num = InNum;
+				Remaining.store(InNum, std::memory_order_relaxed);
+				RunGeneration = ++Generation;
+				Cursor.store(static_cast<uint64>(RunGeneration) << 32, std::memory_order_release);
+			}
+			WakeCondition.notify_all();
+
+			Drain(RunGeneration, &InBody, InNum);
+
+			std::unique_lock<std::mutex> Lock(Mutex);
+			DoneCondition.wait(Lock, [this]() { return Remaining.load(std::memory_order_acquire) == 0; });
+		}
+
+	private:
+		/**
+		 * @brief 현재 작업의 인덱스를 하나씩 가져와 실행
+		 * Cursor 상위 32비트 = 세대, 하위 32비트 = 다음 인덱스.
+		 * 늦게 깬 워커가 다음 작업의 인덱스를 소모하지 않도록 세대가 같을 때만 CAS로 가져간다.
+		 */
+		void Drain(uint32 InGeneration, const function<void(int32)>* InBody, int32 InNum)
+		{
+			bInsideParallelFor = true;
+			uint64 Current = Cursor.load(std::memory_order_acquire);
+			for (;;)
+			{
+				if (static_cast<uint32>(Current >> 32) != InGeneration)
+				{
+					break;
+				}
+
+				const int32 Index = static_cast<int32>(Current & 0xFFFFFFFFull);
+				if (Index >= InNum)
+				{
+					break;
+				}
+
+				if (!Cursor.compare_exchange_weak(Current, Current + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+				{
+					continue;
+				}
+
+				(*InBody)(Index);
+
+				if (Remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					std::lock_guard<std::mutex> Lock(Mutex);
+					DoneCondition.notify_all();
+				}
+				Current = Cursor.load(std::memory_order_acquire);
+			}
+			bInsideParallelFor = false;
+		}
+
+		void WorkerLoop()
+		{
+			uint32 SeenGeneration = 0;
+			for (;;)
+			{
+				const function<void(int32)>* WorkBody;
+				int32 WorkNum;
+				{
+					std::unique_lock<std::mutex> Lock(Mutex);
+					WakeCondition.wait(Lock, [this, SeenGeneration]() { return bStop || Generation != SeenGeneration; });
+					if (bStop)
+					{
+						return;
+					}
+					SeenGeneration = Generation;
+					WorkBody = Body;
+					WorkNum = Num;
+				}
+				Drain(SeenGeneration, WorkBody, WorkNum);
+			}
+		}
+
+		TArray<std::thread> Workers;
+
+		std::mutex DispatchMutex;
+		std::mutex Mutex;
+		std::condition_variable WakeCondition;
+		std::condition_variable DoneCondition;
+
+		// Mutex로 보호
+		const function<void(int32)>* Body = nullptr;
+		int32 Num = 0;
+		uint32 Generation = 0;
+
+		std::atomic<uint64> Cursor{ 0 };
+		std::atomic<int32> Remaining{ 0 };
+		bool bStop = false;
+	};
+
+	FParallelForPool& GetPool()
+	{
+		static FParallelForPool Pool;
+		return Pool;
+	}
+}
+
+void ParallelFor(int32 InNum, const function<void(int32)>& InBody, bool bInForceSingleThread)
+{
+	if (InNum <= 0)
+	{
+		return;
+	}
+
+	if (InNum == 1 || bInForceSingleThread || bInsideParallelFor || GetPool().GetThreadCount() == 1)
+	{
+		for (int32 Index = 0; Index < InNum; ++Index)
+		{
+			InBody(Index);
+		}
+		return;
+	}
+
+	GetPool().Run(InNum, InBody);
+}
+
+int32 GetParallelForThreadCount()
+{
+	return GetPool().GetThreadCount();
+}
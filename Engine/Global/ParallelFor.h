@@ -0,0 +1,12 @@
+#pragma once
+#include "Global/CoreMinimal.h"
+
+/**
+ * @brief InBody(Index)를 [0, InNum) 범위에서 워커 스레드에 나눠 실행하고 모두 끝날 때까지 기다린다
+ * 호출 스레드도 작업에 참여한다. ParallelFor 안에서 다시 ParallelFor를 부르면 그 호출은 단일 스레드로 실행된다.
+ * 인덱스 하나가 작업 하나이므로, 잘게 쪼갤 일은 호출 쪽에서 청크 단위로 묶어서 넘긴다.
+ */
+void ParallelFor(int32 InNum, const function<void(int32)>& InBody, bool bInForceSingleThread = false);
+
+/** 호출 스레드를 포함한 최대 동시 실행 수 */
+int32 GetParallelForThreadCount();
@@ -1,5 +1,13 @@
 #pragma once
 
+/**
+ * @brief Render State Settings for Actor's Component
+ */
+struct FRenderState
+{
+	D3D11_CULL_MODE CullMode = D3D11_CULL_NONE;
+	D3D11_FILL_MODE FillMode = D3D11_FILL_SOLID;
+};
 
 struct FPipelineInfo
 {
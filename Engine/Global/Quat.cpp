@@ -11,8 +11,8 @@ FQuat FQuat::FromAxisAngle(const FVector& Axis, float Radians)
 	FVector N = Axis;
 	N.Normalize();
 	const float Half = 0.5f * Radians;
-	const float S = std::sinf(Half);
-	const float C = std::cosf(Half);
+	const float S = std::sin(Half);
+	const float C = std::cos(Half);
 	return {N.X * S, N.Y * S, N.Z * S, C};
 }
 
@@ -20,12 +20,12 @@ static FQuat QuatFromEulerRadians(const FVector& Radians)
 {
 	// XYZ intrinsic (roll=Z, pitch=X, yaw=Y) 조합과 일관되도록 엔진 표준에 맞춰 적용
 	// 여기서는 일반적인 순서 X->Y->Z (row-vector 기준 우측곱)로 합성
-	const float CX = std::cosf(Radians.X * 0.5f);
-	const float SX = std::sinf(Radians.X * 0.5f);
-	const float CY = std::cosf(Radians.Y * 0.5f);
-	const float SY = std::sinf(Radians.Y * 0.5f);
-	const float CZ = std::cosf(Radians.Z * 0.5f);
-	const float SZ = std::sinf(Radians.Z * 0.5f);
+	const float CX = std::cos(Radians.X * 0.5f);
+	const float SX = std::sin(Radians.X * 0.5f);
+	const float CY = std::cos(Radians.Y * 0.5f);
+	const float SY = std::sin(Radians.Y * 0.5f);
+	const float CZ = std::cos(Radians.Z * 0.5f);
+	const float SZ = std::sin(Radians.Z * 0.5f);
 
 	// q = qx * qy * qz (row-vector, local-right multiply와 합치기 위해)
 	// Hamilton product expanded
@@ -45,19 +45,19 @@ FVector FQuat::ToEulerXYZ(const FQuat& Q)
 	// Row-major + row-vector, R = Rx * Ry * Rz 기준의 역변환
 	FMatrix M = QuatToRotationMatrix(Q);
 
-	float Y = std::asinf(std::clamp(-M.Data[0][2], -1.0f, 1.0f));
+	float Y = std::asin(std::clamp(-M.Data[0][2], -1.0f, 1.0f));
 
 	float X, Z;
-	const float CY = std::cosf(Y);
+	const float CY = std::cos(Y);
 	if (std::fabs(CY) > 1e-6f)
 	{
-		X = std::atan2f(M.Data[1][2], M.Data[2][2]);
-		Z = std::atan2f(M.Data[0][1], M.Data[0][0]);
+		X = std::atan2(M.Data[1][2], M.Data[2][2]);
+		Z = std::atan2(M.Data[0][1], M.Data[0][0]);
 	}
 	else
 	{
 		// Gimbal 근처: z=0으로 두고 x만 계산
-		X = std::atan2f(-M.Data[2][1], M.Data[1][1]);
+		X = std::atan2(-M.Data[2][1], M.Data[1][1]);
 		Z = 0.0f;
 	}
 
@@ -73,7 +73,7 @@ void FQuat::Normalize()
 	const float Len2 = X * X + Y * Y + Z * Z + W * W;
 	if (Len2 > 0.0f)
 	{
-		const float Inv = 1.0f / std::sqrtf(Len2);
+		const float Inv = 1.0f / std::sqrt(Len2);
 		X *= Inv;
 		Y *= Inv;
 		Z *= Inv;
@@ -1,5 +1,11 @@
 #pragma once
-#include <immintrin.h>
+#include <emmintrin.h>
+
+// 4 lane 합을 모든 lane에 ((x+y)+(z+w), _mm_dp_ps와 같은 덧셈 순서, SSE2)
+static inline __m128 HorizontalSum4(__m128 v) {
+	v = _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+}
 
 // 3-float를 [x,y,z,0] 형태로 로드
 static inline __m128 load3(const float* p) {
@@ -11,6 +11,15 @@
 #include <array>
 #include <algorithm>
 
+/** Windows 헤더 없이 빌드할 때의 FORCEINLINE (Windows에서는 winnt.h가 정의) */
+#ifndef FORCEINLINE
+	#if defined(_MSC_VER)
+		#define FORCEINLINE __forceinline
+	#else
+		#define FORCEINLINE inline __attribute__((always_inline))
+	#endif
+#endif
+
 /** UE5 스타일 기본 타입 정의 */
 using uint8 = std::uint8_t;
 using int8 = std::int8_t;
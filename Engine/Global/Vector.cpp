@@ -29,63 +29,39 @@ FVector2::FVector2(const FVector2& InOther)
 }
 
 FVector2 FVector2::operator+(const FVector2& o) const {
-#if defined(__AVX2__)
 	__m128 a = load2(&X), b = load2(&o.X);
 	__m128 r = _mm_add_ps(a, b);
 	FVector2 out; store2(&out.X, r); return out;
-#else
-	return { X + o.X, Y + o.Y };
-#endif
 }
 
 FVector2 FVector2::operator-(const FVector2& o) const {
-#if defined(__AVX2__)
 	__m128 a = load2(&X), b = load2(&o.X);
 	__m128 r = _mm_sub_ps(a, b);
 	FVector2 out; store2(&out.X, r); return out;
-#else
-	return { X - o.X, Y - o.Y };
-#endif
 }
 
 FVector2 FVector2::operator*(float s) const {
-#if defined(__AVX2__)
 	__m128 a = load2(&X), k = _mm_set1_ps(s);
 	__m128 r = _mm_mul_ps(a, k);
 	FVector2 out; store2(&out.X, r); return out;
-#else
-	return { X * s, Y * s };
-#endif
 }
 
 FVector2& FVector2::operator+=(const FVector2& o) {
-#if defined(__AVX2__)
 	__m128 a = load2(&X), b = load2(&o.X);
 	__m128 r = _mm_add_ps(a, b);
 	store2(&X, r); return *this;
-#else
-	X += o.X; Y += o.Y; return *this;
-#endif
 }
 
 FVector2& FVector2::operator-=(const FVector2& o) {
-#if defined(__AVX2__)
 	__m128 a = load2(&X), b = load2(&o.X);
 	__m128 r = _mm_sub_ps(a, b);
 	store2(&X, r); return *this;
-#else
-	X -= o.X; Y -= o.Y; return *this;
-#endif
 }
 
 FVector2& FVector2::operator*=(float s) {
-#if defined(__AVX2__)
 	__m128 a = load2(&X), k = _mm_set1_ps(s);
 	__m128 r = _mm_mul_ps(a, k);
 	store2(&X, r); return *this;
-#else
-	X *= s; Y *= s; return *this;
-#endif
 }
 
 
@@ -122,33 +98,21 @@ void FVector::operator=(const FVector4& InOther)
 
 
 FVector FVector::operator+(const FVector& o) const {
-#if defined(__AVX2__)
 	__m128 a = load3(&X), b = load3(&o.X);
 	__m128 r = _mm_add_ps(a, b);
 	FVector out; store3(&out.X, r); return out;
-#else
-	return { X + o.X, Y + o.Y, Z + o.Z };
-#endif
 }
 
 FVector FVector::operator-(const FVector& o) const {
-#if defined(__AVX2__)
 	__m128 a = load3(&X), b = load3(&o.X);
 	__m128 r = _mm_sub_ps(a, b);
 	FVector out; store3(&out.X, r); return out;
-#else
-	return { X - o.X, Y - o.Y, Z - o.Z };
-#endif
 }
 
 FVector FVector::operator*(float s) const {
-#if defined(__AVX2__)
 	__m128 a = load3(&X), k = _mm_set1_ps(s);
 	__m128 r = _mm_mul_ps(a, k);
 	FVector out; store3(&out.X, r); return out;
-#else
-	return { X * s, Y * s, Z * s };
-#endif
 }
 
 FVector FVector::operator*(const FVector& InOther) const
@@ -157,72 +121,47 @@ FVector FVector::operator*(const FVector& InOther) const
 }
 
 FVector& FVector::operator+=(const FVector& o) {
-#if defined(__AVX2__)
 	__m128 a = load3(&X), b = load3(&o.X);
 	__m128 r = _mm_add_ps(a, b);
 	store3(&X, r); return *this;
-#else
-	X += o.X; Y += o.Y; Z += o.Z; return *this;
-#endif
 }
 
 FVector& FVector::operator-=(const FVector& o) {
-#if defined(__AVX2__)
 	__m128 a = load3(&X), b = load3(&o.X);
 	__m128 r = _mm_sub_ps(a, b);
 	store3(&X, r); return *this;
-#else
-	X -= o.X; Y -= o.Y; Z -= o.Z; return *this;
-#endif
 }
 
 FVector& FVector::operator*=(float s) {
-#if defined(__AVX2__)
 	__m128 a = load3(&X), k = _mm_set1_ps(s);
 	__m128 r = _mm_mul_ps(a, k);
 	store3(&X, r); return *this;
-#else
-	X *= s; Y *= s; Z *= s; return *this;
-#endif
 }
 
 float FVector::Length() const
 {
-#if defined(__AVX2__)
 	__m128 v = load3(&X);
-	__m128 dp = _mm_dp_ps(v, v, 0x71);        // x^2+y^2+z^2 -> [s,0,0,0]
+	__m128 dp = HorizontalSum4(_mm_mul_ps(v, v)); // x^2+y^2+z^2 (w = 0)
 	__m128 s = _mm_sqrt_ss(dp);
 	return _mm_cvtss_f32(s);
-#else
-	return sqrtf(X * X + Y * Y + Z * Z);
-#endif
 }
 
 float FVector::LengthSquared() const
 {
-#if defined(__AVX2__)
 	__m128 v = load3(&X);
-	__m128 dp = _mm_dp_ps(v, v, 0x71);
+	__m128 dp = HorizontalSum4(_mm_mul_ps(v, v));
 	return _mm_cvtss_f32(dp);
-#else
-	return X * X + Y * Y + Z * Z;
-#endif
 }
 
 float FVector::Dot(const FVector& OtherVector) const
 {
-#if defined(__AVX2__)
 	const float a[4] = { X, Y, Z, 0.0f };
 	const float b[4] = { OtherVector.X, OtherVector.Y, OtherVector.Z, 0.0f };
-	return Dot3_AVX(a, b);
-#else
-	return (X * OtherVector.X) + (Y * OtherVector.Y) + (Z * OtherVector.Z);
-#endif
+	return Dot3_SSE(a, b);
 }
 
 FVector FVector::Cross(const FVector& OutVector) const
 {
-#if defined(__AVX2__)
 	// a x b = (a_y b_z - a_z b_y, a_z b_x - a_x b_z, a_x b_y - a_y b_x)
 	__m128 a = load3(&X);
 	__m128 b = load3(&OutVector.X);
@@ -234,20 +173,12 @@ FVector FVector::Cross(const FVector& OutVector) const
 	__m128 b_yzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
 	__m128 c = _mm_sub_ps(_mm_mul_ps(a_yzx, b_zxy), _mm_mul_ps(a_zxy, b_yzx));
 	FVector out; store3(&out.X, c); return out;
-#else
-	return FVector(
-		Z * OutVector.Y - Y * OutVector.Z,
-		X * OutVector.Z - Z * OutVector.X,
-		Y * OutVector.X - X * OutVector.Y
-	);
-#endif
 }
 
 void FVector::Normalize()
 {
-#if defined(__AVX2__)
 	__m128 v = load3(&X);
-	__m128 dp = _mm_dp_ps(v, v, 0x7F);   // 스칼라 s, 나머지 브로드캐스트
+	__m128 dp = HorizontalSum4(_mm_mul_ps(v, v)); // 모든 lane에 x^2+y^2+z^2
 	__m128 len = _mm_sqrt_ps(dp);
 	// 0 나눗셈 방지용 epsilon
 	__m128 eps = _mm_set1_ps(1e-8f);
@@ -255,10 +186,6 @@ void FVector::Normalize()
 	__m128 inv = _mm_div_ps(_mm_set1_ps(1.0f), m);
 	__m128 r = _mm_mul_ps(v, inv);
 	store3(&X, r);
-#else
-	float L = sqrt(LengthSquared());
-	if (L > 0.00000001f) { X /= L; Y /= L; Z /= L; }
-#endif
 }
 
 
@@ -298,52 +225,27 @@ FVector4::FVector4(const FVector4& InOther)
  */
 FVector4 FVector4::operator+(const FVector4& OtherVector) const
 {
-#if defined(__AVX2__)
 	__m128 a = _mm_loadu_ps(&X);
 	__m128 b = _mm_loadu_ps(&OtherVector.X);
 	__m128 r = _mm_add_ps(a, b);
 	FVector4 out; _mm_storeu_ps(&out.X, r); return out;
-#else
-	return FVector4(X + OtherVector.X, Y + OtherVector.Y, Z + OtherVector.Z, W + OtherVector.W);
-#endif
 }
 
 FVector4 FVector4::operator*(const FMatrix& Matrix) const
 {
-#if defined(__AVX2__)
-	__m128 v = _mm_loadu_ps(&X); // [X,Y,Z,W]
-	__m128 c0 = LoadCol(Matrix.Data, 0);
-	__m128 c1 = LoadCol(Matrix.Data, 1);
-	__m128 c2 = LoadCol(Matrix.Data, 2);
-	__m128 c3 = LoadCol(Matrix.Data, 3);
-
+	// [X,Y,Z,W] * M = X*row0 + Y*row1 + Z*row2 + W*row3
 	FVector4 out;
-	out.X = _mm_cvtss_f32(_mm_dp_ps(v, c0, 0xF1));
-	out.Y = _mm_cvtss_f32(_mm_dp_ps(v, c1, 0xF1));
-	out.Z = _mm_cvtss_f32(_mm_dp_ps(v, c2, 0xF1));
-	out.W = _mm_cvtss_f32(_mm_dp_ps(v, c3, 0xF1));
+	_mm_storeu_ps(&out.X, MulRowByMatrix(_mm_loadu_ps(&X), Matrix.Data));
 	return out;
-#else
-	FVector4 Result;
-	Result.X = X * Matrix.Data[0][0] + Y * Matrix.Data[1][0] + Z * Matrix.Data[2][0] + W * Matrix.Data[3][0];
-	Result.Y = X * Matrix.Data[0][1] + Y * Matrix.Data[1][1] + Z * Matrix.Data[2][1] + W * Matrix.Data[3][1];
-	Result.Z = X * Matrix.Data[0][2] + Y * Matrix.Data[1][2] + Z * Matrix.Data[2][2] + W * Matrix.Data[3][2];
-	Result.W = X * Matrix.Data[0][3] + Y * Matrix.Data[1][3] + Z * Matrix.Data[2][3] + W * Matrix.Data[3][3];
-	return Result;
-#endif
 }
 /**
  * @brief 두 벡터를 뺀 새로운 벡터를 반환하는 함수
  */
 FVector4 FVector4::operator-(const FVector4& OtherVector) const
 {
-#if defined(__AVX2__)
 	__m128 a = _mm_loadu_ps(&X), b = _mm_loadu_ps(&OtherVector.X);
 	__m128 r = _mm_sub_ps(a, b);
 	FVector4 out; _mm_storeu_ps(&out.X, r); return out;
-#else
-	return FVector4(X - OtherVector.X, Y - OtherVector.Y, Z - OtherVector.Z, W - OtherVector.W);
-#endif
 }
 
 /**
@@ -351,17 +253,10 @@ FVector4 FVector4::operator-(const FVector4& OtherVector) const
  */
 FVector4 FVector4::operator*(const float Ratio) const
 {
-#if defined(__AVX2__)
-#pragma message("AVX2 path compiled")
-	static volatile int hit_avx2 = (printf("AVX2 path\n"), 0);
-
 	__m128 a = _mm_loadu_ps(&X);
 	__m128 s = _mm_set1_ps(Ratio);
 	__m128 r = _mm_mul_ps(a, s);
 	FVector4 out; _mm_storeu_ps(&out.X, r); return out;
-#else
-	return FVector4(X * Ratio, Y * Ratio, Z * Ratio, W * Ratio);
-#endif
 }
 
 
@@ -370,13 +265,9 @@ FVector4 FVector4::operator*(const float Ratio) const
  */
 void FVector4::operator+=(const FVector4& OtherVector)
 {
-#if defined(__AVX2__)
 	__m128 a = _mm_loadu_ps(&X), b = _mm_loadu_ps(&OtherVector.X);
 	__m128 r = _mm_add_ps(a, b);
 	_mm_storeu_ps(&X, r);
-#else
-	X += OtherVector.X; Y += OtherVector.Y; Z += OtherVector.Z; W += OtherVector.W;
-#endif
 }
 
 /**
@@ -384,13 +275,9 @@ void FVector4::operator+=(const FVector4& OtherVector)
  */
 void FVector4::operator-=(const FVector4& OtherVector)
 {
-#if defined(__AVX2__)
 	__m128 a = _mm_loadu_ps(&X), b = _mm_loadu_ps(&OtherVector.X);
 	__m128 r = _mm_sub_ps(a, b);
 	_mm_storeu_ps(&X, r);
-#else
-	X -= OtherVector.X; Y -= OtherVector.Y; Z -= OtherVector.Z; W -= OtherVector.W;
-#endif
 }
 
 /**
@@ -398,13 +285,9 @@ void FVector4::operator-=(const FVector4& OtherVector)
  */
 void FVector4::operator*=(const float Ratio)
 {
-#if defined(__AVX2__)
 	__m128 a = _mm_loadu_ps(&X), k = _mm_set1_ps(Ratio);
 	__m128 r = _mm_mul_ps(a, k);
 	_mm_storeu_ps(&X, r);
-#else
-	X *= Ratio; Y *= Ratio; Z *= Ratio; W *= Ratio;
-#endif
 }
 
 // FVector static const 멤버 변수 정의
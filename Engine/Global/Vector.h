@@ -3,7 +3,7 @@ struct FMatrix;
 
 // VectorSimd.h (분리 권장)
 #pragma once
-#include <immintrin.h>
+#include "SIMDHelper.h"
 
 // 4원수 로드/스토어 헬퍼 (row-major float[4])
 static inline __m128 LoadVec4(const float* p) { return _mm_loadu_ps(p); }
@@ -12,30 +12,18 @@ static inline __m128  Splat(float s) { return _mm_set1_ps(s); }
 static inline __m128  Set4(float x, float y, float z, float w) { return _mm_set_ps(w, z, y, x); } // XYZW -> lane WZYX
 
 // 3D dot (W=0 가정), 4D dot
-static inline float Dot3_AVX(const float* a, const float* b)
+static inline float Dot3_SSE(const float* a, const float* b)
 {
-#if defined(__AVX2__)
 	__m128 va = _mm_set_ps(0.0f, a[2], a[1], a[0]);
 	__m128 vb = _mm_set_ps(0.0f, b[2], b[1], b[0]);
-	// 0x71 = (maskL=0001, maskH=0111) -> XYZ만 곱/합, 결과는 하위 스칼라
-	__m128 d = _mm_dp_ps(va, vb, 0x71);
-	return _mm_cvtss_f32(d);
-#else
-	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
-#endif
+	return _mm_cvtss_f32(HorizontalSum4(_mm_mul_ps(va, vb)));
 }
 
-static inline float Dot4_AVX(const float* a, const float* b)
+static inline float Dot4_SSE(const float* a, const float* b)
 {
-#if defined(__AVX2__)
 	__m128 va = _mm_loadu_ps(a);
 	__m128 vb = _mm_loadu_ps(b);
-	// 0xF1 = XYZW 모두 곱/합, 결과는 하위 스칼라
-	__m128 d = _mm_dp_ps(va, vb, 0xF1);
-	return _mm_cvtss_f32(d);
-#else
-	return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
-#endif
+	return _mm_cvtss_f32(HorizontalSum4(_mm_mul_ps(va, vb)));
 }
 
 struct FVector2
@@ -315,13 +303,9 @@ struct FVector4
 	 */
 	inline float Dot3(const FVector4& OtherVector) const
 	{
-		#if defined(__AVX2__)
-				const float a[4] = { X, Y, Z, 0.0f };
-				const float b[4] = { OtherVector.X, OtherVector.Y, OtherVector.Z, 0.0f };
-				return Dot3_AVX(a, b);
-		#else
-				return X * OtherVector.X + Y * OtherVector.Y + Z * OtherVector.Z;
-		#endif
+		const float a[4] = { X, Y, Z, 0.0f };
+		const float b[4] = { OtherVector.X, OtherVector.Y, OtherVector.Z, 0.0f };
+		return Dot3_SSE(a, b);
 	}
 	inline float Dot3(const FVector& OtherVector) const
 	{
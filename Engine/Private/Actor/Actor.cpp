@@ -9,17 +9,23 @@
 
 IMPLEMENT_CLASS(AActor, UObject)
 
+void FActorTickFunction::ExecuteTick(float InDeltaTime)
+{
+	Target->Tick(InDeltaTime);
+}
+
 AActor::AActor()
 {
 	USceneComponent* DefaultSceneComponent = CreateDefaultSubobject<USceneComponent>("DefaultSceneRoot");
 	DefaultSceneComponent->SetOwner(this);
 	SetRootComponent(DefaultSceneComponent);
 
-	bTickInEditor = false; bIsTickEnabled = true;
+	PrimaryActorTick.Target = this;
 }
 
 AActor::AActor(UObject* InOuter)
 {
+	PrimaryActorTick.Target = this;
 	SetOuter(InOuter);
 }
 
@@ -123,6 +129,12 @@ void AActor::AddActorComponent(EComponentType InType, USceneComponent* InParentC
 		{
 			SetRootComponent(NewComponent);
 		}
+		// 이미 레벨에 있는 액터라면 새 컴포넌트를 바로 렌더 리스트/틱 매니저에 올린다
+		if (OwnerLevel)
+		{
+			OwnerLevel->RegisterComponentForRender(static_cast<UPrimitiveComponent*>(NewComponent));
+			OwnerLevel->RegisterActorTickFunctions(this);
+		}
     }
 }
 
@@ -322,8 +334,8 @@ void AActor::CopyShallow(UObject* Src)
 	this->RootComponent = BaseActor->GetRootComponent();
 	this->OwnedComponents = BaseActor->GetOwnedComponents();
 	this->InitPos = BaseActor->InitPos;
+	PrimaryActorTick.CopyTickSettings(BaseActor->PrimaryActorTick);
 
-	// bIsTickEnabled
 	//UStaticMesh* StaticMesh = UResourceManager::GetInstance().GetStaticMesh("Data/cube-tex.obj");
 	//this->SetStaticMesh(StaticMesh);
 
@@ -355,18 +367,27 @@ AActor* AActor::DuplicateForTest(ULevel* NewOuter, AActor* OldActor) const
 	return NewActor;
 } 
 
-void AActor::Tick()
+/**
+ * @brief 컴포넌트는 각자 틱 함수로 따로 실행된다 (이 액터의 틱 다음)
+ */
+void AActor::Tick(float DeltaTime)
 {
-	for (UActorComponent* Component : OwnedComponents)
+	SetActorLocation(GetActorLocation() + InitPos * DeltaTime);
+}
+
+void AActor::SetInitPos(FVector Pos)
+{
+	InitPos = Pos;
+
+	// 움직일 게 생겼으면 틱을 켠다 (이미 레벨에 있으면 바로 등록)
+	if (!PrimaryActorTick.bCanEverTick && !(InitPos == FVector(0.0f, 0.0f, 0.0f)))
 	{
-		if (Component && Component->IsComponentTickEnabled())
+		PrimaryActorTick.bCanEverTick = true;
+		if (OwnerLevel)
 		{
-			Component->TickComponent();
+			OwnerLevel->RegisterActorTickFunctions(this);
 		}
 	}
- 
-	SetActorLocation(GetActorLocation() + InitPos * DT);
-
 }
 
 void AActor::BeginPlay()
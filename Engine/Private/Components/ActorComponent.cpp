@@ -3,10 +3,15 @@
 
 IMPLEMENT_ABSTRACT_CLASS(UActorComponent, UObject)
 
+void FActorComponentTickFunction::ExecuteTick(float InDeltaTime)
+{
+	Target->TickComponent(InDeltaTime);
+}
+
 UActorComponent::UActorComponent()
 {
 	ComponentType = EComponentType::Actor;
-	bIsComponentTickEnabled = true;  
+	PrimaryComponentTick.Target = this;
 }
 
 UActorComponent::~UActorComponent()
@@ -20,7 +25,7 @@ void UActorComponent::BeginPlay()
 
 }
 
-void UActorComponent::TickComponent()
+void UActorComponent::TickComponent(float DeltaTime)
 {
 
 }
@@ -41,6 +46,7 @@ void UActorComponent::DuplicateSubObjects()
 
 void UActorComponent::CopyShallow(UObject* Src)
 {
+	PrimaryComponentTick.CopyTickSettings(static_cast<UActorComponent*>(Src)->PrimaryComponentTick);
 }
 
 UObject* UActorComponent::Duplicate()
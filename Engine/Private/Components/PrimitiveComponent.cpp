@@ -1,6 +1,8 @@
 #include "pch.h"
 #include "Components/PrimitiveComponent.h"
 #include "Public/Manager/Resource/ResourceManager.h"
+#include "Actor/Actor.h"
+#include "Level/Level.h"
 
 #include <algorithm>
 
@@ -12,6 +14,39 @@ UPrimitiveComponent::UPrimitiveComponent()
 {
 }
 
+UPrimitiveComponent::~UPrimitiveComponent()
+{
+	if (RenderLevel)
+	{
+		RenderLevel->UnregisterComponentForRender(this);
+	}
+}
+
+void UPrimitiveComponent::SetVisibility(bool bVisibility)
+{
+	if (bVisible == bVisibility)
+	{
+		return;
+	}
+	bVisible = bVisibility;
+
+	// 숨기면 리스트에서 빼고, 보이면 소유 액터가 속한 레벨에 올린다
+	if (!bVisible)
+	{
+		if (RenderLevel)
+		{
+			RenderLevel->UnregisterComponentForRender(this);
+		}
+	}
+	else if (AActor* OwnerActor = GetOwner())
+	{
+		if (ULevel* Level = OwnerActor->GetLevel())
+		{
+			Level->RegisterComponentForRender(this);
+		}
+	}
+}
+
 
 void UPrimitiveComponent::DuplicateSubObjects()
 {
@@ -37,6 +72,7 @@ void UPrimitiveComponent::CopyShallow(UObject* Src)
     const UPrimitiveComponent* Base = static_cast<const UPrimitiveComponent*>(Src);
 
     this->SetColor(Base->GetColor());
-    this->SetVisibility(Base->IsVisible());
+    // 복제본은 아직 레벨에 없으므로 렌더 리스트는 건드리지 않고 값만 옮긴다
+    this->bVisible = Base->IsVisible();
     this->SetOctreeIndex(-1);
 }
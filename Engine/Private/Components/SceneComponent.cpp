@@ -10,10 +10,12 @@ IMPLEMENT_CLASS(USceneComponent, UActorComponent)
 USceneComponent::USceneComponent()
 {
 	ComponentType = EComponentType::Scene;
+	TransformHandle = FTransformStore::GetInstance().Allocate(this);
 }
 
 USceneComponent::~USceneComponent()
 {
+	FTransformStore::GetInstance().Free(TransformHandle);
 }
 
 void USceneComponent::SetParentAttachment(USceneComponent* NewParent)
@@ -43,6 +45,7 @@ void USceneComponent::SetParentAttachment(USceneComponent* NewParent)
 	}
 
 	ParentAttachment = NewParent;
+	FTransformStore::GetInstance().SetParent(TransformHandle, NewParent ? NewParent->TransformHandle : FTransformStore::InvalidHandle);
 
 	if (NewParent)
 	{
@@ -67,44 +70,73 @@ void USceneComponent::RemoveChild(USceneComponent* ChildDeleted)
 
 void USceneComponent::MarkAsDirty()
 {
-	bIsTransformDirty = true;
-	bIsTransformDirtyInverse = true;
-	bIsMoved = true;
+	// 캐시는 항상 부모부터 채워지므로 "더티인 노드의 자손은 모두 더티"가 유지된다.
+	// 따라서 이미 더티인 노드를 만나면 그 아래는 볼 필요가 없다 (기즈모 드래그 중 매 프레임 O(1)).
+	if (IsMarkedDirty())
+	{
+		return;
+	}
 
-	for (USceneComponent* Child : Children)
+	// 자식이 수천 개여도 스택이 넘치지 않도록 재귀 대신 명시적 스택을 쓴다 (스레드마다 하나, 용량 재사용)
+	thread_local TArray<USceneComponent*> PendingComponents;
+	PendingComponents.clear();
+	PendingComponents.push_back(this);
+
+	FTransformStore& Store = FTransformStore::GetInstance();
+	while (!PendingComponents.empty())
 	{
-		Child->MarkAsDirty();
+		USceneComponent* Component = PendingComponents.back();
+		PendingComponents.pop_back();
+
+		Store.SetFlags(Component->TransformHandle, FTransformStore::AllDirty);
+
+		for (USceneComponent* Child : Component->Children)
+		{
+			if (!Child->IsMarkedDirty())
+			{
+				PendingComponents.push_back(Child);
+			}
+		}
 	}
 }
 
 void USceneComponent::SetRelativeLocation(const FVector& Location)
 {
-	if (!(Location == RelativeLocation))
+	FTransformStore& Store = FTransformStore::GetInstance();
+	if (!(Location == Store.GetLocation(TransformHandle)))
 	{
-		RelativeLocation = Location;
+		Store.SetLocation(TransformHandle, Location);
 		MarkAsDirty();
 	}
 }
 
 void USceneComponent::SetRelativeRotation(const FVector& Rotation)
 {
-	if (!(Rotation == RelativeRotation))
+	FTransformStore& Store = FTransformStore::GetInstance();
+	if (!(Rotation == Store.GetRotationEuler(TransformHandle)))
 	{
-		RelativeRotation = Rotation;
 		// Keep quaternion in sync with UI degrees
-		RelativeRotationQuat = FQuat::FromEulerXYZ(RelativeRotation);
+		Store.SetRotation(TransformHandle, FQuat::FromEulerXYZ(Rotation), Rotation);
 		MarkAsDirty();
 	}
 }
+
+void USceneComponent::SetRelativeRotation(const FQuat& Rotation)
+{
+	FTransformStore::GetInstance().SetRotation(TransformHandle, Rotation, FQuat::ToEulerXYZ(Rotation));
+	MarkAsDirty();
+}
+
 void USceneComponent::SetRelativeScale3D(const FVector& Scale)
 {
-	if (!(Scale == RelativeScale3D))
+	FTransformStore& Store = FTransformStore::GetInstance();
+	if (!(Scale == Store.GetScale(TransformHandle)))
 	{
 		FVector ActualScale = Scale;
 		ActualScale.X = std::max(ActualScale.X, MinScale);
 		ActualScale.Y = std::max(ActualScale.Y, MinScale);
 		ActualScale.Z = std::max(ActualScale.Z, MinScale);
-		RelativeScale3D = ActualScale;
+		Store.SetScale(TransformHandle, ActualScale);
 		MarkAsDirty();
 	}
 }
@@ -123,18 +155,18 @@ bool USceneComponent::IsUniformScale() const
 
 const FVector& USceneComponent::GetRelativeLocation() const
 {
-	return RelativeLocation;
+	return FTransformStore::GetInstance().GetLocation(TransformHandle);
 }
 const FVector& USceneComponent::GetRelativeRotation() const
 {
-	return RelativeRotation;
+	return FTransformStore::GetInstance().GetRotationEuler(TransformHandle);
 }
 const FVector& USceneComponent::GetRelativeScale3D() const
 {
-	return RelativeScale3D;
+	return FTransformStore::GetInstance().GetScale(TransformHandle);
 }
 
-const FVector& USceneComponent::GetWorldLocation() const
+FVector USceneComponent::GetWorldLocation() const
 {
 	const FMatrix& WorldMatrix = GetWorldTransformMatrix();
 	return FVector(WorldMatrix.Data[3][0], WorldMatrix.Data[3][1], WorldMatrix.Data[3][2]);
@@ -142,38 +174,13 @@ const FVector& USceneComponent::GetWorldLocation() const
 
 const FMatrix& USceneComponent::GetWorldTransformMatrix() const
 {
-    if (bIsTransformDirty)
-    {
-        // Quaternion-based TRS (row-major): I * S * R * T
-        WorldTransformMatrix = FMatrix::GetModelMatrix(RelativeLocation, RelativeRotationQuat, RelativeScale3D);
-
-        for (USceneComponent* Ancester = ParentAttachment; Ancester; Ancester = Ancester->ParentAttachment)
-        {
-            WorldTransformMatrix *= FMatrix::GetModelMatrix(Ancester->RelativeLocation, Ancester->RelativeRotationQuat, Ancester->RelativeScale3D);
-        }
-
-        bIsTransformDirty = false;
-    }
-
-	return WorldTransformMatrix;
+	// Local(S * R * T) * ParentWorld, 더티면 저장소가 부모부터 지연 계산한다
+	return FTransformStore::GetInstance().GetWorldMatrix(TransformHandle);
 }
 
 const FMatrix& USceneComponent::GetWorldTransformMatrixInverse() const
 {
-
-    if (bIsTransformDirtyInverse)
-    {
-        WorldTransformMatrixInverse = FMatrix::Identity;
-        for (USceneComponent* Ancestor = ParentAttachment; Ancestor; Ancestor = Ancestor->ParentAttachment)
-        {
-            WorldTransformMatrixInverse = FMatrix::GetModelMatrixInverse(Ancestor->RelativeLocation, Ancestor->RelativeRotationQuat, Ancestor->RelativeScale3D) * WorldTransformMatrixInverse;
-        }
-        WorldTransformMatrixInverse = WorldTransformMatrixInverse * FMatrix::GetModelMatrixInverse(RelativeLocation, RelativeRotationQuat, RelativeScale3D);
-
-        bIsTransformDirtyInverse = false;
-    }
-
-	return WorldTransformMatrixInverse;
+	return FTransformStore::GetInstance().GetWorldMatrixInverse(TransformHandle);
 }
  
 void USceneComponent::DuplicateSubObjects()
@@ -196,7 +203,7 @@ UObject* USceneComponent::Duplicate()
 }
 void USceneComponent::CopyShallow(UObject* Src)
 {
-	//Super::CopyShallow(Src);
+	Super::CopyShallow(Src);
 
 	const USceneComponent* BaseSceneComp = static_cast<const USceneComponent*>(Src); 
 	this->SetRelativeLocation(BaseSceneComp->GetRelativeLocation());
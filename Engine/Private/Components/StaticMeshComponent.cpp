@@ -10,6 +10,20 @@
 
 IMPLEMENT_CLASS(UStaticMeshComponent, UMeshComponent)
 
+void UStaticMeshComponent::SetMaterial(UMaterial* Material, int Index)
+{
+	if (Index < 0 || Index >= MaterialList.Num())
+	{
+		return;
+	}
+
+	MaterialList[Index] = Material;
+	if (Material)
+	{
+		Material->ResolveTextures();
+	}
+}
+
 void UStaticMeshComponent::SetStaticMesh(UStaticMesh* InStaticMesh)
 {
 	StaticMesh = InStaticMesh;
@@ -36,6 +50,11 @@ void UStaticMeshComponent::SetStaticMesh(UStaticMesh* InStaticMesh)
 	for (int Index = 0; Index < StaticMeshAsset->Sections.Num(); Index++)
 	{
 		MaterialList[Index] = FObjManager::LoadMaterial(StaticMeshAsset->Sections[Index].MaterialName);
+		// 텍스처 핸들을 지금 받아 두면 렌더 루프에서는 문자열 조회를 하지 않는다
+		if (MaterialList[Index])
+		{
+			MaterialList[Index]->ResolveTextures();
+		}
 	}
 
 	WorldBound = FAABB();
@@ -97,6 +116,14 @@ bool UStaticMeshComponent::IsRayCollided(const FRay& WorldRay, float& ShortestDi
 	return StaticMesh->IsRayCollided(ModelRay, Vertices, Indices);
 }
 
+void UStaticMeshComponent::AddToRenderList(ULevel* Level)
+{
+	if (Level)
+	{
+		Level->AddStaticMeshComponentToRender(this);
+	}
+}
+
 void UStaticMeshComponent::DuplicateSubObjects()
 {
 
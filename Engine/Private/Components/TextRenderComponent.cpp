@@ -1,73 +1,66 @@
 #include "pch.h"
 #include "Components/TextRenderComponent.h"
 #include "Components/PrimitiveComponent.h"
-#include "Render/Renderer/Renderer.h"
+#include "Manager/Resource/ResourceManager.h"
 #include "Level/Level.h"
 #include <string>
 
 IMPLEMENT_CLASS(UTextRenderComponent, UPrimitiveComponent)
 
+namespace
+{
+	uint64 NextGlyphRevision = 1;
+}
+
 UTextRenderComponent::UTextRenderComponent()
 {
-	UResourceManager& ResourceManager = UResourceManager::GetInstance();
 	ComponentType = EComponentType::Text;
 	SetVisibility(true);
 
 	//SetText(L"[크래프톤정글게임테크랩] UID:" + std::to_wstring(GetUUID()));
 }
 
-UTextRenderComponent::~UTextRenderComponent()
+void UTextRenderComponent::BuildGlyphs()
 {
-	if (VertexBuffer)
+	UResourceManager& ResourceManager = UResourceManager::GetInstance();
+	const int32 NumCharacters = static_cast<int32>(Text.size());
+
+	// 기존 정점 배치와 같게 가운데 정렬: 글자 Index는 로컬 Y (Index - N/2) ~ +1 칸을 차지한다
+	Glyphs.resize(NumCharacters);
+	for (int32 Index = 0; Index < NumCharacters; ++Index)
 	{
-		VertexBuffer->Release();
+		FTextGlyphInstance& Glyph = Glyphs[Index];
+		Glyph.Offset = FVector2(static_cast<float>(Index - NumCharacters / 2), 0.0f);
+		Glyph.CharId = ResourceManager.GetCharInfoIdx(Text[Index]);
 	}
 }
 
-void UTextRenderComponent::SetInstanceData(const FWstring& Characters)
+void UTextRenderComponent::SetText(const FWstring& InText)
 {
-	URenderer& Renderer = URenderer::GetInstance();
-	UResourceManager& ResourceManager = UResourceManager::GetInstance();
-	int NumCharacters = Characters.size();
-	TArray<FTextVertex> VertexData;
-	TArray<FTextVertex> VerticesText =
+	if (Text == InText)
 	{
-		// { Position },       U,      V
-		{ {0.0f, -0.5f,  0.5f}, {0.0f,   0.0f} }, // 좌상단
-		{ {0.0f,  0.5f, -0.5f}, {1.0f,   1.0f} }, // 우하단
-		{ {0.0f, -0.5f, -0.5f}, {0.0f,   1.0f} }, // 좌하단
+		return;
+	}
 
-		{ {0.0f,  0.5f, -0.5f}, {1.0f,   1.0f} }, // 우하단
-		{ {0.0f, -0.5f,  0.5f}, {0.0f,   0.0f} }, // 좌상단
-		{ {0.0f,  0.5f,  0.5f}, {1.0f,   0.0f} }, // 우상단
-	};
-	for (int Index = 0; Index < NumCharacters; Index++)
+	// 길이가 같으면 가운데 정렬 위치도 같으므로 바뀐 글자만 고친다
+	if (InText.size() == Text.size())
 	{
-		
-		float OffsetY = (Index - NumCharacters/2);
-		VerticesText[0].Position.Y = OffsetY;
-		VerticesText[1].Position.Y = OffsetY+1;
-		VerticesText[2].Position.Y = OffsetY;
-		VerticesText[3].Position.Y = OffsetY+1;
-		VerticesText[4].Position.Y = OffsetY;
-		VerticesText[5].Position.Y = OffsetY+1;
-		FVector4 Color(1, 1, 1, 1);
-		FVector Offset(0.0f, OffsetY, 0.0f);
-		uint32 CharIdx = ResourceManager.GetCharInfoIdx(Characters[Index]);
-		for (int PIndex = 0; PIndex < 6; PIndex++)
+		UResourceManager& ResourceManager = UResourceManager::GetInstance();
+		for (size_t Index = 0; Index < InText.size(); ++Index)
 		{
-			VerticesText[PIndex].CharId = CharIdx;
+			if (InText[Index] != Text[Index])
+			{
+				Glyphs[Index].CharId = ResourceManager.GetCharInfoIdx(InText[Index]);
+			}
 		}
-		VertexData.Append(VerticesText);
+		Text = InText;
+		GlyphRevision = NextGlyphRevision++;
+		return;
 	}
-	VertexBuffer = Renderer.CreateVertexBuffer(VertexData);
-	VertexNum = static_cast<uint32>(VertexData.size());
-}
 
-void UTextRenderComponent::SetText(const FWstring& InText)
-{
 	Text = InText;
-	SetInstanceData(Text);
+	BuildGlyphs();
+	GlyphRevision = NextGlyphRevision++;
 }
 
 void UTextRenderComponent::AddToRenderList(ULevel* Level)
@@ -0,0 +1,367 @@
+#include "pch.h"
+#include "Components/TransformStore.h"
+#include "Global/ParallelFor.h"
+
+IMPLEMENT_SINGLETON(FTransformStore)
+
+FTransformStore::FTransformStore()
+	: GameThreadId(std::this_thread::get_id())
+{
+}
+
+FTransformStore::~FTransformStore() = default;
+
+namespace
+{
+	/** InOutArray[New] = InOutArray[InOrder[New]] */
+	template <typename T>
+	void Permute(TArray<T>& InOutArray, const TArray<int32>& InOrder)
+	{
+		TArray<T> Sorted;
+		Sorted.reserve(InOrder.size());
+		for (int32 Old : InOrder)
+		{
+			Sorted.push_back(InOutArray[Old]);
+		}
+		InOutArray.swap(Sorted);
+	}
+}
+
+uint32 FTransformStore::Allocate(USceneComponent* InOwner)
+{
+	uint32 Slot;
+	if (!FreeSlots.empty())
+	{
+		Slot = FreeSlots.back();
+		FreeSlots.pop_back();
+	}
+	else
+	{
+		Slot = static_cast<uint32>(SlotToDense.size());
+		SlotToDense.push_back(-1);
+	}
+
+	// 새 항목은 루트로 맨 뒤에 붙는다. 순서는 다음 UpdateWorldMatrices()에서 다시 잡는다
+	SlotToDense[Slot] = static_cast<int32>(Owners.size());
+	Locations.push_back(FVector(0.0f, 0.0f, 0.0f));
+	Rotations.push_back(FQuat::Identity);
+	RotationEulers.push_back(FVector(0.0f, 0.0f, 0.0f));
+	Scales.push_back(FVector(1.0f, 1.0f, 1.0f));
+	WorldMatrices.push_back(FMatrix::Identity);
+	WorldMatrixInverses.push_back(FMatrix::Identity);
+	ParentDense.push_back(-1);
+	Flags.push_back(WorldDirty | InverseDirty);
+	DenseToSlot.push_back(Slot);
+	Owners.push_back(InOwner);
+
+	bOrderDirty = true;
+	return Slot;
+}
+
+void FTransformStore::Free(uint32 InHandle)
+{
+	if (InHandle >= SlotToDense.size() || SlotToDense[InHandle] < 0)
+	{
+		return;
+	}
+
+	// Dense 자리는 다음 정렬 때 걷어낸다
+	const int32 Dense = SlotToDense[InHandle];
+	Owners[Dense] = nullptr;
+	Flags[Dense] = 0;
+	ParentDense[Dense] = -1;
+	++NumFreeDense;
+
+	SlotToDense[InHandle] = -1;
+	FreeSlots.push_back(InHandle);
+	bOrderDirty = true;
+}
+
+void FTransformStore::SetParent(uint32 InHandle, uint32 InParentHandle)
+{
+	ParentDense[DenseIndex(InHandle)] = InParentHandle == InvalidHandle ? -1 : DenseIndex(InParentHandle);
+	bOrderDirty = true;
+}
+
+void FTransformStore::SetRotation(uint32 InHandle, const FQuat& InRotation, const FVector& InRotationEuler)
+{
+	const int32 Dense = DenseIndex(InHandle);
+	Rotations[Dense] = InRotation;
+	RotationEulers[Dense] = InRotationEuler;
+}
+
+const FMatrix& FTransformStore::GetWorldMatrix(uint32 InHandle)
+{
+	const int32 Dense = DenseIndex(InHandle);
+	if (Flags[Dense] & WorldDirty)
+	{
+		// 워커 스레드가 지연 계산하면 다른 스레드가 읽는 행렬과 플래그를 쓰게 된다
+		const bool bGameThread = IsInGameThread();
+		assert(bGameThread && "FTransformStore: 게임 스레드 밖에서 더티 월드 행렬을 읽음 (UpdateWorldMatrices 이후에 읽어야 한다)");
+		if (bGameThread)
+		{
+			ResolveWorld(Dense);
+		}
+	}
+	return WorldMatrices[Dense];
+}
+
+const FMatrix& FTransformStore::GetWorldMatrixInverse(uint32 InHandle)
+{
+	const int32 Dense = DenseIndex(InHandle);
+	if (Flags[Dense] & InverseDirty)
+	{
+		const bool bGameThread = IsInGameThread();
+		assert(bGameThread && "FTransformStore: 게임 스레드 밖에서 더티 역행렬을 읽음 (UpdateWorldMatrices 이후에 읽어야 한다)");
+		if (bGameThread)
+		{
+			ResolveWorldInverse(Dense);
+		}
+	}
+	return WorldMatrixInverses[Dense];
+}
+
+void FTransformStore::ResolveWorld(int32 InDense)
+{
+	// 플래그를 먼저 내려서 부모 순환이 있어도 재귀가 끝나게 한다 (순환 구간은 이전 값을 쓴다)
+	Flags[InDense] &= ~WorldDirty;
+
+	// Local(S * R * T) * ParentWorld, 부모가 더티면 부모부터 채운다
+	FMatrix World = FMatrix::GetModelMatrix(Locations[InDense], Rotations[InDense], Scales[InDense]);
+	const int32 Parent = ParentDense[InDense];
+	if (Parent >= 0)
+	{
+		if (Flags[Parent] & WorldDirty)
+		{
+			ResolveWorld(Parent);
+		}
+		World *= WorldMatrices[Parent];
+	}
+
+	WorldMatrices[InDense] = World;
+}
+
+void FTransformStore::ResolveWorldInverse(int32 InDense)
+{
+	Flags[InDense] &= ~InverseDirty;
+
+	const int32 Parent = ParentDense[InDense];
+	if (Parent >= 0 && (Flags[Parent] & InverseDirty))
+	{
+		ResolveWorldInverse(Parent);
+	}
+	StoreWorldInverse(InDense);
+}
+
+void FTransformStore::StoreWorldInverse(int32 InDense)
+{
+	// (Local * ParentWorld)^-1 = ParentWorld^-1 * Local^-1
+	FMatrix Inverse = FMatrix::GetModelMatrixInverse(Locations[InDense], Rotations[InDense], Scales[InDense]);
+	const int32 Parent = ParentDense[InDense];
+	if (Parent >= 0)
+	{
+		Inverse = WorldMatrixInverses[Parent] * Inverse;
+	}
+
+	WorldMatrixInverses[InDense] = Inverse;
+	Flags[InDense] &= ~InverseDirty;
+}
+
+void FTransformStore::UpdateWorldMatrices()
+{
+	if (bOrderDirty)
+	{
+		SortParentFirst();
+	}
+
+	// 루트에서 닿지 않는 항목(부모 순환)은 정렬 구간 밖에 남으므로 여기서 지연 경로로 채운다
+	for (int32 Dense = NumSorted; Dense < static_cast<int32>(Owners.size()); ++Dense)
+	{
+		if (Owners[Dense] && (Flags[Dense] & WorldDirty))
+		{
+			ResolveWorld(Dense);
+		}
+		if (Owners[Dense] && (Flags[Dense] & InverseDirty))
+		{
+			ResolveWorldInverse(Dense);
+		}
+	}
+
+	const int32 NumRanges = static_cast<int32>(RootRanges.size());
+	if (NumSorted < ParallelThreshold || NumRanges < 2)
+	{
+		UpdateRange(0, NumSorted);
+		return;
+	}
+
+	// 루트 서브트리는 서로 참조하지 않으므로, 항목 수가 비슷하도록 연속된 루트 구간을 묶어 나눠 준다
+	const int32 NumChunks = std::min(NumRanges, GetParallelForThreadCount() * 4);
+	const int32 TargetPerChunk = (NumSorted + NumChunks - 1) / NumChunks;
+
+	TArray<int32> ChunkEnds;
+	ChunkEnds.reserve(NumChunks);
+	for (const auto& [Begin, End] : RootRanges)
+	{
+		const int32 ChunkBegin = ChunkEnds.empty() ? 0 : ChunkEnds.back();
+		if (End - ChunkBegin >= TargetPerChunk)
+		{
+			ChunkEnds.push_back(End);
+		}
+	}
+	if (ChunkEnds.empty() || ChunkEnds.back() != NumSorted)
+	{
+		ChunkEnds.push_back(NumSorted);
+	}
+
+	ParallelFor(static_cast<int32>(ChunkEnds.size()), [this, &ChunkEnds](int32 Chunk)
+		{
+			UpdateRange(Chunk == 0 ? 0 : ChunkEnds[Chunk - 1], ChunkEnds[Chunk]);
+		});
+}
+
+void FTransformStore::UpdateRange(int32 InBegin, int32 InEnd)
+{
+	int32 Index = InBegin;
+	while (Index < InEnd)
+	{
+		if (!(Flags[Index] & WorldDirty))
+		{
+			++Index;
+			continue;
+		}
+
+		// 연속된 더티 구간의 로컬 행렬을 월드 행렬 자리에 한 번에 만든다
+		int32 RunEnd = Index + 1;
+		while (RunEnd < InEnd && (Flags[RunEnd] & WorldDirty))
+		{
+			++RunEnd;
+		}
+		FMatrix::ComposeTRSArray(&Locations[Index], &Rotations[Index], &Scales[Index], &WorldMatrices[Index], RunEnd - Index);
+
+		// 같은 부모를 둔 연속 구간마다 부모 월드 행렬을 곱한다 (부모는 앞쪽에 있어 이미 계산됐다)
+		for (int32 First = Index; First < RunEnd;)
+		{
+			const int32 Parent = ParentDense[First];
+			int32 Last = First + 1;
+			while (Last < RunEnd && ParentDense[Last] == Parent)
+			{
+				++Last;
+			}
+			if (Parent >= 0)
+			{
+				FMatrix::MultiplyArray(&WorldMatrices[First], WorldMatrices[Parent], &WorldMatrices[First], Last - First);
+			}
+			First = Last;
+		}
+
+		for (int32 Dirty = Index; Dirty < RunEnd; ++Dirty)
+		{
+			Flags[Dirty] &= ~WorldDirty;
+		}
+		Index = RunEnd;
+	}
+
+	// 역행렬도 같은 순서로 채운다 → 렌더 워커의 GetWorldMatrixInverse()는 읽기만 한다
+	for (int32 Dense = InBegin; Dense < InEnd; ++Dense)
+	{
+		if (Flags[Dense] & InverseDirty)
+		{
+			StoreWorldInverse(Dense);
+		}
+	}
+}
+
+void FTransformStore::SortParentFirst()
+{
+	const int32 NumDense = static_cast<int32>(Owners.size());
+	auto IsLive = [this](int32 InDense) { return InDense >= 0 && Owners[InDense] != nullptr; };
+
+	// 자식 목록 (CSR, 형제 순서는 기존 Dense 순서 유지)
+	ChildStart.assign(NumDense + 1, 0);
+	for (int32 Dense = 0; Dense < NumDense; ++Dense)
+	{
+		if (IsLive(Dense) && IsLive(ParentDense[Dense]))
+		{
+			++ChildStart[ParentDense[Dense] + 1];
+		}
+	}
+	for (int32 Dense = 0; Dense < NumDense; ++Dense)
+	{
+		ChildStart[Dense + 1] += ChildStart[Dense];
+	}
+	ChildList.resize(ChildStart[NumDense]);
+	TArray<int32> ChildCursor(ChildStart.begin(), ChildStart.end() - 1);
+	for (int32 Dense = 0; Dense < NumDense; ++Dense)
+	{
+		if (IsLive(Dense) && IsLive(ParentDense[Dense]))
+		{
+			ChildList[ChildCursor[ParentDense[Dense]]++] = Dense;
+		}
+	}
+
+	// 루트마다 DFS 전위 순서로 펼친다 → 서브트리 하나가 연속 구간이 된다
+	TArray<int32> OldToNew(NumDense, -1);
+	SortOrder.clear();
+	RootRanges.clear();
+	for (int32 Root = 0; Root < NumDense; ++Root)
+	{
+		if (!IsLive(Root) || IsLive(ParentDense[Root]))
+		{
+			continue;
+		}
+
+		const int32 Begin = static_cast<int32>(SortOrder.size());
+		SortStack.clear();
+		SortStack.push_back(Root);
+		while (!SortStack.empty())
+		{
+			const int32 Dense = SortStack.back();
+			SortStack.pop_back();
+			OldToNew[Dense] = static_cast<int32>(SortOrder.size());
+			SortOrder.push_back(Dense);
+
+			// 첫 자식이 먼저 나오도록 거꾸로 넣는다
+			for (int32 Child = ChildStart[Dense + 1] - 1; Child >= ChildStart[Dense]; --Child)
+			{
+				SortStack.push_back(ChildList[Child]);
+			}
+		}
+		RootRanges.emplace_back(Begin, static_cast<int32>(SortOrder.size()));
+	}
+	NumSorted = static_cast<int32>(SortOrder.size());
+
+	for (int32 Dense = 0; Dense < NumDense; ++Dense)
+	{
+		if (IsLive(Dense) && OldToNew[Dense] < 0)
+		{
+			OldToNew[Dense] = static_cast<int32>(SortOrder.size());
+			SortOrder.push_back(Dense);
+		}
+	}
+
+	TArray<int32> NewParents;
+	NewParents.reserve(SortOrder.size());
+	for (int32 Old : SortOrder)
+	{
+		NewParents.push_back(IsLive(ParentDense[Old]) ? OldToNew[ParentDense[Old]] : -1);
+	}
+	ParentDense.swap(NewParents);
+
+	Permute(Locations, SortOrder);
+	Permute(Rotations, SortOrder);
+	Permute(RotationEulers, SortOrder);
+	Permute(Scales, SortOrder);
+	Permute(WorldMatrices, SortOrder);
+	Permute(WorldMatrixInverses, SortOrder);
+	Permute(Flags, SortOrder);
+	Permute(DenseToSlot, SortOrder);
+	Permute(Owners, SortOrder);
+
+	for (int32 Dense = 0; Dense < static_cast<int32>(DenseToSlot.size()); ++Dense)
+	{
+		SlotToDense[DenseToSlot[Dense]] = Dense;
+	}
+
+	NumFreeDense = 0;
+	bOrderDirty = false;
+}
@@ -3,10 +3,19 @@
 
 #include "Core/Object.h"
 
+#include <random>
+
 using std::stringstream;
 
-// 전역 클래스 레지스트리 초기화
-TArray<UClass*> UClass::AllClasses;
+/**
+ * @brief 전역 클래스 레지스트리
+ * IMPLEMENT_CLASS의 등록 변수가 다른 번역 단위의 정적 초기화 중에 호출하므로 첫 사용 시 생성한다
+ */
+TArray<UClass*>& UClass::GetClassRegistry()
+{
+	static TArray<UClass*> AllClasses;
+	return AllClasses;
+}
 
 /**
  * @brief UClass Constructor
@@ -16,17 +25,48 @@ TArray<UClass*> UClass::AllClasses;
  * @param InConstructor 생성자 함수 포인터
  */
 UClass::UClass(const FString& InName, UClass* InSuperClass, size_t InClassSize, ClassConstructorType InConstructor)
-	: ClassName(InName), SuperClass(InSuperClass), ClassSize(InClassSize), Constructor(InConstructor)
+	: ClassName(InName), SuperClass(InSuperClass), ClassSize(InClassSize), Constructor(InConstructor),
+	  InstancePool(InName, InClassSize)
 {
 	//UE_LOG("UClass: 클래스 등록: %s", ClassName.c_str());
+
+	// 부모의 StaticClass()가 인자로 먼저 평가되므로 부모는 항상 이미 등록돼 있다
+	GetClassRegistry().push_back(this);
+	if (SuperClass && SuperClass != this)
+	{
+		SuperClass->ChildClasses.push_back(this);
+	}
+	RebuildClassIndices();
+}
+
+void UClass::RebuildClassIndices()
+{
+	uint32 NextIndex = 0;
+	for (UClass* Class : GetClassRegistry())
+	{
+		if (!Class->SuperClass || Class->SuperClass == Class)
+		{
+			AssignClassIndices(Class, NextIndex);
+		}
+	}
+}
+
+void UClass::AssignClassIndices(UClass* InClass, uint32& InOutNextIndex)
+{
+	InClass->ClassIndex = InOutNextIndex++;
+	for (UClass* Child : InClass->ChildClasses)
+	{
+		AssignClassIndices(Child, InOutNextIndex);
+	}
+	InClass->SubtreeEnd = InOutNextIndex;
 }
 
 /**
- * @brief 이 클래스가 지정된 클래스의 하위 클래스인지 확인
+ * @brief 이 클래스가 지정된 클래스의 하위 클래스인지 SuperClass 체인을 따라 확인
  * @param OtherClass 확인할 클래스
  * @return 하위 클래스이거나 같은 클래스면 true
  */
-bool UClass::IsChildOf(const UClass* OtherClass) const
+bool UClass::IsChildOfByChainWalk(const UClass* OtherClass) const
 {
 	if (!OtherClass)
 	{
@@ -68,6 +108,48 @@ UObject* UClass::CreateDefaultObject() const
 	return nullptr;
 }
 
+void UClass::BenchmarkCast(int32 InNum, FCastBenchmarkResult& OutResult)
+{
+	OutResult = FCastBenchmarkResult();
+	OutResult.NumQueries = InNum;
+	OutResult.bMatchesChainWalk = true;
+
+	const TArray<UClass*>& Classes = GetClassRegistry();
+	OutResult.NumClasses = static_cast<int32>(Classes.size());
+	if (InNum <= 0 || Classes.empty())
+	{
+		return;
+	}
+
+	// Cast<T>(Object)는 Object->GetClass()->IsChildOf(T::StaticClass())이므로 클래스 쌍으로 비용을 잰다
+	std::mt19937 Random(1234);
+	std::uniform_int_distribution<size_t> ClassDist(0, Classes.size() - 1);
+
+	TArray<std::pair<const UClass*, const UClass*>> Queries(InNum);
+	for (auto& Query : Queries)
+	{
+		Query = { Classes[ClassDist(Random)], Classes[ClassDist(Random)] };
+	}
+
+	TArray<uint8> ChainResults(InNum);
+	const uint64 ChainStart = FPlatformTime::Cycles64();
+	for (int32 Index = 0; Index < InNum; ++Index)
+	{
+		ChainResults[Index] = Queries[Index].first->IsChildOfByChainWalk(Queries[Index].second);
+	}
+	OutResult.ChainWalkMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - ChainStart);
+
+	TArray<uint8> IntervalResults(InNum);
+	const uint64 IntervalStart = FPlatformTime::Cycles64();
+	for (int32 Index = 0; Index < InNum; ++Index)
+	{
+		IntervalResults[Index] = Queries[Index].first->IsChildOf(Queries[Index].second);
+	}
+	OutResult.IntervalMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - IntervalStart);
+
+	OutResult.bMatchesChainWalk = ChainResults == IntervalResults;
+}
+
 ///** UClass 메모리 누수문제로 잠시 기능 제거
 // * @brief 클래스 이름으로 UClass 찾기
 // * @param InClassName 찾을 클래스 이름
@@ -66,6 +66,8 @@ void FClientApp::Tick()
 	auto& ViewportManger = UViewportManager::GetInstance();
 
 
+	// 지난 프레임에 할당한 수/바이트를 확정 (stat memory)
+	FMemoryTracker::MarkFrame();
 	TimeManager.Update();
 
 	Editor->Update();
@@ -144,6 +146,9 @@ int FClientApp::InitializeSystem()
 	UTimeManager::GetInstance();
 	UInputManager::GetInstance();
 
+	// SIMD 경로는 첫 프레임 전에 한 번 결정
+	UE_LOG("CPU Features: SIMD path %s", FCPUFeatures::ToString(FCPUFeatures::GetActiveLevel()));
+
 	// Renderer Initialize
 	auto& Renderer = URenderer::GetInstance();
 	Renderer.Init(Window->GetWindowHandle());
@@ -178,6 +183,7 @@ void FClientApp::UpdateSystem()
 	auto& UiManager = UUIManager::GetInstance();
 	auto& OverlayManager = UOverlayManager::GetInstance();
 	auto& ViewportManager = UViewportManager::GetInstance();
+	FMemoryTracker::MarkFrame();
 	TimeManager.Update();
 	Editor->Update();
 	 
@@ -3,7 +3,6 @@
 #include "Core/EngineStatics.h"
 
 uint32 UEngineStatics::NextUUID = 0;
-TArray<UObject*> GUObjectArray;
 
 IMPLEMENT_CLASS_BASE(UObject)
 
@@ -13,8 +12,7 @@ UObject::UObject() : Outer(nullptr)
 	//Name = FNameTable::GetInstance().GetUniqueName("");
 	Name = FNameTable::GetInstance().GetUniqueName(GetClass()->GetName());
 
-	GUObjectArray.push_back(this);
-	InternalIndex = static_cast<uint32>(GUObjectArray.size()) - 1;
+	ObjectHandle = GUObjectArray.Allocate(this);
 }
 
 UObject::UObject(const FString& InString) : Outer(nullptr)
@@ -22,8 +20,7 @@ UObject::UObject(const FString& InString) : Outer(nullptr)
 	UUID = UEngineStatics::GenUUID();
 	Name = FNameTable::GetInstance().GetUniqueName(InString);
 
-	GUObjectArray.push_back(this);
-	InternalIndex = static_cast<uint32>(GUObjectArray.size()) - 1;
+	ObjectHandle = GUObjectArray.Allocate(this);
 }
 // 소멸자 추가
 UObject::~UObject()
@@ -34,8 +31,33 @@ UObject::~UObject()
 		Outer->RemoveMemoryUsage(AllocatedBytes, AllocatedCounts);
 		Outer = nullptr;
 	}
-	RemoveFromGlobalObjectArray(this);
-	InternalIndex = (uint32)-1;
+	GUObjectArray.Free(ObjectHandle);
+	ObjectHandle = FObjectHandle();
+}
+
+void* UObject::operator new(size_t InSize)
+{
+	return FObjectPool::GetSizedPool(InSize).Allocate();
+}
+
+void* UObject::operator new(size_t InSize, UClass* InClass)
+{
+	// StaticClass()를 다시 선언하지 않은 파생 클래스는 부모 풀보다 클 수 있으므로 크기별 풀로 보낸다
+	if (InClass && InSize <= InClass->GetClassSize())
+	{
+		return InClass->GetInstancePool().Allocate();
+	}
+	return FObjectPool::GetSizedPool(InSize).Allocate();
+}
+
+void UObject::operator delete(void* InMemory)
+{
+	FObjectPool::Free(InMemory);
+}
+
+void UObject::operator delete(void* InMemory, UClass* /*InClass*/)
+{
+	FObjectPool::Free(InMemory);
 }
 
 void UObject::DuplicateSubObjects()
@@ -113,34 +135,3 @@ void UObject::RemoveMemoryUsage(uint64 InBytes, uint32 InCount)
 		Outer->RemoveMemoryUsage(InBytes);
 	}
 }
-
-bool UObject::IsA(const UClass* InClass) const
-{
-	if (!InClass)
-	{
-		return false;
-	}
-
-	return GetClass()->IsChildOf(InClass);
-}
-
-void RemoveFromGlobalObjectArray(UObject* Obj)
-{
-	if (!Obj) return;
-	uint32 idx = Obj->InternalIndex; // private이면 getter 추가하거나 friend 처리
-	if (idx < GUObjectArray.size() && GUObjectArray[idx] == Obj) {
-		UObject* last = GUObjectArray.back();
-		GUObjectArray[idx] = last;
-		last->InternalIndex = idx;
-		GUObjectArray.pop_back();
-	}
-	else {
-		// 인덱스가 꼬였을 때 방어적으로 선형 제거
-		auto it = std::find(GUObjectArray.begin(), GUObjectArray.end(), Obj);
-		if (it != GUObjectArray.end()) {
-			*it = GUObjectArray.back();
-			(*it)->InternalIndex = static_cast<uint32>(it - GUObjectArray.begin());
-			GUObjectArray.pop_back();
-		}
-	}
-}
@@ -0,0 +1,79 @@
+#include "pch.h"
+#include "Core/ObjectArray.h"
+
+FUObjectArray GUObjectArray;
+
+FUObjectArray::~FUObjectArray()
+{
+	// 이 뒤에 소멸하는 정적 오브젝트의 Free()가 해제된 청크를 건드리지 않도록 범위를 비운다
+	NextIndex = 1;
+	NumObjects = 0;
+	for (FObjectItem*& Chunk : Chunks)
+	{
+		delete[] Chunk;
+		Chunk = nullptr;
+	}
+}
+
+FObjectHandle FUObjectArray::Allocate(UObject* InObject)
+{
+	uint32 Index;
+	if (!FreeIndices.empty())
+	{
+		Index = FreeIndices.back();
+		FreeIndices.pop_back();
+	}
+	else
+	{
+		if (NextIndex >= MaxObjects)
+		{
+			assert(!"FUObjectArray: 슬롯 수 초과");
+			return FObjectHandle();
+		}
+
+		Index = NextIndex++;
+		FObjectItem*& Chunk = Chunks[Index / ChunkSize];
+		if (!Chunk)
+		{
+			Chunk = new FObjectItem[ChunkSize];
+		}
+	}
+
+	FObjectItem& Item = GetItem(Index);
+	Item.Object = InObject;
+	++NumObjects;
+	return FObjectHandle{ Index, Item.Generation };
+}
+
+void FUObjectArray::Free(const FObjectHandle& InHandle)
+{
+	if (InHandle.Index == 0 || InHandle.Index >= NextIndex)
+	{
+		return;
+	}
+
+	FObjectItem& Item = GetItem(InHandle.Index);
+	if (Item.Generation != InHandle.Generation || !Item.Object)
+	{
+		return;
+	}
+
+	// 세대를 올려 이 슬롯을 가리키던 핸들/ID를 모두 무효로 만든다
+	Item.Object = nullptr;
+	++Item.Generation;
+	FreeIndices.push_back(InHandle.Index);
+	--NumObjects;
+}
+
+UObject* FUObjectArray::ResolvePickId(uint32 InPickId) const
+{
+	const uint32 Index = InPickId & FObjectHandle::PickIndexMask;
+	if (Index == 0 || Index >= NextIndex)
+	{
+		return nullptr;
+	}
+
+	const FObjectItem& Item = GetItem(Index);
+	const uint32 PickGeneration = InPickId >> FObjectHandle::PickIndexBits;
+	return (Item.Generation & 0xFFu) == PickGeneration ? Item.Object : nullptr;
+}
@@ -0,0 +1,229 @@
+#include "pch.h"
+#include "Core/ObjectPool.h"
+
+#include <new>
+
+namespace
+{
+	size_t AlignUp(size_t InValue, size_t InAlignment)
+	{
+		return (InValue + InAlignment - 1) & ~(InAlignment - 1);
+	}
+
+	TMap<size_t, std::unique_ptr<FObjectPool>>& GetSizedPools()
+	{
+		static TMap<size_t, std::unique_ptr<FObjectPool>> SizedPools;
+		return SizedPools;
+	}
+
+	// 정적 초기화 때 미리 만들어 두어, 런타임에 만들어진 싱글톤들이 소멸하며 오브젝트를 돌려준 뒤에 소멸하게 한다
+	const auto& SizedPoolsEarlyInit = GetSizedPools();
+}
+
+TArray<FObjectPool*>& FObjectPool::GetPoolRegistry()
+{
+	// UClass 정적 초기화 중에 풀이 만들어지므로 첫 사용 시 생성한다
+	static TArray<FObjectPool*> Pools;
+	return Pools;
+}
+
+FObjectPool::FObjectPool(const FString& InName, size_t InObjectSize)
+	: Name(InName)
+{
+	// 자유 목록 포인터를 슬롯에 쓰므로 최소 포인터 크기
+	ObjectStride = AlignUp(InObjectSize > sizeof(void*) ? InObjectSize : sizeof(void*), ObjectAlignment);
+
+	const size_t Usable = SlabSize - sizeof(FSlab);
+	if (ObjectStride <= Usable / 2)
+	{
+		ObjectsPerSlab = static_cast<uint32>(Usable / ObjectStride);
+		SlabBytes = SlabSize;
+	}
+	else
+	{
+		// 슬랩당 하나: 오브젝트는 항상 첫 SlabSize 안에서 시작하므로 하위 비트 마스크로 헤더를 찾을 수 있다
+		ObjectsPerSlab = 1;
+		SlabBytes = AlignUp(sizeof(FSlab) + ObjectStride, SlabSize);
+	}
+
+	GetPoolRegistry().push_back(this);
+}
+
+FObjectPool::~FObjectPool()
+{
+	// 남은 빈 슬랩만 돌려준다. 살아 있는 오브젝트가 있는 슬랩은 그 오브젝트가 해제될 때까지 건드리지 않는다
+	FSlab* Slab = PartialSlabs;
+	while (Slab)
+	{
+		FSlab* Next = Slab->NextPartial;
+		if (Slab->NumLive == 0)
+		{
+			UnlinkPartial(Slab);
+			ReleaseSlab(Slab);
+		}
+		Slab = Next;
+	}
+
+	TArray<FObjectPool*>& Pools = GetPoolRegistry();
+	Pools.erase(std::remove(Pools.begin(), Pools.end(), this), Pools.end());
+}
+
+void* FObjectPool::Allocate()
+{
+	FSlab* Slab = PartialSlabs;
+	if (!Slab)
+	{
+		Slab = CreateSlab();
+		LinkPartial(Slab);
+		++NumEmptySlabs;
+	}
+
+	void* Memory;
+	if (Slab->FreeList)
+	{
+		Memory = Slab->FreeList;
+		Slab->FreeList = *static_cast<void**>(Memory);
+	}
+	else
+	{
+		Memory = GetSlot(Slab, Slab->NumBumped++);
+	}
+
+	if (Slab->NumLive++ == 0)
+	{
+		--NumEmptySlabs;
+	}
+	if (Slab->NumLive == ObjectsPerSlab)
+	{
+		UnlinkPartial(Slab);
+	}
+
+	++TotalAllocations;
+	if (++NumLive > PeakLive)
+	{
+		PeakLive = NumLive;
+	}
+	return Memory;
+}
+
+void FObjectPool::Free(void* InMemory)
+{
+	if (!InMemory)
+	{
+		return;
+	}
+
+	FSlab* Slab = reinterpret_cast<FSlab*>(reinterpret_cast<uintptr_t>(InMemory) & ~(static_cast<uintptr_t>(SlabSize) - 1));
+	Slab->Pool->FreeInSlab(Slab, InMemory);
+}
+
+void FObjectPool::FreeInSlab(FSlab* InSlab, void* InMemory)
+{
+	*static_cast<void**>(InMemory) = InSlab->FreeList;
+	InSlab->FreeList = InMemory;
+	--NumLive;
+
+	if (!InSlab->bInPartialList)
+	{
+		LinkPartial(InSlab);
+	}
+
+	if (--InSlab->NumLive == 0)
+	{
+		// 생성/삭제가 반복될 때 슬랩을 매번 할당하지 않도록 빈 슬랩 하나는 남긴다
+		if (NumEmptySlabs > 0)
+		{
+			UnlinkPartial(InSlab);
+			ReleaseSlab(InSlab);
+		}
+		else
+		{
+			++NumEmptySlabs;
+		}
+	}
+}
+
+FObjectPool::FSlab* FObjectPool::CreateSlab()
+{
+	void* Memory = ::operator new(SlabBytes, std::align_val_t(SlabSize));
+	FSlab* Slab = new (Memory) FSlab();
+	Slab->Pool = this;
+	++NumSlabs;
+	return Slab;
+}
+
+void FObjectPool::ReleaseSlab(FSlab* InSlab)
+{
+	InSlab->~FSlab();
+	::operator delete(InSlab, SlabBytes, std::align_val_t(SlabSize));
+	--NumSlabs;
+}
+
+void FObjectPool::LinkPartial(FSlab* InSlab)
+{
+	// 방금 해제된 슬랩을 앞에 둬서 다음 할당이 캐시에 남아 있는 슬롯을 쓰게 한다
+	InSlab->PrevPartial = nullptr;
+	InSlab->NextPartial = PartialSlabs;
+	if (PartialSlabs)
+	{
+		PartialSlabs->PrevPartial = InSlab;
+	}
+	PartialSlabs = InSlab;
+	InSlab->bInPartialList = true;
+}
+
+void FObjectPool::UnlinkPartial(FSlab* InSlab)
+{
+	if (InSlab->PrevPartial)
+	{
+		InSlab->PrevPartial->NextPartial = InSlab->NextPartial;
+	}
+	else
+	{
+		PartialSlabs = InSlab->NextPartial;
+	}
+	if (InSlab->NextPartial)
+	{
+		InSlab->NextPartial->PrevPartial = InSlab->PrevPartial;
+	}
+	InSlab->PrevPartial = nullptr;
+	InSlab->NextPartial = nullptr;
+	InSlab->bInPartialList = false;
+}
+
+FObjectPoolStats FObjectPool::GetStats() const
+{
+	FObjectPoolStats Stats;
+	Stats.Name = Name;
+	Stats.ObjectSize = static_cast<uint32>(ObjectStride);
+	Stats.NumLive = NumLive;
+	Stats.PeakLive = PeakLive;
+	Stats.NumSlabs = NumSlabs;
+	Stats.Capacity = NumSlabs * ObjectsPerSlab;
+	Stats.ReservedBytes = static_cast<uint64>(NumSlabs) * SlabBytes;
+	Stats.TotalAllocations = TotalAllocations;
+	return Stats;
+}
+
+FObjectPool& FObjectPool::GetSizedPool(size_t InSize)
+{
+	const size_t Stride = AlignUp(InSize, ObjectAlignment);
+	std::unique_ptr<FObjectPool>& Pool = GetSizedPools()[Stride];
+	if (!Pool)
+	{
+		Pool = std::make_unique<FObjectPool>("Sized_" + std::to_string(Stride), Stride);
+	}
+	return *Pool;
+}
+
+void FObjectPool::GatherStats(TArray<FObjectPoolStats>& OutStats)
+{
+	OutStats.clear();
+	for (const FObjectPool* Pool : GetPoolRegistry())
+	{
+		if (Pool->TotalAllocations > 0)
+		{
+			OutStats.push_back(Pool->GetStats());
+		}
+	}
+}
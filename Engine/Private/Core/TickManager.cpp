@@ -0,0 +1,363 @@
+#include "pch.h"
+#include "Core/TickManager.h"
+#include "Global/ParallelFor.h"
+
+namespace
+{
+	constexpr uint8 NumTickGroups = static_cast<uint8>(ETickGroup::Num);
+
+	// 이보다 적으면 워커를 깨우는 비용이 더 크다
+	constexpr int32 MinParallelTicks = 8;
+
+	void RemoveFromArray(TArray<FTickFunction*>& InArray, FTickFunction* InFunction)
+	{
+		InArray.erase(std::remove(InArray.begin(), InArray.end(), InFunction), InArray.end());
+	}
+}
+
+FTickFunction::~FTickFunction()
+{
+	UnRegisterTickFunction();
+
+	for (FTickFunction* Prerequisite : Prerequisites)
+	{
+		RemoveFromArray(Prerequisite->Dependents, this);
+	}
+	for (FTickFunction* Dependent : Dependents)
+	{
+		RemoveFromArray(Dependent->Prerequisites, this);
+	}
+}
+
+void FTickFunction::RegisterTickFunction(FTickManager& InManager)
+{
+	if (!bCanEverTick || Manager == &InManager)
+	{
+		return;
+	}
+	UnRegisterTickFunction();
+
+	Manager = &InManager;
+	TimeUntilNextTick = 0.0f;
+	AccumulatedDeltaTime = 0.0f;
+	Manager->AddRegistered(this);
+}
+
+void FTickFunction::UnRegisterTickFunction()
+{
+	if (Manager)
+	{
+		Manager->RemoveRegistered(this);
+		Manager = nullptr;
+	}
+}
+
+void FTickFunction::SetTickFunctionEnable(bool bInEnabled)
+{
+	if (bEnabled == bInEnabled)
+	{
+		return;
+	}
+	bEnabled = bInEnabled;
+
+	if (Manager)
+	{
+		if (bEnabled)
+		{
+			Manager->AddEnabled(this);
+		}
+		else
+		{
+			Manager->RemoveEnabled(this);
+		}
+	}
+}
+
+void FTickFunction::AddPrerequisite(FTickFunction* InPrerequisite)
+{
+	if (!InPrerequisite || InPrerequisite == this ||
+		std::find(Prerequisites.begin(), Prerequisites.end(), InPrerequisite) != Prerequisites.end())
+	{
+		return;
+	}
+	Prerequisites.push_back(InPrerequisite);
+	InPrerequisite->Dependents.push_back(this);
+}
+
+void FTickFunction::RemovePrerequisite(FTickFunction* InPrerequisite)
+{
+	if (!InPrerequisite)
+	{
+		return;
+	}
+	RemoveFromArray(Prerequisites, InPrerequisite);
+	RemoveFromArray(InPrerequisite->Dependents, this);
+}
+
+void FTickFunction::CopyTickSettings(const FTickFunction& InOther)
+{
+	TickGroup = InOther.TickGroup;
+	TickInterval = InOther.TickInterval;
+	bCanEverTick = InOther.bCanEverTick;
+	bTickInEditor = InOther.bTickInEditor;
+	bRunOnAnyThread = InOther.bRunOnAnyThread;
+	SetTickFunctionEnable(InOther.bEnabled);
+}
+
+FTickManager::~FTickManager()
+{
+	// 레벨보다 오래 사는 틱 함수가 해제된 매니저를 가리키지 않도록 끊는다
+	for (FTickFunction* Function : RegisteredTickFunctions)
+	{
+		Function->Manager = nullptr;
+		Function->RegisteredIndex = -1;
+		Function->EnabledIndex = -1;
+	}
+}
+
+void FTickManager::AddRegistered(FTickFunction* InFunction)
+{
+	InFunction->RegisteredIndex = static_cast<int32>(RegisteredTickFunctions.size());
+	RegisteredTickFunctions.push_back(InFunction);
+
+	if (InFunction->bEnabled)
+	{
+		AddEnabled(InFunction);
+	}
+}
+
+void FTickManager::RemoveRegistered(FTickFunction* InFunction)
+{
+	RemoveEnabled(InFunction);
+
+	const int32 Index = InFunction->RegisteredIndex;
+	if (Index < 0)
+	{
+		return;
+	}
+	FTickFunction* Last = RegisteredTickFunctions.back();
+	RegisteredTickFunctions[Index] = Last;
+	Last->RegisteredIndex = Index;
+	RegisteredTickFunctions.pop_back();
+	InFunction->RegisteredIndex = -1;
+}
+
+void FTickManager::AddEnabled(FTickFunction* InFunction)
+{
+	if (InFunction->EnabledIndex >= 0)
+	{
+		return;
+	}
+	InFunction->EnabledIndex = static_cast<int32>(EnabledTickFunctions.size());
+	EnabledTickFunctions.push_back(InFunction);
+}
+
+void FTickManager::RemoveEnabled(FTickFunction* InFunction)
+{
+	const int32 Index = InFunction->EnabledIndex;
+	if (Index < 0)
+	{
+		return;
+	}
+	FTickFunction* Last = EnabledTickFunctions.back();
+	EnabledTickFunctions[Index] = Last;
+	Last->EnabledIndex = Index;
+	EnabledTickFunctions.pop_back();
+	InFunction->EnabledIndex = -1;
+
+	// 이번 프레임 실행 목록에 남아 있으면 뺀다 (삭제된 액터를 실행하지 않도록)
+	if (bTicking && InFunction->ScheduledFrame == FrameCounter && InFunction->ScheduleIndex >= 0)
+	{
+		Schedule[InFunction->ScheduleIndex] = nullptr;
+		InFunction->ScheduleIndex = -1;
+	}
+}
+
+void FTickManager::Tick(float InDeltaTime, bool bInEditorWorld)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	if (++FrameCounter == 0)
+	{
+		FrameCounter = 1;
+	}
+	bTicking = true;
+
+	// 1) 이번 프레임에 실행할 틱 고르기
+	DueTickFunctions.clear();
+	for (FTickFunction* Function : EnabledTickFunctions)
+	{
+		if (bInEditorWorld && !Function->bTickInEditor)
+		{
+			continue;
+		}
+
+		float DeltaTime = InDeltaTime;
+		if (Function->TickInterval > 0.0f)
+		{
+			Function->AccumulatedDeltaTime += InDeltaTime;
+			Function->TimeUntilNextTick -= InDeltaTime;
+			if (Function->TimeUntilNextTick > 0.0f)
+			{
+				continue;
+			}
+			DeltaTime = Function->AccumulatedDeltaTime;
+			Function->AccumulatedDeltaTime = 0.0f;
+			// 많이 밀렸어도 한 프레임에 한 번만 실행하고, 다음 간격부터 다시 센다
+			Function->TimeUntilNextTick = std::max(Function->TimeUntilNextTick + Function->TickInterval, 0.0f);
+		}
+
+		Function->ScheduledDeltaTime = DeltaTime;
+		Function->DueFrame = FrameCounter;
+		DueTickFunctions.push_back(Function);
+	}
+
+	// 2) 선행 관계로 (단계, 차례) 정하기
+	uint16 MaxWave = 0;
+	for (FTickFunction* Function : DueTickFunctions)
+	{
+		ScheduleTickFunction(Function);
+		MaxWave = std::max(MaxWave, Function->ScheduledWave);
+	}
+
+	// 3) (단계, 차례) 키로 계수 정렬
+	const int32 WavesPerGroup = MaxWave + 1;
+	const int32 NumKeys = NumTickGroups * WavesPerGroup;
+	WaveOffsets.assign(NumKeys + 1, 0);
+	for (const FTickFunction* Function : DueTickFunctions)
+	{
+		++WaveOffsets[Function->ScheduledGroup * WavesPerGroup + Function->ScheduledWave + 1];
+	}
+	for (int32 Key = 0; Key < NumKeys; ++Key)
+	{
+		WaveOffsets[Key + 1] += WaveOffsets[Key];
+	}
+	Schedule.resize(DueTickFunctions.size());
+	for (FTickFunction* Function : DueTickFunctions)
+	{
+		int32& Cursor = WaveOffsets[Function->ScheduledGroup * WavesPerGroup + Function->ScheduledWave];
+		Function->ScheduleIndex = Cursor;
+		Schedule[Cursor++] = Function;
+	}
+	// 위에서 각 키의 시작이 끝으로 밀렸으므로 한 칸씩 되돌린다
+	for (int32 Key = NumKeys; Key > 0; --Key)
+	{
+		WaveOffsets[Key] = WaveOffsets[Key - 1];
+	}
+	WaveOffsets[0] = 0;
+
+	// 4) 실행
+	Stats = FTickStats();
+	for (int32 Key = 0; Key < NumKeys; ++Key)
+	{
+		const int32 Begin = WaveOffsets[Key];
+		const int32 End = WaveOffsets[Key + 1];
+		if (Begin == End)
+		{
+			continue;
+		}
+		Stats.NumTickedPerGroup[Key / WavesPerGroup] += End - Begin;
+		++Stats.NumWaves;
+		RunWave(Begin, End);
+	}
+
+	bTicking = false;
+
+	Stats.NumRegistered = static_cast<uint32>(RegisteredTickFunctions.size());
+	Stats.NumEnabled = static_cast<uint32>(EnabledTickFunctions.size());
+	Stats.NumTicked = static_cast<uint32>(DueTickFunctions.size());
+	Stats.TickMilliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+}
+
+/**
+ * @brief 선행 틱을 먼저 정한 뒤 그보다 한 차례 뒤에 둔다 (이번 프레임에 실행하지 않는 선행 틱은 무시)
+ */
+void FTickManager::ScheduleTickFunction(FTickFunction* InFunction)
+{
+	if (InFunction->ScheduledFrame == FrameCounter)
+	{
+		return;
+	}
+	if (InFunction->bScheduling)
+	{
+		// 순환: 되돌아온 쪽에서는 이 선행 관계를 무시한다
+		return;
+	}
+	InFunction->bScheduling = true;
+
+	uint8 Group = static_cast<uint8>(InFunction->TickGroup);
+	uint16 Wave = 0;
+	for (FTickFunction* Prerequisite : InFunction->Prerequisites)
+	{
+		if (Prerequisite->DueFrame != FrameCounter)
+		{
+			continue;
+		}
+		ScheduleTickFunction(Prerequisite);
+		if (Prerequisite->ScheduledFrame != FrameCounter)
+		{
+			continue;
+		}
+
+		if (Prerequisite->ScheduledGroup > Group)
+		{
+			Group = Prerequisite->ScheduledGroup;
+			Wave = Prerequisite->ScheduledWave + 1;
+		}
+		else if (Prerequisite->ScheduledGroup == Group)
+		{
+			Wave = std::max<uint16>(Wave, Prerequisite->ScheduledWave + 1);
+		}
+	}
+
+	InFunction->ScheduledGroup = Group;
+	InFunction->ScheduledWave = Wave;
+	InFunction->ScheduledFrame = FrameCounter;
+	InFunction->bScheduling = false;
+}
+
+void FTickManager::RunWave(int32 InBegin, int32 InEnd)
+{
+	// 워커에서 돌 수 있는 틱을 먼저 모아 병렬로 실행한다 (이들은 등록/삭제를 하지 않는다)
+	ParallelBatch.clear();
+	for (int32 Index = InBegin; Index < InEnd; ++Index)
+	{
+		if (FTickFunction* Function = Schedule[Index]; Function && Function->bRunOnAnyThread)
+		{
+			ParallelBatch.push_back(Function);
+		}
+	}
+
+	const int32 NumParallel = static_cast<int32>(ParallelBatch.size());
+	if (NumParallel >= MinParallelTicks && GetParallelForThreadCount() > 1)
+	{
+		const int32 NumChunks = std::min(NumParallel, GetParallelForThreadCount() * 4);
+		ParallelFor(NumChunks, [this, NumParallel, NumChunks](int32 Chunk)
+		{
+			const int32 ChunkBegin = NumParallel * Chunk / NumChunks;
+			const int32 ChunkEnd = NumParallel * (Chunk + 1) / NumChunks;
+			for (int32 Index = ChunkBegin; Index < ChunkEnd; ++Index)
+			{
+				ParallelBatch[Index]->ExecuteTick(ParallelBatch[Index]->ScheduledDeltaTime);
+			}
+		});
+		Stats.NumTickedParallel += NumParallel;
+	}
+	else
+	{
+		for (FTickFunction* Function : ParallelBatch)
+		{
+			Function->ExecuteTick(Function->ScheduledDeltaTime);
+		}
+	}
+
+	// 게임 스레드 틱은 앞선 틱이 지운 항목을 건너뛰도록 매번 다시 읽는다
+	for (int32 Index = InBegin; Index < InEnd; ++Index)
+	{
+		FTickFunction* Function = Schedule[Index];
+		if (Function && !Function->bRunOnAnyThread)
+		{
+			Function->ExecuteTick(Function->ScheduledDeltaTime);
+		}
+	}
+}
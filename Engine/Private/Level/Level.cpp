@@ -11,6 +11,37 @@
 #include "Manager/UI/UIManager.h"
 IMPLEMENT_CLASS(ULevel, UObject)
 
+namespace
+{
+	/** 끝에 붙이고 컴포넌트에 인덱스를 기록한다 (이미 등록돼 있으면 무시) */
+	template<typename T>
+	void AddToRenderArray(TArray<T*>& InOutList, T* InComponent, ULevel* InLevel)
+	{
+		if (!InComponent || InComponent->GetRenderLevel())
+		{
+			return;
+		}
+		InComponent->SetRenderListSlot(InLevel, InOutList.Num());
+		InOutList.Add(InComponent);
+	}
+
+	/** 마지막 원소를 빈 자리로 옮기고 줄인다. 옮긴 원소의 인덱스만 바뀐다 */
+	template<typename T>
+	void RemoveFromRenderArray(TArray<T*>& InOutList, T* InComponent)
+	{
+		const int32 Index = InComponent->GetRenderListIndex();
+		if (Index < 0 || Index >= InOutList.Num() || InOutList[Index] != InComponent)
+		{
+			return;
+		}
+
+		T* Last = InOutList.back();
+		InOutList[Index] = Last;
+		Last->SetRenderListSlot(Last->GetRenderLevel(), Index);
+		InOutList.pop_back();
+	}
+}
+
 ULevel::ULevel() = default;
 
 ULevel::ULevel(const FString& InName)
@@ -31,24 +62,19 @@ void ULevel::Init()
 
 void ULevel::Update()
 {
+	MEMORY_TAG_SCOPE(Level);
+
 	// Process Delayed Task
 	ProcessPendingDeletions();
 
 	uint64 AllocatedByte = GetAllocatedBytes();
 	uint32 AllocatedCount = GetAllocatedCount();
-	StaticOctree.Rearrange();
-
-	TextComponentsToRender.clear();
-	BillboardComponentsToRender.clear();
-	StaticMeshComponentsToRender.clear();
-
-	for (auto& Actor : LevelActors)
 	{
-		if (Actor)
-		{
-			UpdateComponentsToRender(Actor);
-		}
-	} 
+		MEMORY_TAG_SCOPE(Octree);
+		StaticOctree.Rearrange(DT);
+	}
+
+	// 렌더 리스트는 컴포넌트 생성/표시/삭제 시점에 갱신되므로 여기서 다시 만들지 않는다
 }
 
 void ULevel::Render()
@@ -58,80 +84,103 @@ void ULevel::Render()
 void ULevel::Cleanup()
 {
 	UUIManager::GetInstance().SetSelectedActor(nullptr);
-	// 지연 삭제 먼저
-	for (AActor*& A : ActorsToDelete)
+
+	// 모든 액터 삭제 (지연 삭제 대기 액터도 목록에 있으므로 대기 목록은 비우기만 한다. 두 번 지우지 않도록)
+	TArray<AActor*> Actors = LevelActors.ReleaseAll();
+	for (AActor*& A : Actors)
 	{
 		A->SetLevel(nullptr);         // 역참조 해제
 		RemoveFromRenderQueues(A);
 		SafeDelete(A);
 	}
-	ActorsToDelete.clear();
 
-	// 모든 액터 삭제
-	for (AActor*& A : LevelActors)
+	// 액터 밖에서 남은 컴포넌트가 이 레벨을 가리키지 않도록 끊고 비운다
+	for (UStaticMeshComponent* Component : StaticMeshComponentsToRender)
 	{
-		A->SetLevel(nullptr);         // 역참조 해제
-		RemoveFromRenderQueues(A);
-		SafeDelete(A);
+		Component->SetRenderListSlot(nullptr, -1);
+	}
+	for (UTextRenderComponent* Component : TextComponentsToRender)
+	{
+		Component->SetRenderListSlot(nullptr, -1);
+	}
+	for (UBillboardComponent* Component : BillboardComponentsToRender)
+	{
+		Component->SetRenderListSlot(nullptr, -1);
 	}
-	LevelActors.clear();
+	StaticMeshComponentsToRender.clear();
 	TextComponentsToRender.clear();
+	BillboardComponentsToRender.clear();
 	StaticOctree.clear();
 }
 
-void ULevel::UpdateComponentsToRender(AActor* Actor)
+void ULevel::AddToOctree(UPrimitiveComponent* Component)
 {
-    if (!Actor)
-    {
-        return;
-    }
-    for (auto& Component : Actor->GetOwnedComponents())
-    {
-        
-        if (Component->IsA(UPrimitiveComponent::StaticClass()))
-        {
+    MEMORY_TAG_SCOPE(Octree);
+    StaticOctree.AddElement(Component, 0);
+}
 
-            UPrimitiveComponent* PrimitiveComponent = static_cast<UPrimitiveComponent*>(Component);
-			if (!PrimitiveComponent->IsVisible())
-			{
-				continue;
-			}
-          /*  if ( PrimitiveComponent->IsMoved())
-            {
-				StaticOctree.UpdateElement(PrimitiveComponent);
-				PrimitiveComponent->NotMove();
-            }*/
-			if (Component->IsA(UTextRenderComponent::StaticClass()))
-			{
-				UTextRenderComponent* TextComponent = static_cast<UTextRenderComponent*>(Component);
-				
-				TextComponentsToRender.Add(TextComponent);
-			}
-			if (Component->IsA(UStaticMeshComponent::StaticClass()))
-			{
-				StaticMeshComponentsToRender.Add(static_cast<UStaticMeshComponent*>(Component));
-			}
-			// Billboard
-			if (Component->IsA(UBillboardComponent::StaticClass()))
-			{
-				BillboardComponentsToRender.Add(static_cast<UBillboardComponent*>(Component));
-			}
-        }
-		
-    }
+void ULevel::AddBillboardComponentToRender(UBillboardComponent* Component)
+{
+	AddToRenderArray(BillboardComponentsToRender, Component, this);
 }
 
-void ULevel::AddToOctree(UPrimitiveComponent* Component)
+void ULevel::AddStaticMeshComponentToRender(UStaticMeshComponent* Component)
 {
-    StaticOctree.AddElement(Component, 0);
+	AddToRenderArray(StaticMeshComponentsToRender, Component, this);
 }
 
-void ULevel::AddBillboardComponentToRender(UBillboardComponent* Component)
+void ULevel::RegisterComponentForRender(UPrimitiveComponent* Component)
 {
-    if (Component)
-    {
-        BillboardComponentsToRender.Add(Component);
-    }
+	if (!Component || !Component->IsVisible() || Component->GetRenderLevel() == this)
+	{
+		return;
+	}
+	if (ULevel* PreviousLevel = Component->GetRenderLevel())
+	{
+		PreviousLevel->UnregisterComponentForRender(Component);
+	}
+
+	// 타입별 리스트 선택은 각 컴포넌트의 AddToRenderList가 한다
+	Component->AddToRenderList(this);
+}
+
+void ULevel::UnregisterComponentForRender(UPrimitiveComponent* Component)
+{
+	if (!Component || Component->GetRenderLevel() != this)
+	{
+		return;
+	}
+
+	switch (Component->GetComponentType())
+	{
+	case EComponentType::StaticMesh:
+		RemoveFromRenderArray(StaticMeshComponentsToRender, static_cast<UStaticMeshComponent*>(Component));
+		break;
+	case EComponentType::Text:
+		RemoveFromRenderArray(TextComponentsToRender, static_cast<UTextRenderComponent*>(Component));
+		break;
+	case EComponentType::Billboard:
+		RemoveFromRenderArray(BillboardComponentsToRender, static_cast<UBillboardComponent*>(Component));
+		break;
+	default:
+		break;
+	}
+	Component->SetRenderListSlot(nullptr, -1);
+}
+
+void ULevel::RegisterActorComponentsForRender(AActor* InActor)
+{
+	if (!InActor)
+	{
+		return;
+	}
+	for (UActorComponent* Component : InActor->GetOwnedComponents())
+	{
+		if (Component && Component->IsA(UPrimitiveComponent::StaticClass()))
+		{
+			RegisterComponentForRender(static_cast<UPrimitiveComponent*>(Component));
+		}
+	}
 }
 
 void ULevel::AddActor(AActor* InActor)
@@ -140,10 +189,12 @@ void ULevel::AddActor(AActor* InActor)
     {
         return;
     }
+    MEMORY_TAG_SCOPE(Level);
+
     // Rebase ownership to this level
     InActor->SetOuter(this);
     InActor->SetLevel(this);
-    LevelActors.push_back(InActor);
+    LevelActors.Add(InActor);
 
     // Register primitives in octree (root and child primitives)
     USceneComponent* Root = InActor->GetRootComponent();
@@ -158,10 +209,53 @@ void ULevel::AddActor(AActor* InActor)
             AddToOctree(static_cast<UPrimitiveComponent*>(Comp));
         }
     }
+
+    RegisterActorComponentsForRender(InActor);
+    RegisterActorTickFunctions(InActor);
+}
+
+void ULevel::RegisterActorTickFunctions(AActor* InActor)
+{
+	if (!InActor)
+	{
+		return;
+	}
+
+	FTickFunction& ActorTick = InActor->PrimaryActorTick;
+	ActorTick.RegisterTickFunction(TickManager);
+	for (UActorComponent* Component : InActor->GetOwnedComponents())
+	{
+		if (Component && Component->PrimaryComponentTick.bCanEverTick)
+		{
+			Component->PrimaryComponentTick.RegisterTickFunction(TickManager);
+			if (ActorTick.IsTickFunctionRegistered())
+			{
+				Component->PrimaryComponentTick.AddPrerequisite(&ActorTick);
+			}
+		}
+	}
+}
+
+void ULevel::UnregisterActorTickFunctions(AActor* InActor)
+{
+	if (!InActor)
+	{
+		return;
+	}
+
+	InActor->PrimaryActorTick.UnRegisterTickFunction();
+	for (UActorComponent* Component : InActor->GetOwnedComponents())
+	{
+		if (Component)
+		{
+			Component->PrimaryComponentTick.UnRegisterTickFunction();
+		}
+	}
 }
 
 void ULevel::NewOctree(const FAABB& OctreeSize)
 {
+	MEMORY_TAG_SCOPE(Octree);
 	StaticOctree.NewOctree(OctreeSize);
 }
 
@@ -172,7 +266,7 @@ UPrimitiveComponent* ULevel::GetPrimitiveCollided(const FRay& WorldRay, float& S
 
 void ULevel::AddTextComponentToRender(UTextRenderComponent* Component)
 {
-	TextComponentsToRender.push_back(Component);
+	AddToRenderArray(TextComponentsToRender, Component, this);
 }
 
 
@@ -185,55 +279,81 @@ bool ULevel::IsActorValid(AActor* InActor) const
 		return false;
 	}
 	// Actor가 자신의 Level 포인터를 가진다면 가장 빠른 1차 필터
-	if (InActor->GetLevel() != this)  // (있다면 사용)
+	if (InActor->GetLevel() != this)
 	{
 		return false;                    
 	}
-	if (std::find(LevelActors.begin(), LevelActors.end(), InActor) == LevelActors.end())
+	// 찾지 않고 액터가 들고 있는 슬롯과 삭제 대기 플래그만 확인한다
+	return LevelActors.IsValid(InActor);
+}
+
+/**
+ * @brief Level에서 Actor 제거하는 함수
+ */
+bool ULevel::DestroyActor(AActor* InActor)
+{
+	if (!InActor)
 	{
 		return false;
 	}
 
-	if (std::find(ActorsToDelete.begin(), ActorsToDelete.end(), InActor) != ActorsToDelete.end())
+	if (DestroyActors({ InActor }) == 0)
 	{
+		UE_LOG("Level: DestroyActor: Actor Is Not In This Level");
 		return false;
 	}
+
+	UE_LOG("Level: Actor Destroyed Successfully");
 	return true;
 }
 
-
-
-/**
- * @brief Level에서 Actor 제거하는 함수
- */
-bool ULevel::DestroyActor(AActor* InActor)
+int32 ULevel::DestroyActors(const TArray<AActor*>& InActors)
 {
-	if (!InActor)
+	MEMORY_TAG_SCOPE(Level);
+
+	// 1) LevelActors에서 교체 삭제 (다른 레벨의 액터와 중복은 걸러지고, 삭제 대기 목록에서도 빠진다)
+	TArray<AActor*> Destroyed;
+	LevelActors.RemoveBatch(InActors, Destroyed);
+	if (Destroyed.empty())
 	{
-		return false;
+		return 0;
 	}
-	RemoveFromRenderQueues(InActor);
-	// LevelActors 리스트에서 제거
-	for (auto Iterator = LevelActors.begin(); Iterator != LevelActors.end(); ++Iterator)
+
+	// 2) 렌더 리스트와 틱은 액터마다 O(1) 해제, 옥트리는 모아서 한 번에 지운다
+	TArray<UPrimitiveComponent*> OctreeElements;
+	UUIManager& Manager = UUIManager::GetInstance();
+	const AActor* CurrentSelection = Manager.GetSelectedActor();
+	bool bSelectedDestroyed = false;
+	for (AActor* Actor : Destroyed)
 	{
-		if (*Iterator == InActor)
+		RemoveFromRenderQueues(Actor);
+		UnregisterActorTickFunctions(Actor);
+		for (UActorComponent* Component : Actor->GetOwnedComponents())
 		{
-			LevelActors.erase(Iterator);
-			break;
+			if (Component && Component->IsA(UPrimitiveComponent::StaticClass()))
+			{
+				OctreeElements.push_back(static_cast<UPrimitiveComponent*>(Component));
+			}
 		}
+		bSelectedDestroyed |= Actor == CurrentSelection;
 	}
-
-	UUIManager& Manager = UUIManager::GetInstance();
-	if (InActor == Manager.GetSelectedActor())
+	{
+		MEMORY_TAG_SCOPE(Octree);
+		StaticOctree.RemoveElements(OctreeElements);
+	}
+	if (bSelectedDestroyed)
 	{
 		Manager.SetSelectedActor(nullptr);
 	}
 
-	// Remove
-	SafeDelete(InActor);
+	// 3) 메모리 해제 (오브젝트 배열 슬롯과 풀 블록은 UObject 소멸자가 돌려준다)
+	for (AActor* Actor : Destroyed)
+	{
+		Actor->SetLevel(nullptr);
+		SafeDelete(Actor);
+	}
 
-	UE_LOG("Level: Actor Destroyed Successfully");
-	return true;
+	return Destroyed.Num();
 }
 
 /**
@@ -248,20 +368,24 @@ void ULevel::MarkActorForDeletion(AActor* InActor)
 	}
 
 	// 이미 삭제 대기 중인지 확인
-	for (AActor* PendingActor : ActorsToDelete)
+	if (InActor->IsPendingKill())
 	{
-		if (PendingActor == InActor)
-		{
-			UE_LOG("Level: Actor Already Marked For Deletion");
-			return;
-		}
+		UE_LOG("Level: Actor Already Marked For Deletion");
+		return;
+	}
+	if (!LevelActors.Contains(InActor))
+	{
+		UE_LOG("Level: MarkActorForDeletion: Actor Is Not In This Level");
+		return;
 	}
 
 	RemoveFromRenderQueues(InActor);
+	// 삭제는 다음 프레임이지만 틱은 지금부터 멈춘다
+	UnregisterActorTickFunctions(InActor);
 
 	UUIManager::GetInstance().SetSelectedActor(nullptr);
 	// 삭제 대기 리스트에 추가
-	ActorsToDelete.push_back(InActor);
+	LevelActors.MarkPendingKill(InActor);
 	UE_LOG("Level: Actor Marked For Deletion In Next Tick: %p", InActor);
 }
 
@@ -311,64 +435,35 @@ void ULevel::TryApplySavedCameraSnapshot()
  */
 void ULevel::ProcessPendingDeletions()
 {
-	if (ActorsToDelete.empty())
+	if (LevelActors.NumPendingKill() == 0)
 	{
 		return;
 	}
 
-	UE_LOG("[Level] Processing %zu Pending Deletions", ActorsToDelete.size());
+	UE_LOG("[Level] Processing %d Pending Deletions", LevelActors.NumPendingKill());
 
-	// 대기 중인 액터들을 삭제
-	for (AActor* ActorToDelete : ActorsToDelete)
-	{
-		if (!ActorToDelete)
-			continue;
-
-		// LevelActors 리스트에서 제거
-		for (auto Iterator = LevelActors.begin(); Iterator != LevelActors.end(); ++Iterator)
-		{
-			if (*Iterator == ActorToDelete)
-			{
-				LevelActors.erase(Iterator);
-				break;
-			}
-		}
+	// 대기 중인 액터들을 한 번에 삭제 (목록을 꺼내 두어 DestroyActors가 대기 목록을 다시 훑지 않게 한다)
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	const TArray<AActor*> PendingActors = LevelActors.TakePendingKill();
+	const int32 NumDestroyed = DestroyActors(PendingActors);
 
-		// Release Memory
-		SafeDelete(ActorToDelete);
-		UE_LOG("[Level] Actor Deleted: %p", ActorToDelete);
-	}
-
-	// Clear TArray
-	ActorsToDelete.clear();
-	UE_LOG("[Level] All Pending Deletions Processed");
+	UE_LOG("[Level] %d Pending Deletions Processed (%.3f ms)", NumDestroyed,
+		FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
 }
 
 void ULevel::RemoveFromRenderQueues(AActor* Owner)
 {
 	if (!Owner) return;
 
-	StaticMeshComponentsToRender.erase(
-		std::remove_if(StaticMeshComponentsToRender.begin(), StaticMeshComponentsToRender.end(),
-			[Owner](UStaticMeshComponent* C) { return C && C->GetOuter() == Owner; }),
-		StaticMeshComponentsToRender.end());
-
-	TextComponentsToRender.erase(
-		std::remove_if(TextComponentsToRender.begin(), TextComponentsToRender.end(),
-			[Owner](UTextRenderComponent* C) { return C && C->GetOuter() == Owner; }),
-		TextComponentsToRender.end());
-
-	BillboardComponentsToRender.erase(
-		std::remove_if(BillboardComponentsToRender.begin(), BillboardComponentsToRender.end(),
-			[Owner](UBillboardComponent* C) { return C && C->GetOuter() == Owner; }),
-		BillboardComponentsToRender.end());
-
-
-	//옥트리에서도 제거, 이거 안 하면 dangling 포인터 참조
-	/*for (UActorComponent* Component : Owner->GetOwnedComponents())
+	for (UActorComponent* Component : Owner->GetOwnedComponents())
 	{
-		StaticOctree.RemoveElement(Cast<UPrimitiveComponent>(Component));
-	}*/
+		if (Component && Component->IsA(UPrimitiveComponent::StaticClass()))
+		{
+			UnregisterComponentForRender(static_cast<UPrimitiveComponent*>(Component));
+		}
+	}
+
+	// 옥트리 제거는 DestroyActors에서 모아서 한 번에 한다 (삭제 대기 중에는 피킹될 수 있음)
 }
 
 
@@ -378,5 +473,5 @@ bool ULevel::IsPendingDeletion(AActor* InActor) const
 	{
 		return false;
 	}
-	return std::find(ActorsToDelete.begin(), ActorsToDelete.end(), InActor) != ActorsToDelete.end();
+	return InActor->IsPendingKill();
 }
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Manager/Level/World.h"
 #include "Core/EngineStatics.h"
+#include "Core/ObjectIterator.h"
 
 #include "Level/Level.h"
 #include "Manager/Path/PathManager.h"
@@ -62,42 +63,23 @@ void UWorld::Tick()
 		CurrentLevel->Update();
 	}
 	   
-	// Editor Tick  
-	if (GWorld && GWorld->GetWorldType() == EWorldType::Editor)
+	// 레벨 틱 매니저에 등록된 틱만 실행한다. 에디터 월드에서는 bTickInEditor인 것만
+	if (GWorld && GWorld->GetCurrentLevel())
 	{
-		ULevel* Level = GWorld->GetCurrentLevel();
-		if (Level != nullptr)
+		const EWorldType Type = GWorld->GetWorldType();
+		if (Type == EWorldType::Editor || Type == EWorldType::PIE)
 		{
-			for (AActor* Actor : Level->GetLevelActors())
-			{
-				if (Actor && Actor->IsTickInEditor())
-				{
-					Actor->Tick();
-				}
-			}
+			GWorld->GetCurrentLevel()->GetTickManager().Tick(DT, Type == EWorldType::Editor);
 		}
 	}
-
-	//PIE Tick
-	else if (GWorld && GWorld->GetWorldType() == EWorldType::PIE)
-	{
-		ULevel* Level = GWorld->GetCurrentLevel();
-		{
-			for (AActor* Actor : Level->GetLevelActors())
-			{
-				if (Actor)
-				{
-					Actor->Tick();
-				}
-			}
-		} 
-	}
 }
 /**
  * @brief New Blank Level 생성
  */
 bool UWorld::CreateNewLevel(const FString& InLevelName)
 {
+	MEMORY_TAG_SCOPE(Level);
+
 	UE_LOG("LevelManager: Creating New Level: %s", InLevelName.c_str());
 	// 이전 씬 완전 정리
 	ClearAllLevels();
@@ -172,6 +154,8 @@ bool UWorld::SaveCurrentLevel(const FString& InFilePath) const
  */
 bool UWorld::LoadLevel(const FString& InLevelName, const FString& InFilePath)
 {
+	MEMORY_TAG_SCOPE(Level);
+
 	UE_LOG("LevelManager: Loading Level '%s' From: %s", InLevelName.c_str(), InFilePath.c_str());
 
 	// 1) 이전 씬 완전 정리(+UUID/Name 리셋)
@@ -225,7 +209,14 @@ bool UWorld::LoadLevel(const FString& InLevelName, const FString& InFilePath)
 }
 void UWorld::ClearAllLevels()
 {
-	FNameTable::GetInstance().Reset();      // 이름/넘버링 초기화
+	// 현재 액터 클래스 이름들의 넘버링을 0부터 다시 시작한다
+	for (TObjectIterator<AActor> It; It; ++It)
+	{
+		if (AActor* Actor = *It)
+		{
+			FNameTable::GetInstance().ResetNumber(Actor->GetClass()->GetName());
+		}
+	}
 	// 1) 현재 레벨 포함 모든 레벨 파괴
 	if (CurrentLevel)
 	{
@@ -430,6 +421,8 @@ bool UWorld::LoadLevelFromMetadata(ULevel* InLevel, const FLevelMetadata& InMeta
 
 UWorld* UWorld::DuplicateWorldForPIE(UWorld* EditorWorld)
 {
+	MEMORY_TAG_SCOPE(Level);
+
 	//TODO 싱글톤해제 시켜야 됨 
 	UWorld* Dst = NewObject<UWorld>();
 	Dst->Init(EWorldType::PIE);
@@ -459,8 +452,12 @@ void UWorld::InitializeActorsForPlay()
 	if (!DupLevel) return;
 
 	//Actor 초기화
-	for (AActor* Actor : DupLevel->GetLevelActors())
+	//GetLevelActors는 복사본이 아니므로 BeginPlay 중 스폰에 대비해 인덱스로 돈다 (새 액터는 스폰 때 BeginPlay를 이미 받음)
+	const TArray<AActor*>& Actors = DupLevel->GetLevelActors();
+	const int32 NumActors = Actors.Num();
+	for (int32 Index = 0; Index < NumActors; ++Index)
 	{
+		AActor* Actor = Actors[Index];
 		if (Actor == nullptr) continue;
 
 		Actor->BeginPlay();
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Manager/Level/World.h"
 #include "Core/EngineStatics.h"
+#include "Core/ObjectIterator.h"
 
 #include "Level/Level.h"
 #include "Manager/Path/PathManager.h"
@@ -196,7 +197,14 @@ bool UWorld::LoadLevel(const FString& InLevelName, const FString& InFilePath)
 }
 void UWorld::ClearAllLevels()
 {
-	FNameTable::GetInstance().Reset();      // 이름/넘버링 초기화
+	// 현재 액터 클래스 이름들의 넘버링을 0부터 다시 시작한다
+	for (TObjectIterator<AActor> It; It; ++It)
+	{
+		if (AActor* Actor = *It)
+		{
+			FNameTable::GetInstance().ResetNumber(Actor->GetClass()->GetName());
+		}
+	}
 	// 1) 현재 레벨 포함 모든 레벨 파괴
 	if (CurrentLevel)
 	{
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Manager/Overlay/OverlayManager.h"
 #include "Render/Renderer/Renderer.h"
+#include "Render/Renderer/Pipeline.h"
 
 #pragma comment(lib, "d2d1")
 #pragma comment(lib, "dwrite")
@@ -24,7 +25,7 @@ void UOverlayManager::Release()
 }
 void UOverlayManager::RenderOverlay()
 {	
-	if (CurrentOverlayType == EOverlayType::NONE)
+	if (CurrentOverlayType == EOverlayType::NONE && !bShowRenderStats && !bShowMemoryStats)
 	{
 		return;
 	}
@@ -67,23 +68,24 @@ void UOverlayManager::RenderOverlay()
 	switch (CurrentOverlayType)
 	{
 	case EOverlayType::FPS:
-		RenderFPSOverlay();
-		break;
-	
-	case EOverlayType::Memory:
-		//RenderMemoryOverlay();
-		UE_LOG("Have to Add Memory Layout");
-		break;
-	
 	case EOverlayType::All:
 		RenderFPSOverlay();
-		UE_LOG("Have to Add Memory Layout");
-		//RenderMemoryOverlay();
 		break;
-	
+
 	default:
 		break;
 	}
+
+	// FPS 오버레이(3줄) 아래에 통계 블록을 차례로 쌓는다
+	float StartY = OVERLAY_MARGIN_Y + OVERLAY_LINE_HEIGHT * (CurrentOverlayType == EOverlayType::FPS || CurrentOverlayType == EOverlayType::All ? 3 : 0);
+	if (bShowRenderStats)
+	{
+		StartY = RenderStatsOverlay(StartY);
+	}
+	if (bShowMemoryStats || CurrentOverlayType == EOverlayType::Memory || CurrentOverlayType == EOverlayType::All)
+	{
+		RenderMemoryOverlay(StartY);
+	}
 	
 	HRESULT ResultHandle = D2DRenderTarget->EndDraw();
 	if (FAILED(ResultHandle))
@@ -394,12 +396,63 @@ void UOverlayManager::RenderFPSOverlay() const
 	wchar_t PickingTimeText[256];
 	(void)swprintf_s(PickingTimeText, L"Picking Time %fms : Num Attemps %d : Accumulated Time %fms", FWindowsPlatformTime::ToMilliseconds(LastPickTime)
 	,TotalPickCount, FWindowsPlatformTime::ToMilliseconds(TotalPickTime));
+	wchar_t SIMDText[64];
+	(void)swprintf_s(SIMDText, L"SIMD: %hs", FCPUFeatures::ToString(FCPUFeatures::GetActiveLevel()));
 
 
 	uint32 RenderColor = GetFPSColor(CurrentFPS);
 	DrawText(FPSInfoText, OVERLAY_MARGIN_X, OVERLAY_MARGIN_Y, RenderColor);
 	DrawText(GameTimeInfoText, OVERLAY_MARGIN_X+120, OVERLAY_MARGIN_Y, RenderColor);
 	DrawText(PickingTimeText, OVERLAY_MARGIN_X, OVERLAY_MARGIN_Y + OVERLAY_LINE_HEIGHT, RenderColor);
+	DrawText(SIMDText, OVERLAY_MARGIN_X, OVERLAY_MARGIN_Y + OVERLAY_LINE_HEIGHT * 2, RenderColor);
+}
+
+float UOverlayManager::RenderStatsOverlay(float InStartY) const
+{
+	if (!TextBrush || !TextFormat)
+	{
+		return InStartY;
+	}
+
+	// 이번 프레임은 아직 그리는 중이므로 지난 프레임 값을 표시
+	TArray<FString> Lines;
+	FRenderStats::FormatLines(URenderer::GetInstance().GetRenderStats().GetLastFrame(), Lines);
+	return DrawLines(Lines, InStartY);
+}
+
+float UOverlayManager::RenderMemoryOverlay(float InStartY) const
+{
+	if (!TextBrush || !TextFormat)
+	{
+		return InStartY;
+	}
+
+	FMemoryStats MemoryStats;
+	FMemoryTracker::GetStats(MemoryStats);
+	TArray<FString> Lines;
+	FMemoryTracker::FormatLines(MemoryStats, Lines);
+	return DrawLines(Lines, InStartY);
+}
+
+float UOverlayManager::DrawLines(const TArray<FString>& InLines, float InStartY) const
+{
+	for (int32 Index = 0; Index < InLines.Num(); ++Index)
+	{
+		wchar_t LineText[256];
+		(void)swprintf_s(LineText, L"%hs", InLines[Index].c_str());
+		DrawText(LineText, OVERLAY_MARGIN_X, InStartY + OVERLAY_LINE_HEIGHT * Index, 0xFFFFFFFF);
+	}
+	return InStartY + OVERLAY_LINE_HEIGHT * InLines.Num();
+}
+
+void UOverlayManager::SetRenderStatsVisible(bool bInVisible)
+{
+	bShowRenderStats = bInVisible;
+}
+
+void UOverlayManager::SetMemoryStatsVisible(bool bInVisible)
+{
+	bShowMemoryStats = bInVisible;
 }
 
 void UOverlayManager::DrawText(const wchar_t* InText, float InX, float InY, uint32 InColor) const
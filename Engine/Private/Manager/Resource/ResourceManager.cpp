@@ -16,6 +16,8 @@ UResourceManager::~UResourceManager() = default;
 
 void UResourceManager::Initialize()
 {
+	MEMORY_TAG_SCOPE(Assets);
+
 	URenderer& Renderer = URenderer::GetInstance();
 	FObjManager& ObjManager = FObjManager::GetInstance();
 	//ObjManager는 Obj뿐만 아니라 material도 관리함. material만 따로 필요한 경우가 있음(지금은 아무런 정보 없는, WhiteSpace material이 필요)
@@ -50,45 +52,12 @@ void UResourceManager::Initialize()
 
 	CreateTextSampler();
 
-    CreateStaticMeshShader();
-    CreateDefaultShader();
-    CreateTextShader();
-    // Billboard/texture shader
-    {
-        ID3DBlob* VertexShaderCSO = nullptr;
-        ID3DBlob* PixelShaderCSO = nullptr;
-
-        ID3D11VertexShader* VertexShader = nullptr;
-        ID3D11PixelShader* PixelShader = nullptr;
-        ID3D11InputLayout* InputLayout = nullptr;
-
-        D3DCompileFromFile(L"Asset/Shader/TextureShader.hlsl", nullptr, nullptr, "mainVS", "vs_5_0", 0, 0,
-            &VertexShaderCSO, nullptr);
-        Renderer.GetDevice()->CreateVertexShader(VertexShaderCSO->GetBufferPointer(),
-            VertexShaderCSO->GetBufferSize(), nullptr, &VertexShader);
-
-        D3DCompileFromFile(L"Asset/Shader/TextureShader.hlsl", nullptr, nullptr, "mainPS", "ps_5_0", 0, 0,
-            &PixelShaderCSO, nullptr);
-        Renderer.GetDevice()->CreatePixelShader(PixelShaderCSO->GetBufferPointer(),
-            PixelShaderCSO->GetBufferSize(), nullptr, &PixelShader);
-
-        D3D11_INPUT_ELEMENT_DESC Layout[] =
-        {
-            {"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0,  D3D11_INPUT_PER_VERTEX_DATA, 0},
-            {"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,    0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0},
-        };
-        Renderer.GetDevice()->CreateInputLayout(Layout, ARRAYSIZE(Layout), VertexShaderCSO->GetBufferPointer(),
-            VertexShaderCSO->GetBufferSize(), &InputLayout);
-
-        FShader Shader;
-        Shader.InputLayout = InputLayout;
-        Shader.VertexShader = VertexShader;
-        Shader.PixelShader  = PixelShader;
-        Shaders.emplace(EShaderType::TextureShader, Shader);
-
-        if (VertexShaderCSO) VertexShaderCSO->Release();
-        if (PixelShaderCSO)  PixelShaderCSO->Release();
-    }
+	CreateStaticMeshShader();
+	CreateDefaultShader();
+	CreateTextShader();
+	CreateTextureShader();
+	UE_LOG("Shader Cache: %u hit, %u compiled (%s)", NumShaderCacheHits, NumShaderCompiles,
+		ShaderCache.GetCacheDirectory().c_str());
 }
 
 void UResourceManager::Release()
@@ -113,18 +82,15 @@ void UResourceManager::Release()
 		Pair.second->Release();
 	}
 	SamplerStates.clear();
-	for (auto& Pair : ShaderResourceViews)
-	{
-		if(Pair.second)
-			Pair.second->Release();
-	}
-	ShaderResourceViews.clear();
+	ReleaseTextures();
 
 	ReleaseShaders();
 }
 
 UStaticMesh* UResourceManager::GetStaticMesh(const FString& Path)
 {
+	MEMORY_TAG_SCOPE(Assets);
+
 	if (StaticMeshes.Find(Path))
 	{
 		return StaticMeshes[Path];
@@ -140,6 +106,8 @@ UStaticMesh* UResourceManager::GetStaticMesh(const FString& Path)
 
 ID3D11ShaderResourceView* UResourceManager::LoadTexture(const FString& Path)
 {
+	MEMORY_TAG_SCOPE(Assets);
+
 	URenderer& Renderer = URenderer::GetInstance();
 	ID3D11Device* Device = Renderer.GetDevice();
 	const wstring WidePath = StringToWideString(Path);
@@ -202,6 +170,35 @@ ID3D11ShaderResourceView* UResourceManager::GetTexture(const FString& Path)
 
 }
 
+ID3D11ShaderResourceView* UResourceManager::GetDefaultTexture()
+{
+	if (!DefaultTexture)
+	{
+		DefaultTexture = GetTexture("Data/None.dds");
+	}
+	return DefaultTexture;
+}
+
+void UResourceManager::ReloadTextures()
+{
+	ReleaseTextures();
+	UE_LOG("ResourceManager: 텍스처 캐시 초기화 (세대 %u)", TextureGeneration);
+}
+
+void UResourceManager::ReleaseTextures()
+{
+	for (auto& Pair : ShaderResourceViews)
+	{
+		if(Pair.second)
+			Pair.second->Release();
+	}
+	ShaderResourceViews.clear();
+	DefaultTexture = nullptr;
+
+	// 해제된 SRV를 들고 있는 캐시를 모두 무효화
+	++TextureGeneration;
+}
+
 ID3D11SamplerState* UResourceManager::GetSamplerState(ESamplerType Type)
 {
 	return SamplerStates[Type];
@@ -293,26 +290,75 @@ void UResourceManager::LoadCharInfoMap()
 ////////////////////////////////////////////For Text////////////////////////////////////
 
 
+bool UResourceManager::LoadShaderBytecode(const FString& InSourcePath, const FString& InEntryPoint, const FString& InProfile,
+	TArray<uint8>& OutBytecode)
+{
+	FShaderCompileRequest Request;
+	Request.SourcePath = InSourcePath;
+	Request.EntryPoint = InEntryPoint;
+	Request.Profile = InProfile;
+	Request.CompilerVersion = D3D_COMPILER_VERSION;
+
+	uint64 Key = 0;
+	const bool bHasKey = FShaderCache::ComputeKey(Request, Key);
+	if (bHasKey && ShaderCache.Load(Request, Key, OutBytecode))
+	{
+		++NumShaderCacheHits;
+		return true;
+	}
+
+	TArray<D3D_SHADER_MACRO> Macros;
+	for (const auto& [Name, Value] : Request.Defines)
+	{
+		Macros.push_back({ Name.c_str(), Value.c_str() });
+	}
+	Macros.push_back({ nullptr, nullptr });
+
+	ID3DBlob* Bytecode = nullptr;
+	ID3DBlob* Errors = nullptr;
+	const HRESULT Result = D3DCompileFromFile(path(InSourcePath).wstring().c_str(), Macros.data(),
+		D3D_COMPILE_STANDARD_FILE_INCLUDE, InEntryPoint.c_str(), InProfile.c_str(), Request.Flags, 0, &Bytecode, &Errors);
+	++NumShaderCompiles;
+
+	if (FAILED(Result) || !Bytecode)
+	{
+		UE_LOG("Shader Compile Failed: %s (%s)\n%s", InSourcePath.c_str(), InEntryPoint.c_str(),
+			Errors ? static_cast<const char*>(Errors->GetBufferPointer()) : "");
+		if (Errors) Errors->Release();
+		if (Bytecode) Bytecode->Release();
+		return false;
+	}
+	if (Errors) Errors->Release();
+
+	const uint8* Data = static_cast<const uint8*>(Bytecode->GetBufferPointer());
+	OutBytecode.assign(Data, Data + Bytecode->GetBufferSize());
+	Bytecode->Release();
+
+	if (bHasKey)
+	{
+		ShaderCache.Store(Request, Key, OutBytecode.data(), OutBytecode.size());
+	}
+	return true;
+}
+
 void UResourceManager::CreateStaticMeshShader()
 {
 	URenderer& Renderer = URenderer::GetInstance();
-	ID3DBlob* VertexShaderCSO;
-	ID3DBlob* PixelShaderCSO;
+	TArray<uint8> VertexShaderCSO;
+	TArray<uint8> PixelShaderCSO;
 
 	ID3D11VertexShader* VertexShader;
 	ID3D11PixelShader* PixelShader;
 	ID3D11InputLayout* InputLayout;
-	D3DCompileFromFile(L"Asset/Shader/StaticMeshShader.hlsl", nullptr, nullptr, "MainVS", "vs_5_0", 0, 0,
-		&VertexShaderCSO, nullptr);
+	LoadShaderBytecode("Asset/Shader/StaticMeshShader.hlsl", "MainVS", "vs_5_0", VertexShaderCSO);
 
-	Renderer.GetDevice()->CreateVertexShader(VertexShaderCSO->GetBufferPointer(),
-		VertexShaderCSO->GetBufferSize(), nullptr, &VertexShader);
+	Renderer.GetDevice()->CreateVertexShader(VertexShaderCSO.data(),
+		VertexShaderCSO.size(), nullptr, &VertexShader);
 
-	D3DCompileFromFile(L"Asset/Shader/StaticMeshShader.hlsl", nullptr, nullptr, "MainPS", "ps_5_0", 0, 0,
-		&PixelShaderCSO, nullptr);
+	LoadShaderBytecode("Asset/Shader/StaticMeshShader.hlsl", "MainPS", "ps_5_0", PixelShaderCSO);
 
-	Renderer.GetDevice()->CreatePixelShader(PixelShaderCSO->GetBufferPointer(),
-		PixelShaderCSO->GetBufferSize(), nullptr, &PixelShader);
+	Renderer.GetDevice()->CreatePixelShader(PixelShaderCSO.data(),
+		PixelShaderCSO.size(), nullptr, &PixelShader);
 
 	D3D11_INPUT_ELEMENT_DESC layout[] =
 	{
@@ -322,17 +368,14 @@ void UResourceManager::CreateStaticMeshShader()
 		{"TEXTURE", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 40, D3D11_INPUT_PER_VERTEX_DATA, 0},
 	};
 
-	Renderer.GetDevice()->CreateInputLayout(layout, ARRAYSIZE(layout), VertexShaderCSO->GetBufferPointer(),
-		VertexShaderCSO->GetBufferSize(), &InputLayout);
+	Renderer.GetDevice()->CreateInputLayout(layout, ARRAYSIZE(layout), VertexShaderCSO.data(),
+		VertexShaderCSO.size(), &InputLayout);
 
 	FShader Shader;
 	Shader.InputLayout = InputLayout;
 	Shader.VertexShader = VertexShader;
 	Shader.PixelShader = PixelShader;
 	Shaders.emplace(EShaderType::StaticMeshShader, Shader);
-
-	VertexShaderCSO->Release();
-	PixelShaderCSO->Release();
 }
 
 /**
@@ -342,23 +385,21 @@ void UResourceManager::CreateDefaultShader()
 {
 	URenderer& Renderer = URenderer::GetInstance();
 
-	ID3DBlob* VertexShaderCSO;
-	ID3DBlob* PixelShaderCSO;
+	TArray<uint8> VertexShaderCSO;
+	TArray<uint8> PixelShaderCSO;
 
 	ID3D11VertexShader* VertexShader;
 	ID3D11PixelShader* PixelShader;
 	ID3D11InputLayout* InputLayout;
-	D3DCompileFromFile(L"Asset/Shader/SampleShader.hlsl", nullptr, nullptr, "MainVS", "vs_5_0", 0, 0,
-		&VertexShaderCSO, nullptr);
+	LoadShaderBytecode("Asset/Shader/SampleShader.hlsl", "MainVS", "vs_5_0", VertexShaderCSO);
 
-	Renderer.GetDevice()->CreateVertexShader(VertexShaderCSO->GetBufferPointer(),
-		VertexShaderCSO->GetBufferSize(), nullptr, &VertexShader);
+	Renderer.GetDevice()->CreateVertexShader(VertexShaderCSO.data(),
+		VertexShaderCSO.size(), nullptr, &VertexShader);
 
-	D3DCompileFromFile(L"Asset/Shader/SampleShader.hlsl", nullptr, nullptr, "MainPS", "ps_5_0", 0, 0,
-		&PixelShaderCSO, nullptr);
+	LoadShaderBytecode("Asset/Shader/SampleShader.hlsl", "MainPS", "ps_5_0", PixelShaderCSO);
 
-	Renderer.GetDevice()->CreatePixelShader(PixelShaderCSO->GetBufferPointer(),
-		PixelShaderCSO->GetBufferSize(), nullptr, &PixelShader);
+	Renderer.GetDevice()->CreatePixelShader(PixelShaderCSO.data(),
+		PixelShaderCSO.size(), nullptr, &PixelShader);
 
 	D3D11_INPUT_ELEMENT_DESC layout[] =
 	{
@@ -366,8 +407,8 @@ void UResourceManager::CreateDefaultShader()
 		{"COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0},
 	};
 
-	Renderer.GetDevice()->CreateInputLayout(layout, ARRAYSIZE(layout), VertexShaderCSO->GetBufferPointer(),
-		VertexShaderCSO->GetBufferSize(), &InputLayout);
+	Renderer.GetDevice()->CreateInputLayout(layout, ARRAYSIZE(layout), VertexShaderCSO.data(),
+		VertexShaderCSO.size(), &InputLayout);
 
 
 	FShader Shader;
@@ -375,51 +416,80 @@ void UResourceManager::CreateDefaultShader()
 	Shader.VertexShader = VertexShader;
 	Shader.PixelShader = PixelShader;
 	Shaders.emplace(EShaderType::SampleShader, Shader);
-
-	VertexShaderCSO->Release();
-	PixelShaderCSO->Release();
 }
 
 void UResourceManager::CreateTextShader()
 {
 	URenderer& Renderer = URenderer::GetInstance();
-	ID3DBlob* VertexShaderCSO;
-	ID3DBlob* PixelShaderCSO;
+	TArray<uint8> VertexShaderCSO;
+	TArray<uint8> PixelShaderCSO;
 
 	ID3D11VertexShader* VertexShader;
 	ID3D11PixelShader* PixelShader;
 	ID3D11InputLayout* InputLayout;
 
-	D3DCompileFromFile(L"Asset/Shader/TextShader.hlsl", nullptr, nullptr, "mainVS", "vs_5_0", 0, 0,
-		&VertexShaderCSO, nullptr);
+	LoadShaderBytecode("Asset/Shader/TextShader.hlsl", "mainVS", "vs_5_0", VertexShaderCSO);
 
-	Renderer.GetDevice()->CreateVertexShader(VertexShaderCSO->GetBufferPointer(),
-		VertexShaderCSO->GetBufferSize(), nullptr, &VertexShader);
+	Renderer.GetDevice()->CreateVertexShader(VertexShaderCSO.data(),
+		VertexShaderCSO.size(), nullptr, &VertexShader);
 
-	D3DCompileFromFile(L"Asset/Shader/TextShader.hlsl", nullptr, nullptr, "mainPS", "ps_5_0", 0, 0,
-		&PixelShaderCSO, nullptr);
+	LoadShaderBytecode("Asset/Shader/TextShader.hlsl", "mainPS", "ps_5_0", PixelShaderCSO);
 
-	Renderer.GetDevice()->CreatePixelShader(PixelShaderCSO->GetBufferPointer(),
-		PixelShaderCSO->GetBufferSize(), nullptr, &PixelShader);
+	Renderer.GetDevice()->CreatePixelShader(PixelShaderCSO.data(),
+		PixelShaderCSO.size(), nullptr, &PixelShader);
 
 	D3D11_INPUT_ELEMENT_DESC layout[] =
 	{
-		{"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
-		{"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0},
-		{"TEXCOORD", 1, DXGI_FORMAT_R32_UINT, 0, 20, D3D11_INPUT_PER_VERTEX_DATA, 0},
+		// 글자 한 개 = 인스턴스 한 개 (글자 표 번호 uint), 글자 데이터는 StructuredBuffer, 사각형 모서리는 SV_VertexID로 만든다
+		{"TEXCOORD", 0, DXGI_FORMAT_R32_UINT, 0, 0, D3D11_INPUT_PER_INSTANCE_DATA, 1},
 	};
 
-	Renderer.GetDevice()->CreateInputLayout(layout, ARRAYSIZE(layout), VertexShaderCSO->GetBufferPointer(),
-		VertexShaderCSO->GetBufferSize(), &InputLayout);
+	Renderer.GetDevice()->CreateInputLayout(layout, ARRAYSIZE(layout), VertexShaderCSO.data(),
+		VertexShaderCSO.size(), &InputLayout);
 
 	FShader Shader;
 	Shader.InputLayout = InputLayout;
 	Shader.VertexShader = VertexShader;
 	Shader.PixelShader = PixelShader;
 	Shaders.emplace(EShaderType::TextShader, Shader);
+}
 
-	VertexShaderCSO->Release();
-	PixelShaderCSO->Release();
+/**
+ * @brief 빌보드(TextureShader) 셰이더 생성
+ */
+void UResourceManager::CreateTextureShader()
+{
+	URenderer& Renderer = URenderer::GetInstance();
+	TArray<uint8> VertexShaderCSO;
+	TArray<uint8> PixelShaderCSO;
+
+	ID3D11VertexShader* VertexShader = nullptr;
+	ID3D11PixelShader* PixelShader = nullptr;
+	ID3D11InputLayout* InputLayout = nullptr;
+
+	LoadShaderBytecode("Asset/Shader/TextureShader.hlsl", "mainVS", "vs_5_0", VertexShaderCSO);
+	Renderer.GetDevice()->CreateVertexShader(VertexShaderCSO.data(),
+		VertexShaderCSO.size(), nullptr, &VertexShader);
+
+	LoadShaderBytecode("Asset/Shader/TextureShader.hlsl", "mainPS", "ps_5_0", PixelShaderCSO);
+	Renderer.GetDevice()->CreatePixelShader(PixelShaderCSO.data(),
+		PixelShaderCSO.size(), nullptr, &PixelShader);
+
+	D3D11_INPUT_ELEMENT_DESC Layout[] =
+	{
+		{"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0,  D3D11_INPUT_PER_VERTEX_DATA, 0},
+		{"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT,    0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0},
+		{"COLOR",    0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, 20, D3D11_INPUT_PER_VERTEX_DATA, 0},
+		{"UUID",     0, DXGI_FORMAT_R32_UINT,        0, 36, D3D11_INPUT_PER_VERTEX_DATA, 0},
+	};
+	Renderer.GetDevice()->CreateInputLayout(Layout, ARRAYSIZE(Layout), VertexShaderCSO.data(),
+		VertexShaderCSO.size(), &InputLayout);
+
+	FShader Shader;
+	Shader.InputLayout = InputLayout;
+	Shader.VertexShader = VertexShader;
+	Shader.PixelShader = PixelShader;
+	Shaders.emplace(EShaderType::TextureShader, Shader);
 }
 
 
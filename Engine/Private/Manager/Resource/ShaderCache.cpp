@@ -0,0 +1,234 @@
+#include "Manager/Resource/ShaderCache.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+	constexpr uint64 HashPrime = 0x100000001b3ull;
+	constexpr uint32 BlobMagic = 0x43444853;	// "SHDC"
+	constexpr size_t BlobKeyDigits = 16;
+	constexpr const char* BlobExtension = ".cso";
+
+	/** 블롭 파일 앞에 붙는 헤더. 키/크기가 맞지 않으면 깨진 파일로 보고 다시 컴파일한다 */
+	struct FShaderBlobHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint64 Key;
+		uint64 Size;
+	};
+
+	bool ReadWholeFile(const path& InPath, FString& OutContents)
+	{
+		ifstream File(InPath, std::ios::binary);
+		if (!File)
+		{
+			return false;
+		}
+		OutContents.assign(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+		return true;
+	}
+
+	/** #include "Name" 줄에서 Name을 꺼낸다 (<...> 인클루드는 엔진 밖 파일이므로 보지 않는다) */
+	bool ParseInclude(const FString& InLine, FString& OutName)
+	{
+		size_t Pos = InLine.find_first_not_of(" \t");
+		if (Pos == FString::npos || InLine.compare(Pos, 8, "#include") != 0)
+		{
+			return false;
+		}
+		const size_t Open = InLine.find('"', Pos + 8);
+		const size_t Close = Open == FString::npos ? FString::npos : InLine.find('"', Open + 1);
+		if (Close == FString::npos)
+		{
+			return false;
+		}
+		OutName = InLine.substr(Open + 1, Close - Open - 1);
+		return true;
+	}
+
+	/** InContents가 끌어오는 인클루드를 처음 등장한 순서대로 재귀 해시한다 */
+	void HashIncludes(const FString& InContents, const path& InDirectory, TArray<FString>& InOutVisited, uint64& InOutHash)
+	{
+		std::istringstream Stream(InContents);
+		FString Line;
+		FString IncludeName;
+		while (std::getline(Stream, Line))
+		{
+			if (!ParseInclude(Line, IncludeName))
+			{
+				continue;
+			}
+
+			const path IncludePath = (InDirectory / IncludeName).lexically_normal();
+			const FString IncludeKey = IncludePath.generic_string();
+			if (std::find(InOutVisited.begin(), InOutVisited.end(), IncludeKey) != InOutVisited.end())
+			{
+				continue;
+			}
+			InOutVisited.push_back(IncludeKey);
+
+			InOutHash = FShaderCache::HashString(IncludeKey, InOutHash);
+			FString IncludeContents;
+			if (ReadWholeFile(IncludePath, IncludeContents))
+			{
+				InOutHash = FShaderCache::HashString(IncludeContents, InOutHash);
+				HashIncludes(IncludeContents, IncludePath.parent_path(), InOutVisited, InOutHash);
+			}
+		}
+	}
+}
+
+FShaderCache::FShaderCache(const FString& InCacheDirectory)
+	: CacheDirectory(InCacheDirectory)
+{
+}
+
+uint64 FShaderCache::HashBytes(const void* InData, size_t InSize, uint64 InSeed)
+{
+	const uint8* Bytes = static_cast<const uint8*>(InData);
+	uint64 Hash = InSeed;
+	for (size_t Index = 0; Index < InSize; ++Index)
+	{
+		Hash ^= Bytes[Index];
+		Hash *= HashPrime;
+	}
+	return Hash;
+}
+
+uint64 FShaderCache::HashString(const FString& InString, uint64 InSeed)
+{
+	// 길이도 넣어서 "ab"+"c"와 "a"+"bc"가 같은 키가 되지 않게 한다
+	const uint64 Length = InString.size();
+	return HashBytes(InString.data(), InString.size(), HashBytes(&Length, sizeof(Length), InSeed));
+}
+
+bool FShaderCache::ComputeKey(const FShaderCompileRequest& InRequest, uint64& OutKey)
+{
+	FString Source;
+	if (!ReadWholeFile(InRequest.SourcePath, Source))
+	{
+		return false;
+	}
+
+	uint64 Hash = HashBytes(&FormatVersion, sizeof(FormatVersion));
+	Hash = HashString(Source, Hash);
+
+	TArray<FString> Visited;
+	HashIncludes(Source, path(InRequest.SourcePath).parent_path(), Visited, Hash);
+
+	Hash = HashString(InRequest.EntryPoint, Hash);
+	Hash = HashString(InRequest.Profile, Hash);
+	for (const auto& [Name, Value] : InRequest.Defines)
+	{
+		Hash = HashString(Name, Hash);
+		Hash = HashString(Value, Hash);
+	}
+	Hash = HashBytes(&InRequest.Flags, sizeof(InRequest.Flags), Hash);
+	Hash = HashBytes(&InRequest.CompilerVersion, sizeof(InRequest.CompilerVersion), Hash);
+
+	OutKey = Hash;
+	return true;
+}
+
+FString FShaderCache::GetBlobPrefix(const FShaderCompileRequest& InRequest)
+{
+	uint64 Permutation = HashSeed;
+	for (const auto& [Name, Value] : InRequest.Defines)
+	{
+		Permutation = HashString(Name, Permutation);
+		Permutation = HashString(Value, Permutation);
+	}
+	Permutation = HashBytes(&InRequest.Flags, sizeof(InRequest.Flags), Permutation);
+
+	char PermutationText[9];
+	snprintf(PermutationText, sizeof(PermutationText), "%08x", static_cast<uint32>(Permutation ^ (Permutation >> 32)));
+	return path(InRequest.SourcePath).stem().string() + "_" + InRequest.EntryPoint + "_" + InRequest.Profile + "_" + PermutationText + "_";
+}
+
+FString FShaderCache::GetBlobPath(const FShaderCompileRequest& InRequest, uint64 InKey) const
+{
+	char KeyText[17];
+	snprintf(KeyText, sizeof(KeyText), "%016llx", static_cast<unsigned long long>(InKey));
+	return (path(CacheDirectory) / (GetBlobPrefix(InRequest) + KeyText + BlobExtension)).generic_string();
+}
+
+bool FShaderCache::Load(const FShaderCompileRequest& InRequest, uint64 InKey, TArray<uint8>& OutBytecode) const
+{
+	ifstream File(GetBlobPath(InRequest, InKey), std::ios::binary);
+	if (!File)
+	{
+		return false;
+	}
+
+	FShaderBlobHeader Header = {};
+	if (!File.read(reinterpret_cast<char*>(&Header), sizeof(Header)) ||
+		Header.Magic != BlobMagic || Header.Version != FormatVersion || Header.Key != InKey || Header.Size == 0)
+	{
+		return false;
+	}
+
+	OutBytecode.resize(Header.Size);
+	if (!File.read(reinterpret_cast<char*>(OutBytecode.data()), static_cast<std::streamsize>(Header.Size)))
+	{
+		OutBytecode.clear();
+		return false;
+	}
+	return true;
+}
+
+bool FShaderCache::Store(const FShaderCompileRequest& InRequest, uint64 InKey, const void* InBytecode, size_t InSize) const
+{
+	if (!InBytecode || InSize == 0)
+	{
+		return false;
+	}
+
+	std::error_code Error;
+	create_directories(CacheDirectory, Error);
+
+	// 소스가 바뀌어 남은 같은 퍼뮤테이션의 이전 키 블롭은 다시 쓰일 일이 없으므로 지운다
+	// 이름 모양(<접두사><키 16자리>.cso)까지 맞아야 지워서, 이름이 접두사로 시작하는 다른 소스의 블롭은 건드리지 않는다
+	const FString Prefix = GetBlobPrefix(InRequest);
+	const FString BlobPath = GetBlobPath(InRequest, InKey);
+	const size_t BlobNameLength = Prefix.size() + BlobKeyDigits + std::strlen(BlobExtension);
+	for (const auto& Entry : filesystem::directory_iterator(CacheDirectory, Error))
+	{
+		const FString FileName = Entry.path().filename().string();
+		if (FileName.size() == BlobNameLength && FileName.rfind(Prefix, 0) == 0 &&
+			FileName.compare(Prefix.size() + BlobKeyDigits, FString::npos, BlobExtension) == 0 &&
+			Entry.path().generic_string() != BlobPath)
+		{
+			filesystem::remove(Entry.path(), Error);
+		}
+	}
+
+	// 쓰다 끊겨도 반쪽 블롭이 남지 않게 임시 파일에 쓴 뒤 이름을 바꾼다
+	const FString TempPath = BlobPath + ".tmp";
+	{
+		ofstream File(TempPath, std::ios::binary | std::ios::trunc);
+		if (!File)
+		{
+			return false;
+		}
+
+		const FShaderBlobHeader Header = { BlobMagic, FormatVersion, InKey, static_cast<uint64>(InSize) };
+		File.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+		File.write(static_cast<const char*>(InBytecode), static_cast<std::streamsize>(InSize));
+		if (!File)
+		{
+			File.close();
+			filesystem::remove(TempPath, Error);
+			return false;
+		}
+	}
+
+	filesystem::rename(TempPath, BlobPath, Error);
+	if (Error)
+	{
+		filesystem::remove(TempPath, Error);
+		return false;
+	}
+	return true;
+}
@@ -109,6 +109,8 @@ void UUIManager::Release()
  */
 void UUIManager::Update()
 {
+	MEMORY_TAG_SCOPE(UI);
+
 	if (!bIsInitialized)
 	{
 		return;
@@ -139,6 +141,8 @@ void UUIManager::Update()
  */
 void UUIManager::Render()
 {
+	MEMORY_TAG_SCOPE(UI);
+
 	if (!bIsInitialized)
 	{
 		return;
@@ -1,101 +1,55 @@
 #include "pch.h"
 #include "Render/Cull/MSOC.h"
-#if defined(__AVX2__)
-#include <immintrin.h>
-#endif
+#include "Render/Cull/MSOCKernels.h"
+#include <emmintrin.h>
 // 타일 4코너만으로 FULL/MISS/PARTIAL 판정
 enum class ETileClass { Full, Miss, Partial };
 // ─────────────────────────────────────────────────────────────
 // 타일 4코너 Full/Miss/Partial 분류 (SIMD)
-//   - 삼각형은 CCW(이미 area2>0로 보장) 기준
+//   - 볼록 다각형은 CCW(이미 area2>0로 보장) 기준
 //   - FULL  : 모든 에지에서 4코너 모두 >= 0
 //   - MISS  : 어떤 에지든 4코너 모두 < 0
 //   - PART  : 나머지
+//   - bTexelCenters: 코너 텍셀의 중심에서 평가 (보수적 커버리지의 에지는 텍셀 중심 기준이다)
 // ─────────────────────────────────────────────────────────────
 
 
-static FORCEINLINE ETileClass ClassifyTileByCorners(const FProjectedTri& t, int tx, int ty)
+static FORCEINLINE ETileClass ClassifyTileByCorners(const FCoverageEdges& E, int tx, int ty, bool bTexelCenters)
 {
-	const float fx0 = tx * MSOC_TILE_W;
-	const float fy0 = ty * MSOC_TILE_H;
+	const float Offset = bTexelCenters ? 0.5f : 0.0f;
+	const float fx0 = tx * MSOC_TILE_W + Offset;
+	const float fy0 = ty * MSOC_TILE_H + Offset;
 	const float fx1 = fx0 + (MSOC_TILE_W - 1);
 	const float fy1 = fy0 + (MSOC_TILE_H - 1);
 
-#if defined(__AVX2__)
 	// 4개 코너를 벡터로 묶기: (x0,y0),(x1,y0),(x0,y1),(x1,y1)
 	const __m128 px = _mm_setr_ps(fx0, fx1, fx0, fx1);
 	const __m128 py = _mm_setr_ps(fy0, fy0, fy1, fy1);
 	const __m128 z = _mm_set1_ps(0.0f);
 
-	// 각 에지의 계수 (E(P)=A*x + B*y + C). CCW 규칙:
-	// e0: v0->v1, e1: v1->v2, e2: v2->v0
-	const float A0 = (t.y0 - t.y1), B0 = (t.x1 - t.x0), C0 = (t.x0 * t.y1 - t.y0 * t.x1);
-	const float A1 = (t.y1 - t.y2), B1 = (t.x2 - t.x1), C1 = (t.x1 * t.y2 - t.y1 * t.x2);
-	const float A2 = (t.y2 - t.y0), B2 = (t.x0 - t.x2), C2 = (t.x2 * t.y0 - t.y2 * t.x0);
-
-	const __m128 A0v = _mm_set1_ps(A0), B0v = _mm_set1_ps(B0), C0v = _mm_set1_ps(C0);
-	const __m128 A1v = _mm_set1_ps(A1), B1v = _mm_set1_ps(B1), C1v = _mm_set1_ps(C1);
-	const __m128 A2v = _mm_set1_ps(A2), B2v = _mm_set1_ps(B2), C2v = _mm_set1_ps(C2);
-
-	auto edge_eval = [&](const __m128& A, const __m128& B, const __m128& C) -> __m128 {
-#if defined(__FMA__)
-		// e = A*px + B*py + C
-		return _mm_fmadd_ps(B, py, _mm_fmadd_ps(A, px, C));
-#else
-		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(A, px), _mm_mul_ps(B, py)), C);
-#endif
-	};
-
-	const __m128 e0 = edge_eval(A0v, B0v, C0v);
-	const __m128 e1 = edge_eval(A1v, B1v, C1v);
-	const __m128 e2 = edge_eval(A2v, B2v, C2v);
-
+	// e = A*px + B*py + C (SSE2)
 	// 각 에지에 대해 (e >= 0) 마스크(4비트). 0xF면 4코너 모두 inside.
-	const int m0_ge = _mm_movemask_ps(_mm_cmp_ps(e0, z, _CMP_GE_OQ));
-	const int m1_ge = _mm_movemask_ps(_mm_cmp_ps(e1, z, _CMP_GE_OQ));
-	const int m2_ge = _mm_movemask_ps(_mm_cmp_ps(e2, z, _CMP_GE_OQ));
+	int AllInside = 0xF;
+	bool bMiss = false;
+	for (int e = 0; e < E.NumEdges; ++e)
+	{
+		const __m128 Edge = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(E.A[e]), px), _mm_mul_ps(_mm_set1_ps(E.B[e]), py)),
+			_mm_set1_ps(E.C[e]));
+		const int Ge = _mm_movemask_ps(_mm_cmpge_ps(Edge, z));
 
-	// MISS: 어떤 에지든 4코너 모두 (e < 0) → (e>=0) 마스크가 0
-	if ((m0_ge == 0) | (m1_ge == 0) | (m2_ge == 0))
+		// MISS: 어떤 에지든 4코너 모두 (e < 0) → (e>=0) 마스크가 0
+		bMiss |= (Ge == 0);
+		AllInside &= Ge;
+	}
+
+	if (bMiss)
 		return ETileClass::Miss;
 
 	// FULL: 모든 에지에서 4코너 모두 (e >= 0)
-	if ((m0_ge == 0xF) & (m1_ge == 0xF) & (m2_ge == 0xF))
+	if (AllInside == 0xF)
 		return ETileClass::Full;
 
 	return ETileClass::Partial;
-#else
-	// 스칼라 폴백(기존 로직)
-	auto edge = [](float px, float py, float ax, float ay, float bx, float by) {
-		return (px - ax) * (by - ay) - (py - ay) * (bx - ax);
-		};
-	const float e0c0 = edge(fx0, fy0, t.x0, t.y0, t.x1, t.y1);
-	const float e0c1 = edge(fx1, fy0, t.x0, t.y0, t.x1, t.y1);
-	const float e0c2 = edge(fx0, fy1, t.x0, t.y0, t.x1, t.y1);
-	const float e0c3 = edge(fx1, fy1, t.x0, t.y0, t.x1, t.y1);
-
-	const float e1c0 = edge(fx0, fy0, t.x1, t.y1, t.x2, t.y2);
-	const float e1c1 = edge(fx1, fy0, t.x1, t.y1, t.x2, t.y2);
-	const float e1c2 = edge(fx0, fy1, t.x1, t.y1, t.x2, t.y2);
-	const float e1c3 = edge(fx1, fy1, t.x1, t.y1, t.x2, t.y2);
-
-	const float e2c0 = edge(fx0, fy0, t.x2, t.y2, t.x0, t.y0);
-	const float e2c1 = edge(fx1, fy0, t.x2, t.y2, t.x0, t.y0);
-	const float e2c2 = edge(fx0, fy1, t.x2, t.y2, t.x0, t.y0);
-	const float e2c3 = edge(fx1, fy1, t.x2, t.y2, t.x0, t.y0);
-
-	const float e0min = std::min(std::min(e0c0, e0c1), std::min(e0c2, e0c3));
-	const float e1min = std::min(std::min(e1c0, e1c1), std::min(e1c2, e1c3));
-	const float e2min = std::min(std::min(e2c0, e2c1), std::min(e2c2, e2c3));
-	if (e0min >= 0 && e1min >= 0 && e2min >= 0) return ETileClass::Full;
-
-	const float e0max = std::max(std::max(e0c0, e0c1), std::max(e0c2, e0c3));
-	const float e1max = std::max(std::max(e1c0, e1c1), std::max(e1c2, e1c3));
-	const float e2max = std::max(std::max(e2c0, e2c1), std::max(e2c2, e2c3));
-	if (e0max < 0 || e1max < 0 || e2max < 0) return ETileClass::Miss;
-
-	return ETileClass::Partial;
-#endif
 }
 
 
@@ -163,83 +117,402 @@ static FORCEINLINE ETileClass ClassifyTileByCorners(const FProjectedTri& t, int
 //}
 
  
+// ─────────────────────────────────────────────────────────────
+// 보수적 래스터의 삼각형 묶음
+//   텍셀을 통째로 덮어야 커버로 치므로 박스 면의 대각선, 맞닿은 면 사이처럼 삼각형 경계에 걸친 텍셀은
+//   어느 삼각형에도 들어가지 않는다. 에지를 반대 방향으로 공유하는 앞면 삼각형들의 외곽이 볼록하면
+//   그 외곽 다각형 하나로 그려 경계 텍셀을 살린다 (박스의 보이는 면 1~3개 = 볼록 4~6각형).
+// ─────────────────────────────────────────────────────────────
+namespace
+{
+	static_assert(MSOC_PATCH_TRIS * 3 <= 64, "묶음의 정점 ID는 64비트 마스크에 들어가야 한다");
+
+	bool SharesEdge(const FOccluderPatchBatch& Batch, int L, int R)
+	{
+		const int* LIds = Batch.VertexIds[L];
+		const int* RIds = Batch.VertexIds[R];
+		for (int a = 0; a < 3; ++a)
+		{
+			for (int b = 0; b < 3; ++b)
+			{
+				if (LIds[a] == RIds[(b + 1) % 3] && LIds[(a + 1) % 3] == RIds[b]) return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * @brief 묶음의 경계(반대 방향 짝이 없는 에지)를 한 바퀴 돌아 볼록 다각형이면 보수적 에지를 만든다
+	 * 갈림길이 있거나(겹친 면), 한 바퀴에 모든 경계를 돌지 못하거나(구멍), 오목하면 false
+	 */
+	bool SetupPatchCoverageEdges(const FOccluderPatchBatch& Batch, const int* Members, int NumMembers,
+		FCoverageEdges& Out, float& OutZMax)
+	{
+		// 정점별로 나가는 에지의 도착 정점 마스크
+		uint64 OutMask[MSOC_PATCH_TRIS * 3];
+		int    NextBoundary[MSOC_PATCH_TRIS * 3];
+		for (int m = 0; m < NumMembers; ++m)
+		{
+			for (int k = 0; k < 3; ++k)
+			{
+				OutMask[Batch.VertexIds[Members[m]][k]] = 0;
+				NextBoundary[Batch.VertexIds[Members[m]][k]] = -1;
+			}
+		}
+		for (int m = 0; m < NumMembers; ++m)
+		{
+			const int* Ids = Batch.VertexIds[Members[m]];
+			OutMask[Ids[0]] |= 1ull << Ids[1];
+			OutMask[Ids[1]] |= 1ull << Ids[2];
+			OutMask[Ids[2]] |= 1ull << Ids[0];
+		}
+
+		// 경계 에지는 시작 정점 기준으로 하나씩만 있어야 한다 (둘이면 갈림길)
+		int NumBoundary = 0;
+		int Start = -1;
+		for (int m = 0; m < NumMembers; ++m)
+		{
+			const int* Ids = Batch.VertexIds[Members[m]];
+			for (int k = 0; k < 3; ++k)
+			{
+				const int From = Ids[k], To = Ids[(k + 1) % 3];
+				if ((OutMask[To] >> From) & 1) continue;
+
+				if (NextBoundary[From] >= 0 || NumBoundary == MSOC_MAX_COVERAGE_EDGES) return false;
+				NextBoundary[From] = To;
+				Start = From;
+				++NumBoundary;
+			}
+		}
+		if (NumBoundary < 3) return false;
+
+		float Xs[MSOC_MAX_COVERAGE_EDGES], Ys[MSOC_MAX_COVERAGE_EDGES];
+		int Current = Start;
+		for (int Step = 0; Step < NumBoundary; ++Step)
+		{
+			Xs[Step] = Batch.Vertices[Current].X;
+			Ys[Step] = Batch.Vertices[Current].Y;
+			Current = NextBoundary[Current];
+			if (Current < 0 || (Step + 1 < NumBoundary) == (Current == Start)) return false;
+		}
+
+		// 모든 꼭짓점에서 왼쪽으로 꺾이거나 곧게 이어지고, 에지 방향이 한 바퀴만 돌아야 볼록
+		// (방향이 아래쪽 반평면에서 위쪽 반평면으로 넘어가는 횟수 = 감은 횟수)
+		// 한 직선 위의 공유 정점은 투영 오차로 아주 조금 오른쪽으로 꺾일 수 있어 허용한다.
+		// 에지 반평면의 교집합은 외곽 안쪽에 있으므로 그만큼 덜 덮을 뿐 보수성은 유지된다.
+		int NumWinds = 0;
+		for (int k = 0; k < NumBoundary; ++k)
+		{
+			const int a = (k + 1) % NumBoundary, b = (k + 2) % NumBoundary;
+			const float Ex0 = Xs[a] - Xs[k], Ey0 = Ys[a] - Ys[k];
+			const float Ex1 = Xs[b] - Xs[a], Ey1 = Ys[b] - Ys[a];
+			const float Cross = Ex0 * Ey1 - Ey0 * Ex1;
+			const float Dot = Ex0 * Ex1 + Ey0 * Ey1;
+			if (Cross < 0.0f && (Dot <= 0.0f || Cross * Cross > 1e-10f * Dot * Dot)) return false;
+			if (Cross == 0.0f && Dot <= 0.0f) return false;
+
+			const bool bUpper0 = Ey0 > 0.0f || (Ey0 == 0.0f && Ex0 > 0.0f);
+			const bool bUpper1 = Ey1 > 0.0f || (Ey1 == 0.0f && Ex1 > 0.0f);
+			NumWinds += (!bUpper0 && bUpper1) ? 1 : 0;
+		}
+		if (NumWinds != 1) return false;
+
+		SetupCoverageEdges(Xs, Ys, NumBoundary, true, Out);
+		const FProjectedTri& First = Batch.Tris[Members[0]];
+		Out.minX = First.minX; Out.minY = First.minY; Out.maxX = First.maxX; Out.maxY = First.maxY;
+		OutZMax = 0.0f;
+		for (int m = 0; m < NumMembers; ++m)
+		{
+			const FProjectedTri& T = Batch.Tris[Members[m]];
+			Out.minX = std::min(Out.minX, T.minX); Out.minY = std::min(Out.minY, T.minY);
+			Out.maxX = std::max(Out.maxX, T.maxX); Out.maxY = std::max(Out.maxY, T.maxY);
+			OutZMax = std::max({ OutZMax, T.z0, T.z1, T.z2 });
+		}
+		return true;
+	}
+}
+
 void USoftwareOcclusionCuller::RasterizeOcculuderTriangles(const TArray<FSoftwareTri>& Tris)
 {
 	const int ScreenW = HiZ.ScreenW;
 	const int ScreenH = HiZ.ScreenH;
+	const bool bConservative = IsDownsampled();
+
+	// 보수적 래스터는 정점을 공유하며 이어지는 삼각형을 모아 에지 공유 묶음 단위로 그린다
+	FOccluderPatchBatch Batch;
 
 	for (const FSoftwareTri& T : Tris)
 	{
-		FProjectedTri PT;
-		if (!ProjectTriangle(T, ViewProj, VP, PT, ScreenW, ScreenH))
-			continue;
+		// 근평면을 가로지르는 삼각형은 잘라서 최대 2개로 나뉜다
+		FProjectedTri Clipped[2];
+		const int NumClipped = ProjectTriangleClipped(T, ViewProj, VP, Clipped, ScreenW, ScreenH);
+
+		for (int i = 0; i < NumClipped; ++i)
+		{
+			if (!bConservative)
+			{
+				FCoverageEdges Edges;
+				SetupTriCoverageEdges(Clipped[i], false, Edges);
+				RasterizeCoverage(Edges, std::max({ Clipped[i].z0, Clipped[i].z1, Clipped[i].z2 }));
+				continue;
+			}
+
+			if (!Batch.Add(Clipped[i]))
+			{
+				RasterizePatchBatch(Batch);
+				Batch.Reset();
+				Batch.Add(Clipped[i]);
+			}
+		}
+	}
+
+	RasterizePatchBatch(Batch);
+}
+
+void USoftwareOcclusionCuller::RasterizePatchBatch(const FOccluderPatchBatch& Batch)
+{
+	auto RasterizeTri = [this](const FProjectedTri& T)
+	{
+		FCoverageEdges Edges;
+		SetupTriCoverageEdges(T, true, Edges);
+		RasterizeCoverage(Edges, std::max({ T.z0, T.z1, T.z2 }));
+	};
 
-		const float ZtriMax = std::max({ PT.z0, PT.z1, PT.z2 });
+	const int NumTris = Batch.NumTris;
+	if (NumTris == 0) return;
+	if (NumTris == 1)
+	{
+		RasterizeTri(Batch.Tris[0]);
+		return;
+	}
 
-		const int tx0 = std::clamp(PT.minX / MSOC_TILE_W, 0, HiZ.TilesX - 1);
-		const int ty0 = std::clamp(PT.minY / MSOC_TILE_H, 0, HiZ.TilesY - 1);
-		const int tx1 = std::clamp(PT.maxX / MSOC_TILE_W, 0, HiZ.TilesX - 1);
-		const int ty1 = std::clamp(PT.maxY / MSOC_TILE_H, 0, HiZ.TilesY - 1);
+	// 묶음은 대개 메시 하나(박스 하나)이므로 통째로 먼저 시도한다
+	int All[MSOC_PATCH_TRIS];
+	for (int i = 0; i < NumTris; ++i)
+	{
+		All[i] = i;
+	}
+	FCoverageEdges Edges;
+	float ZMax;
+	if (SetupPatchCoverageEdges(Batch, All, NumTris, Edges, ZMax))
+	{
+		RasterizeCoverage(Edges, ZMax);
+		return;
+	}
 
-		for (int ty = ty0; ty <= ty1; ++ty)
+	// 외곽이 볼록하지 않으면(겹친 면, T자 이음새, 투영이 뒤집힌 면 등) 에지를 공유하는 이웃을
+	// 볼록함이 유지되는 동안만 붙여 나눠 그린다
+	bool bAssigned[MSOC_PATCH_TRIS] = {};
+	for (int Seed = 0; Seed < NumTris; ++Seed)
+	{
+		if (bAssigned[Seed]) continue;
+
+		int Group[MSOC_PATCH_TRIS] = { Seed };
+		int NumGroup = 1;
+		bAssigned[Seed] = true;
+
+		FCoverageEdges GroupEdges;
+		float GroupZMax = 0.0f;
+		for (bool bGrew = true; bGrew;)
 		{
-			for (int tx = tx0; tx <= tx1; ++tx)
+			bGrew = false;
+			for (int i = Seed + 1; i < NumTris; ++i)
 			{
-				FMaskedTile& Tile = HiZ.Tiles[ty * HiZ.TilesX + tx];
-
-				// 레퍼런스(Z0max)가 더 앞이면 이 삼각형으로는 개선 불가
-				if (ZtriMax >= Tile.Z0max) continue;
-
-				// ── ★ 선분류: Full/Miss/Partial
-				const ETileClass tc = ClassifyTileByCorners(PT, tx, ty);
-				if (tc == ETileClass::Miss) continue;
-
-				if (tc == ETileClass::Full)
-				{ 
-					if (ZtriMax < Tile.Z0max)
-						Tile.Z0max = ZtriMax;
-					 
-					Tile.Z1max = 0.0f;
-#if defined(__AVX2__)
-						_mm256_store_si256(reinterpret_cast<__m256i*>(Tile.CoverageMask),
-							_mm256_setzero_si256());
-#else
-					for (int r = 0; r < MSOC_TILE_H; ++r) Tile.CoverageMask[r] = 0u;
-#endif
-					Tile.bFullCovered = true;
-					continue;
-				}
-
-				// ── Partial 타일만 커버리지 생성
-				uint32_t cov[MSOC_TILE_H];
-#if defined(__AVX2__)
-				BuildConverageMask_Conservative(PT, tx, ty, cov);
-#else
-				BuildCoverageMask_Scanline(PT, tx, ty, cov);
-#endif
+				if (bAssigned[i]) continue;
 
-				bool anyBit = false;
-#if defined(__AVX2__)
+				bool bNeighbor = false;
+				for (int g = 0; g < NumGroup && !bNeighbor; ++g)
 				{
-					const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cov));
-					anyBit = (_mm256_testz_si256(v, v) == 0);
+					bNeighbor = SharesEdge(Batch, i, Group[g]);
 				}
-#else
-				for (int r = 0; r < MSOC_TILE_H; ++r)
-					if (cov[r]) { anyBit = true; break; }
-#endif
+				Group[NumGroup] = i;
+				if (bNeighbor && SetupPatchCoverageEdges(Batch, Group, NumGroup + 1, Edges, ZMax))
+				{
+					GroupEdges = Edges;
+					GroupZMax = ZMax;
+					bAssigned[i] = true;
+					++NumGroup;
+					bGrew = true;
+				}
+			}
+		}
+
+		if (NumGroup == 1)
+		{
+			RasterizeTri(Batch.Tris[Group[0]]);
+		}
+		else
+		{
+			RasterizeCoverage(GroupEdges, GroupZMax);
+		}
+	}
+}
+
+void USoftwareOcclusionCuller::RasterizeCoverage(const FCoverageEdges& Edges, float ZMax)
+{
+	const bool bConservative = IsDownsampled();
+
+	const int tx0 = std::clamp(Edges.minX / MSOC_TILE_W, 0, HiZ.TilesX - 1);
+	const int ty0 = std::clamp(Edges.minY / MSOC_TILE_H, 0, HiZ.TilesY - 1);
+	const int tx1 = std::clamp(Edges.maxX / MSOC_TILE_W, 0, HiZ.TilesX - 1);
+	const int ty1 = std::clamp(Edges.maxY / MSOC_TILE_H, 0, HiZ.TilesY - 1);
+
+	const FOcclusionKernels& Kernels = GetOcclusionKernels();
+
+	for (int ty = ty0; ty <= ty1; ++ty)
+	{
+		for (int tx = tx0; tx <= tx1; ++tx)
+		{
+			FMaskedTile& Tile = HiZ.Tiles[ty * HiZ.TilesX + tx];
+
+			// 레퍼런스(Z0max)가 더 앞이면 이 다각형으로는 개선 불가
+			if (ZMax >= Tile.Z0max) continue;
+
+			// ── ★ 선분류: Full/Miss/Partial
+			const ETileClass tc = ClassifyTileByCorners(Edges, tx, ty, bConservative);
+			if (tc == ETileClass::Miss) continue;
+
+			if (tc == ETileClass::Full)
+			{ 
+				if (ZMax < Tile.Z0max)
+					Tile.Z0max = ZMax;
+				 
+				Tile.Z1max = 0.0f;
+				for (int r = 0; r < MSOC_TILE_H; ++r) Tile.CoverageMask[r] = 0u;
+				Tile.bFullCovered = true;
+				continue;
+			}
 
-				if (!anyBit) continue;
+			// ── Partial 타일만 커버리지 생성
+			alignas(32) uint32_t cov[MSOC_TILE_H];
+			Kernels.BuildCoverageMask(Edges, tx, ty, cov);
 
-				UpdateTileWithTri(Tile, cov, ZtriMax);
+			bool anyBit = false;
+			{
+				const __m128i v = _mm_or_si128(
+					_mm_load_si128(reinterpret_cast<const __m128i*>(cov)),
+					_mm_load_si128(reinterpret_cast<const __m128i*>(cov + 4)));
+				anyBit = _mm_movemask_epi8(_mm_cmpeq_epi32(v, _mm_setzero_si128())) != 0xFFFF;
 			}
+
+			if (!anyBit) continue;
+
+			UpdateTileWithTri(Tile, cov, ZMax);
 		}
 	}
 }
 
 
+void USoftwareOcclusionCuller::BeginFrame(const FMatrix& InViewProj, const FOcclusionViewport& InVP)
+{
+	SaveReprojectionHistory();
+	bRecordCurrentView = false;
+	SetupView(InViewProj, InVP);
+}
 
+void USoftwareOcclusionCuller::BeginFrame(const FMatrix& InViewProj, const FMatrix& InInvViewProj,
+	const FOcclusionViewport& InVP, uint32 InViewKey)
+{
+	// 지우기 전에 직전 프레임 결과를 그 프레임을 그린 뷰의 이력으로 보관
+	SaveReprojectionHistory();
+	SetupView(InViewProj, InVP);
+
+	CurrentViewKey = InViewKey;
+	CurrentInvViewProj = InInvViewProj;
+	bRecordCurrentView = bReprojectionSeeding;
 
+	if (bReprojectionSeeding)
+	{
+		if (const FReprojectionHistory* History = ReprojectionHistory.Find(InViewKey))
+		{
+			SeedFromHistory(*History);
+		}
+	}
+}
+
+void USoftwareOcclusionCuller::SetupView(const FMatrix& InViewProj, const FOcclusionViewport& InVP)
+{
+	ViewProj = InViewProj;
+	VP = InVP;
+
+	// 백버퍼 픽셀 기준 뷰포트를 버퍼 해상도로
+	if (BackBufferW > 0 && BackBufferH > 0)
+	{
+		const float ScaleX = static_cast<float>(HiZ.ScreenW) / static_cast<float>(BackBufferW);
+		const float ScaleY = static_cast<float>(HiZ.ScreenH) / static_cast<float>(BackBufferH);
+		VP.TopLeftX *= ScaleX;
+		VP.Width *= ScaleX;
+		VP.TopLeftY *= ScaleY;
+		VP.Height *= ScaleY;
+	}
+	HiZ.Clear();
+}
+
+void USoftwareOcclusionCuller::SaveReprojectionHistory()
+{
+	if (!bRecordCurrentView) return;
+
+	FReprojectionHistory& History = ReprojectionHistory[CurrentViewKey];
+	History.InvViewProj = CurrentInvViewProj;
+	History.VP = VP;
+	History.TileZ.resize(HiZ.Tiles.size());
+	for (size_t i = 0; i < HiZ.Tiles.size(); ++i)
+	{
+		History.TileZ[i] = HiZ.Tiles[i].bFullCovered ? HiZ.Tiles[i].Z0max : 1.0f;
+	}
+}
+
+void USoftwareOcclusionCuller::SeedFromHistory(const FReprojectionHistory& InHistory)
+{
+	const FOcclusionViewport& PrevVP = InHistory.VP;
+	if (InHistory.TileZ.size() != HiZ.Tiles.size()) return;
+	if (PrevVP.Width <= 0.0f || PrevVP.Height <= 0.0f) return;
+
+	// 이전 뷰포트의 스크린 좌표 + 깊이를 월드 좌표로 복원
+	auto Unproject = [&](float InX, float InY, float InZ) -> FVector
+	{
+		const float NdcX = (InX - PrevVP.TopLeftX) / PrevVP.Width * 2.0f - 1.0f;
+		const float NdcY = 1.0f - (InY - PrevVP.TopLeftY) / PrevVP.Height * 2.0f;
+		const float NdcZ = InZ * 2.0f - 1.0f; // ProjectToScreen의 z*0.5+0.5 역변환
+		const FVector4 H = FVector4(NdcX, NdcY, NdcZ, 1.0f) * InHistory.InvViewProj;
+		const float InvW = 1.0f / H.W;
+		return FVector(H.X * InvW, H.Y * InvW, H.Z * InvW);
+	};
+
+	const float VPx0 = PrevVP.TopLeftX;
+	const float VPy0 = PrevVP.TopLeftY;
+	const float VPx1 = PrevVP.TopLeftX + PrevVP.Width;
+	const float VPy1 = PrevVP.TopLeftY + PrevVP.Height;
+
+	// FULL 타일 하나 = 타일 최대 깊이에 놓인 사각형 오클루더 (삼각형 2개)
+	TArray<FSoftwareTri> SeedTris;
+	for (int ty = 0; ty < HiZ.TilesY; ++ty)
+	{
+		for (int tx = 0; tx < HiZ.TilesX; ++tx)
+		{
+			const float Z = InHistory.TileZ[ty * HiZ.TilesX + tx];
+			if (Z >= 1.0f) continue;
+
+			const float x0 = static_cast<float>(tx * MSOC_TILE_W);
+			const float y0 = static_cast<float>(ty * MSOC_TILE_H);
+			const float x1 = x0 + MSOC_TILE_W;
+			const float y1 = y0 + MSOC_TILE_H;
+
+			// 이전 뷰포트 밖으로 걸친 타일은 깊이가 다른 뷰의 것일 수 있어 제외
+			if (x0 < VPx0 || y0 < VPy0 || x1 > VPx1 || y1 > VPy1) continue;
+
+			const FVector TL = Unproject(x0, y0, Z);
+			const FVector TR = Unproject(x1, y0, Z);
+			const FVector BR = Unproject(x1, y1, Z);
+			const FVector BL = Unproject(x0, y1, Z);
+
+			SeedTris.push_back({ TL, TR, BR });
+			SeedTris.push_back({ TL, BR, BL });
+		}
+	}
+
+	RasterizeOcculuderTriangles(SeedTris);
+}
 
 bool USoftwareOcclusionCuller::TestAABB(const FAABB& Box) const
 {
@@ -249,6 +522,11 @@ bool USoftwareOcclusionCuller::TestAABB(const FAABB& Box) const
 	if (!ProjectAABB_ToScreen(Box, ViewProj, VP, W, H, R))
 		return false; // 투영 실패 또는 화면 밖 => 오클루전 판정 생략
 
+	return TestScreenRect(R);
+}
+
+bool USoftwareOcclusionCuller::TestScreenRect(const FScreenRect& R) const
+{
 	// 타일 범위
 	int tx0 = R.x0 / MSOC_TILE_W, tx1 = R.x1 / MSOC_TILE_W;
 	int ty0 = R.y0 / MSOC_TILE_H, ty1 = R.y1 / MSOC_TILE_H;
@@ -288,39 +566,212 @@ bool USoftwareOcclusionCuller::TestAABB(const FAABB& Box) const
 
 			// Working 레이어의 커버리지 마스크로 행별 완전 커버 확인
 			const uint32_t needMask = RowRangeMask_InTile(R, tx);
+			bool bRowsCovered = true;
 
-#if defined(__AVX2__)
 			{
-				// 8행을 한 번에 검사:
+				// 8행을 4행씩 두 번에 검사:
 				// fail[r] = (((CoverageMask[r] & needMask) ^ needMask) != 0) 인 래인
-				const __m256i covVec = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(T.CoverageMask));
-				const __m256i need = _mm256_set1_epi32(static_cast<int>(needMask));
-				const __m256i andv = _mm256_and_si256(covVec, need);
-				const __m256i xorv = _mm256_xor_si256(andv, need); // 0이면 통과, !=0이면 실패
+				const __m128i need = _mm_set1_epi32(static_cast<int>(needMask));
 
 				// 활성 행(ry0..ry1)만 검사하도록 마스크 구성
-				alignas(32) uint32_t actArr[MSOC_TILE_H] = {};
+				alignas(16) uint32_t actArr[MSOC_TILE_H] = {};
 				for (int i = ry0; i <= ry1; ++i) actArr[i] = 0xFFFFFFFFu;
-				const __m256i actMask = _mm256_load_si256(reinterpret_cast<const __m256i*>(actArr));
 
-				const __m256i fail = _mm256_and_si256(xorv, actMask);
-				// fail에 하나라도 비트가 있으면 테스트 실패
-				if (_mm256_testz_si256(fail, fail) == 0)
-					return false;
-			}
-#else
-			for (int r = ry0; r <= ry1; ++r)
-			{
-				// 박스가 덮는 행 구간이 타일 커버리지에 완전히 포함되어야 함
-				if ((T.CoverageMask[r] & needMask) != needMask)
-					return false; // 한 행이라도 빈 구간 → 보수적 실패
+				__m128i fail = _mm_setzero_si128();
+				for (int Half = 0; Half < MSOC_TILE_H; Half += 4)
+				{
+					const __m128i covVec = _mm_load_si128(reinterpret_cast<const __m128i*>(T.CoverageMask + Half));
+					const __m128i actMask = _mm_load_si128(reinterpret_cast<const __m128i*>(actArr + Half));
+					const __m128i xorv = _mm_xor_si128(_mm_and_si128(covVec, need), need); // 0이면 통과, !=0이면 실패
+					fail = _mm_or_si128(fail, _mm_and_si128(xorv, actMask));
+				}
+				// fail에 하나라도 비트가 있으면 빈 구간이 있음
+				bRowsCovered = _mm_movemask_epi8(_mm_cmpeq_epi32(fail, _mm_setzero_si128())) == 0xFFFF;
 			}
-#endif
 
-			// 모든 교차 행이 완전히 커버 → 깊이 비교(Working 레이어)
-			if (!(R.zmin > T.Z1max))
+			// 모든 교차 행이 완전히 커버 → Working 레이어, 빈 구간이 있으면 타일 전체를 덮는 Reference 레이어
+			if (!(R.zmin > (bRowsCovered ? T.Z1max : T.Z0max)))
 				return false;
 		}
 	}
 	return true; // 모든 타일에서 가림 보장 → occluded
 }
+
+void USoftwareOcclusionCuller::TestAABBBatch(const FAABBSoA& Boxes, TArray<uint64>& OutVisibleBits) const
+{
+	const int32 Num = Boxes.Num();
+	OutVisibleBits.assign((Num + 63) / 64, 0ull);
+
+	auto MarkVisible = [&OutVisibleBits](int32 Index)
+	{
+		OutVisibleBits[Index >> 6] |= (1ull << (Index & 63));
+	};
+
+	// 가시성 판정이 여러 스레드에서 동시에 불리므로 스크래치는 스레드마다 따로 둔다
+	thread_local TArray<FScreenRect> ProjectedRects;
+	thread_local TArray<uint8>       ProjectedValid;
+
+	// 투영은 CPU 경로별 커널로 한 번에, 타일 검사는 박스마다
+	ProjectedRects.resize(Num);
+	ProjectedValid.resize(Num);
+	GetOcclusionKernels().ProjectAABBs(Boxes, ViewProj, VP, HiZ.ScreenW, HiZ.ScreenH,
+		ProjectedRects.data(), ProjectedValid.data());
+
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		// 카메라 뒤로 걸친 박스/빈 사각형은 단일 테스트와 마찬가지로 보이는 것으로 처리
+		if (!ProjectedValid[Index] || !TestScreenRect(ProjectedRects[Index]))
+		{
+			MarkVisible(Index);
+		}
+	}
+}
+
+void USoftwareOcclusionCuller::BenchmarkResolutions(const TArray<FAABB>& Boxes, const FMatrix& InViewProj,
+	const FOcclusionViewport& InVP, int InBackBufferW, int InBackBufferH, const TArray<TPair<int, int>>& InSizes,
+	TArray<FOcclusionBenchmarkResult>& OutResults)
+{
+	OutResults.clear();
+
+	TArray<FSoftwareTri> Tris;
+	FAABBSoA BoxesSoA;
+	Tris.reserve(Boxes.size() * 12);
+	BoxesSoA.Reserve(static_cast<int32>(Boxes.size()));
+	for (const FAABB& Box : Boxes)
+	{
+		AppendAABBAsTris(Box, Tris);
+		BoxesSoA.Add(Box);
+	}
+
+	// 0 x 0 = 백버퍼 해상도 기준 결과
+	TArray<TPair<int, int>> Sizes;
+	Sizes.push_back({ 0, 0 });
+	Sizes.insert(Sizes.end(), InSizes.begin(), InSizes.end());
+
+	// 래스터라이즈는 해상도 간 비율을 보려는 것이므로 잡음이 적은 최솟값을 쓴다
+	constexpr int32 NumRasterRuns = 3;
+
+	TArray<uint8> ReferenceOccluded;
+	USoftwareOcclusionCuller Culler;
+
+	for (const TPair<int, int>& Size : Sizes)
+	{
+		Culler.SetBufferResolution(Size.first, Size.second);
+		Culler.Init(InBackBufferW, InBackBufferH);
+
+		FOcclusionBenchmarkResult Result;
+		Result.BufferW = Culler.GetHiZ().ScreenW;
+		Result.BufferH = Culler.GetHiZ().ScreenH;
+		Result.NumTiles = Culler.GetHiZ().TilesX * Culler.GetHiZ().TilesY;
+
+		for (int32 Run = 0; Run < NumRasterRuns; ++Run)
+		{
+			Culler.BeginFrame(InViewProj, InVP);
+			const uint64 RasterStart = FPlatformTime::Cycles64();
+			Culler.RasterizeOcculuderTriangles(Tris);
+			const double RasterizeMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - RasterStart);
+			Result.RasterizeMs = (Run == 0) ? RasterizeMs : std::min(Result.RasterizeMs, RasterizeMs);
+		}
+		if (!OutResults.empty() && Result.RasterizeMs > 0.0)
+		{
+			Result.RasterSpeedup = OutResults[0].RasterizeMs / Result.RasterizeMs;
+		}
+
+		TArray<uint8> Occluded(Boxes.size(), 0);
+		const uint64 TestStart = FPlatformTime::Cycles64();
+		for (size_t Index = 0; Index < Boxes.size(); ++Index)
+		{
+			Occluded[Index] = Culler.TestAABB(Boxes[Index]) ? 1 : 0;
+		}
+		Result.TestMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - TestStart);
+
+		TArray<uint64> VisibleBits;
+		const uint64 BatchStart = FPlatformTime::Cycles64();
+		Culler.TestAABBBatch(BoxesSoA, VisibleBits);
+		Result.TestBatchMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - BatchStart);
+
+		if (ReferenceOccluded.empty())
+		{
+			ReferenceOccluded = Occluded;
+		}
+
+		for (size_t Index = 0; Index < Boxes.size(); ++Index)
+		{
+			if (!Occluded[Index])
+			{
+				if (ReferenceOccluded[Index])
+				{
+					++Result.NumMissedOccluded;
+				}
+				continue;
+			}
+			++Result.NumOccluded;
+			if (!ReferenceOccluded[Index])
+			{
+				++Result.NumExtraOccluded;
+			}
+		}
+
+		OutResults.push_back(Result);
+	}
+}
+
+void USoftwareOcclusionCuller::BenchmarkKernels(const TArray<FAABB>& Boxes, const FMatrix& InViewProj,
+	const FOcclusionViewport& InVP, int InBackBufferW, int InBackBufferH, TArray<FOcclusionKernelBenchmarkResult>& OutResults)
+{
+	OutResults.clear();
+
+	TArray<FSoftwareTri> Tris;
+	FAABBSoA BoxesSoA;
+	Tris.reserve(Boxes.size() * 12);
+	BoxesSoA.Reserve(static_cast<int32>(Boxes.size()));
+	for (const FAABB& Box : Boxes)
+	{
+		AppendAABBAsTris(Box, Tris);
+		BoxesSoA.Add(Box);
+	}
+
+	const ESIMDLevel PreviousLevel = FCPUFeatures::GetActiveLevel();
+	const ESIMDLevel MaxLevel = FCPUFeatures::Get().MaxLevel;
+
+	TArray<uint64> ReferenceBits;
+	USoftwareOcclusionCuller Culler;
+
+	for (int32 LevelIndex = 0; LevelIndex <= static_cast<int32>(MaxLevel); ++LevelIndex)
+	{
+		const ESIMDLevel Level = static_cast<ESIMDLevel>(LevelIndex);
+		FCPUFeatures::SetActiveLevel(Level);
+
+		Culler.Init(InBackBufferW, InBackBufferH);
+		Culler.BeginFrame(InViewProj, InVP);
+
+		FOcclusionKernelBenchmarkResult Result;
+		Result.Level = Level;
+
+		const uint64 RasterStart = FPlatformTime::Cycles64();
+		Culler.RasterizeOcculuderTriangles(Tris);
+		Result.RasterizeMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - RasterStart);
+
+		TArray<uint64> VisibleBits;
+		const uint64 BatchStart = FPlatformTime::Cycles64();
+		Culler.TestAABBBatch(BoxesSoA, VisibleBits);
+		Result.TestBatchMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - BatchStart);
+
+		if (ReferenceBits.empty())
+		{
+			ReferenceBits = VisibleBits;
+		}
+
+		for (int32 Index = 0; Index < BoxesSoA.Num(); ++Index)
+		{
+			const bool bVisible = (VisibleBits[Index >> 6] >> (Index & 63)) & 1ull;
+			const bool bReferenceVisible = (ReferenceBits[Index >> 6] >> (Index & 63)) & 1ull;
+			Result.NumOccluded += bVisible ? 0 : 1;
+			Result.NumMismatched += (bVisible != bReferenceVisible) ? 1 : 0;
+		}
+
+		OutResults.push_back(Result);
+	}
+
+	FCPUFeatures::SetActiveLevel(PreviousLevel);
+}
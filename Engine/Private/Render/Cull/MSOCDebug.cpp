@@ -0,0 +1,233 @@
+#include "pch.h"
+#include "Render/Cull/MSOCDebug.h"
+
+FMatrix FOcclusionScene::BuildViewProj() const
+{
+	const FMatrix T = FMatrix::TranslationMatrixInverse(CameraLocation);
+	const FMatrix R = FMatrix::RotationMatrixInverseCamera(FVector::GetDegreeToRadian(CameraRotation));
+	const FMatrix View = T * (R * FMatrix::BasisLHYToUE());
+
+	const float Aspect = static_cast<float>(ScreenW) / static_cast<float>(std::max(1, ScreenH));
+	const float F = 1.0f / std::tan(FVector::GetDegreeToRadian(FovY) * 0.5f);
+
+	FMatrix P = FMatrix::Identity;
+	P.Data[0][0] = F / Aspect;
+	P.Data[1][1] = F;
+	P.Data[2][2] = FarZ / (FarZ - NearZ);
+	P.Data[2][3] = 1.0f;
+	P.Data[3][2] = (-NearZ * FarZ) / (FarZ - NearZ);
+	P.Data[3][3] = 0.0f;
+
+	return View * P;
+}
+
+FMatrix FOcclusionScene::BuildViewProjInverse() const
+{
+	// (View * P)^-1 = P^-1 * View^-1
+	const FMatrix R = FMatrix::RotationMatrixCamera(FVector::GetDegreeToRadian(CameraRotation));
+	const FMatrix T = FMatrix::TranslationMatrix(CameraLocation);
+	const FMatrix InvView = (FMatrix::BasisUEToLHY() * R) * T;
+
+	const float Aspect = static_cast<float>(ScreenW) / static_cast<float>(std::max(1, ScreenH));
+	const float F = 1.0f / std::tan(FVector::GetDegreeToRadian(FovY) * 0.5f);
+
+	FMatrix InvP = FMatrix::Identity;
+	InvP.Data[0][0] = Aspect / F;
+	InvP.Data[1][1] = 1.0f / F;
+	InvP.Data[2][2] = 0.0f;
+	InvP.Data[2][3] = -(FarZ - NearZ) / (NearZ * FarZ);
+	InvP.Data[3][2] = 1.0f;
+	InvP.Data[3][3] = FarZ / (NearZ * FarZ);
+
+	return InvP * InvView;
+}
+
+bool FOcclusionHarness::LoadScene(const FString& InFilePath, FOcclusionScene& OutScene)
+{
+	ifstream File(InFilePath);
+	if (!File.is_open())
+	{
+		UE_LOG("OcclusionHarness: 장면 파일을 열 수 없습니다: %s", InFilePath.c_str());
+		return false;
+	}
+
+	OutScene = FOcclusionScene();
+
+	FString Line;
+	int32 LineNumber = 0;
+	while (std::getline(File, Line))
+	{
+		++LineNumber;
+		const size_t CommentPosition = Line.find('#');
+		if (CommentPosition != FString::npos)
+		{
+			Line.erase(CommentPosition);
+		}
+
+		std::istringstream Stream(Line);
+		FString Keyword;
+		if (!(Stream >> Keyword))
+		{
+			continue;
+		}
+
+		bool bParsed = true;
+		if (Keyword == "camera")
+		{
+			bParsed = static_cast<bool>(Stream
+				>> OutScene.CameraLocation.X >> OutScene.CameraLocation.Y >> OutScene.CameraLocation.Z
+				>> OutScene.CameraRotation.X >> OutScene.CameraRotation.Y >> OutScene.CameraRotation.Z
+				>> OutScene.FovY >> OutScene.NearZ >> OutScene.FarZ);
+		}
+		else if (Keyword == "screen")
+		{
+			bParsed = static_cast<bool>(Stream >> OutScene.ScreenW >> OutScene.ScreenH);
+		}
+		else if (Keyword == "buffer")
+		{
+			bParsed = static_cast<bool>(Stream >> OutScene.BufferW >> OutScene.BufferH);
+		}
+		else if (Keyword == "occluder" || Keyword == "occludee")
+		{
+			FAABB Box;
+			bParsed = static_cast<bool>(Stream
+				>> Box.Min.X >> Box.Min.Y >> Box.Min.Z
+				>> Box.Max.X >> Box.Max.Y >> Box.Max.Z);
+
+			if (bParsed && Keyword == "occluder")
+			{
+				OutScene.Occluders.push_back(Box);
+			}
+			else if (bParsed)
+			{
+				FString Expectation;
+				Stream >> Expectation;
+				OutScene.Occludees.push_back(Box);
+				OutScene.Expected.push_back(Expectation == "visible" ? 1 : (Expectation == "occluded" ? 2 : 0));
+			}
+		}
+		else
+		{
+			bParsed = false;
+		}
+
+		if (!bParsed)
+		{
+			UE_LOG("OcclusionHarness: %s(%d) 해석할 수 없는 줄입니다", InFilePath.c_str(), LineNumber);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FOcclusionHarness::Run(const FOcclusionScene& InScene, USoftwareOcclusionCuller& OutCuller, FOcclusionHarnessReport& OutReport)
+{
+	OutReport = FOcclusionHarnessReport();
+
+	const FOcclusionViewport Viewport = {
+		0.0f, 0.0f, static_cast<float>(InScene.ScreenW), static_cast<float>(InScene.ScreenH), 0.0f, 1.0f };
+
+	OutCuller.SetBufferResolution(InScene.BufferW, InScene.BufferH);
+	OutCuller.Init(InScene.ScreenW, InScene.ScreenH);
+	OutCuller.BeginFrame(InScene.BuildViewProj(), Viewport);
+
+	TArray<FSoftwareTri> Tris;
+	Tris.reserve(InScene.Occluders.size() * 12);
+	for (const FAABB& Box : InScene.Occluders)
+	{
+		AppendAABBAsTris(Box, Tris);
+	}
+
+	const uint64 RasterStart = FPlatformTime::Cycles64();
+	OutCuller.RasterizeOcculuderTriangles(Tris);
+	OutReport.RasterizeMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - RasterStart);
+
+	OutReport.Occluded.resize(InScene.Occludees.size(), 0);
+	const uint64 TestStart = FPlatformTime::Cycles64();
+	for (size_t Index = 0; Index < InScene.Occludees.size(); ++Index)
+	{
+		OutReport.Occluded[Index] = OutCuller.TestAABB(InScene.Occludees[Index]) ? 1 : 0;
+	}
+	OutReport.TestMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - TestStart);
+
+	for (size_t Index = 0; Index < InScene.Occludees.size(); ++Index)
+	{
+		const bool bOccluded = OutReport.Occluded[Index] != 0;
+		OutReport.NumOccluded += bOccluded ? 1 : 0;
+
+		const uint8 Expected = Index < InScene.Expected.size() ? InScene.Expected[Index] : 0;
+		if ((Expected == 1 && bOccluded) || (Expected == 2 && !bOccluded))
+		{
+			++OutReport.NumMismatched;
+		}
+	}
+}
+
+bool FOcclusionHarness::WritePGM(const FString& InFilePath, int32 InWidth, int32 InHeight, const TArray<uint8>& InPixels)
+{
+	ofstream File(InFilePath, std::ios::binary);
+	if (!File.is_open())
+	{
+		UE_LOG("OcclusionHarness: 파일을 쓸 수 없습니다: %s", InFilePath.c_str());
+		return false;
+	}
+
+	File << "P5\n" << InWidth << " " << InHeight << "\n255\n";
+	File.write(reinterpret_cast<const char*>(InPixels.data()), static_cast<streamsize>(InPixels.size()));
+	return File.good();
+}
+
+bool FOcclusionHarness::WriteCoveragePGM(const FMaskedHiZBuffer& InHiZ, const FString& InFilePath)
+{
+	const int32 W = InHiZ.ScreenW;
+	const int32 H = InHiZ.ScreenH;
+	TArray<uint8> Pixels(static_cast<size_t>(W) * H, 0);
+
+	for (int32 Y = 0; Y < H; ++Y)
+	{
+		for (int32 X = 0; X < W; ++X)
+		{
+			const FMaskedTile& Tile = InHiZ.Tiles[(Y / MSOC_TILE_H) * InHiZ.TilesX + (X / MSOC_TILE_W)];
+			const uint32 RowMask = Tile.CoverageMask[Y % MSOC_TILE_H];
+			const bool bWorkingCovered = (RowMask >> (X % MSOC_TILE_W)) & 1u;
+
+			Pixels[static_cast<size_t>(Y) * W + X] = Tile.bFullCovered ? 255 : (bWorkingCovered ? 128 : 0);
+		}
+	}
+
+	return WritePGM(InFilePath, W, H, Pixels);
+}
+
+bool FOcclusionHarness::WriteTileDepthPGM(const FMaskedHiZBuffer& InHiZ, const FString& InFilePath, bool bWorkingLayer)
+{
+	const int32 W = InHiZ.ScreenW;
+	const int32 H = InHiZ.ScreenH;
+	TArray<uint8> Pixels(static_cast<size_t>(W) * H, 0);
+
+	for (int32 Y = 0; Y < H; ++Y)
+	{
+		for (int32 X = 0; X < W; ++X)
+		{
+			const FMaskedTile& Tile = InHiZ.Tiles[(Y / MSOC_TILE_H) * InHiZ.TilesX + (X / MSOC_TILE_W)];
+			const float Z = std::clamp(bWorkingLayer ? Tile.Z1max : Tile.Z0max, 0.0f, 1.0f);
+
+			Pixels[static_cast<size_t>(Y) * W + X] = static_cast<uint8>(Z * 255.0f + 0.5f);
+		}
+	}
+
+	return WritePGM(InFilePath, W, H, Pixels);
+}
+
+bool FOcclusionHarness::DumpBuffer(const FMaskedHiZBuffer& InHiZ, const FString& InPrefix)
+{
+	if (InHiZ.Tiles.empty())
+	{
+		return false;
+	}
+
+	bool bResult = WriteCoveragePGM(InHiZ, InPrefix + "_coverage.pgm");
+	bResult &= WriteTileDepthPGM(InHiZ, InPrefix + "_z0.pgm", false);
+	bResult &= WriteTileDepthPGM(InHiZ, InPrefix + "_z1.pgm", true);
+	return bResult;
+}
@@ -0,0 +1,126 @@
+#include "pch.h"
+#include "Render/Cull/MSOCKernelsCommon.h"
+
+// ─────────────────────────────────────────────────────────────
+// Scalar
+// ─────────────────────────────────────────────────────────────
+static void BuildCoverageMask_Scalar(const FCoverageEdges& E, int TileX, int TileY, uint32 OutMask[8])
+{
+	FCoverageSetup S;
+	SetupCoverage(E, TileX, TileY, S);
+
+	for (int r = 0; r < MSOC_TILE_H; ++r)
+	{
+		OutMask[r] = 0u;
+	}
+
+	for (int ry = S.LY0; ry <= S.LY1; ++ry)
+	{
+		const float Py = float(S.Y0 + ry) + 0.5f;
+		uint32 RowMask = 0u;
+		for (int rx = S.LX0; rx <= S.LX1; ++rx)
+		{
+			const float Px = float(S.X0 + rx) + 0.5f;
+			bool bInside = true;
+			for (int e = 0; e < E.NumEdges && bInside; ++e)
+			{
+				bInside = (E.A[e] * Px + E.B[e] * Py + E.C[e]) >= 0.0f;
+			}
+			RowMask |= bInside ? (1u << rx) : 0u;
+		}
+		OutMask[ry] = RowMask;
+	}
+}
+
+/** 박스 하나의 8코너 투영 (Scalar 단일/배치 경로 공용), 코너가 하나라도 카메라 뒤면 false */
+static bool ProjectBoxCorners_Scalar(const float Lo[3], const float Hi[3], const FMatrix& M, const FOcclusionViewport& VP,
+	int ScreenW, int ScreenH, FScreenRect& R)
+{
+	float MinSX = FLT_MAX, MaxSX = -FLT_MAX, MinSY = FLT_MAX, MaxSY = -FLT_MAX, MinSZ = FLT_MAX;
+	for (int Corner = 0; Corner < 8; ++Corner)
+	{
+		float X, Y, Z;
+		CornerOfBox(Corner, Lo, Hi, X, Y, Z);
+
+		const float Hx = X * M.Data[0][0] + Y * M.Data[1][0] + Z * M.Data[2][0] + M.Data[3][0];
+		const float Hy = X * M.Data[0][1] + Y * M.Data[1][1] + Z * M.Data[2][1] + M.Data[3][1];
+		const float Hz = X * M.Data[0][2] + Y * M.Data[1][2] + Z * M.Data[2][2] + M.Data[3][2];
+		const float Hw = X * M.Data[0][3] + Y * M.Data[1][3] + Z * M.Data[2][3] + M.Data[3][3];
+		if (Hw <= 0.0f)
+		{
+			R = { 0, 0, -1, -1, 0.0f };
+			return false;
+		}
+
+		const float InvW = 1.0f / Hw;
+		const float Sx = VP.TopLeftX + (Hx * InvW * 0.5f + 0.5f) * VP.Width;
+		const float Sy = VP.TopLeftY + (0.5f - Hy * InvW * 0.5f) * VP.Height;
+		const float Sz = 0.5f + Hz * InvW * 0.5f;
+
+		MinSX = std::min(MinSX, Sx); MaxSX = std::max(MaxSX, Sx);
+		MinSY = std::min(MinSY, Sy); MaxSY = std::max(MaxSY, Sy);
+		MinSZ = std::min(MinSZ, Sz);
+	}
+
+	R.x0 = std::clamp((int)std::floor(MinSX), 0, ScreenW - 1);
+	R.x1 = std::clamp((int)std::ceil(MaxSX), 0, ScreenW - 1);
+	R.y0 = std::clamp((int)std::floor(MinSY), 0, ScreenH - 1);
+	R.y1 = std::clamp((int)std::ceil(MaxSY), 0, ScreenH - 1);
+	R.zmin = std::clamp(MinSZ, 0.0f, 1.0f);
+	return R.x0 <= R.x1 && R.y0 <= R.y1;
+}
+
+static void ProjectAABBs_Scalar(const FAABBSoA& Boxes, const FMatrix& M, const FOcclusionViewport& VP,
+	int ScreenW, int ScreenH, FScreenRect* OutRects, uint8* OutValid)
+{
+	const int32 Num = Boxes.Num();
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		const float Lo[3] = { Boxes.MinX[Index], Boxes.MinY[Index], Boxes.MinZ[Index] };
+		const float Hi[3] = { Boxes.MaxX[Index], Boxes.MaxY[Index], Boxes.MaxZ[Index] };
+		OutValid[Index] = ProjectBoxCorners_Scalar(Lo, Hi, M, VP, ScreenW, ScreenH, OutRects[Index]) ? 1 : 0;
+	}
+}
+
+static bool ProjectAABB_Scalar(const FAABB& Box, const FMatrix& M, const FOcclusionViewport& VP,
+	int ScreenW, int ScreenH, FScreenRect& OutRect)
+{
+	const float Lo[3] = { Box.Min.X, Box.Min.Y, Box.Min.Z };
+	const float Hi[3] = { Box.Max.X, Box.Max.Y, Box.Max.Z };
+	return ProjectBoxCorners_Scalar(Lo, Hi, M, VP, ScreenW, ScreenH, OutRect);
+}
+
+static void TransformTriangle_Scalar(const FSoftwareTri& Tri, const FMatrix& M, FClipVertex OutVerts[3])
+{
+	const FVector* P[3] = { &Tri.P0, &Tri.P1, &Tri.P2 };
+	for (int i = 0; i < 3; ++i)
+	{
+		const float X = P[i]->X, Y = P[i]->Y, Z = P[i]->Z;
+		OutVerts[i].X = X * M.Data[0][0] + Y * M.Data[1][0] + Z * M.Data[2][0] + M.Data[3][0];
+		OutVerts[i].Y = X * M.Data[0][1] + Y * M.Data[1][1] + Z * M.Data[2][1] + M.Data[3][1];
+		OutVerts[i].Z = X * M.Data[0][2] + Y * M.Data[1][2] + Z * M.Data[2][2] + M.Data[3][2];
+		OutVerts[i].W = X * M.Data[0][3] + Y * M.Data[1][3] + Z * M.Data[2][3] + M.Data[3][3];
+	}
+}
+
+// ─────────────────────────────────────────────────────────────
+// 테이블 (SSE4.1 이상은 MSOCKernelsSSE41/AVX2/AVX512.cpp)
+//   삼각형 변환은 정점이 3개뿐이라 상위 경로도 SSE 커널을 그대로 쓴다
+// ─────────────────────────────────────────────────────────────
+static const FOcclusionKernels GOcclusionKernels[static_cast<int>(ESIMDLevel::End)] =
+{
+	{ ESIMDLevel::Scalar, &BuildCoverageMask_Scalar, &ProjectAABBs_Scalar, &ProjectAABB_Scalar, &TransformTriangle_Scalar },
+	{ ESIMDLevel::SSE41,  &BuildCoverageMask_SSE41,  &ProjectAABBs_SSE41,  &ProjectAABB_SSE41,  &TransformTriangle_SSE41 },
+	{ ESIMDLevel::AVX2,   &BuildCoverageMask_AVX2,   &ProjectAABBs_AVX2,   &ProjectAABB_AVX2,   &TransformTriangle_SSE41 },
+	{ ESIMDLevel::AVX512, &BuildCoverageMask_AVX512, &ProjectAABBs_AVX512, &ProjectAABB_AVX512, &TransformTriangle_SSE41 },
+};
+
+const FOcclusionKernels& GetOcclusionKernels()
+{
+	return GOcclusionKernels[static_cast<int>(FCPUFeatures::GetActiveLevel())];
+}
+
+const FOcclusionKernels& GetOcclusionKernels(ESIMDLevel InLevel)
+{
+	return GOcclusionKernels[static_cast<int>(std::min(InLevel, FCPUFeatures::Get().MaxLevel))];
+}
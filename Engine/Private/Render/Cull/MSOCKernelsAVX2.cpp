@@ -0,0 +1,175 @@
+#include "Global/CoreMinimal.h"
+#include "Render/Cull/MSOCKernelsCommon.h"
+
+// ─────────────────────────────────────────────────────────────
+// AVX2 (8 lane)
+// ─────────────────────────────────────────────────────────────
+void BuildCoverageMask_AVX2(const FCoverageEdges& Edges, int TileX, int TileY, uint32 OutMask[8])
+{
+	FCoverageSetup S;
+	SetupCoverage(Edges, TileX, TileY, S);
+
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(OutMask), _mm256_setzero_si256());
+
+	// 32픽셀 = 8픽셀 × 4블록
+	const __m256 Idx = _mm256_set_ps(7.f, 6.f, 5.f, 4.f, 3.f, 2.f, 1.f, 0.f);
+	const __m256 Zero = _mm256_setzero_ps();
+	const int NumEdges = Edges.NumEdges;
+	__m256 A[MSOC_MAX_COVERAGE_EDGES], B[MSOC_MAX_COVERAGE_EDGES], C[MSOC_MAX_COVERAGE_EDGES];
+	for (int e = 0; e < NumEdges; ++e)
+	{
+		A[e] = _mm256_set1_ps(Edges.A[e]); B[e] = _mm256_set1_ps(Edges.B[e]); C[e] = _mm256_set1_ps(Edges.C[e]);
+	}
+
+	for (int ry = S.LY0; ry <= S.LY1; ++ry)
+	{
+		const __m256 Py = _mm256_set1_ps(float(S.Y0 + ry) + 0.5f);
+		__m256 Row[MSOC_MAX_COVERAGE_EDGES];
+		for (int e = 0; e < NumEdges; ++e)
+		{
+			Row[e] = _mm256_fmadd_ps(B[e], Py, C[e]);
+		}
+
+		uint32 RowMask = 0u;
+		for (int Block = 0; Block < 4; ++Block)
+		{
+			const __m256 Px = _mm256_add_ps(Idx, _mm256_set1_ps(float(S.X0 + Block * 8) + 0.5f));
+			__m256 Inside = _mm256_cmp_ps(_mm256_fmadd_ps(A[0], Px, Row[0]), Zero, _CMP_GE_OQ);
+			for (int e = 1; e < NumEdges; ++e)
+			{
+				Inside = _mm256_and_ps(Inside, _mm256_cmp_ps(_mm256_fmadd_ps(A[e], Px, Row[e]), Zero, _CMP_GE_OQ));
+			}
+			RowMask |= static_cast<uint32>(_mm256_movemask_ps(Inside)) << (Block * 8);
+		}
+		OutMask[ry] = RowMask & S.RangeMask;
+	}
+	_mm256_zeroupper();
+}
+
+void ProjectAABBs_AVX2(const FAABBSoA& Boxes, const FMatrix& Mat, const FOcclusionViewport& VP,
+	int ScreenW, int ScreenH, FScreenRect* OutRects, uint8* OutValid)
+{
+	// 행렬/뷰포트 브로드캐스트는 루프 밖에서 한 번만
+	__m256 M[4][4];
+	for (int r = 0; r < 4; ++r)
+		for (int c = 0; c < 4; ++c)
+			M[r][c] = _mm256_set1_ps(Mat.Data[r][c]);
+
+	const __m256 Half = _mm256_set1_ps(0.5f);
+	const __m256 Two = _mm256_set1_ps(2.0f);
+	const __m256 Zero = _mm256_setzero_ps();
+	const __m256 One = _mm256_set1_ps(1.0f);
+	const __m256 VTX = _mm256_set1_ps(VP.TopLeftX), VTY = _mm256_set1_ps(VP.TopLeftY);
+	const __m256 VW = _mm256_set1_ps(VP.Width), VH = _mm256_set1_ps(VP.Height);
+	const __m256 MaxX = _mm256_set1_ps(static_cast<float>(ScreenW - 1));
+	const __m256 MaxY = _mm256_set1_ps(static_cast<float>(ScreenH - 1));
+
+	alignas(32) float Scratch[6][8];
+	const int32 Num = Boxes.Num();
+	for (int32 Base = 0; Base < Num; Base += 8)
+	{
+		const int32 Count = std::min(8, Num - Base);
+		const float* Src[6];
+		GatherBoxLanes<8>(Boxes, Base, Count, Scratch, Src);
+
+		const __m256 Lo[3] = { _mm256_loadu_ps(Src[0]), _mm256_loadu_ps(Src[1]), _mm256_loadu_ps(Src[2]) };
+		const __m256 Hi[3] = { _mm256_loadu_ps(Src[3]), _mm256_loadu_ps(Src[4]), _mm256_loadu_ps(Src[5]) };
+
+		__m256 MinSX = _mm256_set1_ps(FLT_MAX), MaxSX = _mm256_set1_ps(-FLT_MAX);
+		__m256 MinSY = _mm256_set1_ps(FLT_MAX), MaxSY = _mm256_set1_ps(-FLT_MAX);
+		__m256 MinSZ = _mm256_set1_ps(FLT_MAX);
+		__m256 Behind = _mm256_setzero_ps();
+
+		// 각 코너마다 8개 박스를 동시에 투영
+		for (int Corner = 0; Corner < 8; ++Corner)
+		{
+			const __m256 X = (Corner & 1) ? Hi[0] : Lo[0];
+			const __m256 Y = (Corner & 2) ? Hi[1] : Lo[1];
+			const __m256 Z = (Corner & 4) ? Hi[2] : Lo[2];
+
+			const __m256 Hx = _mm256_fmadd_ps(X, M[0][0], _mm256_fmadd_ps(Y, M[1][0], _mm256_fmadd_ps(Z, M[2][0], M[3][0])));
+			const __m256 Hy = _mm256_fmadd_ps(X, M[0][1], _mm256_fmadd_ps(Y, M[1][1], _mm256_fmadd_ps(Z, M[2][1], M[3][1])));
+			const __m256 Hz = _mm256_fmadd_ps(X, M[0][2], _mm256_fmadd_ps(Y, M[1][2], _mm256_fmadd_ps(Z, M[2][2], M[3][2])));
+			const __m256 Hw = _mm256_fmadd_ps(X, M[0][3], _mm256_fmadd_ps(Y, M[1][3], _mm256_fmadd_ps(Z, M[2][3], M[3][3])));
+
+			Behind = _mm256_or_ps(Behind, _mm256_cmp_ps(Hw, Zero, _CMP_LE_OQ));
+
+			// 1/w (rcp + 뉴튼 1회)
+			__m256 InvW = _mm256_rcp_ps(Hw);
+			InvW = _mm256_mul_ps(InvW, _mm256_fnmadd_ps(Hw, InvW, Two));
+
+			const __m256 Sx = _mm256_fmadd_ps(_mm256_fmadd_ps(_mm256_mul_ps(Hx, InvW), Half, Half), VW, VTX);
+			const __m256 Sy = _mm256_fmadd_ps(_mm256_fnmadd_ps(_mm256_mul_ps(Hy, InvW), Half, Half), VH, VTY);
+			const __m256 Sz = _mm256_fmadd_ps(_mm256_mul_ps(Hz, InvW), Half, Half);
+
+			MinSX = _mm256_min_ps(MinSX, Sx); MaxSX = _mm256_max_ps(MaxSX, Sx);
+			MinSY = _mm256_min_ps(MinSY, Sy); MaxSY = _mm256_max_ps(MaxSY, Sy);
+			MinSZ = _mm256_min_ps(MinSZ, Sz);
+		}
+
+		// floor/ceil 후 화면으로 clamp (ProjectAABB_ToScreen과 동일한 규칙)
+		alignas(32) int32 RX0[8], RX1[8], RY0[8], RY1[8];
+		alignas(32) float RZ[8];
+		_mm256_store_si256(reinterpret_cast<__m256i*>(RX0), _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_floor_ps(MinSX), Zero), MaxX)));
+		_mm256_store_si256(reinterpret_cast<__m256i*>(RX1), _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_ceil_ps(MaxSX), Zero), MaxX)));
+		_mm256_store_si256(reinterpret_cast<__m256i*>(RY0), _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_floor_ps(MinSY), Zero), MaxY)));
+		_mm256_store_si256(reinterpret_cast<__m256i*>(RY1), _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_ceil_ps(MaxSY), Zero), MaxY)));
+		_mm256_store_ps(RZ, _mm256_min_ps(_mm256_max_ps(MinSZ, Zero), One));
+
+		WriteRects(Base, Count, RX0, RY0, RX1, RY1, RZ, static_cast<uint32>(_mm256_movemask_ps(Behind)), OutRects, OutValid);
+	}
+	_mm256_zeroupper();
+}
+
+/** 박스 하나: lane = 코너 8개, lane마다의 연산은 ProjectAABBs_AVX2와 같다 */
+bool ProjectAABB_AVX2(const FAABB& Box, const FMatrix& Mat, const FOcclusionViewport& VP,
+	int ScreenW, int ScreenH, FScreenRect& OutRect)
+{
+	const __m256 Half = _mm256_set1_ps(0.5f);
+	const __m256 Two = _mm256_set1_ps(2.0f);
+	const __m256 Zero = _mm256_setzero_ps();
+
+	const float Lo[3] = { Box.Min.X, Box.Min.Y, Box.Min.Z };
+	const float Hi[3] = { Box.Max.X, Box.Max.Y, Box.Max.Z };
+	const __m256 X = _mm256_setr_ps(Lo[0], Hi[0], Lo[0], Hi[0], Lo[0], Hi[0], Lo[0], Hi[0]);
+	const __m256 Y = _mm256_setr_ps(Lo[1], Lo[1], Hi[1], Hi[1], Lo[1], Lo[1], Hi[1], Hi[1]);
+	const __m256 Z = _mm256_setr_ps(Lo[2], Lo[2], Lo[2], Lo[2], Hi[2], Hi[2], Hi[2], Hi[2]);
+
+	auto Row = [&Mat](int r, int c) { return _mm256_set1_ps(Mat.Data[r][c]); };
+	const __m256 Hx = _mm256_fmadd_ps(X, Row(0, 0), _mm256_fmadd_ps(Y, Row(1, 0), _mm256_fmadd_ps(Z, Row(2, 0), Row(3, 0))));
+	const __m256 Hy = _mm256_fmadd_ps(X, Row(0, 1), _mm256_fmadd_ps(Y, Row(1, 1), _mm256_fmadd_ps(Z, Row(2, 1), Row(3, 1))));
+	const __m256 Hz = _mm256_fmadd_ps(X, Row(0, 2), _mm256_fmadd_ps(Y, Row(1, 2), _mm256_fmadd_ps(Z, Row(2, 2), Row(3, 2))));
+	const __m256 Hw = _mm256_fmadd_ps(X, Row(0, 3), _mm256_fmadd_ps(Y, Row(1, 3), _mm256_fmadd_ps(Z, Row(2, 3), Row(3, 3))));
+
+	if (_mm256_movemask_ps(_mm256_cmp_ps(Hw, Zero, _CMP_LE_OQ)) != 0)
+	{
+		_mm256_zeroupper();
+		OutRect = { 0, 0, -1, -1, 0.0f };
+		return false;
+	}
+
+	__m256 InvW = _mm256_rcp_ps(Hw);
+	InvW = _mm256_mul_ps(InvW, _mm256_fnmadd_ps(Hw, InvW, Two));
+
+	const __m256 Sx = _mm256_fmadd_ps(_mm256_fmadd_ps(_mm256_mul_ps(Hx, InvW), Half, Half), _mm256_set1_ps(VP.Width), _mm256_set1_ps(VP.TopLeftX));
+	const __m256 Sy = _mm256_fmadd_ps(_mm256_fnmadd_ps(_mm256_mul_ps(Hy, InvW), Half, Half), _mm256_set1_ps(VP.Height), _mm256_set1_ps(VP.TopLeftY));
+	const __m256 Sz = _mm256_fmadd_ps(_mm256_mul_ps(Hz, InvW), Half, Half);
+
+	// 상하위 128비트를 합친 뒤 4 lane 축약
+	const __m128 MinSX = HorizontalMin(_mm_min_ps(_mm256_castps256_ps128(Sx), _mm256_extractf128_ps(Sx, 1)));
+	const __m128 MaxSX = HorizontalMax(_mm_max_ps(_mm256_castps256_ps128(Sx), _mm256_extractf128_ps(Sx, 1)));
+	const __m128 MinSY = HorizontalMin(_mm_min_ps(_mm256_castps256_ps128(Sy), _mm256_extractf128_ps(Sy, 1)));
+	const __m128 MaxSY = HorizontalMax(_mm_max_ps(_mm256_castps256_ps128(Sy), _mm256_extractf128_ps(Sy, 1)));
+	const __m128 MinSZ = HorizontalMin(_mm_min_ps(_mm256_castps256_ps128(Sz), _mm256_extractf128_ps(Sz, 1)));
+	_mm256_zeroupper();
+
+	const __m128 Zero4 = _mm_setzero_ps();
+	const __m128 MaxX = _mm_set1_ps(static_cast<float>(ScreenW - 1));
+	const __m128 MaxY = _mm_set1_ps(static_cast<float>(ScreenH - 1));
+	OutRect.x0 = _mm_cvttss_si32(_mm_min_ps(_mm_max_ps(_mm_floor_ps(MinSX), Zero4), MaxX));
+	OutRect.x1 = _mm_cvttss_si32(_mm_min_ps(_mm_max_ps(_mm_ceil_ps(MaxSX), Zero4), MaxX));
+	OutRect.y0 = _mm_cvttss_si32(_mm_min_ps(_mm_max_ps(_mm_floor_ps(MinSY), Zero4), MaxY));
+	OutRect.y1 = _mm_cvttss_si32(_mm_min_ps(_mm_max_ps(_mm_ceil_ps(MaxSY), Zero4), MaxY));
+	OutRect.zmin = _mm_cvtss_f32(_mm_min_ps(_mm_max_ps(MinSZ, Zero4), _mm_set1_ps(1.0f)));
+	return OutRect.x0 <= OutRect.x1 && OutRect.y0 <= OutRect.y1;
+}
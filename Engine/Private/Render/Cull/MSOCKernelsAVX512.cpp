@@ -0,0 +1,174 @@
+#include "Global/CoreMinimal.h"
+#include "Render/Cull/MSOCKernelsCommon.h"
+
+// ─────────────────────────────────────────────────────────────
+// AVX-512 (16 lane)
+// ─────────────────────────────────────────────────────────────
+void BuildCoverageMask_AVX512(const FCoverageEdges& Edges, int TileX, int TileY, uint32 OutMask[8])
+{
+	FCoverageSetup S;
+	SetupCoverage(Edges, TileX, TileY, S);
+
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(OutMask), _mm256_setzero_si256());
+
+	// 32픽셀 = 16픽셀 × 2블록
+	const __m512 Idx = _mm512_set_ps(15.f, 14.f, 13.f, 12.f, 11.f, 10.f, 9.f, 8.f, 7.f, 6.f, 5.f, 4.f, 3.f, 2.f, 1.f, 0.f);
+	const __m512 Zero = _mm512_setzero_ps();
+	const int NumEdges = Edges.NumEdges;
+	__m512 A[MSOC_MAX_COVERAGE_EDGES], B[MSOC_MAX_COVERAGE_EDGES], C[MSOC_MAX_COVERAGE_EDGES];
+	for (int e = 0; e < NumEdges; ++e)
+	{
+		A[e] = _mm512_set1_ps(Edges.A[e]); B[e] = _mm512_set1_ps(Edges.B[e]); C[e] = _mm512_set1_ps(Edges.C[e]);
+	}
+
+	for (int ry = S.LY0; ry <= S.LY1; ++ry)
+	{
+		const __m512 Py = _mm512_set1_ps(float(S.Y0 + ry) + 0.5f);
+		__m512 Row[MSOC_MAX_COVERAGE_EDGES];
+		for (int e = 0; e < NumEdges; ++e)
+		{
+			Row[e] = _mm512_fmadd_ps(B[e], Py, C[e]);
+		}
+
+		uint32 RowMask = 0u;
+		for (int Block = 0; Block < 2; ++Block)
+		{
+			const __m512 Px = _mm512_add_ps(Idx, _mm512_set1_ps(float(S.X0 + Block * 16) + 0.5f));
+			__mmask16 Inside = _mm512_cmp_ps_mask(_mm512_fmadd_ps(A[0], Px, Row[0]), Zero, _CMP_GE_OQ);
+			for (int e = 1; e < NumEdges; ++e)
+			{
+				Inside = _mm512_mask_cmp_ps_mask(Inside, _mm512_fmadd_ps(A[e], Px, Row[e]), Zero, _CMP_GE_OQ);
+			}
+			RowMask |= static_cast<uint32>(Inside) << (Block * 16);
+		}
+		OutMask[ry] = RowMask & S.RangeMask;
+	}
+	_mm256_zeroupper();
+}
+
+void ProjectAABBs_AVX512(const FAABBSoA& Boxes, const FMatrix& Mat, const FOcclusionViewport& VP,
+	int ScreenW, int ScreenH, FScreenRect* OutRects, uint8* OutValid)
+{
+	__m512 M[4][4];
+	for (int r = 0; r < 4; ++r)
+		for (int c = 0; c < 4; ++c)
+			M[r][c] = _mm512_set1_ps(Mat.Data[r][c]);
+
+	const __m512 Half = _mm512_set1_ps(0.5f);
+	const __m512 Two = _mm512_set1_ps(2.0f);
+	const __m512 Zero = _mm512_setzero_ps();
+	const __m512 One = _mm512_set1_ps(1.0f);
+	const __m512 VTX = _mm512_set1_ps(VP.TopLeftX), VTY = _mm512_set1_ps(VP.TopLeftY);
+	const __m512 VW = _mm512_set1_ps(VP.Width), VH = _mm512_set1_ps(VP.Height);
+	const __m512 MaxX = _mm512_set1_ps(static_cast<float>(ScreenW - 1));
+	const __m512 MaxY = _mm512_set1_ps(static_cast<float>(ScreenH - 1));
+
+	alignas(64) float Scratch[6][16];
+	const int32 Num = Boxes.Num();
+	for (int32 Base = 0; Base < Num; Base += 16)
+	{
+		const int32 Count = std::min(16, Num - Base);
+		const float* Src[6];
+		GatherBoxLanes<16>(Boxes, Base, Count, Scratch, Src);
+
+		const __m512 Lo[3] = { _mm512_loadu_ps(Src[0]), _mm512_loadu_ps(Src[1]), _mm512_loadu_ps(Src[2]) };
+		const __m512 Hi[3] = { _mm512_loadu_ps(Src[3]), _mm512_loadu_ps(Src[4]), _mm512_loadu_ps(Src[5]) };
+
+		__m512 MinSX = _mm512_set1_ps(FLT_MAX), MaxSX = _mm512_set1_ps(-FLT_MAX);
+		__m512 MinSY = _mm512_set1_ps(FLT_MAX), MaxSY = _mm512_set1_ps(-FLT_MAX);
+		__m512 MinSZ = _mm512_set1_ps(FLT_MAX);
+		__mmask16 Behind = 0;
+
+		for (int Corner = 0; Corner < 8; ++Corner)
+		{
+			const __m512 X = (Corner & 1) ? Hi[0] : Lo[0];
+			const __m512 Y = (Corner & 2) ? Hi[1] : Lo[1];
+			const __m512 Z = (Corner & 4) ? Hi[2] : Lo[2];
+
+			const __m512 Hx = _mm512_fmadd_ps(X, M[0][0], _mm512_fmadd_ps(Y, M[1][0], _mm512_fmadd_ps(Z, M[2][0], M[3][0])));
+			const __m512 Hy = _mm512_fmadd_ps(X, M[0][1], _mm512_fmadd_ps(Y, M[1][1], _mm512_fmadd_ps(Z, M[2][1], M[3][1])));
+			const __m512 Hz = _mm512_fmadd_ps(X, M[0][2], _mm512_fmadd_ps(Y, M[1][2], _mm512_fmadd_ps(Z, M[2][2], M[3][2])));
+			const __m512 Hw = _mm512_fmadd_ps(X, M[0][3], _mm512_fmadd_ps(Y, M[1][3], _mm512_fmadd_ps(Z, M[2][3], M[3][3])));
+
+			Behind |= _mm512_cmp_ps_mask(Hw, Zero, _CMP_LE_OQ);
+
+			__m512 InvW = _mm512_rcp14_ps(Hw);
+			InvW = _mm512_mul_ps(InvW, _mm512_fnmadd_ps(Hw, InvW, Two));
+
+			const __m512 Sx = _mm512_fmadd_ps(_mm512_fmadd_ps(_mm512_mul_ps(Hx, InvW), Half, Half), VW, VTX);
+			const __m512 Sy = _mm512_fmadd_ps(_mm512_fnmadd_ps(_mm512_mul_ps(Hy, InvW), Half, Half), VH, VTY);
+			const __m512 Sz = _mm512_fmadd_ps(_mm512_mul_ps(Hz, InvW), Half, Half);
+
+			MinSX = _mm512_min_ps(MinSX, Sx); MaxSX = _mm512_max_ps(MaxSX, Sx);
+			MinSY = _mm512_min_ps(MinSY, Sy); MaxSY = _mm512_max_ps(MaxSY, Sy);
+			MinSZ = _mm512_min_ps(MinSZ, Sz);
+		}
+
+		constexpr int Floor = _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC;
+		constexpr int Ceil = _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC;
+
+		alignas(64) int32 RX0[16], RX1[16], RY0[16], RY1[16];
+		alignas(64) float RZ[16];
+		_mm512_store_si512(RX0, _mm512_cvttps_epi32(_mm512_min_ps(_mm512_max_ps(_mm512_roundscale_ps(MinSX, Floor), Zero), MaxX)));
+		_mm512_store_si512(RX1, _mm512_cvttps_epi32(_mm512_min_ps(_mm512_max_ps(_mm512_roundscale_ps(MaxSX, Ceil), Zero), MaxX)));
+		_mm512_store_si512(RY0, _mm512_cvttps_epi32(_mm512_min_ps(_mm512_max_ps(_mm512_roundscale_ps(MinSY, Floor), Zero), MaxY)));
+		_mm512_store_si512(RY1, _mm512_cvttps_epi32(_mm512_min_ps(_mm512_max_ps(_mm512_roundscale_ps(MaxSY, Ceil), Zero), MaxY)));
+		_mm512_store_ps(RZ, _mm512_min_ps(_mm512_max_ps(MinSZ, Zero), One));
+
+		WriteRects(Base, Count, RX0, RY0, RX1, RY1, RZ, static_cast<uint32>(Behind), OutRects, OutValid);
+	}
+	_mm256_zeroupper();
+}
+
+/** 박스 하나: 16 lane에 코너 8개를 두 번 넣는다, lane마다의 연산은 ProjectAABBs_AVX512와 같다 */
+bool ProjectAABB_AVX512(const FAABB& Box, const FMatrix& Mat, const FOcclusionViewport& VP,
+	int ScreenW, int ScreenH, FScreenRect& OutRect)
+{
+	const __m512 Half = _mm512_set1_ps(0.5f);
+	const __m512 Two = _mm512_set1_ps(2.0f);
+	const __m512 Zero = _mm512_setzero_ps();
+
+	const float Lo[3] = { Box.Min.X, Box.Min.Y, Box.Min.Z };
+	const float Hi[3] = { Box.Max.X, Box.Max.Y, Box.Max.Z };
+	const __m512 X = _mm512_setr_ps(Lo[0], Hi[0], Lo[0], Hi[0], Lo[0], Hi[0], Lo[0], Hi[0],
+		Lo[0], Hi[0], Lo[0], Hi[0], Lo[0], Hi[0], Lo[0], Hi[0]);
+	const __m512 Y = _mm512_setr_ps(Lo[1], Lo[1], Hi[1], Hi[1], Lo[1], Lo[1], Hi[1], Hi[1],
+		Lo[1], Lo[1], Hi[1], Hi[1], Lo[1], Lo[1], Hi[1], Hi[1]);
+	const __m512 Z = _mm512_setr_ps(Lo[2], Lo[2], Lo[2], Lo[2], Hi[2], Hi[2], Hi[2], Hi[2],
+		Lo[2], Lo[2], Lo[2], Lo[2], Hi[2], Hi[2], Hi[2], Hi[2]);
+
+	auto Row = [&Mat](int r, int c) { return _mm512_set1_ps(Mat.Data[r][c]); };
+	const __m512 Hx = _mm512_fmadd_ps(X, Row(0, 0), _mm512_fmadd_ps(Y, Row(1, 0), _mm512_fmadd_ps(Z, Row(2, 0), Row(3, 0))));
+	const __m512 Hy = _mm512_fmadd_ps(X, Row(0, 1), _mm512_fmadd_ps(Y, Row(1, 1), _mm512_fmadd_ps(Z, Row(2, 1), Row(3, 1))));
+	const __m512 Hz = _mm512_fmadd_ps(X, Row(0, 2), _mm512_fmadd_ps(Y, Row(1, 2), _mm512_fmadd_ps(Z, Row(2, 2), Row(3, 2))));
+	const __m512 Hw = _mm512_fmadd_ps(X, Row(0, 3), _mm512_fmadd_ps(Y, Row(1, 3), _mm512_fmadd_ps(Z, Row(2, 3), Row(3, 3))));
+
+	if (_mm512_cmp_ps_mask(Hw, Zero, _CMP_LE_OQ) != 0)
+	{
+		_mm256_zeroupper();
+		OutRect = { 0, 0, -1, -1, 0.0f };
+		return false;
+	}
+
+	__m512 InvW = _mm512_rcp14_ps(Hw);
+	InvW = _mm512_mul_ps(InvW, _mm512_fnmadd_ps(Hw, InvW, Two));
+
+	const __m512 Sx = _mm512_fmadd_ps(_mm512_fmadd_ps(_mm512_mul_ps(Hx, InvW), Half, Half), _mm512_set1_ps(VP.Width), _mm512_set1_ps(VP.TopLeftX));
+	const __m512 Sy = _mm512_fmadd_ps(_mm512_fnmadd_ps(_mm512_mul_ps(Hy, InvW), Half, Half), _mm512_set1_ps(VP.Height), _mm512_set1_ps(VP.TopLeftY));
+	const __m512 Sz = _mm512_fmadd_ps(_mm512_mul_ps(Hz, InvW), Half, Half);
+
+	const float MinSX = _mm512_reduce_min_ps(Sx), MaxSX = _mm512_reduce_max_ps(Sx);
+	const float MinSY = _mm512_reduce_min_ps(Sy), MaxSY = _mm512_reduce_max_ps(Sy);
+	const float MinSZ = _mm512_reduce_min_ps(Sz);
+	_mm256_zeroupper();
+
+	const __m128 Zero4 = _mm_setzero_ps();
+	const __m128 MaxX = _mm_set1_ps(static_cast<float>(ScreenW - 1));
+	const __m128 MaxY = _mm_set1_ps(static_cast<float>(ScreenH - 1));
+	OutRect.x0 = _mm_cvttss_si32(_mm_min_ps(_mm_max_ps(_mm_floor_ps(_mm_set1_ps(MinSX)), Zero4), MaxX));
+	OutRect.x1 = _mm_cvttss_si32(_mm_min_ps(_mm_max_ps(_mm_ceil_ps(_mm_set1_ps(MaxSX)), Zero4), MaxX));
+	OutRect.y0 = _mm_cvttss_si32(_mm_min_ps(_mm_max_ps(_mm_floor_ps(_mm_set1_ps(MinSY)), Zero4), MaxY));
+	OutRect.y1 = _mm_cvttss_si32(_mm_min_ps(_mm_max_ps(_mm_ceil_ps(_mm_set1_ps(MaxSY)), Zero4), MaxY));
+	OutRect.zmin = _mm_cvtss_f32(_mm_min_ps(_mm_max_ps(_mm_set1_ps(MinSZ), Zero4), _mm_set1_ps(1.0f)));
+	return OutRect.x0 <= OutRect.x1 && OutRect.y0 <= OutRect.y1;
+}
@@ -0,0 +1,204 @@
+#include "Global/CoreMinimal.h"
+#include "Render/Cull/MSOCKernelsCommon.h"
+
+// ─────────────────────────────────────────────────────────────
+// SSE4.1 (4 lane)
+// ─────────────────────────────────────────────────────────────
+void BuildCoverageMask_SSE41(const FCoverageEdges& Edges, int TileX, int TileY, uint32 OutMask[8])
+{
+	FCoverageSetup S;
+	SetupCoverage(Edges, TileX, TileY, S);
+
+	for (int r = 0; r < MSOC_TILE_H; ++r)
+	{
+		OutMask[r] = 0u;
+	}
+
+	const __m128 Idx = _mm_set_ps(3.f, 2.f, 1.f, 0.f);
+	const __m128 Zero = _mm_setzero_ps();
+	const int NumEdges = Edges.NumEdges;
+	__m128 A[MSOC_MAX_COVERAGE_EDGES], B[MSOC_MAX_COVERAGE_EDGES], C[MSOC_MAX_COVERAGE_EDGES];
+	for (int e = 0; e < NumEdges; ++e)
+	{
+		A[e] = _mm_set1_ps(Edges.A[e]); B[e] = _mm_set1_ps(Edges.B[e]); C[e] = _mm_set1_ps(Edges.C[e]);
+	}
+
+	for (int ry = S.LY0; ry <= S.LY1; ++ry)
+	{
+		const __m128 Py = _mm_set1_ps(float(S.Y0 + ry) + 0.5f);
+		// y 항은 행마다 한 번만
+		__m128 Row[MSOC_MAX_COVERAGE_EDGES];
+		for (int e = 0; e < NumEdges; ++e)
+		{
+			Row[e] = _mm_add_ps(_mm_mul_ps(B[e], Py), C[e]);
+		}
+
+		uint32 RowMask = 0u;
+		for (int Block = 0; Block < 8; ++Block)
+		{
+			const __m128 Px = _mm_add_ps(Idx, _mm_set1_ps(float(S.X0 + Block * 4) + 0.5f));
+			__m128 Inside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(A[0], Px), Row[0]), Zero);
+			for (int e = 1; e < NumEdges; ++e)
+			{
+				Inside = _mm_and_ps(Inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(A[e], Px), Row[e]), Zero));
+			}
+			RowMask |= static_cast<uint32>(_mm_movemask_ps(Inside)) << (Block * 4);
+		}
+		OutMask[ry] = RowMask & S.RangeMask;
+	}
+}
+
+void ProjectAABBs_SSE41(const FAABBSoA& Boxes, const FMatrix& Mat, const FOcclusionViewport& VP,
+	int ScreenW, int ScreenH, FScreenRect* OutRects, uint8* OutValid)
+{
+	__m128 M[4][4];
+	for (int r = 0; r < 4; ++r)
+		for (int c = 0; c < 4; ++c)
+			M[r][c] = _mm_set1_ps(Mat.Data[r][c]);
+
+	const __m128 Half = _mm_set1_ps(0.5f);
+	const __m128 Two = _mm_set1_ps(2.0f);
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 One = _mm_set1_ps(1.0f);
+	const __m128 VTX = _mm_set1_ps(VP.TopLeftX), VTY = _mm_set1_ps(VP.TopLeftY);
+	const __m128 VW = _mm_set1_ps(VP.Width), VH = _mm_set1_ps(VP.Height);
+	const __m128 MaxX = _mm_set1_ps(static_cast<float>(ScreenW - 1));
+	const __m128 MaxY = _mm_set1_ps(static_cast<float>(ScreenH - 1));
+
+	alignas(16) float Scratch[6][4];
+	const int32 Num = Boxes.Num();
+	for (int32 Base = 0; Base < Num; Base += 4)
+	{
+		const int32 Count = std::min(4, Num - Base);
+		const float* Src[6];
+		GatherBoxLanes<4>(Boxes, Base, Count, Scratch, Src);
+
+		const __m128 Lo[3] = { _mm_loadu_ps(Src[0]), _mm_loadu_ps(Src[1]), _mm_loadu_ps(Src[2]) };
+		const __m128 Hi[3] = { _mm_loadu_ps(Src[3]), _mm_loadu_ps(Src[4]), _mm_loadu_ps(Src[5]) };
+
+		__m128 MinSX = _mm_set1_ps(FLT_MAX), MaxSX = _mm_set1_ps(-FLT_MAX);
+		__m128 MinSY = _mm_set1_ps(FLT_MAX), MaxSY = _mm_set1_ps(-FLT_MAX);
+		__m128 MinSZ = _mm_set1_ps(FLT_MAX);
+		__m128 Behind = _mm_setzero_ps();
+
+		for (int Corner = 0; Corner < 8; ++Corner)
+		{
+			const __m128 X = (Corner & 1) ? Hi[0] : Lo[0];
+			const __m128 Y = (Corner & 2) ? Hi[1] : Lo[1];
+			const __m128 Z = (Corner & 4) ? Hi[2] : Lo[2];
+
+			const __m128 Hx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M[0][0]), _mm_mul_ps(Y, M[1][0])), _mm_add_ps(_mm_mul_ps(Z, M[2][0]), M[3][0]));
+			const __m128 Hy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M[0][1]), _mm_mul_ps(Y, M[1][1])), _mm_add_ps(_mm_mul_ps(Z, M[2][1]), M[3][1]));
+			const __m128 Hz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M[0][2]), _mm_mul_ps(Y, M[1][2])), _mm_add_ps(_mm_mul_ps(Z, M[2][2]), M[3][2]));
+			const __m128 Hw = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M[0][3]), _mm_mul_ps(Y, M[1][3])), _mm_add_ps(_mm_mul_ps(Z, M[2][3]), M[3][3]));
+
+			Behind = _mm_or_ps(Behind, _mm_cmple_ps(Hw, Zero));
+
+			__m128 InvW = _mm_rcp_ps(Hw);
+			InvW = _mm_mul_ps(InvW, _mm_sub_ps(Two, _mm_mul_ps(Hw, InvW)));
+
+			const __m128 Sx = _mm_add_ps(VTX, _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(Hx, InvW), Half), Half), VW));
+			const __m128 Sy = _mm_add_ps(VTY, _mm_mul_ps(_mm_sub_ps(Half, _mm_mul_ps(_mm_mul_ps(Hy, InvW), Half)), VH));
+			const __m128 Sz = _mm_add_ps(Half, _mm_mul_ps(_mm_mul_ps(Hz, InvW), Half));
+
+			MinSX = _mm_min_ps(MinSX, Sx); MaxSX = _mm_max_ps(MaxSX, Sx);
+			MinSY = _mm_min_ps(MinSY, Sy); MaxSY = _mm_max_ps(MaxSY, Sy);
+			MinSZ = _mm_min_ps(MinSZ, Sz);
+		}
+
+		alignas(16) int32 RX0[4], RX1[4], RY0[4], RY1[4];
+		alignas(16) float RZ[4];
+		_mm_store_si128(reinterpret_cast<__m128i*>(RX0), _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_floor_ps(MinSX), Zero), MaxX)));
+		_mm_store_si128(reinterpret_cast<__m128i*>(RX1), _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_ceil_ps(MaxSX), Zero), MaxX)));
+		_mm_store_si128(reinterpret_cast<__m128i*>(RY0), _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_floor_ps(MinSY), Zero), MaxY)));
+		_mm_store_si128(reinterpret_cast<__m128i*>(RY1), _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_ceil_ps(MaxSY), Zero), MaxY)));
+		_mm_store_ps(RZ, _mm_min_ps(_mm_max_ps(MinSZ, Zero), One));
+
+		WriteRects(Base, Count, RX0, RY0, RX1, RY1, RZ, static_cast<uint32>(_mm_movemask_ps(Behind)), OutRects, OutValid);
+	}
+}
+
+/**
+ * 박스 하나: lane = 코너 (bit0 = X, bit1 = Y), Min.Z 면과 Max.Z 면을 두 번에 나눠 투영한다
+ * lane마다의 연산은 ProjectAABBs_SSE41과 같다.
+ */
+bool ProjectAABB_SSE41(const FAABB& Box, const FMatrix& Mat, const FOcclusionViewport& VP,
+	int ScreenW, int ScreenH, FScreenRect& OutRect)
+{
+	__m128 M[4][4];
+	for (int r = 0; r < 4; ++r)
+		for (int c = 0; c < 4; ++c)
+			M[r][c] = _mm_set1_ps(Mat.Data[r][c]);
+
+	const __m128 Half = _mm_set1_ps(0.5f);
+	const __m128 Two = _mm_set1_ps(2.0f);
+	const __m128 Zero = _mm_setzero_ps();
+	const __m128 One = _mm_set1_ps(1.0f);
+	const __m128 VTX = _mm_set1_ps(VP.TopLeftX), VTY = _mm_set1_ps(VP.TopLeftY);
+	const __m128 VW = _mm_set1_ps(VP.Width), VH = _mm_set1_ps(VP.Height);
+
+	const __m128 X = _mm_setr_ps(Box.Min.X, Box.Max.X, Box.Min.X, Box.Max.X);
+	const __m128 Y = _mm_setr_ps(Box.Min.Y, Box.Min.Y, Box.Max.Y, Box.Max.Y);
+	const float FaceZ[2] = { Box.Min.Z, Box.Max.Z };
+
+	__m128 MinSX = _mm_set1_ps(FLT_MAX), MaxSX = _mm_set1_ps(-FLT_MAX);
+	__m128 MinSY = _mm_set1_ps(FLT_MAX), MaxSY = _mm_set1_ps(-FLT_MAX);
+	__m128 MinSZ = _mm_set1_ps(FLT_MAX);
+	__m128 Behind = _mm_setzero_ps();
+
+	for (int Face = 0; Face < 2; ++Face)
+	{
+		const __m128 Z = _mm_set1_ps(FaceZ[Face]);
+
+		const __m128 Hx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M[0][0]), _mm_mul_ps(Y, M[1][0])), _mm_add_ps(_mm_mul_ps(Z, M[2][0]), M[3][0]));
+		const __m128 Hy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M[0][1]), _mm_mul_ps(Y, M[1][1])), _mm_add_ps(_mm_mul_ps(Z, M[2][1]), M[3][1]));
+		const __m128 Hz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M[0][2]), _mm_mul_ps(Y, M[1][2])), _mm_add_ps(_mm_mul_ps(Z, M[2][2]), M[3][2]));
+		const __m128 Hw = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M[0][3]), _mm_mul_ps(Y, M[1][3])), _mm_add_ps(_mm_mul_ps(Z, M[2][3]), M[3][3]));
+
+		Behind = _mm_or_ps(Behind, _mm_cmple_ps(Hw, Zero));
+
+		__m128 InvW = _mm_rcp_ps(Hw);
+		InvW = _mm_mul_ps(InvW, _mm_sub_ps(Two, _mm_mul_ps(Hw, InvW)));
+
+		const __m128 Sx = _mm_add_ps(VTX, _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(Hx, InvW), Half), Half), VW));
+		const __m128 Sy = _mm_add_ps(VTY, _mm_mul_ps(_mm_sub_ps(Half, _mm_mul_ps(_mm_mul_ps(Hy, InvW), Half)), VH));
+		const __m128 Sz = _mm_add_ps(Half, _mm_mul_ps(_mm_mul_ps(Hz, InvW), Half));
+
+		MinSX = _mm_min_ps(MinSX, Sx); MaxSX = _mm_max_ps(MaxSX, Sx);
+		MinSY = _mm_min_ps(MinSY, Sy); MaxSY = _mm_max_ps(MaxSY, Sy);
+		MinSZ = _mm_min_ps(MinSZ, Sz);
+	}
+
+	if (_mm_movemask_ps(Behind) != 0)
+	{
+		OutRect = { 0, 0, -1, -1, 0.0f };
+		return false;
+	}
+
+	const __m128 MaxX = _mm_set1_ps(static_cast<float>(ScreenW - 1));
+	const __m128 MaxY = _mm_set1_ps(static_cast<float>(ScreenH - 1));
+	OutRect.x0 = _mm_cvttss_si32(_mm_min_ps(_mm_max_ps(_mm_floor_ps(HorizontalMin(MinSX)), Zero), MaxX));
+	OutRect.x1 = _mm_cvttss_si32(_mm_min_ps(_mm_max_ps(_mm_ceil_ps(HorizontalMax(MaxSX)), Zero), MaxX));
+	OutRect.y0 = _mm_cvttss_si32(_mm_min_ps(_mm_max_ps(_mm_floor_ps(HorizontalMin(MinSY)), Zero), MaxY));
+	OutRect.y1 = _mm_cvttss_si32(_mm_min_ps(_mm_max_ps(_mm_ceil_ps(HorizontalMax(MaxSY)), Zero), MaxY));
+	OutRect.zmin = _mm_cvtss_f32(_mm_min_ps(_mm_max_ps(HorizontalMin(MinSZ), Zero), One));
+	return OutRect.x0 <= OutRect.x1 && OutRect.y0 <= OutRect.y1;
+}
+
+void TransformTriangle_SSE41(const FSoftwareTri& Tri, const FMatrix& Mat, FClipVertex OutVerts[3])
+{
+	// 행 벡터 규칙: H = x * row0 + y * row1 + z * row2 + row3
+	const __m128 R0 = _mm_loadu_ps(Mat.Data[0]);
+	const __m128 R1 = _mm_loadu_ps(Mat.Data[1]);
+	const __m128 R2 = _mm_loadu_ps(Mat.Data[2]);
+	const __m128 R3 = _mm_loadu_ps(Mat.Data[3]);
+
+	const FVector* P[3] = { &Tri.P0, &Tri.P1, &Tri.P2 };
+	for (int i = 0; i < 3; ++i)
+	{
+		const __m128 H = _mm_add_ps(
+			_mm_add_ps(_mm_mul_ps(_mm_set1_ps(P[i]->X), R0), _mm_mul_ps(_mm_set1_ps(P[i]->Y), R1)),
+			_mm_add_ps(_mm_mul_ps(_mm_set1_ps(P[i]->Z), R2), R3));
+		_mm_storeu_ps(&OutVerts[i].X, H);
+	}
+}
@@ -0,0 +1,87 @@
+#include "pch.h"
+#include "Render/Renderer/BillboardBatcher.h"
+
+void FBillboardBatcher::Reset()
+{
+	// 용량은 유지해서 매 프레임 재할당하지 않는다
+	Sprites.clear();
+	BatchIndexByTexture.clear();
+	Batches.clear();
+	Vertices.clear();
+}
+
+void FBillboardBatcher::AddSprite(ID3D11ShaderResourceView* InTexture, const FVector& InCenter, const FVector& InRight,
+	const FVector& InUp, float InHalfWidth, float InHalfHeight, const FVector4& InUVRect, const FVector4& InColor, uint32 InUUID)
+{
+	if (!InTexture)
+	{
+		return;
+	}
+
+	// 텍스처마다 처음 본 순서대로 묶음 번호를 준다
+	auto [It, bInserted] = BatchIndexByTexture.try_emplace(InTexture, static_cast<uint32>(Batches.size()));
+	if (bInserted)
+	{
+		FBillboardBatch Batch;
+		Batch.Texture = InTexture;
+		Batches.push_back(Batch);
+	}
+	Batches[It->second].NumVertices += VerticesPerSprite;
+
+	const FVector Right = InRight * InHalfWidth;
+	const FVector Up = InUp * InHalfHeight;
+
+	FPendingSprite Sprite;
+	Sprite.Texture = InTexture;
+	Sprite.BatchIndex = It->second;
+	Sprite.Corners[0] = InCenter - Right - Up;
+	Sprite.Corners[1] = InCenter + Right - Up;
+	Sprite.Corners[2] = InCenter + Right + Up;
+	Sprite.Corners[3] = InCenter - Right + Up;
+	Sprite.UVRect = InUVRect;
+	Sprite.Color = InColor;
+	Sprite.UUID = InUUID;
+	Sprites.push_back(Sprite);
+}
+
+void FBillboardBatcher::Build()
+{
+	// 묶음별 시작 위치 (묶음 크기는 AddSprite에서 이미 셌다)
+	uint32 FirstVertex = 0;
+	for (FBillboardBatch& Batch : Batches)
+	{
+		Batch.FirstVertex = FirstVertex;
+		FirstVertex += Batch.NumVertices;
+	}
+	Vertices.resize(FirstVertex);
+
+	// 묶음 안에서는 추가된 순서(뒤→앞)를 유지하며 펼친다
+	TArray<uint32> WriteCursor(Batches.size());
+	for (size_t Index = 0; Index < Batches.size(); ++Index)
+	{
+		WriteCursor[Index] = Batches[Index].FirstVertex;
+	}
+
+	for (const FPendingSprite& Sprite : Sprites)
+	{
+		const float U = Sprite.UVRect.X;
+		const float V = Sprite.UVRect.Y;
+		const float UL = Sprite.UVRect.Z;
+		const float VL = Sprite.UVRect.W;
+
+		// 좌하 → 우하 → 우상, 좌하 → 우상 → 좌상 (텍스처 V는 아래로 증가)
+		const FVector2 CornerUVs[4] = { { U, V + VL }, { U + UL, V + VL }, { U + UL, V }, { U, V } };
+		static constexpr uint32 CornerOrder[VerticesPerSprite] = { 0, 1, 2, 0, 2, 3 };
+
+		FBillboardVertex* Out = Vertices.data() + WriteCursor[Sprite.BatchIndex];
+		for (uint32 Corner : CornerOrder)
+		{
+			Out->Position = Sprite.Corners[Corner];
+			Out->UV = CornerUVs[Corner];
+			Out->Color = Sprite.Color;
+			Out->UUID = Sprite.UUID;
+			++Out;
+		}
+		WriteCursor[Sprite.BatchIndex] += VerticesPerSprite;
+	}
+}
@@ -120,19 +120,6 @@ void UDeviceResources::CreateIdBuffer()
 
 	Device->CreateTexture2D(&TextureDesc, nullptr, &IdBuffer);
 
-	TextureDesc.Format = DXGI_FORMAT_R32_UINT;
-	TextureDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
-	TextureDesc.Usage = D3D11_USAGE_STAGING;
-	TextureDesc.Width = Width;
-	TextureDesc.Height = Height;
-	TextureDesc.MipLevels = 1;
-	TextureDesc.ArraySize = 1;
-	TextureDesc.SampleDesc.Count = 1;
-	TextureDesc.SampleDesc.Quality = 0;
-	TextureDesc.BindFlags = 0;
-
-	Device->CreateTexture2D(&TextureDesc, nullptr, &IdStagingBuffer);
-
     Device->CreateRenderTargetView(IdBuffer, nullptr, &IdBufferRTV);
 
 }
@@ -144,11 +131,6 @@ void UDeviceResources::ReleaseIdBuffer()
         IdBufferRTV->Release();
         IdBufferRTV = nullptr;
     }
-    if (IdStagingBuffer)
-    {
-        IdStagingBuffer->Release();
-        IdStagingBuffer = nullptr;
-    }
     if (IdBuffer)
     {
         IdBuffer->Release();
@@ -0,0 +1,328 @@
+#include "pch.h"
+#include "Render/Renderer/DrawList.h"
+#include "Global/ParallelFor.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <tuple>
+
+namespace
+{
+	FORCEINLINE uint64 ClampField(uint32 InValue, uint32 InBits)
+	{
+		const uint32 MaxValue = (1u << InBits) - 1u;
+		return static_cast<uint64>(std::min(InValue, MaxValue));
+	}
+
+	// 이보다 적으면 스레드 분배 비용이 정렬보다 크다
+	constexpr int32 ParallelRadixThreshold = 16384;
+	constexpr int32 RadixBuckets = 256;
+}
+
+uint32 DrawSortKey::QuantizeDepth(float InDepth)
+{
+	if (!(InDepth > 0.0f))
+	{
+		return 0u;
+	}
+
+	uint32 Bits;
+	std::memcpy(&Bits, &InDepth, sizeof(Bits));
+	// 부호 비트는 0이므로 상위 24비트(지수 + 가수 상위 16비트)만 남긴다
+	return (Bits >> (32 - DepthBits - 1)) & ((1u << DepthBits) - 1u);
+}
+
+uint64 DrawSortKey::MakeOpaque(uint32 InPipeline, uint32 InMesh, uint32 InSection, uint32 InMaterial, float InDepth)
+{
+	uint64 Key = static_cast<uint64>(EDrawPass::Opaque) << 62;
+	Key |= ClampField(InPipeline, PipelineBits) << 56;
+	Key |= ClampField(InMesh, MeshBits) << 42;
+	Key |= ClampField(InSection, SectionBits) << 36;
+	Key |= ClampField(InMaterial, MaterialBits) << 24;
+	Key |= static_cast<uint64>(QuantizeDepth(InDepth));
+	return Key;
+}
+
+uint64 DrawSortKey::MakeTranslucent(EDrawPass InPass, uint32 InPipeline, uint32 InMesh, uint32 InSection, uint32 InMaterial, float InDepth)
+{
+	// 멀리 있는 것부터 → 깊이를 뒤집어 오름차순 정렬에 맞춘다
+	const uint32 InvertedDepth = ((1u << DepthBits) - 1u) - QuantizeDepth(InDepth);
+
+	uint64 Key = static_cast<uint64>(InPass) << 62;
+	Key |= static_cast<uint64>(InvertedDepth) << 38;
+	Key |= ClampField(InPipeline, PipelineBits) << 32;
+	Key |= ClampField(InMesh, MeshBits) << 18;
+	Key |= ClampField(InSection, SectionBits) << 12;
+	Key |= ClampField(InMaterial, MaterialBits);
+	return Key;
+}
+
+void RadixSortDrawCommands(TArray<FDrawCommand>& InOutCommands, TArray<FDrawCommand>& InScratch, bool bInForceSingleThread)
+{
+	const int32 Num = static_cast<int32>(InOutCommands.size());
+	if (Num <= 1)
+	{
+		return;
+	}
+	InScratch.resize(Num);
+
+	const bool bParallel = !bInForceSingleThread && Num >= ParallelRadixThreshold && GetParallelForThreadCount() > 1;
+	const int32 NumChunks = bParallel ? std::min(GetParallelForThreadCount() * 2, Num / (ParallelRadixThreshold / 4)) : 1;
+	const int32 ChunkSize = (Num + NumChunks - 1) / NumChunks;
+
+	// 청크별 256칸 히스토그램 (청크 → 버킷 오프셋으로 재사용)
+	TArray<uint32> Histograms(static_cast<size_t>(NumChunks) * RadixBuckets);
+
+	FDrawCommand* Source = InOutCommands.data();
+	FDrawCommand* Destination = InScratch.data();
+
+	// 모든 키에서 같은 바이트를 찾기 위한 AND/OR
+	uint64 AllAnd = ~0ull, AllOr = 0ull;
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		AllAnd &= Source[Index].SortKey;
+		AllOr |= Source[Index].SortKey;
+	}
+	const uint64 VaryingBits = AllAnd ^ AllOr;
+
+	for (uint32 Shift = 0; Shift < 64; Shift += 8)
+	{
+		if (((VaryingBits >> Shift) & 0xFFull) == 0)
+		{
+			continue;
+		}
+
+		std::fill(Histograms.begin(), Histograms.end(), 0u);
+
+		ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			uint32* Histogram = Histograms.data() + static_cast<size_t>(Chunk) * RadixBuckets;
+			const int32 Begin = Chunk * ChunkSize;
+			const int32 End = std::min(Num, Begin + ChunkSize);
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				++Histogram[(Source[Index].SortKey >> Shift) & 0xFF];
+			}
+		}, !bParallel);
+
+		// 버킷 우선, 청크 순으로 누적 → 청크끼리도 원래 순서가 유지되어 안정 정렬
+		uint32 Offset = 0;
+		for (int32 Bucket = 0; Bucket < RadixBuckets; ++Bucket)
+		{
+			for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+			{
+				uint32& Count = Histograms[static_cast<size_t>(Chunk) * RadixBuckets + Bucket];
+				const uint32 ChunkCount = Count;
+				Count = Offset;
+				Offset += ChunkCount;
+			}
+		}
+
+		ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			uint32* Offsets = Histograms.data() + static_cast<size_t>(Chunk) * RadixBuckets;
+			const int32 Begin = Chunk * ChunkSize;
+			const int32 End = std::min(Num, Begin + ChunkSize);
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				Destination[Offsets[(Source[Index].SortKey >> Shift) & 0xFF]++] = Source[Index];
+			}
+		}, !bParallel);
+
+		std::swap(Source, Destination);
+	}
+
+	// 홀수 번 분배했으면 결과가 스크래치에 있다
+	if (Source != InOutCommands.data())
+	{
+		InOutCommands.swap(InScratch);
+	}
+}
+
+void FDrawList::Reset()
+{
+	Commands.clear();
+	FullStates.clear();
+	MeshIds.clear();
+	MaterialIds.clear();
+	bFieldOverflow = false;
+}
+
+uint32 FDrawList::GetStateId(TMap<const void*, uint32>& InOutIds, const void* InState)
+{
+	if (!InState)
+	{
+		return 0u;
+	}
+
+	// 0은 "상태 없음"으로 남겨 둔다
+	auto [It, bInserted] = InOutIds.try_emplace(InState, static_cast<uint32>(InOutIds.size()) + 1u);
+	return It->second;
+}
+
+uint32 FDrawList::GetMeshId(const void* InMesh)
+{
+	return GetStateId(MeshIds, InMesh);
+}
+
+uint32 FDrawList::GetMaterialId(const void* InMaterial)
+{
+	return GetStateId(MaterialIds, InMaterial);
+}
+
+void FDrawList::AddCommand(uint64 InSortKey, const FFullState& InState, uint32 InPayload)
+{
+	using namespace DrawSortKey;
+	bFieldOverflow |= InState.Pipeline >= (1u << PipelineBits)
+		|| InState.Mesh >= (1u << MeshBits)
+		|| InState.Section >= (1u << SectionBits)
+		|| InState.Material >= (1u << MaterialBits);
+
+	FDrawCommand Command;
+	Command.SortKey = InSortKey;
+	Command.Payload = InPayload;
+	Commands.push_back(Command);
+	FullStates.push_back(InState);
+}
+
+void FDrawList::AddOpaque(uint32 InPipeline, const void* InMesh, uint32 InSection, const void* InMaterial, float InDepth, uint32 InPayload)
+{
+	const FFullState State = { InPipeline, GetMeshId(InMesh), InSection, GetMaterialId(InMaterial) };
+	AddCommand(DrawSortKey::MakeOpaque(State.Pipeline, State.Mesh, State.Section, State.Material, InDepth), State, InPayload);
+}
+
+void FDrawList::AddTranslucent(EDrawPass InPass, uint32 InPipeline, const void* InMesh, uint32 InSection, const void* InMaterial,
+	float InDepth, uint32 InPayload)
+{
+	const FFullState State = { InPipeline, GetMeshId(InMesh), InSection, GetMaterialId(InMaterial) };
+	AddCommand(DrawSortKey::MakeTranslucent(InPass, State.Pipeline, State.Mesh, State.Section, State.Material, InDepth), State, InPayload);
+}
+
+void FDrawList::Sort()
+{
+	if (bFieldOverflow)
+	{
+		SortWithFullStates();
+		return;
+	}
+	RadixSortDrawCommands(Commands, Scratch);
+}
+
+void FDrawList::SortWithFullStates()
+{
+	using namespace DrawSortKey;
+	constexpr uint64 DepthMask = (1ull << DepthBits) - 1ull;
+
+	const uint32 Num = static_cast<uint32>(Commands.size());
+	SortOrder.resize(Num);
+	for (uint32 Index = 0; Index < Num; ++Index)
+	{
+		SortOrder[Index] = Index;
+	}
+
+	// 키 레이아웃과 같은 우선순위: 패스 → (불투명) 상태, 깊이 / (반투명) 뒤집은 깊이, 상태
+	std::stable_sort(SortOrder.begin(), SortOrder.end(), [this](uint32 A, uint32 B)
+	{
+		const uint64 KeyA = Commands[A].SortKey;
+		const uint64 KeyB = Commands[B].SortKey;
+		const EDrawPass PassA = GetPass(KeyA);
+		const EDrawPass PassB = GetPass(KeyB);
+		if (PassA != PassB)
+		{
+			return PassA < PassB;
+		}
+
+		const FFullState& StateA = FullStates[A];
+		const FFullState& StateB = FullStates[B];
+		const auto TieA = std::tie(StateA.Pipeline, StateA.Mesh, StateA.Section, StateA.Material);
+		const auto TieB = std::tie(StateB.Pipeline, StateB.Mesh, StateB.Section, StateB.Material);
+
+		if (PassA == EDrawPass::Opaque)
+		{
+			if (TieA != TieB)
+			{
+				return TieA < TieB;
+			}
+			return (KeyA & DepthMask) < (KeyB & DepthMask);
+		}
+
+		const uint64 DepthA = (KeyA >> 38) & DepthMask;
+		const uint64 DepthB = (KeyB >> 38) & DepthMask;
+		if (DepthA != DepthB)
+		{
+			return DepthA < DepthB;
+		}
+		return TieA < TieB;
+	});
+
+	Scratch.resize(Num);
+	TArray<FFullState> SortedStates(Num);
+	for (uint32 Index = 0; Index < Num; ++Index)
+	{
+		Scratch[Index] = Commands[SortOrder[Index]];
+		SortedStates[Index] = FullStates[SortOrder[Index]];
+	}
+	Commands.swap(Scratch);
+	FullStates.swap(SortedStates);
+}
+
+void FDrawList::Benchmark(int32 InNum, FDrawListBenchmarkResult& OutResult)
+{
+	OutResult = FDrawListBenchmarkResult();
+	OutResult.NumCommands = InNum;
+	OutResult.bMatchesStdSort = true;
+	if (InNum <= 0)
+	{
+		return;
+	}
+
+	// 메시 64종, 머티리얼 32종을 가진 장면을 흉내 낸다 (포인터 대신 주소 값만 사용)
+	std::mt19937 Random(1234);
+	std::uniform_int_distribution<int32> MeshDist(1, 64);
+	std::uniform_int_distribution<int32> MaterialDist(1, 32);
+	std::uniform_real_distribution<float> DepthDist(0.1f, 1000.0f);
+
+	struct FSource { uintptr_t Mesh; uintptr_t Material; float Depth; };
+	TArray<FSource> Sources(InNum);
+	for (FSource& Source : Sources)
+	{
+		Source = { static_cast<uintptr_t>(MeshDist(Random)) * 64, static_cast<uintptr_t>(MaterialDist(Random)) * 64 + 4096, DepthDist(Random) };
+	}
+
+	FDrawList List;
+	const uint64 BuildStart = FPlatformTime::Cycles64();
+	for (int32 Index = 0; Index < InNum; ++Index)
+	{
+		const FSource& Source = Sources[Index];
+		List.AddOpaque(0, reinterpret_cast<const void*>(Source.Mesh), 0, reinterpret_cast<const void*>(Source.Material), Source.Depth, Index);
+	}
+	OutResult.BuildMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - BuildStart);
+
+	const TArray<FDrawCommand> Unsorted = List.Commands;
+
+	TArray<FDrawCommand> Reference = Unsorted;
+	const uint64 StdStart = FPlatformTime::Cycles64();
+	std::stable_sort(Reference.begin(), Reference.end(),
+		[](const FDrawCommand& A, const FDrawCommand& B) { return A.SortKey < B.SortKey; });
+	OutResult.StdSortMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StdStart);
+
+	TArray<FDrawCommand> Single = Unsorted;
+	TArray<FDrawCommand> Scratch;
+	const uint64 SingleStart = FPlatformTime::Cycles64();
+	RadixSortDrawCommands(Single, Scratch, true);
+	OutResult.RadixSortSingleThreadMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - SingleStart);
+
+	const uint64 RadixStart = FPlatformTime::Cycles64();
+	List.Sort();
+	OutResult.RadixSortMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - RadixStart);
+
+	for (int32 Index = 0; Index < InNum; ++Index)
+	{
+		if (List.Commands[Index].Payload != Reference[Index].Payload || Single[Index].Payload != Reference[Index].Payload)
+		{
+			OutResult.bMatchesStdSort = false;
+			break;
+		}
+	}
+}
@@ -0,0 +1,84 @@
+#include "pch.h"
+#include "Render/Renderer/DynamicRingBuffer.h"
+
+namespace
+{
+	// 처음 만들 때 최소 크기 (빌보드 약 1000장 분량)
+	constexpr uint32 MinRingBytes = 256 * 1024;
+}
+
+void FDynamicRingBuffer::Release()
+{
+	if (Buffer)
+	{
+		Buffer->Release();
+		Buffer = nullptr;
+	}
+	CapacityBytes = 0;
+	CursorBytes = 0;
+}
+
+bool FDynamicRingBuffer::EnsureCapacity(ID3D11Device* InDevice, uint32 InRequiredBytes)
+{
+	if (Buffer && CapacityBytes >= InRequiredBytes)
+	{
+		return true;
+	}
+
+	const uint32 NewCapacity = std::max({ MinRingBytes, InRequiredBytes, CapacityBytes * 2 });
+	Release();
+
+	D3D11_BUFFER_DESC Desc = {};
+	Desc.ByteWidth = NewCapacity;
+	Desc.Usage = D3D11_USAGE_DYNAMIC;
+	Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+	Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+	if (FAILED(InDevice->CreateBuffer(&Desc, nullptr, &Buffer)))
+	{
+		Buffer = nullptr;
+		return false;
+	}
+
+	CapacityBytes = NewCapacity;
+	// 새 버퍼는 GPU가 쓰고 있을 리 없지만 첫 Map은 DISCARD여야 한다
+	CursorBytes = CapacityBytes;
+	return true;
+}
+
+bool FDynamicRingBuffer::Write(ID3D11Device* InDevice, ID3D11DeviceContext* InContext, const void* InData, uint32 InCount,
+	uint32 InStride, uint32& OutFirstElement)
+{
+	if (InCount == 0 || InStride == 0)
+	{
+		return false;
+	}
+
+	const uint32 Bytes = InCount * InStride;
+	if (!EnsureCapacity(InDevice, Bytes))
+	{
+		return false;
+	}
+
+	// 시작 위치를 Stride 배수로 맞춰야 원소 번호로 Draw할 수 있다
+	uint32 Offset = (CursorBytes + InStride - 1) / InStride * InStride;
+	D3D11_MAP MapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+	if (Offset + Bytes > CapacityBytes)
+	{
+		Offset = 0;
+		MapType = D3D11_MAP_WRITE_DISCARD;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE Mapped = {};
+	if (FAILED(InContext->Map(Buffer, 0, MapType, 0, &Mapped)))
+	{
+		return false;
+	}
+	std::memcpy(static_cast<uint8*>(Mapped.pData) + Offset, InData, Bytes);
+	InContext->Unmap(Buffer, 0);
+
+	CursorBytes = Offset + Bytes;
+	bLastWriteDiscard = (MapType == D3D11_MAP_WRITE_DISCARD);
+	OutFirstElement = Offset / InStride;
+	return true;
+}
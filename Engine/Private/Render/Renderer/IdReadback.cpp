@@ -0,0 +1,193 @@
+#include "pch.h"
+#include "Render/Renderer/IdReadback.h"
+
+void FIdReadback::Release()
+{
+	for (FStagingSlot& Slot : Slots)
+	{
+		if (Slot.Staging)
+		{
+			Slot.Staging->Release();
+			Slot.Staging = nullptr;
+		}
+		Slot.bPending = false;
+	}
+
+	if (ImmediateStaging)
+	{
+		ImmediateStaging->Release();
+		ImmediateStaging = nullptr;
+	}
+
+	WriteSlot = 0;
+	bHasResolved = false;
+}
+
+void FIdReadback::Invalidate()
+{
+	// 스테이징은 영역 크기 고정이라 다시 만들 필요 없이 결과만 버린다
+	for (FStagingSlot& Slot : Slots)
+	{
+		Slot.bPending = false;
+	}
+	bHasResolved = false;
+}
+
+bool FIdReadback::MakeRegion(ID3D11Texture2D* InIdBuffer, int32 InCenterX, int32 InCenterY, D3D11_BOX& OutRegion)
+{
+	D3D11_TEXTURE2D_DESC Desc = {};
+	InIdBuffer->GetDesc(&Desc);
+	const int32 Width = static_cast<int32>(Desc.Width);
+	const int32 Height = static_cast<int32>(Desc.Height);
+	if (Width <= 0 || Height <= 0 || InCenterX < 0 || InCenterY < 0 || InCenterX >= Width || InCenterY >= Height)
+	{
+		return false;
+	}
+
+	// 가장자리에서는 영역을 안쪽으로 밀어 넣는다 (화면이 영역보다 작으면 잘린다)
+	const int32 Left = std::clamp(InCenterX - RegionSize / 2, 0, std::max(0, Width - RegionSize));
+	const int32 Top = std::clamp(InCenterY - RegionSize / 2, 0, std::max(0, Height - RegionSize));
+
+	OutRegion.left = static_cast<UINT>(Left);
+	OutRegion.top = static_cast<UINT>(Top);
+	OutRegion.right = static_cast<UINT>(std::min(Left + RegionSize, Width));
+	OutRegion.bottom = static_cast<UINT>(std::min(Top + RegionSize, Height));
+	OutRegion.front = 0;
+	OutRegion.back = 1;
+	return true;
+}
+
+bool FIdReadback::EnsureStaging(ID3D11Device* InDevice, ID3D11Texture2D*& InOutStaging)
+{
+	if (InOutStaging)
+	{
+		return true;
+	}
+
+	D3D11_TEXTURE2D_DESC Desc = {};
+	Desc.Format = DXGI_FORMAT_R32_UINT;
+	Desc.Width = RegionSize;
+	Desc.Height = RegionSize;
+	Desc.MipLevels = 1;
+	Desc.ArraySize = 1;
+	Desc.SampleDesc.Count = 1;
+	Desc.Usage = D3D11_USAGE_STAGING;
+	Desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+
+	if (FAILED(InDevice->CreateTexture2D(&Desc, nullptr, &InOutStaging)))
+	{
+		InOutStaging = nullptr;
+		return false;
+	}
+	return true;
+}
+
+void FIdReadback::Resolve(const D3D11_MAPPED_SUBRESOURCE& InMapped, const D3D11_BOX& InRegion)
+{
+	const uint32 Width = InRegion.right - InRegion.left;
+	const uint32 Height = InRegion.bottom - InRegion.top;
+	ResolvedIds.resize(static_cast<size_t>(Width) * Height);
+
+	const uint8* Src = static_cast<const uint8*>(InMapped.pData);
+	for (uint32 Row = 0; Row < Height; ++Row)
+	{
+		memcpy(ResolvedIds.data() + static_cast<size_t>(Row) * Width, Src + static_cast<size_t>(Row) * InMapped.RowPitch,
+			Width * sizeof(uint32));
+	}
+
+	ResolvedRegion = InRegion;
+	bHasResolved = true;
+}
+
+void FIdReadback::Tick(ID3D11Device* InDevice, ID3D11DeviceContext* InContext, ID3D11Texture2D* InIdBuffer,
+	int32 InCursorX, int32 InCursorY)
+{
+	if (!InIdBuffer)
+	{
+		return;
+	}
+
+	// 오래된 슬롯부터 수거: 아직 GPU가 안 끝냈으면 그 뒤 슬롯도 안 끝났으므로 멈춘다
+	for (uint32 Age = 0; Age < NumStagingSlots; ++Age)
+	{
+		FStagingSlot& Slot = Slots[(WriteSlot + Age) % NumStagingSlots];
+		if (!Slot.bPending)
+		{
+			continue;
+		}
+
+		D3D11_MAPPED_SUBRESOURCE Mapped = {};
+		const HRESULT Hr = InContext->Map(Slot.Staging, 0, D3D11_MAP_READ, D3D11_MAP_FLAG_DO_NOT_WAIT, &Mapped);
+		if (Hr == DXGI_ERROR_WAS_STILL_DRAWING)
+		{
+			break;
+		}
+
+		Slot.bPending = false;
+		if (SUCCEEDED(Hr))
+		{
+			Resolve(Mapped, Slot.Region);
+			InContext->Unmap(Slot.Staging, 0);
+		}
+	}
+
+	// 커서가 ID 버퍼 밖이면 새로 복사하지 않는다 (마지막 결과는 유지)
+	D3D11_BOX Region = {};
+	if (!MakeRegion(InIdBuffer, InCursorX, InCursorY, Region))
+	{
+		return;
+	}
+
+	// 링이 한 바퀴 돌 때까지 안 끝난 슬롯은 결과를 버리고 덮어쓴다
+	FStagingSlot& Slot = Slots[WriteSlot];
+	if (!EnsureStaging(InDevice, Slot.Staging))
+	{
+		return;
+	}
+
+	InContext->CopySubresourceRegion(Slot.Staging, 0, 0, 0, 0, InIdBuffer, 0, &Region);
+	Slot.Region = Region;
+	Slot.bPending = true;
+	WriteSlot = (WriteSlot + 1) % NumStagingSlots;
+}
+
+bool FIdReadback::TryGetId(int32 InX, int32 InY, uint32& OutId) const
+{
+	if (!bHasResolved || InX < 0 || InY < 0)
+	{
+		return false;
+	}
+
+	const uint32 X = static_cast<uint32>(InX);
+	const uint32 Y = static_cast<uint32>(InY);
+	if (X < ResolvedRegion.left || X >= ResolvedRegion.right || Y < ResolvedRegion.top || Y >= ResolvedRegion.bottom)
+	{
+		return false;
+	}
+
+	const uint32 Width = ResolvedRegion.right - ResolvedRegion.left;
+	OutId = ResolvedIds[static_cast<size_t>(Y - ResolvedRegion.top) * Width + (X - ResolvedRegion.left)];
+	return true;
+}
+
+bool FIdReadback::ReadIdImmediate(ID3D11Device* InDevice, ID3D11DeviceContext* InContext, ID3D11Texture2D* InIdBuffer,
+	int32 InX, int32 InY, uint32& OutId)
+{
+	D3D11_BOX Region = {};
+	if (!InIdBuffer || !MakeRegion(InIdBuffer, InX, InY, Region) || !EnsureStaging(InDevice, ImmediateStaging))
+	{
+		return false;
+	}
+
+	InContext->CopySubresourceRegion(ImmediateStaging, 0, 0, 0, 0, InIdBuffer, 0, &Region);
+
+	D3D11_MAPPED_SUBRESOURCE Mapped = {};
+	if (FAILED(InContext->Map(ImmediateStaging, 0, D3D11_MAP_READ, 0, &Mapped)))
+	{
+		return false;
+	}
+	Resolve(Mapped, Region);
+	InContext->Unmap(ImmediateStaging, 0);
+
+	return TryGetId(InX, InY, OutId);
+}
@@ -0,0 +1,92 @@
+#include "pch.h"
+#include "Render/Renderer/InstanceBatcher.h"
+
+void FInstanceBatcher::Reset()
+{
+	// 용량은 유지해서 매 프레임 재할당하지 않는다
+	Pending.clear();
+	DrawList.Reset();
+	MeshRanges.clear();
+	Batches.clear();
+	InstanceData.clear();
+}
+
+void FInstanceBatcher::AddInstance(UStaticMesh* InMesh, int32 InSectionIndex, const UMaterial* InMaterial,
+	uint32 InIndexStart, uint32 InIndexCount, const FMatrix& InWorld, uint32 InUUID, float InViewDepth, const FVector4& InColor)
+{
+	if (!InMesh || InIndexCount == 0)
+	{
+		return;
+	}
+
+	Pending.push_back({ InMesh, InMaterial, InSectionIndex, InIndexStart, InIndexCount, InUUID, InViewDepth, InWorld, InColor });
+}
+
+void FInstanceBatcher::Build()
+{
+	MeshRanges.clear();
+	Batches.clear();
+	InstanceData.clear();
+
+	const uint32 NumPending = static_cast<uint32>(Pending.size());
+	if (NumPending == 0)
+	{
+		return;
+	}
+
+	// 원본 대신 (정렬 키, 인덱스)만 정렬 (FPendingInstance는 행렬 때문에 크다)
+	// 기수 정렬은 안정 정렬이라 키가 같으면 추가된 순서가 유지되어 결과가 프레임마다 흔들리지 않는다
+	DrawList.Reset();
+	for (uint32 Index = 0; Index < NumPending; ++Index)
+	{
+		const FPendingInstance& Instance = Pending[Index];
+		DrawList.AddOpaque(0, Instance.Mesh, static_cast<uint32>(Instance.SectionIndex), Instance.Material, Instance.ViewDepth, Index);
+	}
+	DrawList.Sort();
+
+	const TArray<FDrawCommand>& SortedCommands = DrawList.GetCommands();
+
+	InstanceData.resize(NumPending);
+
+	uint32 MeshFirstInstance = 0;
+	for (uint32 Sorted = 0; Sorted < NumPending; ++Sorted)
+	{
+		const FPendingInstance& Instance = Pending[SortedCommands[Sorted].Payload];
+
+		FInstanceGPUData& GPUData = InstanceData[Sorted];
+		GPUData.World = Instance.World;
+		GPUData.Color = Instance.Color;
+		GPUData.UUID = Instance.UUID;
+
+		// 메시가 바뀌면 새 구간 시작
+		if (MeshRanges.empty() || MeshRanges.back().Mesh != Instance.Mesh)
+		{
+			FInstanceMeshRange Range;
+			Range.Mesh = Instance.Mesh;
+			Range.FirstInstance = Sorted;
+			Range.FirstBatch = static_cast<int32>(Batches.size());
+			MeshRanges.push_back(Range);
+			MeshFirstInstance = Sorted;
+		}
+		++MeshRanges.back().NumInstances;
+
+		// 섹션/머티리얼이 바뀌면 새 배치 시작
+		const bool bNewBatch = Batches.empty()
+			|| MeshRanges.back().NumBatches == 0
+			|| Batches.back().SectionIndex != Instance.SectionIndex
+			|| Batches.back().Material != Instance.Material;
+		if (bNewBatch)
+		{
+			FInstanceBatch Batch;
+			Batch.Mesh = Instance.Mesh;
+			Batch.SectionIndex = Instance.SectionIndex;
+			Batch.Material = Instance.Material;
+			Batch.IndexStart = Instance.IndexStart;
+			Batch.IndexCount = Instance.IndexCount;
+			Batch.FirstInstance = Sorted - MeshFirstInstance;
+			Batches.push_back(Batch);
+			++MeshRanges.back().NumBatches;
+		}
+		++Batches.back().NumInstances;
+	}
+}
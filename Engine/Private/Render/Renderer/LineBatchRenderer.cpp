@@ -269,6 +269,7 @@ void ULineBatchRenderer::UpdateVertexBuffer()
 	{
 		memcpy(MappedResource.pData, BatchedVertices.data(), CurrentVertexCount * sizeof(FVertex));
 		DeviceContext->Unmap(DynamicVertexBuffer, 0);
+		Renderer.GetRenderStats().AddUpload(CurrentVertexCount * sizeof(FVertex));
 	}
 }
 
@@ -287,6 +288,7 @@ void ULineBatchRenderer::UpdateIndexBuffer()
 	{
 		memcpy(MappedResource.pData, BatchedIndices.data(), CurrentIndexCount * sizeof(uint32));
 		DeviceContext->Unmap(DynamicIndexBuffer, 0);
+		Renderer.GetRenderStats().AddUpload(CurrentIndexCount * sizeof(uint32));
 	}
 }
 
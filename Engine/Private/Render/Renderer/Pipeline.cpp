@@ -1,9 +1,17 @@
 #include "pch.h"
 #include "Render/Renderer/Pipeline.h"
 #include "Public/Manager/Resource/ResourceManager.h"
+
+// EPipelineTopology는 D3D11 값을 그대로 쓴다
+static_assert(static_cast<uint32>(EPipelineTopology::PointList) == D3D11_PRIMITIVE_TOPOLOGY_POINTLIST);
+static_assert(static_cast<uint32>(EPipelineTopology::LineList) == D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
+static_assert(static_cast<uint32>(EPipelineTopology::LineStrip) == D3D11_PRIMITIVE_TOPOLOGY_LINESTRIP);
+static_assert(static_cast<uint32>(EPipelineTopology::TriangleList) == D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+static_assert(static_cast<uint32>(EPipelineTopology::TriangleStrip) == D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+
 /// @brief 그래픽 파이프라인을 관리하는 클래스
 UPipeline::UPipeline(ID3D11DeviceContext* InDeviceContext, ID3D11Device* InDevice)
-	: DeviceContext(InDeviceContext), Device(InDevice)
+	: DeviceContext(InDeviceContext), Device(InDevice), ContextAdapter(InDeviceContext), StateCache(ContextAdapter)
 {
 	CreateBlendState();
 	CreateDepthStencilState();
@@ -52,93 +60,173 @@ const FPipelineInfo& UPipeline::GetOrCreatePipelineState(const FPipelineDescKey&
 
 }
 
-/// @brief 파이프라인 상태를 업데이트
+/// @brief 파이프라인 상태를 업데이트 (이미 바인딩된 상태는 건너뜀)
 void UPipeline::UpdatePipeline(FPipelineInfo Info)
 {
-	DeviceContext->IASetPrimitiveTopology(Info.Topology);
-	if (Info.InputLayout)
-		DeviceContext->IASetInputLayout(Info.InputLayout);
-	if (Info.VertexShader)
-		DeviceContext->VSSetShader(Info.VertexShader, nullptr, 0);
-	if (Info.RasterizerState)
-		DeviceContext->RSSetState(Info.RasterizerState);
-	if (Info.DepthStencilState)
-		DeviceContext->OMSetDepthStencilState(Info.DepthStencilState, 0);
-	if (Info.PixelShader)
-		DeviceContext->PSSetShader(Info.PixelShader, nullptr, 0);
-	if (Info.BlendState)
-		DeviceContext->OMSetBlendState(Info.BlendState, nullptr, 0xffffffff);
+	FPipelineStateDesc Desc;
+	Desc.InputLayout = FInputLayoutHandle(Info.InputLayout);
+	Desc.VertexShader = FVertexShaderHandle(Info.VertexShader);
+	Desc.RasterizerState = FRasterizerStateHandle(Info.RasterizerState);
+	Desc.DepthStencilState = FDepthStencilStateHandle(Info.DepthStencilState);
+	Desc.PixelShader = FPixelShaderHandle(Info.PixelShader);
+	Desc.BlendState = FBlendStateHandle(Info.BlendState);
+	Desc.Topology = static_cast<EPipelineTopology>(Info.Topology);
+	StateCache.SetPipeline(Desc);
 }
 
 /// @brief 정점 버퍼를 바인딩
 void UPipeline::SetVertexBuffer(ID3D11Buffer* VertexBuffer, uint32 Stride)
 {
-	uint32 Offset = 0;
-	DeviceContext->IASetVertexBuffers(0, 1, &VertexBuffer, &Stride, &Offset);
+	StateCache.SetVertexBuffer(0, FBufferHandle(VertexBuffer), Stride);
 }
 
 void UPipeline::SetInstanceBuffer(ID3D11Buffer* InstanceBuffer, uint32 Stride)
 {
-	uint32 Offset = 0;
-	DeviceContext->IASetVertexBuffers(1, 1, &InstanceBuffer, &Stride, &Offset);
+	StateCache.SetVertexBuffer(1, FBufferHandle(InstanceBuffer), Stride);
 }
 
 /// @brief 상수 버퍼를 설정
 void UPipeline::SetConstantBuffer(uint32 Slot, bool bIsVS, ID3D11Buffer* ConstantBuffer)
 {
-	if (ConstantBuffer)
-	{
-		if (bIsVS)
-			DeviceContext->VSSetConstantBuffers(Slot, 1, &ConstantBuffer);
-		else
-			DeviceContext->PSSetConstantBuffers(Slot, 1, &ConstantBuffer);
-	}
+	StateCache.SetConstantBuffer(Slot, bIsVS, FBufferHandle(ConstantBuffer));
 }
 
 /// @brief 셰이더 리소스 뷰 설정
 void UPipeline::SetShaderResourceView(uint32 Slot, bool bIsVS, ID3D11ShaderResourceView* ShaderResourceView)
 {
-	if (bIsVS)
-		DeviceContext->VSSetShaderResources(Slot, 1, &ShaderResourceView);
-	else
-		DeviceContext->PSSetShaderResources(Slot, 1, &ShaderResourceView);
+	StateCache.SetShaderResourceView(Slot, bIsVS, FShaderResourceHandle(ShaderResourceView));
 }
 
 /// @brief 샘플러 상태를 설정
 void UPipeline::SetSamplerState(uint32 Slot, bool bIsVS, ID3D11SamplerState* SamplerState)
 {
-	if (bIsVS)
-		DeviceContext->VSSetSamplers(Slot, 1, &SamplerState);
-	else
-		DeviceContext->PSSetSamplers(Slot, 1, &SamplerState);
+	StateCache.SetSamplerState(Slot, bIsVS, FSamplerHandle(SamplerState));
 }
 
 /// @brief 정점 개수를 기반으로 드로우 호출
 void UPipeline::Draw(uint32 VertexCount, uint32 StartLocation)
 {
-	DeviceContext->Draw(VertexCount, StartLocation);
+	StateCache.Draw(VertexCount, StartLocation);
 }
 
 void UPipeline::DrawInstanced(uint32 VertexCountPerInstance, uint32 InstanceCount, uint32 VertexStartLocation, uint32 InstanceStartLocation)
 {
-	DeviceContext->DrawInstanced(VertexCountPerInstance, InstanceCount, VertexStartLocation, InstanceStartLocation);
+	StateCache.DrawInstanced(VertexCountPerInstance, InstanceCount, VertexStartLocation, InstanceStartLocation);
 }
 
 /// @brief 인덱스 버퍼를 설정
 void UPipeline::SetIndexBuffer(ID3D11Buffer* IndexBuffer, DXGI_FORMAT Format)
 {
-	DeviceContext->IASetIndexBuffer(IndexBuffer, Format, 0);
+	StateCache.SetIndexBuffer(FBufferHandle(IndexBuffer), static_cast<uint32>(Format));
 }
 
 /// @brief 인덱스 버퍼를 사용한 드로우 호출
 void UPipeline::DrawIndexed(uint32 IndexCount, uint32 StartIndexLocation, int32 BaseVertexLocation)
 {
-	DeviceContext->DrawIndexed(IndexCount, StartIndexLocation, BaseVertexLocation);
+	StateCache.DrawIndexed(IndexCount, StartIndexLocation, BaseVertexLocation);
 }
 
 void UPipeline::DrawIndexedInstanced(uint32 IndexCountPerInstance, uint32 InstanceCount, uint32 StartIndexLocation, int32 BaseVertexLocation, uint32 StartInstanceLocation)
 {
-	DeviceContext->DrawIndexedInstanced(IndexCountPerInstance, InstanceCount, StartIndexLocation, BaseVertexLocation, StartInstanceLocation);
+	StateCache.DrawIndexedInstanced(IndexCountPerInstance, InstanceCount, StartIndexLocation, BaseVertexLocation, StartInstanceLocation);
+}
+
+// =================================================================
+// FD3D11PipelineContext
+// =================================================================
+
+void FD3D11PipelineContext::SetPrimitiveTopology(EPipelineTopology InTopology)
+{
+	DeviceContext->IASetPrimitiveTopology(static_cast<D3D11_PRIMITIVE_TOPOLOGY>(InTopology));
+}
+
+void FD3D11PipelineContext::SetInputLayout(FInputLayoutHandle InInputLayout)
+{
+	DeviceContext->IASetInputLayout(static_cast<ID3D11InputLayout*>(InInputLayout.Ptr));
+}
+
+void FD3D11PipelineContext::SetVertexShader(FVertexShaderHandle InVertexShader)
+{
+	DeviceContext->VSSetShader(static_cast<ID3D11VertexShader*>(InVertexShader.Ptr), nullptr, 0);
+}
+
+void FD3D11PipelineContext::SetPixelShader(FPixelShaderHandle InPixelShader)
+{
+	DeviceContext->PSSetShader(static_cast<ID3D11PixelShader*>(InPixelShader.Ptr), nullptr, 0);
+}
+
+void FD3D11PipelineContext::SetRasterizerState(FRasterizerStateHandle InRasterizerState)
+{
+	DeviceContext->RSSetState(static_cast<ID3D11RasterizerState*>(InRasterizerState.Ptr));
+}
+
+void FD3D11PipelineContext::SetDepthStencilState(FDepthStencilStateHandle InDepthStencilState)
+{
+	DeviceContext->OMSetDepthStencilState(static_cast<ID3D11DepthStencilState*>(InDepthStencilState.Ptr), 0);
+}
+
+void FD3D11PipelineContext::SetBlendState(FBlendStateHandle InBlendState)
+{
+	DeviceContext->OMSetBlendState(static_cast<ID3D11BlendState*>(InBlendState.Ptr), nullptr, 0xffffffff);
+}
+
+void FD3D11PipelineContext::SetVertexBuffer(uint32 InSlot, FBufferHandle InBuffer, uint32 InStride, uint32 InOffset)
+{
+	ID3D11Buffer* Buffer = static_cast<ID3D11Buffer*>(InBuffer.Ptr);
+	DeviceContext->IASetVertexBuffers(InSlot, 1, &Buffer, &InStride, &InOffset);
+}
+
+void FD3D11PipelineContext::SetIndexBuffer(FBufferHandle InBuffer, uint32 InFormat, uint32 InOffset)
+{
+	DeviceContext->IASetIndexBuffer(static_cast<ID3D11Buffer*>(InBuffer.Ptr), static_cast<DXGI_FORMAT>(InFormat), InOffset);
+}
+
+void FD3D11PipelineContext::SetConstantBuffer(uint32 InSlot, bool bInIsVS, FBufferHandle InBuffer)
+{
+	ID3D11Buffer* Buffer = static_cast<ID3D11Buffer*>(InBuffer.Ptr);
+	if (bInIsVS)
+		DeviceContext->VSSetConstantBuffers(InSlot, 1, &Buffer);
+	else
+		DeviceContext->PSSetConstantBuffers(InSlot, 1, &Buffer);
+}
+
+void FD3D11PipelineContext::SetShaderResourceView(uint32 InSlot, bool bInIsVS, FShaderResourceHandle InView)
+{
+	ID3D11ShaderResourceView* View = static_cast<ID3D11ShaderResourceView*>(InView.Ptr);
+	if (bInIsVS)
+		DeviceContext->VSSetShaderResources(InSlot, 1, &View);
+	else
+		DeviceContext->PSSetShaderResources(InSlot, 1, &View);
+}
+
+void FD3D11PipelineContext::SetSamplerState(uint32 InSlot, bool bInIsVS, FSamplerHandle InSampler)
+{
+	ID3D11SamplerState* Sampler = static_cast<ID3D11SamplerState*>(InSampler.Ptr);
+	if (bInIsVS)
+		DeviceContext->VSSetSamplers(InSlot, 1, &Sampler);
+	else
+		DeviceContext->PSSetSamplers(InSlot, 1, &Sampler);
+}
+
+void FD3D11PipelineContext::Draw(uint32 InVertexCount, uint32 InStartVertex)
+{
+	DeviceContext->Draw(InVertexCount, InStartVertex);
+}
+
+void FD3D11PipelineContext::DrawInstanced(uint32 InVertexCountPerInstance, uint32 InInstanceCount, uint32 InStartVertex, uint32 InStartInstance)
+{
+	DeviceContext->DrawInstanced(InVertexCountPerInstance, InInstanceCount, InStartVertex, InStartInstance);
+}
+
+void FD3D11PipelineContext::DrawIndexed(uint32 InIndexCount, uint32 InStartIndex, int32 InBaseVertex)
+{
+	DeviceContext->DrawIndexed(InIndexCount, InStartIndex, InBaseVertex);
+}
+
+void FD3D11PipelineContext::DrawIndexedInstanced(uint32 InIndexCountPerInstance, uint32 InInstanceCount, uint32 InStartIndex,
+	int32 InBaseVertex, uint32 InStartInstance)
+{
+	DeviceContext->DrawIndexedInstanced(InIndexCountPerInstance, InInstanceCount, InStartIndex, InBaseVertex, InStartInstance);
 }
 
 
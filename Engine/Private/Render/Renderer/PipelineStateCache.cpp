@@ -0,0 +1,189 @@
+#include "pch.h"
+#include "Render/Renderer/PipelineStateCache.h"
+
+FPipelineStateCache::FPipelineStateCache(IPipelineContext& InContext)
+	: Context(InContext)
+{
+}
+
+void FPipelineStateCache::Invalidate()
+{
+	Topology.bValid = false;
+	InputLayout.bValid = false;
+	VertexShader.bValid = false;
+	PixelShader.bValid = false;
+	RasterizerState.bValid = false;
+	DepthStencilState.bValid = false;
+	BlendState.bValid = false;
+
+	for (auto& Slot : VertexStreams) { Slot.bValid = false; }
+	IndexStream.bValid = false;
+
+	for (uint32 Stage = 0; Stage < 2; ++Stage)
+	{
+		for (auto& Slot : ConstantBuffers[Stage]) { Slot.bValid = false; }
+		for (auto& Slot : ShaderResources[Stage]) { Slot.bValid = false; }
+		for (auto& Slot : Samplers[Stage]) { Slot.bValid = false; }
+	}
+}
+
+void FPipelineStateCache::BeginFrame()
+{
+	LastFrameStats = Stats;
+	Stats = FPipelineStats();
+
+	// 프레임 사이에 UI/오버레이 렌더러가 컨텍스트를 만졌을 수 있다
+	Invalidate();
+}
+
+void FPipelineStateCache::SetPipeline(const FPipelineStateDesc& InDesc)
+{
+	if (ShouldBind(Topology, InDesc.Topology))
+	{
+		Context.SetPrimitiveTopology(InDesc.Topology);
+	}
+	if (InDesc.InputLayout && ShouldBind(InputLayout, InDesc.InputLayout))
+	{
+		Context.SetInputLayout(InDesc.InputLayout);
+	}
+	if (InDesc.VertexShader && ShouldBind(VertexShader, InDesc.VertexShader))
+	{
+		Context.SetVertexShader(InDesc.VertexShader);
+	}
+	if (InDesc.RasterizerState && ShouldBind(RasterizerState, InDesc.RasterizerState))
+	{
+		Context.SetRasterizerState(InDesc.RasterizerState);
+	}
+	if (InDesc.DepthStencilState && ShouldBind(DepthStencilState, InDesc.DepthStencilState))
+	{
+		Context.SetDepthStencilState(InDesc.DepthStencilState);
+	}
+	if (InDesc.PixelShader && ShouldBind(PixelShader, InDesc.PixelShader))
+	{
+		Context.SetPixelShader(InDesc.PixelShader);
+	}
+	if (InDesc.BlendState && ShouldBind(BlendState, InDesc.BlendState))
+	{
+		Context.SetBlendState(InDesc.BlendState);
+	}
+}
+
+void FPipelineStateCache::SetVertexBuffer(uint32 InSlot, FBufferHandle InBuffer, uint32 InStride, uint32 InOffset)
+{
+	// 추적하지 않는 슬롯은 그대로 내려보낸다
+	if (InSlot >= MaxVertexStreams)
+	{
+		++Stats.IssuedBinds;
+		Context.SetVertexBuffer(InSlot, InBuffer, InStride, InOffset);
+		return;
+	}
+	if (ShouldBind(VertexStreams[InSlot], FVertexStream{ InBuffer, InStride, InOffset }))
+	{
+		Context.SetVertexBuffer(InSlot, InBuffer, InStride, InOffset);
+	}
+}
+
+void FPipelineStateCache::SetIndexBuffer(FBufferHandle InBuffer, uint32 InFormat, uint32 InOffset)
+{
+	if (ShouldBind(IndexStream, FIndexStream{ InBuffer, InFormat, InOffset }))
+	{
+		Context.SetIndexBuffer(InBuffer, InFormat, InOffset);
+	}
+}
+
+void FPipelineStateCache::SetConstantBuffer(uint32 InSlot, bool bInIsVS, FBufferHandle InBuffer)
+{
+	// nullptr는 기존처럼 무시 (이전 바인딩 유지)
+	if (!InBuffer || InSlot >= MaxConstantBuffers)
+	{
+		return;
+	}
+	if (ShouldBind(ConstantBuffers[bInIsVS ? 1 : 0][InSlot], InBuffer))
+	{
+		Context.SetConstantBuffer(InSlot, bInIsVS, InBuffer);
+	}
+}
+
+void FPipelineStateCache::SetShaderResourceView(uint32 InSlot, bool bInIsVS, FShaderResourceHandle InView)
+{
+	if (InSlot >= MaxShaderResources)
+	{
+		++Stats.IssuedBinds;
+		Context.SetShaderResourceView(InSlot, bInIsVS, InView);
+		return;
+	}
+	if (ShouldBind(ShaderResources[bInIsVS ? 1 : 0][InSlot], InView))
+	{
+		Context.SetShaderResourceView(InSlot, bInIsVS, InView);
+	}
+}
+
+void FPipelineStateCache::SetSamplerState(uint32 InSlot, bool bInIsVS, FSamplerHandle InSampler)
+{
+	if (InSlot >= MaxSamplers)
+	{
+		return;
+	}
+	if (ShouldBind(Samplers[bInIsVS ? 1 : 0][InSlot], InSampler))
+	{
+		Context.SetSamplerState(InSlot, bInIsVS, InSampler);
+	}
+}
+
+bool FPipelineStateCache::ShouldDraw(uint32 InCount, uint32 InInstanceCount)
+{
+	if (InCount == 0 || InInstanceCount == 0)
+	{
+		++Stats.SkippedDraws;
+		return false;
+	}
+	++Stats.IssuedDraws;
+	Stats.Instances += InInstanceCount;
+
+	// 토폴로지를 모르면(캐시 무효화 직후) 삼각형 수는 세지 않는다
+	if (Topology.bValid)
+	{
+		if (Topology.Value == EPipelineTopology::TriangleList)
+		{
+			Stats.Triangles += static_cast<uint64>(InCount / 3) * InInstanceCount;
+		}
+		else if (Topology.Value == EPipelineTopology::TriangleStrip && InCount >= 3)
+		{
+			Stats.Triangles += static_cast<uint64>(InCount - 2) * InInstanceCount;
+		}
+	}
+	return true;
+}
+
+void FPipelineStateCache::Draw(uint32 InVertexCount, uint32 InStartVertex)
+{
+	if (ShouldDraw(InVertexCount))
+	{
+		Context.Draw(InVertexCount, InStartVertex);
+	}
+}
+
+void FPipelineStateCache::DrawInstanced(uint32 InVertexCountPerInstance, uint32 InInstanceCount, uint32 InStartVertex, uint32 InStartInstance)
+{
+	if (ShouldDraw(InVertexCountPerInstance, InInstanceCount))
+	{
+		Context.DrawInstanced(InVertexCountPerInstance, InInstanceCount, InStartVertex, InStartInstance);
+	}
+}
+
+void FPipelineStateCache::DrawIndexed(uint32 InIndexCount, uint32 InStartIndex, int32 InBaseVertex)
+{
+	if (ShouldDraw(InIndexCount))
+	{
+		Context.DrawIndexed(InIndexCount, InStartIndex, InBaseVertex);
+	}
+}
+
+void FPipelineStateCache::DrawIndexedInstanced(uint32 InIndexCountPerInstance, uint32 InInstanceCount, uint32 InStartIndex,
+	int32 InBaseVertex, uint32 InStartInstance)
+{
+	if (ShouldDraw(InIndexCountPerInstance, InInstanceCount))
+	{
+		Context.DrawIndexedInstanced(InIndexCountPerInstance, InInstanceCount, InStartIndex, InBaseVertex, InStartInstance);
+	}
+}
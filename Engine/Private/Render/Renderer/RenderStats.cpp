@@ -0,0 +1,121 @@
+#include "pch.h"
+#include "Render/Renderer/RenderStats.h"
+
+void FRenderStats::BeginFrame()
+{
+	Current = FRenderFrameStats();
+	Current.FrameNumber = ++FrameCounter;
+	FrameStartCycles = FPlatformTime::Cycles64();
+}
+
+void FRenderStats::EndFrame(const FPipelineStats& InPipelineStats, uint32 InNumViews)
+{
+	Current.Pipeline = InPipelineStats;
+	Current.NumViews = InNumViews;
+	Current.FrameMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - FrameStartCycles);
+
+	LastFrame = Current;
+
+	if (CsvFile.is_open())
+	{
+		WriteCsvRow(CsvFile, LastFrame);
+		++NumCsvRows;
+	}
+}
+
+void FRenderStats::AddPassCycles(ERenderStatPass InPass, uint64 InCycles)
+{
+	Current.PassMs[static_cast<uint8>(InPass)] += FPlatformTime::ToMilliseconds(InCycles);
+}
+
+bool FRenderStats::StartCsvCapture(const FString& InFilePath)
+{
+	StopCsvCapture();
+
+	CsvFile.open(InFilePath, std::ios::out | std::ios::trunc);
+	if (!CsvFile.is_open())
+	{
+		return false;
+	}
+
+	CsvFilePath = InFilePath;
+	NumCsvRows = 0;
+	WriteCsvHeader(CsvFile);
+	return true;
+}
+
+void FRenderStats::StopCsvCapture()
+{
+	if (CsvFile.is_open())
+	{
+		CsvFile.flush();
+		CsvFile.close();
+	}
+}
+
+const char* FRenderStats::GetPassName(ERenderStatPass InPass)
+{
+	switch (InPass)
+	{
+	case ERenderStatPass::Visibility:	return "Visibility";
+	case ERenderStatPass::Level:		return "Level";
+	case ERenderStatPass::Billboards:	return "Billboards";
+	case ERenderStatPass::Text:			return "Text";
+	case ERenderStatPass::EditorLines:	return "EditorLines";
+	case ERenderStatPass::UI:			return "UI";
+	default:							return "Unknown";
+	}
+}
+
+void FRenderStats::WriteCsvHeader(std::ostream& InStream)
+{
+	InStream << "Frame,Views,DrawCalls,SkippedDraws,Instances,Triangles,Binds,SkippedBinds,Uploads,UploadBytes";
+	for (uint8 Pass = 0; Pass < static_cast<uint8>(ERenderStatPass::Num); ++Pass)
+	{
+		InStream << ',' << GetPassName(static_cast<ERenderStatPass>(Pass)) << "Ms";
+	}
+	InStream << ",FrameMs\n";
+}
+
+void FRenderStats::WriteCsvRow(std::ostream& InStream, const FRenderFrameStats& InStats)
+{
+	const FPipelineStats& Pipeline = InStats.Pipeline;
+	InStream << InStats.FrameNumber << ',' << InStats.NumViews << ','
+		<< Pipeline.IssuedDraws << ',' << Pipeline.SkippedDraws << ',' << Pipeline.Instances << ',' << Pipeline.Triangles << ','
+		<< Pipeline.IssuedBinds << ',' << Pipeline.SkippedBinds << ','
+		<< InStats.NumUploads << ',' << InStats.UploadBytes;
+
+	char Buffer[32];
+	for (uint8 Pass = 0; Pass < static_cast<uint8>(ERenderStatPass::Num); ++Pass)
+	{
+		(void)snprintf(Buffer, sizeof(Buffer), ",%.4f", InStats.PassMs[Pass]);
+		InStream << Buffer;
+	}
+	(void)snprintf(Buffer, sizeof(Buffer), ",%.4f\n", InStats.FrameMs);
+	InStream << Buffer;
+}
+
+void FRenderStats::FormatLines(const FRenderFrameStats& InStats, TArray<FString>& OutLines)
+{
+	OutLines.clear();
+
+	const FPipelineStats& Pipeline = InStats.Pipeline;
+	char Line[256];
+
+	(void)snprintf(Line, sizeof(Line), "Draws %u (skip %u)  Instances %llu  Triangles %llu  Views %u",
+		Pipeline.IssuedDraws, Pipeline.SkippedDraws, static_cast<unsigned long long>(Pipeline.Instances),
+		static_cast<unsigned long long>(Pipeline.Triangles), InStats.NumViews);
+	OutLines.push_back(Line);
+
+	(void)snprintf(Line, sizeof(Line), "Binds %u (skip %u)  Uploads %u (%.1f KB)",
+		Pipeline.IssuedBinds, Pipeline.SkippedBinds, InStats.NumUploads, static_cast<double>(InStats.UploadBytes) / 1024.0);
+	OutLines.push_back(Line);
+
+	int Written = snprintf(Line, sizeof(Line), "CPU %.2f ms:", InStats.FrameMs);
+	for (uint8 Pass = 0; Pass < static_cast<uint8>(ERenderStatPass::Num) && Written > 0 && Written < static_cast<int>(sizeof(Line)); ++Pass)
+	{
+		Written += snprintf(Line + Written, sizeof(Line) - Written, "  %s %.2f",
+			GetPassName(static_cast<ERenderStatPass>(Pass)), InStats.PassMs[Pass]);
+	}
+	OutLines.push_back(Line);
+}
@@ -12,6 +12,7 @@
 #include "Components/TextRenderComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/BillboardComponent.h"
+#include "Components/TransformStore.h"
 #include "Mesh/Material.h"
 #include "Render/UI/Layout/MultiViewBuilders.h"
 #include "Render/UI/Layout/Splitter.h"
@@ -20,6 +21,7 @@
 #include "ImGui/imgui.h"
 #include "Math/Octree.h"
 #include "Core/ObjectIterator.h"
+#include "Global/ParallelFor.h"
 #include <algorithm>
 #include <cstring>
 #include "Core/Object.h"
@@ -32,15 +34,6 @@
 #include "Render/Viewport/Viewport.h"
 
 
-namespace
-{
-	struct FInstanceGPUData
-	{
-		FMatrix World;
-		FVector4 Color;
-	};
-}
-
 IMPLEMENT_CLASS(URenderer, UObject)
 IMPLEMENT_SINGLETON(URenderer)
 
@@ -50,6 +43,8 @@ URenderer::~URenderer() = default;
 
 void URenderer::Init(HWND InWindowHandle)
 {
+	MEMORY_TAG_SCOPE(Renderer);
+
 	DeviceResources = new UDeviceResources(InWindowHandle);
 	Pipeline = new UPipeline(GetDeviceContext(), GetDevice());
 
@@ -117,13 +112,14 @@ void URenderer::Release()
 	SaveMultiViewCameraSettings();
 
 	ReleaseConstantBuffer();
+	ReleasePrimitiveInstanceBuffers();
 
 	ReleaseResource();
 
-	ReleaseVertexBuffer(BillboardVertexBuffer);
-	BillboardVertexBuffer = nullptr;
-	BillboardVertexBufferVertexCount = 0;
-	BillboardVertexBufferStride = 0;
+	BillboardVertexRing.Release();
+	TextGlyphRing.Release();
+	IdReadback.Release();
+	RenderStats.StopCsvCapture();
 
 	if (MultiViewRoot)
 	{
@@ -160,8 +156,35 @@ void URenderer::ReleaseResource()
 
 void URenderer::Update(UEditor* Editor)
 {
+	MEMORY_TAG_SCOPE(Renderer);
+
+	RenderStats.BeginFrame();
+
 	RenderBegin();
 
+	if (GWorld->GetWorldType() == EWorldType::PIE)
+	{
+
+		UWorld* PIEWorld = GEditor->GetPIEWorldContext().World();
+		if (PIEWorld)
+		{
+			GWorld = PIEWorld;
+		}
+		else
+		{
+			GWorld = GEditor->GetEditorWorldContext().World();
+		}
+	}
+
+	DXGI_SWAP_CHAIN_DESC scd = {};
+	GetSwapChain()->GetDesc(&scd);
+	const LONG maxW = (LONG)scd.BufferDesc.Width;
+	const LONG maxH = (LONG)scd.BufferDesc.Height;
+
+	// =================================================================
+	// 활성 뷰포트 수집 (뷰포트 영역/시저/카메라)
+	// =================================================================
+	int32 NumViews = 0;
 	for (FViewport* Viewport : UViewportManager::GetInstance().GetViewports())
 	{
 		if (Viewport->GetRect().W < 1.0f || Viewport->GetRect().H < 1.0f)
@@ -169,29 +192,18 @@ void URenderer::Update(UEditor* Editor)
 			continue;
 		}
 
-		FRect SingleWindowRect = Viewport->GetRect();
-		const int32 ViewportToolBarHeight = 32;
-		D3D11_VIEWPORT LocalViewport = { SingleWindowRect.X,SingleWindowRect.Y + ViewportToolBarHeight, SingleWindowRect.W, SingleWindowRect.H - ViewportToolBarHeight, 0.0f, 1.0f };
-		GetDeviceContext()->RSSetViewports(1, &LocalViewport);
-
-		if (GWorld->GetWorldType() == EWorldType::PIE)
+		if (NumViews >= ViewVisibilities.Num())
 		{
-
-			UWorld* PIEWorld = GEditor->GetPIEWorldContext().World();
-			if (PIEWorld)
-			{
-				GWorld = PIEWorld;
-			}
-			else
-			{
-				GWorld = GEditor->GetEditorWorldContext().World();
-			}
+			ViewVisibilities.emplace_back();
 		}
+		FViewVisibility& View = ViewVisibilities[NumViews++];
+		View.Viewport = Viewport;
 
-		DXGI_SWAP_CHAIN_DESC scd = {};
-		GetSwapChain()->GetDesc(&scd);
-		LONG maxW = (LONG)scd.BufferDesc.Width;
-		LONG maxH = (LONG)scd.BufferDesc.Height;
+		FRect SingleWindowRect = Viewport->GetRect();
+		const int32 ViewportToolBarHeight = 32;
+		View.LocalViewport = { SingleWindowRect.X,SingleWindowRect.Y + ViewportToolBarHeight, SingleWindowRect.W, SingleWindowRect.H - ViewportToolBarHeight, 0.0f, 1.0f };
+
+		const D3D11_VIEWPORT& LocalViewport = View.LocalViewport;
 		LONG left = (LONG)LocalViewport.TopLeftX;
 		LONG top = (LONG)LocalViewport.TopLeftY;
 		LONG right = (LONG)(LocalViewport.TopLeftX + LocalViewport.Width);
@@ -200,15 +212,46 @@ void URenderer::Update(UEditor* Editor)
 		top = std::max<LONG>(0, std::min<LONG>(top, maxH - 1));
 		right = std::max<LONG>(left + 1, std::min<LONG>(right, maxW));
 		bottom = std::max<LONG>(top + 1, std::min<LONG>(bottom, maxH));
-		D3D11_RECT r{ left, top, right, bottom };
-		GetDeviceContext()->RSSetScissorRects(1, &r);
+		View.ScissorRect = { left, top, right, bottom };
+
+		View.Camera = Viewport->GetViewportClient()->GetCamera();
+		View.ViewLocation = View.Camera ? View.Camera->GetLocation() : Editor->GetCameraLocation();
+		View.ViewForward = View.Camera ? View.Camera->GetForward() : FVector(1, 0, 0);
+	}
+
+	// =================================================================
+	// 가시성 단계: 뷰마다 보이는 목록/정렬된 드로우 목록을 워커 스레드에서 병렬로 만든다
+	// =================================================================
+	ULevel* Level = GWorld->GetCurrentLevel();
+	{
+		FRenderStatScope VisibilityScope(RenderStats, ERenderStatPass::Visibility);
+		// 워커끼리 같은 컴포넌트의 지연 계산을 하지 않도록 더티 월드 행렬을 여기서 한 번에 끝내 둔다
+		FTransformStore::GetInstance().UpdateWorldMatrices();
+		// 텍스트 글자 표는 뷰끼리 공유하므로 병렬 단계 전에 한 번만 갱신/업로드한다
+		UpdateTextTables(Level);
+
+		ParallelFor(NumViews, [this, Level](int32 ViewIndex)
+			{
+				ComputeViewVisibility(ViewVisibilities[ViewIndex], Level);
+			});
+	}
+
+	// =================================================================
+	// 제출 단계: 렌더 스레드가 뷰 순서대로 업로드하고 드로우를 기록한다
+	// =================================================================
+	for (int32 ViewIndex = 0; ViewIndex < NumViews; ++ViewIndex)
+	{
+		const FViewVisibility& View = ViewVisibilities[ViewIndex];
+
+		GetDeviceContext()->RSSetViewports(1, &View.LocalViewport);
+		GetDeviceContext()->RSSetScissorRects(1, &View.ScissorRect);
 
 
 		// 카메라 세팅을 세이브합니다.
 		CheckAndSaveCameraSettings();
 
 		// 카메라 세팅
-		Cam = Viewport->GetViewportClient()->GetCamera();
+		Cam = View.Camera;
 		
 		// ★★★ 수정된 핵심 로직 ★★★
 		// 현재 뷰포트에 맞는 카메라의 데이터를 가져와 Constant Buffer를 직접 업데이트합니다.
@@ -221,7 +264,10 @@ void URenderer::Update(UEditor* Editor)
 		// =================================================================
 		// Pass 1 로직을 추가합니다.
 		// =================================================================
-		RenderLevel();
+		{
+			FRenderStatScope LevelScope(RenderStats, ERenderStatPass::Level);
+			RenderLevel(View);
+		}
 
 		// =================================================================
 		// 여기에 데칼 렌더링(Pass 2) 로직을 추가합니다.
@@ -229,15 +275,24 @@ void URenderer::Update(UEditor* Editor)
 		// RenderDecals();  <-- 이런 함수를 만들어서 호출
 
 
-		// Transparent billboards (sprites), sort back-to-front per viewport
-		RenderBillboards(Cam ? Cam->GetLocation() : Editor->GetCameraLocation());
+		// Transparent billboards (sprites), sorted back-to-front per viewport
+		{
+			FRenderStatScope BillboardsScope(RenderStats, ERenderStatPass::Billboards);
+			RenderBillboards(View);
+		}
 
 		//Batch Line Rendering
-		Editor->RenderEditorBatched(Cam ? Cam->GetLocation() : Editor->GetCameraLocation());
+		{
+			FRenderStatScope EditorLinesScope(RenderStats, ERenderStatPass::EditorLines);
+			Editor->RenderEditorBatched(View.ViewLocation);
+		}
 
 
-		// For text sorting, use per-viewport camera location if available
-		RenderText(Cam ? Cam->GetLocation() : Editor->GetCameraLocation());
+		// Text, sorted back-to-front per viewport
+		{
+			FRenderStatScope TextScope(RenderStats, ERenderStatPass::Text);
+			RenderText(View);
+		}
 	}
 	
 
@@ -247,16 +302,17 @@ void URenderer::Update(UEditor* Editor)
 		CacheWorld = nullptr;
 	}
 
-	UUIManager::GetInstance().Render();
-
-	RenderEnd();
-	static float RefreshTime = 0.0f;
-	RefreshTime += DT;
-	if (RefreshTime > DT * 20)
 	{
-		ReadbackIdBuffer();
-		RefreshTime = 0;
+		FRenderStatScope UIScope(RenderStats, ERenderStatPass::UI);
+		UUIManager::GetInstance().Render();
 	}
+
+	RenderEnd();
+
+	// 커서 주변 ID만 비동기로 복사 (결과는 1~2 프레임 뒤에 수거)
+	ReadbackIdBuffer();
+
+	RenderStats.EndFrame(Pipeline->GetStats(), static_cast<uint32>(NumViews));
 }
 
 /**
@@ -264,6 +320,8 @@ void URenderer::Update(UEditor* Editor)
  */
 void URenderer::RenderBegin()
 {
+	Pipeline->BeginFrame();
+
 	ID3D11RenderTargetView* RenderTargetView = DeviceResources->GetRenderTargetView();
 	ID3D11RenderTargetView* IdBufferRTV = DeviceResources->GetIdBufferRTV();
 	ID3D11DepthStencilView* DepthStencilView = DeviceResources->GetDepthStencilView();
@@ -282,33 +340,28 @@ void URenderer::RenderBegin()
 	DeviceResources->UpdateViewport();
 }
 
-void URenderer::RenderLevel()
+void URenderer::ComputeViewVisibility(FViewVisibility& InOutView, ULevel* InLevel) const
 {
+	// 뷰포트가 그대로여도 지난 프레임 결과가 남지 않도록 항상 비운다
+	InOutView.InstanceBatcher.Reset();
+	InOutView.BillboardBatcher.Reset();
+	InOutView.TextBatcher.Reset();
 
-	// 여기에 카메라 VP 업데이트 한 번 싹
-	//
-	if (!GWorld->GetCurrentLevel()) { return; }
-
-	// Check show flags for primitive components
-	if (IsShowFlagEnabled(EEngineShowFlags::SF_Primitives) == false) { return; }
-
-	FPipelineDescKey PipelineDescKey;
-	PipelineDescKey.BlendType = EBlendType::Opaque;
-	PipelineDescKey.DepthStencilType = EDepthStencilType::Opaque;
-	PipelineDescKey.ShaderType = EShaderType::StaticMeshShader;
-	PipelineDescKey.Topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
-	FRasterizerKey RasterizerKey;
-	RasterizerKey.CullMode = D3D11_CULL_BACK;
-	RasterizerKey.FillMode = D3D11_FILL_SOLID;
-
-	if (CurrentViewMode == EViewModeIndex::Wireframe)
+	if (!InLevel)
 	{
-		RasterizerKey.CullMode = D3D11_CULL_NONE;
-		RasterizerKey.FillMode = D3D11_FILL_WIREFRAME;
+		return;
 	}
-	PipelineDescKey.RasterizerKey = RasterizerKey;
-	Pipeline->UpdatePipeline(Pipeline->GetOrCreatePipelineState(PipelineDescKey));
 
+	// 뷰끼리는 병렬이므로 안쪽 정렬(ParallelFor)은 단일 스레드로 실행된다
+	GatherStaticMeshes(InOutView, InLevel);
+	GatherBillboards(InOutView, InLevel);
+	GatherText(InOutView, InLevel);
+}
+
+void URenderer::GatherStaticMeshes(FViewVisibility& InOutView, ULevel* InLevel) const
+{
+	// Check show flags for primitive components
+	if (IsShowFlagEnabled(EEngineShowFlags::SF_Primitives) == false) { return; }
 
 	// =================================================================
 	// 옥트리를 이용한 프러스텀 컬링 부분
@@ -325,235 +378,292 @@ void URenderer::RenderLevel()
 	//
 	//UE_LOG("%d", PrimitiveComponentsToRender.Num());
 
-	TArray<UStaticMeshComponent*>& StaticMeshComponentsToRender = GWorld->GetCurrentLevel()->GetStaticMeshComponentsToRender();
+	const TArray<UStaticMeshComponent*>& StaticMeshComponentsToRender = InLevel->GetStaticMeshComponentsToRender();
 
-	// 컬링된 결과(PrimitiveComponentsToRender)를 순회하여 렌더링
-	for (auto& Component : StaticMeshComponentsToRender)
-	{
+	// 보이는 섹션을 (메시, 섹션, 머티리얼)로 묶어서 묶음마다 DrawIndexedInstanced 1회
+	// 묶음 안의 인스턴스는 카메라 전방 축 깊이로 앞→뒤 정렬해 early-Z가 잘 걸리게 한다
+	const FVector& ViewLocation = InOutView.ViewLocation;
+	const FVector& ViewForward = InOutView.ViewForward;
 
-		// UPrimitiveComponent를 UStaticMeshComponent로 캐스팅
-		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Component);
-		// 캐스팅이 실패하면(nullptr이면) 이 컴포넌트는 StaticMesh가 아니므로 건너뜀 (크래시 방지)
+	FInstanceBatcher& InstanceBatcher = InOutView.InstanceBatcher;
+	for (UStaticMeshComponent* StaticMeshComponent : StaticMeshComponentsToRender)
+	{
 		if (!StaticMeshComponent)
 		{
 			continue;
 		}
 
 		UStaticMesh* StaticMesh = StaticMeshComponent->GetStaticMesh();
-		if (!StaticMesh)
+		FStaticMesh* Asset = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+		if (!Asset)
 		{
 			continue;
 		}
-		Pipeline->SetVertexBuffer(StaticMesh->GetVertexBuffer(), StrideStaticMesh);
-		Pipeline->SetIndexBuffer(StaticMesh->GetIndexBuffer(), DXGI_FORMAT_R32_UINT);
-
-
-		////////////// 텍스쳐 적용 테스트 코드////////////////
-		UResourceManager& ResourceManager = UResourceManager::GetInstance();
-		FStaticMesh* Asset = StaticMesh->GetStaticMeshAsset();
 
-		if (Asset && !Asset->Sections.empty())
+		const FMatrix& World = StaticMeshComponent->GetWorldTransformMatrix();
+		const float ViewDepth = (StaticMeshComponent->GetWorldLocation() - ViewLocation).Dot(ViewForward);
+		for (int Index = 0; Index < Asset->Sections.Num(); Index++)
 		{
-			for (int Index = 0; Index < Asset->Sections.Num(); Index++)
-			{
-				ID3D11ShaderResourceView* TextureSRV = nullptr;
-
-				Pipeline->SetConstantBuffer(0, true, ConstantBufferModels);
-				// 안전하게 캐스팅된 StaticMeshComponent 변수 사용
-				UpdateConstant(FModelConstant{ Component->GetWorldTransformMatrix(), Component->GetInternalIndex() });
-
-				// 안전하게 캐스팅된 StaticMeshComponent 변수 사용
-				const UMaterial* Material = Component->GetMaterial(Index);
-				if (Material)
-				{
-					if (!Material->GetKdTextureFilePath().empty())
-					{
-						TextureSRV = ResourceManager.GetTexture(Material->GetKdTextureFilePath());
-						if (TextureSRV)
-						{
-							Pipeline->SetShaderResourceView(1, false, TextureSRV);
-							Pipeline->SetConstantBuffer(2, true, ConstantBufferColor);
-							UpdateConstant(FVector4(1.0f, 1.0f, 1.0f, 1.0f));
-						}
-					}
-					else
-					{
-						Pipeline->SetConstantBuffer(2, true, ConstantBufferColor);
-						UpdateConstant(FVector4(Material->GetMaterialInfo().Kd, 1.0f));
-					}
-				}
-
-				if (!TextureSRV)
-				{
-					//매터리얼에 텍스쳐가 없거나 텍스처를 로드하지 못한 경우 흰색 텍스쳐 써서 기본 vertex 컬러 출력되도록 함.
-					TextureSRV = ResourceManager.GetTexture("Data/None.dds");
-					if (TextureSRV)
-					{
-						Pipeline->SetShaderResourceView(1, false, TextureSRV);
-					}
-				}
-				Pipeline->DrawIndexed(Asset->Sections[Index].IndexCount, Asset->Sections[Index].IndexStart, 0);
-			}
+			const FMeshSection& Section = Asset->Sections[Index];
+			InstanceBatcher.AddInstance(StaticMesh, Index, StaticMeshComponent->GetMaterial(Index),
+				Section.IndexStart, Section.IndexCount, World, StaticMeshComponent->GetPickId(), ViewDepth);
 		}
 	}
-	//UE_LOG("OC: %d", count);
+	InstanceBatcher.Build();
 }
 
-void URenderer::RenderBillboards(const FVector& CameraLocation)
+void URenderer::GatherBillboards(FViewVisibility& InOutView, ULevel* InLevel) const
 {
-    const TArray<UBillboardComponent*>& List = GWorld->GetCurrentLevel()->GetBillboardComponentsToRender();
+    const TArray<UBillboardComponent*>& List = InLevel->GetBillboardComponentsToRender();
     if (List.Num() == 0) return;
 
-    // Pipeline setup
-    FPipelineDescKey PipelineDescKey;
-    PipelineDescKey.BlendType = EBlendType::Transparent;
-    PipelineDescKey.DepthStencilType = EDepthStencilType::Transparent;
-    PipelineDescKey.ShaderType = EShaderType::TextureShader;
-    PipelineDescKey.Topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
-    FRasterizerKey RasterizerKey; RasterizerKey.CullMode = D3D11_CULL_NONE; RasterizerKey.FillMode = D3D11_FILL_SOLID;
-    if (CurrentViewMode == EViewModeIndex::Wireframe) { RasterizerKey.FillMode = D3D11_FILL_WIREFRAME; }
-    PipelineDescKey.RasterizerKey = RasterizerKey;
-    Pipeline->UpdatePipeline(Pipeline->GetOrCreatePipelineState(PipelineDescKey));
-
-    // Sampler
-    UResourceManager& RM = UResourceManager::GetInstance();
-    ID3D11SamplerState* Samp = RM.GetSamplerState(ESamplerType::Text);
-
     // Camera axes
-    const FVector CamForward = Cam ? Cam->GetForward() : FVector(1,0,0);
+    const FVector& CamForward = InOutView.ViewForward;
     const FVector WorldUp = FVector(0,0,1);
     FVector Right = WorldUp.Cross(CamForward); Right.Normalize();
     FVector Up = CamForward.Cross(Right); Up.Normalize();
 
-    struct FPosUv { FVector P; FVector2 UV; };
-
-    // Sort back-to-front (transparent)
-    struct FBItem { UBillboardComponent* C; float D; };
-    TArray<FBItem> Sorted;
-    Sorted.reserve(List.Num());
-    for (auto* C : List)
+    // Sort back-to-front (transparent): 정렬 키 = ~거리 → 스프라이트 텍스처
+    FDrawList& TranslucentDrawList = InOutView.TranslucentDrawList;
+    TranslucentDrawList.Reset();
+    for (int32 Index = 0; Index < List.Num(); ++Index)
     {
-        FBItem I{ C, (CameraLocation - C->GetWorldLocation()).Length() };
-        Sorted.push_back(I);
+        UBillboardComponent* C = List[Index];
+        if (!C || !C->GetSpriteSRV()) continue;
+        const float DistanceSquared = (InOutView.ViewLocation - C->GetWorldLocation()).LengthSquared();
+        TranslucentDrawList.AddTranslucent(EDrawPass::Billboard, 0, nullptr, 0, C->GetSpriteSRV(), DistanceSquared, Index);
     }
-    std::sort(Sorted.begin(), Sorted.end(), [](const FBItem& A, const FBItem& B){ return A.D > B.D; });
+    TranslucentDrawList.Sort();
 
-    for (const FBItem& It : Sorted)
+    // 뷰포트의 모든 빌보드를 텍스처별로 묶어 정점 하나의 배열로 펼친다
+    FBillboardBatcher& BillboardBatcher = InOutView.BillboardBatcher;
+    for (const FDrawCommand& Command : TranslucentDrawList.GetCommands())
     {
-        UBillboardComponent* C = It.C;
-        if (!C || !C->GetSpriteSRV()) continue;
+        UBillboardComponent* C = List[Command.Payload];
 
         float W=0,H=0; {
             FAABB B = C->GetWorldBounds();
             FVector Ext = B.GetExtent();
             W = Ext.X * 2.f; H = Ext.Y * 2.f; if (W<=0 || H<=0) { W=1.f; H=1.f; }
         }
-        const float HW = 0.5f * W; const float HH = 0.5f * H;
-        const FVector Center = C->GetWorldLocation();
-
-        const FVector P0 = Center + Right * (-HW)	+   Up * (-HH);
-		const FVector P1 = Center + Right * (HW)	+	Up * (-HH);
-		const FVector P2 = Center + Right * (HW)	+	Up * (HH);
-		const FVector P3 = Center + Right * (-HW)	+	Up * (HH);
 
         float U=0,V=0,UL=1,VL=1; C->GetUV(U,V,UL,VL);
 
-        TArray<FPosUv> Vtx;
-        Vtx = {
-            { P0, {U,     V+VL} },
-            { P1, {U+UL,  V+VL} },
-            { P2, {U+UL,  V    } },
-            { P0, {U,     V+VL} },
-            { P2, {U+UL,  V    } },
-            { P3, {U,     V    } },
-        };
-
-        const uint32 VertexCount = static_cast<uint32>(Vtx.Num());
-        const uint32 VertexStride = sizeof(FVector) + sizeof(FVector2);
-        if (!UploadBillboardVertices(Vtx.data(), VertexCount, VertexStride))
-        {
-            continue;
-        }
+        BillboardBatcher.AddSprite(C->GetSpriteSRV(), C->GetWorldLocation(), Right, Up, 0.5f * W, 0.5f * H,
+            FVector4(U, V, UL, VL), C->GetColor(), C->GetPickId());
+    }
+    BillboardBatcher.Build();
+}
 
-        // Constant buffers
-        Pipeline->SetConstantBuffer(0, true, ConstantBufferModels);
-        UpdateConstant(FModelConstant(FMatrix::Identity, C->GetInternalIndex()));
+void URenderer::GatherText(FViewVisibility& InOutView, ULevel* InLevel) const
+{
+	if (IsShowFlagEnabled(EEngineShowFlags::SF_BillboardText) == false) { return; }
 
-        // Billboard CB (b4)
-        UpdateBillboardConstant(FVector4(U, V, UL, VL), C->GetColor());
+	//text(외 투명한 물체)들은 블랜딩을 적용하기 위해서 zbuffer에 쓰기를 하지 않음, 그래서 뒤에 있는 물체가 앞에 있는 물체 위에 렌더링되는 현상이 벌어짐
+	//그래서 zbuffer에 쓰지 않으면서 추가로 카메라로부터 거리순으로 정렬을 해서 멀리 있는 물체부터 그려줘야함.
+	///////////////////////////////////Sorting//////////////////////////////////////////
+	// 정렬 키 = ~거리. 거리 제곱도 순서는 같으므로 sqrt는 하지 않는다
+	const TArray<UTextRenderComponent*>& TextComponents = InLevel->GetTextComponentsToRender();
+	if (TextLabelRanges.Num() != TextComponents.Num())
+	{
+		return;
+	}
 
-        // Bind texture & sampler
-        Pipeline->SetShaderResourceView(0, false, C->GetSpriteSRV());
-        Pipeline->SetSamplerState(0, false, Samp);
+	FDrawList& TranslucentDrawList = InOutView.TranslucentDrawList;
+	TranslucentDrawList.Reset();
+	for (int32 Index = 0; Index < TextComponents.Num(); ++Index)
+	{
+		if (TextLabelRanges[Index].Count == 0)
+		{
+			continue;
+		}
+		const float DistanceSquared = (InOutView.ViewLocation - TextComponents[Index]->GetWorldLocation()).LengthSquared();
+		TranslucentDrawList.AddTranslucent(EDrawPass::Text, 0, nullptr, 0, nullptr, DistanceSquared, Index);
+	}
+	TranslucentDrawList.Sort();
+	/////////////////////////////////////////////////////////////////////////////////////
 
-        Pipeline->SetVertexBuffer(BillboardVertexBuffer, VertexStride);
-        Pipeline->Draw(VertexCount, 0);
-    }
+	// 정렬된 순서대로 글자 표 번호만 모은다 (제출 단계에서 DrawInstanced 1회)
+	FTextBatcher& TextBatcher = InOutView.TextBatcher;
+	for (const FDrawCommand& Command : TranslucentDrawList.GetCommands())
+	{
+		TextBatcher.AddLabel(TextLabelRanges[Command.Payload]);
+	}
 }
 
-bool URenderer::UploadBillboardVertices(const void* VertexData, uint32 VertexCount, uint32 Stride)
+void URenderer::UpdateTextTables(ULevel* InLevel)
 {
-	if (VertexCount == 0 || Stride == 0)
+	TextLabelRanges.clear();
+	if (!InLevel || IsShowFlagEnabled(EEngineShowFlags::SF_BillboardText) == false)
 	{
-		return false;
+		return;
 	}
 
-	EnsureBillboardVertexBuffer(VertexCount, Stride);
-	if (BillboardVertexBuffer == nullptr)
+	// 글자 리비전이나 행렬이 바뀐 라벨만 캐시가 더티 구간으로 남긴다
+	const TArray<UTextRenderComponent*>& TextComponents = InLevel->GetTextComponentsToRender();
+	TextLabelRanges.resize(TextComponents.Num());
+	TextGlyphCache.BeginFrame();
+	for (int32 Index = 0; Index < TextComponents.Num(); ++Index)
 	{
-		return false;
+		UTextRenderComponent* Component = TextComponents[Index];
+		if (Component->GetGlyphs().empty())
+		{
+			continue;
+		}
+		TextLabelRanges[Index] = TextGlyphCache.UpdateLabel(Component, Component->GetGlyphRevision(), Component->GetGlyphs(),
+			Component->GetWorldTransformMatrix(), Component->GetPickId());
 	}
+	TextGlyphCache.EndFrame();
 
-	D3D11_MAPPED_SUBRESOURCE Mapped = {};
-	HRESULT hr = GetDeviceContext()->Map(BillboardVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped);
-	if (FAILED(hr))
+	// 표가 커져 버퍼를 새로 만들었으면 전체를, 아니면 바뀐 구간만 올린다
+	const TArray<FTextGlyphInstance>& Glyphs = TextGlyphCache.GetGlyphs();
+	const TArray<FInstanceGPUData>& Labels = TextGlyphCache.GetLabels();
+	const uint32 NumGlyphs = static_cast<uint32>(Glyphs.Num());
+	const uint32 NumLabels = static_cast<uint32>(Labels.Num());
+
+	if (EnsureTableBufferCapacity(TextGlyphBuffer, NumGlyphs, sizeof(FTextGlyphInstance)))
 	{
-		return false;
+		UploadTableBufferRanges(TextGlyphBuffer, Glyphs.data(), sizeof(FTextGlyphInstance), { { 0, NumGlyphs } });
+	}
+	else
+	{
+		UploadTableBufferRanges(TextGlyphBuffer, Glyphs.data(), sizeof(FTextGlyphInstance), TextGlyphCache.GetDirtyGlyphRanges());
 	}
 
-	std::memcpy(Mapped.pData, VertexData, static_cast<size_t>(VertexCount) * static_cast<size_t>(Stride));
-	GetDeviceContext()->Unmap(BillboardVertexBuffer, 0);
-	return true;
+	if (EnsureTableBufferCapacity(TextLabelBuffer, NumLabels, sizeof(FInstanceGPUData)))
+	{
+		UploadTableBufferRanges(TextLabelBuffer, Labels.data(), sizeof(FInstanceGPUData), { { 0, NumLabels } });
+	}
+	else
+	{
+		UploadTableBufferRanges(TextLabelBuffer, Labels.data(), sizeof(FInstanceGPUData), TextGlyphCache.GetDirtyLabelRanges());
+	}
+
+	TextGlyphCache.ClearDirty();
 }
 
-void URenderer::EnsureBillboardVertexBuffer(uint32 VertexCount, uint32 Stride)
+ID3D11ShaderResourceView* URenderer::GetFontTexture()
 {
-	if (VertexCount == 0 || Stride == 0)
+	UResourceManager& ResourceManager = UResourceManager::GetInstance();
+	if (FontTextureGeneration != ResourceManager.GetTextureGeneration())
 	{
-		return;
+		FontTexture = ResourceManager.GetTexture("Asset/Font/Pretendard-Regular.dds");
+		FontTextureGeneration = ResourceManager.GetTextureGeneration();
 	}
+	return FontTexture;
+}
+
+void URenderer::RenderLevel(const FViewVisibility& InView)
+{
+	if (!GWorld->GetCurrentLevel()) { return; }
 
-	if (BillboardVertexBuffer && BillboardVertexBufferVertexCount >= VertexCount && BillboardVertexBufferStride == Stride)
+	// Check show flags for primitive components
+	if (IsShowFlagEnabled(EEngineShowFlags::SF_Primitives) == false) { return; }
+
+	const FInstanceBatcher& InstanceBatcher = InView.InstanceBatcher;
+	if (InstanceBatcher.GetBatches().empty())
 	{
 		return;
 	}
 
-	ReleaseVertexBuffer(BillboardVertexBuffer);
-	BillboardVertexBuffer = nullptr;
-	BillboardVertexBufferVertexCount = 0;
-	BillboardVertexBufferStride = 0;
+	FPipelineDescKey PipelineDescKey;
+	PipelineDescKey.BlendType = EBlendType::Opaque;
+	PipelineDescKey.DepthStencilType = EDepthStencilType::Opaque;
+	PipelineDescKey.ShaderType = EShaderType::StaticMeshShader;
+	PipelineDescKey.Topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+	FRasterizerKey RasterizerKey;
+	RasterizerKey.CullMode = D3D11_CULL_BACK;
+	RasterizerKey.FillMode = D3D11_FILL_SOLID;
 
-	D3D11_BUFFER_DESC Desc{};
-	Desc.ByteWidth = VertexCount * Stride;
-	Desc.Usage = D3D11_USAGE_DYNAMIC;
-	Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-	Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+	if (CurrentViewMode == EViewModeIndex::Wireframe)
+	{
+		RasterizerKey.CullMode = D3D11_CULL_NONE;
+		RasterizerKey.FillMode = D3D11_FILL_WIREFRAME;
+	}
+	PipelineDescKey.RasterizerKey = RasterizerKey;
+	Pipeline->UpdatePipeline(Pipeline->GetOrCreatePipelineState(PipelineDescKey));
 
-	HRESULT hr = GetDevice()->CreateBuffer(&Desc, nullptr, &BillboardVertexBuffer);
-	if (FAILED(hr))
+	const TArray<FInstanceGPUData>& InstanceData = InstanceBatcher.GetInstanceData();
+	const TArray<FInstanceBatch>& Batches = InstanceBatcher.GetBatches();
+
+	Pipeline->SetConstantBuffer(3, true, ConstantBufferInstanceBatch);
+	for (const FInstanceMeshRange& Range : InstanceBatcher.GetMeshRanges())
 	{
-		return;
+		// 메시별 구조화 버퍼에 이 메시의 모든 인스턴스를 한 번에 업로드
+		FStructuredBufferResource& Resource = GetOrCreateStructuredBuffer(Range.Mesh);
+		EnsureStructuredBufferCapacity(Resource, Range.NumInstances);
+		if (!Resource.ShaderResourceView)
+		{
+			continue;
+		}
+		UploadStructuredBufferData(Resource, InstanceData.data() + Range.FirstInstance, Range.NumInstances);
+
+		Pipeline->SetShaderResourceView(0, true, Resource.ShaderResourceView);
+		Pipeline->SetVertexBuffer(Range.Mesh->GetVertexBuffer(), StrideStaticMesh);
+		Pipeline->SetIndexBuffer(Range.Mesh->GetIndexBuffer(), DXGI_FORMAT_R32_UINT);
+
+		for (int32 BatchIndex = Range.FirstBatch; BatchIndex < Range.FirstBatch + Range.NumBatches; ++BatchIndex)
+		{
+			const FInstanceBatch& Batch = Batches[BatchIndex];
+			BindStaticMeshMaterial(Batch.Material);
+			UpdateInstanceBatchConstant(Batch.FirstInstance);
+			Pipeline->DrawIndexedInstanced(Batch.IndexCount, Batch.NumInstances, Batch.IndexStart, 0, 0);
+		}
 	}
+}
 
-	BillboardVertexBufferVertexCount = VertexCount;
-	BillboardVertexBufferStride = Stride;
+void URenderer::RenderBillboards(const FViewVisibility& InView)
+{
+    const FBillboardBatcher& BillboardBatcher = InView.BillboardBatcher;
+    if (BillboardBatcher.GetVertices().empty()) return;
+
+    // Pipeline setup
+    FPipelineDescKey PipelineDescKey;
+    PipelineDescKey.BlendType = EBlendType::Transparent;
+    PipelineDescKey.DepthStencilType = EDepthStencilType::Transparent;
+    PipelineDescKey.ShaderType = EShaderType::TextureShader;
+    PipelineDescKey.Topology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
+    FRasterizerKey RasterizerKey; RasterizerKey.CullMode = D3D11_CULL_NONE; RasterizerKey.FillMode = D3D11_FILL_SOLID;
+    if (CurrentViewMode == EViewModeIndex::Wireframe) { RasterizerKey.FillMode = D3D11_FILL_WIREFRAME; }
+    PipelineDescKey.RasterizerKey = RasterizerKey;
+    Pipeline->UpdatePipeline(Pipeline->GetOrCreatePipelineState(PipelineDescKey));
+
+    // Sampler
+    UResourceManager& RM = UResourceManager::GetInstance();
+    ID3D11SamplerState* Samp = RM.GetSamplerState(ESamplerType::Text);
+
+    // 한 번만 업로드 (같은 프레임의 다른 뷰포트와 링 버퍼를 NO_OVERWRITE로 나눠 쓴다)
+    const TArray<FBillboardVertex>& Vertices = BillboardBatcher.GetVertices();
+    uint32 BaseVertex = 0;
+    if (!BillboardVertexRing.Write(GetDevice(), GetDeviceContext(), Vertices.data(), static_cast<uint32>(Vertices.Num()),
+        sizeof(FBillboardVertex), BaseVertex))
+    {
+        return;
+    }
+    RenderStats.AddUpload(Vertices.Num() * sizeof(FBillboardVertex));
+
+    Pipeline->SetSamplerState(0, false, Samp);
+    Pipeline->SetVertexBuffer(BillboardVertexRing.GetBuffer(), sizeof(FBillboardVertex));
+
+    // 텍스처마다 Draw 1회
+    for (const FBillboardBatch& Batch : BillboardBatcher.GetBatches())
+    {
+        Pipeline->SetShaderResourceView(0, false, Batch.Texture);
+        Pipeline->Draw(Batch.NumVertices, BaseVertex + Batch.FirstVertex);
+    }
 }
 
-void URenderer::RenderText(const FVector& CameraLocation)
+void URenderer::RenderText(const FViewVisibility& InView)
 {
 	if (IsShowFlagEnabled(EEngineShowFlags::SF_BillboardText) == false) { return; }
 
-	// Rebind char table (slot b4) because billboard pass may override it
+	const TArray<uint32>& GlyphSlots = InView.TextBatcher.GetGlyphSlots();
+	if (GlyphSlots.empty() || !TextGlyphBuffer.ShaderResourceView || !TextLabelBuffer.ShaderResourceView)
+	{
+		return;
+	}
+
+	// Rebind char table (slot b4) in case another pass bound a different buffer there
 	Pipeline->SetConstantBuffer(4, true, ConstantBufferCharTable);
 
 	//shader, rasterizaer state, depth stencil state, input layout 설정///////////////////
@@ -577,59 +687,29 @@ void URenderer::RenderText(const FVector& CameraLocation)
 	/////////////////////////////////////////////////////////////////////////////////////
 
 	/////////////텍스처, 샘플러 설정////////////////////
-	UResourceManager& ResourceManager = UResourceManager::GetInstance();
-	ID3D11ShaderResourceView* Srv = ResourceManager.GetTexture("Asset/Font/Pretendard-Regular.dds");
-	ID3D11SamplerState* SamplerState = ResourceManager.GetSamplerState(ESamplerType::Text);
+	ID3D11SamplerState* SamplerState = UResourceManager::GetInstance().GetSamplerState(ESamplerType::Text);
 
-	Pipeline->SetShaderResourceView(0, false, Srv);
+	Pipeline->SetShaderResourceView(0, false, GetFontTexture());
 	Pipeline->SetSamplerState(0, false, SamplerState);
 	////////////텍스처, 샘플러 설정//////////////////////
 
 
 
 
-	//text(외 투명한 물체)들은 블랜딩을 적용하기 위해서 zbuffer에 쓰기를 하지 않음, 그래서 뒤에 있는 물체가 앞에 있는 물체 위에 렌더링되는 현상이 벌어짐
-	//그래서 zbuffer에 쓰지 않으면서 추가로 카메라로부터 거리순으로 정렬을 해서 멀리 있는 물체부터 그려줘야함.
-	///////////////////////////////////Sorting//////////////////////////////////////////
-	struct RenderObject
+	/////////////////////////////////가시성 단계에서 뒤→앞으로 모은 글자 번호로 DrawInstanced 1회//////////////////////
+	// 글자/라벨 표는 UpdateTextTables에서 이미 올렸으므로 여기서는 번호만 링 버퍼에 쓴다
+	uint32 FirstSlot = 0;
+	if (!TextGlyphRing.Write(GetDevice(), GetDeviceContext(), GlyphSlots.data(), static_cast<uint32>(GlyphSlots.Num()),
+		sizeof(uint32), FirstSlot))
 	{
-		UTextRenderComponent* Component;
-		float DistanceToCamera;
-
-		bool operator<(const RenderObject& Other) const
-		{
-			return this->DistanceToCamera > Other.DistanceToCamera;
-		}
-	};
-
-	TArray<RenderObject> RenderList;
-
-	for (UTextRenderComponent* Component : GWorld->GetCurrentLevel()->GetTextComponentsToRender())
-	{
-		RenderObject Object;
-		Object.Component = Component;
-		Object.DistanceToCamera = (CameraLocation - Component->GetWorldLocation()).Length();
-		RenderList.push_back(Object);
+		return;
 	}
-	std::sort(RenderList.begin(), RenderList.end());
-	/////////////////////////////////////////////////////////////////////////////////////
-
+	RenderStats.AddUpload(GlyphSlots.Num() * sizeof(uint32));
 
-
-	/////////////////////////////////정렬된 리스트 순회하면서 렌더링//////////////////////
-	for (RenderObject& Object : RenderList)
-	{
-		Pipeline->SetConstantBuffer(0, true, ConstantBufferModels);
-
-		USceneComponent* RootComponent = Object.Component->GetOwner()->GetRootComponent();
-
-		UpdateConstant(FModelConstant(Object.Component->GetWorldTransformMatrix(),Object.Component->GetInternalIndex()));
-
-
-		Pipeline->SetVertexBuffer(Object.Component->GetVertexBuffer(), StrideTextVertex);
-
-		Pipeline->Draw(Object.Component->GetVertexNum(), 0);
-	}
+	Pipeline->SetShaderResourceView(1, true, TextLabelBuffer.ShaderResourceView);
+	Pipeline->SetShaderResourceView(2, true, TextGlyphBuffer.ShaderResourceView);
+	Pipeline->SetVertexBuffer(TextGlyphRing.GetBuffer(), sizeof(uint32));
+	Pipeline->DrawInstanced(FTextBatcher::VerticesPerGlyph, static_cast<uint32>(GlyphSlots.Num()), 0, FirstSlot);
 	////////////////////////////////////////////////////////////////////////////////////
 
 }
@@ -718,9 +798,126 @@ void URenderer::OnResize(uint32 InWidth, uint32 InHeight)
     GetDeviceContext()->OMSetRenderTargets(2, RenderTargetViews, DeviceResources->GetDepthStencilView());
 	UOverlayManager::GetInstance().RecreateBackBufferResources();
 
-	MSOC.Resize(InWidth, InHeight);
+	// InWidth/InHeight가 0이면 윈도우 크기를 따르므로 실제 스왑체인 크기를 사용
+	DXGI_SWAP_CHAIN_DESC scd = {};
+	GetSwapChain()->GetDesc(&scd);
+	MSOC.Resize((int)scd.BufferDesc.Width, (int)scd.BufferDesc.Height);
+
+	IdReadback.Invalidate();
+}
+
+bool URenderer::GatherBenchmarkScene(const char* InLogTag, FMatrix& OutViewProj, FOcclusionViewport& OutViewport,
+	TArray<FAABB>& OutBoxes, int& OutBackBufferW, int& OutBackBufferH)
+{
+	ULevel* Level = GWorld ? GWorld->GetCurrentLevel() : nullptr;
+	if (!Level)
+	{
+		UE_LOG("%s: 레벨이 없습니다", InLogTag);
+		return false;
+	}
+
+	// 첫 번째 원근 뷰포트의 카메라 기준으로 측정
+	UCamera* BenchCamera = nullptr;
+	for (FViewport* Viewport : UViewportManager::GetInstance().GetViewports())
+	{
+		UCamera* ViewportCamera = Viewport->GetViewportClient() ? Viewport->GetViewportClient()->GetCamera() : nullptr;
+		if (!ViewportCamera || ViewportCamera->GetCameraType() != ECameraType::ECT_Perspective)
+		{
+			continue;
+		}
+		const FRect Rect = Viewport->GetRect();
+		if (Rect.W < 1.0f || Rect.H < 1.0f)
+		{
+			continue;
+		}
+		BenchCamera = ViewportCamera;
+		OutViewport = { static_cast<float>(Rect.X), static_cast<float>(Rect.Y), static_cast<float>(Rect.W), static_cast<float>(Rect.H), 0.0f, 1.0f };
+		break;
+	}
+	if (!BenchCamera)
+	{
+		UE_LOG("%s: 원근 뷰포트가 없습니다", InLogTag);
+		return false;
+	}
+	OutViewProj = BenchCamera->GetViewProj();
+
+	OutBoxes.clear();
+	for (UStaticMeshComponent* Component : Level->GetStaticMeshComponentsToRender())
+	{
+		if (Component)
+		{
+			OutBoxes.push_back(Component->GetWorldBounds());
+		}
+	}
+
+	DXGI_SWAP_CHAIN_DESC scd = {};
+	GetSwapChain()->GetDesc(&scd);
+	OutBackBufferW = (int)scd.BufferDesc.Width;
+	OutBackBufferH = (int)scd.BufferDesc.Height;
+	return true;
+}
+
+void URenderer::RunOcclusionBenchmark()
+{
+	FMatrix ViewProj;
+	FOcclusionViewport BenchViewport;
+	TArray<FAABB> Boxes;
+	int BackBufferW = 0, BackBufferH = 0;
+	if (!GatherBenchmarkScene("Occlusion Benchmark", ViewProj, BenchViewport, Boxes, BackBufferW, BackBufferH))
+	{
+		return;
+	}
 
-	CachedIdBuffer.resize(InWidth * InHeight);
+	const TArray<TPair<int, int>> Sizes = { { 1024, 512 }, { 512, 256 }, { 256, 128 } };
+	TArray<FOcclusionBenchmarkResult> Results;
+	USoftwareOcclusionCuller::BenchmarkResolutions(Boxes, ViewProj, BenchViewport, BackBufferW, BackBufferH, Sizes, Results);
+
+	UE_LOG("Occlusion Benchmark: %d boxes", (int)Boxes.size());
+	for (const FOcclusionBenchmarkResult& Result : Results)
+	{
+		UE_LOG("  %4dx%-4d  %5d tiles  raster %.3f ms (x%.2f)  test %.3f ms (batch %.3f ms)  occluded %d  missed %d  extra %d",
+			Result.BufferW, Result.BufferH, Result.NumTiles, Result.RasterizeMs, Result.RasterSpeedup, Result.TestMs,
+			Result.TestBatchMs, Result.NumOccluded, Result.NumMissedOccluded, Result.NumExtraOccluded);
+	}
+}
+
+void URenderer::RunSIMDBenchmark()
+{
+	FMatrix ViewProj;
+	FOcclusionViewport BenchViewport;
+	TArray<FAABB> Boxes;
+	int BackBufferW = 0, BackBufferH = 0;
+	if (!GatherBenchmarkScene("SIMD Benchmark", ViewProj, BenchViewport, Boxes, BackBufferW, BackBufferH))
+	{
+		return;
+	}
+
+	TArray<FOcclusionKernelBenchmarkResult> Results;
+	USoftwareOcclusionCuller::BenchmarkKernels(Boxes, ViewProj, BenchViewport, BackBufferW, BackBufferH, Results);
+
+	// 행렬 일괄 곱: 인스턴스/트랜스폼 갱신 규모를 가정한 합성 데이터
+	constexpr int32 NumMatrices = 16384;
+	TArray<FMatrix> Worlds(NumMatrices);
+	TArray<FMatrix> Products(NumMatrices);
+	for (int32 Index = 0; Index < NumMatrices; ++Index)
+	{
+		const float T = static_cast<float>(Index);
+		Worlds[Index] = FMatrix::GetModelMatrix(FVector(T, T * 0.5f, -T), FVector(T, T * 2.0f, T * 3.0f), FVector(1.0f, 2.0f, 3.0f));
+	}
+
+	UE_LOG("SIMD Benchmark: CPU max %s, active %s, %d boxes, %d matrices",
+		FCPUFeatures::ToString(FCPUFeatures::Get().MaxLevel), FCPUFeatures::ToString(FCPUFeatures::GetActiveLevel()),
+		(int)Boxes.size(), NumMatrices);
+	for (const FOcclusionKernelBenchmarkResult& Result : Results)
+	{
+		const uint64 MatrixStart = FPlatformTime::Cycles64();
+		FMatrix::MultiplyArray(Worlds.data(), ViewProj, Products.data(), NumMatrices, Result.Level);
+		const double MatrixMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - MatrixStart);
+
+		UE_LOG("  %-8s  raster %.3f ms  batch test %.3f ms  matrix %.3f ms  occluded %d  mismatched %d",
+			FCPUFeatures::ToString(Result.Level), Result.RasterizeMs, Result.TestBatchMs, MatrixMs,
+			Result.NumOccluded, Result.NumMismatched);
+	}
 }
 
 /**
@@ -837,38 +1034,12 @@ int URenderer::GetHoveredViewportIndex(float MouseX, float MouseY, FRect& OutRec
 
 void URenderer::ReadbackIdBuffer()
 {
-	ID3D11DeviceContext* Ctx = GetDeviceContext();
-	DXGI_SWAP_CHAIN_DESC scd = {};
-	GetSwapChain()->GetDesc(&scd);
-	const LONG maxW = (LONG)scd.BufferDesc.Width;
-	const LONG maxH = (LONG)scd.BufferDesc.Height;
-	// GPU → CPU 스테이징으로 전체 복사
-	Ctx->CopyResource(DeviceResources->GetIdStagingBuffer(), DeviceResources->GetIdBuffer());
-
-	D3D11_MAPPED_SUBRESOURCE Mapped{};
-	if (SUCCEEDED(Ctx->Map(DeviceResources->GetIdStagingBuffer(), 0, D3D11_MAP_READ, 0, &Mapped)))
-	{
-		const uint8_t* Src = static_cast<const uint8_t*>(Mapped.pData);
-		const size_t RowPitch = Mapped.RowPitch;
-		const size_t BytesPerRow = maxW * sizeof(uint32);
-		const size_t NumPixels = maxW * maxH;
-
-		CachedIdBuffer.resize(maxW * maxH);
-		for (int Index = 0; Index < maxH; Index++)
-		{
-			// 대상 주소: CachedIdBuffer의 i번째 줄 시작
-			uint8_t* pDest = reinterpret_cast<uint8_t*>(CachedIdBuffer.data()) + (Index * BytesPerRow);
-			// 원본 주소: GPU 메모리의 i번째 줄 시작
-			const uint8_t* pSourceRow = Src + (Index * RowPitch);
-			// 한 줄의 실제 데이터만큼만 복사
-			memcpy(pDest, pSourceRow, BytesPerRow);
-		}
-
-		Ctx->Unmap(DeviceResources->GetIdStagingBuffer(), 0);
-	}
+	const FVector& MousePosition = UInputManager::GetInstance().GetMousePosition();
+	IdReadback.Tick(GetDevice(), GetDeviceContext(), DeviceResources->GetIdBuffer(),
+		static_cast<int32>(MousePosition.X), static_cast<int32>(MousePosition.Y));
 }
 
-UPrimitiveComponent* URenderer::GetCollidedPrimitive(int MouseX, int MouseY) const
+UPrimitiveComponent* URenderer::GetCollidedPrimitive(int MouseX, int MouseY)
 {
 	const FRect viewportRect = UViewportManager::GetInstance().GetRoot()->GetRect();
 	const LONG viewportRight = viewportRect.X + viewportRect.W;
@@ -879,24 +1050,16 @@ UPrimitiveComponent* URenderer::GetCollidedPrimitive(int MouseX, int MouseY) con
 		return nullptr;
 	}
 
-	DXGI_SWAP_CHAIN_DESC scd = {};
-	GetSwapChain()->GetDesc(&scd);
-	const LONG bufferWidth = static_cast<LONG>(scd.BufferDesc.Width);
-	const LONG bufferHeight = static_cast<LONG>(scd.BufferDesc.Height);
-	if (bufferWidth <= 0 || bufferHeight <= 0)
+	// 보통은 클릭 전 프레임들에 커서 주변을 이미 읽어왔으므로 CPU 조회로 끝난다
+	uint32 Id = 0;
+	if (!IdReadback.TryGetId(MouseX, MouseY, Id) &&
+		!IdReadback.ReadIdImmediate(GetDevice(), GetDeviceContext(), DeviceResources->GetIdBuffer(), MouseX, MouseY, Id))
 	{
 		return nullptr;
 	}
 
-	const LONG clampedX = std::clamp<LONG>(MouseX, 0, bufferWidth - 1);
-	const LONG clampedY = std::clamp<LONG>(MouseY, 0, bufferHeight - 1);
-	const size_t index = static_cast<size_t>(clampedY) * static_cast<size_t>(bufferWidth) + static_cast<size_t>(clampedX);
-	if (index >= CachedIdBuffer.size())
-	{
-		return nullptr;
-	}
-
-	return Cast<UPrimitiveComponent>(GUObjectArray[CachedIdBuffer[index]]);
+	// 세대까지 맞아야 찾으므로, 그 사이 삭제/재사용된 슬롯의 ID는 nullptr이 된다
+	return Cast<UPrimitiveComponent>(GUObjectArray.ResolvePickId(Id));
 }
 void URenderer::RenderVisibleSort(TArray<UPrimitiveComponent*>& PrimToRender)
 {
@@ -1129,15 +1292,17 @@ void URenderer::CreateConstantBuffer()
 		Pipeline->SetConstantBuffer(4, true, ConstantBufferCharTable);
 	}
 
-	// Billboard constant buffer (UVRect + Color)
+	/**
+	 * @brief 인스턴스 묶음의 구조화 버퍼 시작 위치 (SV_InstanceID는 StartInstanceLocation을 더하지 않는다)
+	 */
 	{
-		struct C { FVector4 A; FVector4 B; };
-		D3D11_BUFFER_DESC Desc = {};
-		Desc.ByteWidth = sizeof(C) + 0xF & 0xFFFFFFF0;
-		Desc.Usage = D3D11_USAGE_DYNAMIC;
-		Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-		Desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-		GetDevice()->CreateBuffer(&Desc, nullptr, &ConstantBufferBillboard);
+		D3D11_BUFFER_DESC ConstantBufferDesc = {};
+		ConstantBufferDesc.ByteWidth = 16;
+		ConstantBufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+		ConstantBufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+		ConstantBufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+
+		GetDevice()->CreateBuffer(&ConstantBufferDesc, nullptr, &ConstantBufferInstanceBatch);
 	}
 
 	//UpdateInstanceDrawConstants(false, 0, 0);
@@ -1172,10 +1337,10 @@ void URenderer::ReleaseConstantBuffer()
 		ConstantBufferCharTable = nullptr;
 	}
 
-	if (ConstantBufferBillboard)
+	if (ConstantBufferInstanceBatch)
 	{
-		ConstantBufferBillboard->Release();
-		ConstantBufferBillboard = nullptr;
+		ConstantBufferInstanceBatch->Release();
+		ConstantBufferInstanceBatch = nullptr;
 	}
 }
 
@@ -1188,6 +1353,7 @@ void URenderer::UpdateConstant(const FModelConstant& InModelConstant) const
 		FModelConstant* Constants = static_cast<FModelConstant*>(ConstantBufferMSR.pData);
 		*Constants = InModelConstant;
 		GetDeviceContext()->Unmap(ConstantBufferModels, 0);
+		RenderStats.AddUpload(sizeof(FModelConstant));
 	}
 }
 
@@ -1210,6 +1376,7 @@ void URenderer::UpdateConstant(const FVector& InPosition, const FVector& InRotat
 			(*constants).UUID = 0;
 		}
 		GetDeviceContext()->Unmap(ConstantBufferModels, 0);
+		RenderStats.AddUpload(sizeof(FModelConstant));
 	}
 }
 
@@ -1231,6 +1398,7 @@ void URenderer::UpdateConstant(const FViewProjConstants& InViewProjConstants) co
 			ViewProjectionConstants->ViewModeIndex = static_cast<uint32>(CurrentViewMode);
 		}
 		GetDeviceContext()->Unmap(ConstantBufferPerFrame, 0);
+		RenderStats.AddUpload(sizeof(FViewProjConstants));
 	}
 }
 
@@ -1252,21 +1420,50 @@ void URenderer::UpdateConstant(const FVector4& Color) const
 			ColorConstants->W = Color.W;
 		}
 		GetDeviceContext()->Unmap(ConstantBufferColor, 0);
+		RenderStats.AddUpload(sizeof(FVector4));
 	}
 }
 
-void URenderer::UpdateBillboardConstant(const FVector4& UVRect, const FVector4& Color) const
+void URenderer::UpdateInstanceBatchConstant(uint32 InInstanceOffset) const
 {
-    if (!ConstantBufferBillboard) return;
-    D3D11_MAPPED_SUBRESOURCE M = {};
-    GetDeviceContext()->Map(ConstantBufferBillboard, 0, D3D11_MAP_WRITE_DISCARD, 0, &M);
-    struct C { FVector4 A; FVector4 B; };
-    C* Data = (C*)M.pData;
-    Data->A = UVRect;
-    Data->B = Color;
-    GetDeviceContext()->Unmap(ConstantBufferBillboard, 0);
-    Pipeline->SetConstantBuffer(4, true, ConstantBufferBillboard);
-    Pipeline->SetConstantBuffer(4, false, ConstantBufferBillboard);
+	if (!ConstantBufferInstanceBatch)
+	{
+		return;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE ConstantBufferMSR = {};
+	GetDeviceContext()->Map(ConstantBufferInstanceBatch, 0, D3D11_MAP_WRITE_DISCARD, 0, &ConstantBufferMSR);
+	uint32* Offset = static_cast<uint32*>(ConstantBufferMSR.pData);
+	Offset[0] = InInstanceOffset;
+	GetDeviceContext()->Unmap(ConstantBufferInstanceBatch, 0);
+	RenderStats.AddUpload(sizeof(uint32));
+}
+
+/**
+ * @brief 스태틱 메시 섹션의 머티리얼(텍스처/Kd 색) 바인딩
+ * 텍스처가 없거나 로드하지 못한 경우 흰색 텍스처를 써서 기본 vertex 컬러가 출력되도록 한다.
+ */
+void URenderer::BindStaticMeshMaterial(const UMaterial* InMaterial)
+{
+	// 머티리얼에 캐시된 핸들만 사용 (문자열 조회 없음)
+	ID3D11ShaderResourceView* TextureSRV = InMaterial ? InMaterial->GetKdTexture() : nullptr;
+
+	Pipeline->SetConstantBuffer(2, true, ConstantBufferColor);
+
+	if (TextureSRV)
+	{
+		UpdateConstant(FVector4(1.0f, 1.0f, 1.0f, 1.0f));
+	}
+	else
+	{
+		UpdateConstant(InMaterial ? FVector4(InMaterial->GetMaterialInfo().Kd, 1.0f) : FVector4(1.0f, 1.0f, 1.0f, 1.0f));
+		TextureSRV = UResourceManager::GetInstance().GetDefaultTexture();
+	}
+
+	if (TextureSRV)
+	{
+		Pipeline->SetShaderResourceView(1, false, TextureSRV);
+	}
 }
 
 URenderer::FStructuredBufferResource& URenderer::GetOrCreateStructuredBuffer(UStaticMesh* InKey)
@@ -1359,6 +1556,90 @@ void URenderer::UploadStructuredBufferData(FStructuredBufferResource& InResource
 	const size_t CopySize = sizeof(FInstanceGPUData) * static_cast<size_t>(InInstanceCount);
 	memcpy(Mapped.pData, InData, CopySize);
 	GetDeviceContext()->Unmap(InResource.Buffer, 0);
+	RenderStats.AddUpload(CopySize);
+}
+
+bool URenderer::EnsureTableBufferCapacity(FStructuredBufferResource& InResource, uint32 InRequiredCount, uint32 InStride)
+{
+	if (InRequiredCount == 0)
+	{
+		return false;
+	}
+
+	if (InResource.Capacity >= InRequiredCount && InResource.Buffer && InResource.ShaderResourceView)
+	{
+		return false;
+	}
+
+	uint32 NewCapacity = InResource.Capacity > 0 ? InResource.Capacity : 64u;
+	while (NewCapacity < InRequiredCount)
+	{
+		NewCapacity *= 2u;
+	}
+
+	ReleaseStructuredBuffer(InResource);
+
+	// 구간만 UpdateSubresource로 고쳐 쓰므로 DYNAMIC(전체 DISCARD)이 아니라 DEFAULT로 만든다
+	D3D11_BUFFER_DESC BufferDesc = {};
+	BufferDesc.ByteWidth = InStride * NewCapacity;
+	BufferDesc.Usage = D3D11_USAGE_DEFAULT;
+	BufferDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+	BufferDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+	BufferDesc.StructureByteStride = InStride;
+
+	ID3D11Device* Device = GetDevice();
+	HRESULT Hr = Device->CreateBuffer(&BufferDesc, nullptr, &InResource.Buffer);
+	if (FAILED(Hr) || !InResource.Buffer)
+	{
+		UE_LOG("Failed to create table structured buffer");
+		InResource.Buffer = nullptr;
+		return false;
+	}
+
+	D3D11_SHADER_RESOURCE_VIEW_DESC SrvDesc = {};
+	SrvDesc.Format = DXGI_FORMAT_UNKNOWN;
+	SrvDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+	SrvDesc.Buffer.FirstElement = 0;
+	SrvDesc.Buffer.NumElements = NewCapacity;
+
+	Hr = Device->CreateShaderResourceView(InResource.Buffer, &SrvDesc, &InResource.ShaderResourceView);
+	if (FAILED(Hr) || !InResource.ShaderResourceView)
+	{
+		UE_LOG("Failed to create table buffer SRV");
+		InResource.ShaderResourceView = nullptr;
+		ReleaseStructuredBuffer(InResource);
+		return false;
+	}
+
+	InResource.Capacity = NewCapacity;
+	return true;
+}
+
+void URenderer::UploadTableBufferRanges(FStructuredBufferResource& InResource, const void* InData, uint32 InStride,
+	const TArray<FTextTableRange>& InRanges)
+{
+	if (!InResource.Buffer)
+	{
+		return;
+	}
+
+	const uint8* Source = static_cast<const uint8*>(InData);
+	for (const FTextTableRange& Range : InRanges)
+	{
+		const uint32 End = std::min(Range.First + Range.Count, InResource.Capacity);
+		if (Range.First >= End)
+		{
+			continue;
+		}
+
+		D3D11_BOX Box = {};
+		Box.left = Range.First * InStride;
+		Box.right = End * InStride;
+		Box.bottom = 1;
+		Box.back = 1;
+		GetDeviceContext()->UpdateSubresource(InResource.Buffer, 0, &Box, Source + Box.left, 0, 0);
+		RenderStats.AddUpload(Box.right - Box.left);
+	}
 }
 
 void URenderer::ReleasePrimitiveInstanceBuffers()
@@ -1381,5 +1662,30 @@ void URenderer::ReleasePrimitiveInstanceBuffers()
 	}
 
 	StaticMeshStructuredBuffers.Empty();
+
+	// 표를 다시 만들면 캐시된 라벨도 전부 다시 올라가야 한다
+	ReleaseStructuredBuffer(TextGlyphBuffer);
+	ReleaseStructuredBuffer(TextLabelBuffer);
+	TextGlyphCache.Clear();
+	TextLabelRanges.clear();
+	FontTexture = nullptr;
+	FontTextureGeneration = 0;
+}
+
+void URenderer::ReleaseStructuredBuffer(FStructuredBufferResource& InResource)
+{
+	if (InResource.ShaderResourceView)
+	{
+		InResource.ShaderResourceView->Release();
+		InResource.ShaderResourceView = nullptr;
+	}
+
+	if (InResource.Buffer)
+	{
+		InResource.Buffer->Release();
+		InResource.Buffer = nullptr;
+	}
+
+	InResource.Capacity = 0;
 }
 
@@ -0,0 +1,194 @@
+#include "pch.h"
+#include "Render/Renderer/TextBatcher.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	// 한 글자씩 늘어날 때마다 자리를 옮기지 않도록 용량은 2의 거듭제곱으로 잡는다
+	constexpr uint32 MinGlyphCapacity = 8;
+
+	uint32 GlyphCapacityFor(uint32 InNumGlyphs)
+	{
+		uint32 Capacity = MinGlyphCapacity;
+		while (Capacity < InNumGlyphs)
+		{
+			Capacity *= 2u;
+		}
+		return Capacity;
+	}
+}
+
+void FTextGlyphCache::BeginFrame()
+{
+	++Frame;
+}
+
+FTextTableRange FTextGlyphCache::UpdateLabel(const void* InKey, uint64 InRevision, const TArray<FTextGlyphInstance>& InGlyphs,
+	const FMatrix& InWorld, uint32 InUUID)
+{
+	const uint32 NumGlyphs = static_cast<uint32>(InGlyphs.size());
+	auto [It, bInserted] = Entries.try_emplace(InKey);
+	FEntry& Entry = It->second;
+	Entry.LastFrame = Frame;
+
+	bool bLabelDirty = bInserted;
+	if (bInserted)
+	{
+		if (!FreeLabels.empty())
+		{
+			Entry.LabelIndex = FreeLabels.back();
+			FreeLabels.pop_back();
+		}
+		else
+		{
+			Entry.LabelIndex = static_cast<uint32>(Labels.size());
+			Labels.emplace_back();
+		}
+	}
+
+	bool bGlyphsDirty = bInserted || Entry.Revision != InRevision || Entry.NumGlyphs != NumGlyphs;
+	if (NumGlyphs > Entry.Capacity)
+	{
+		if (!bInserted)
+		{
+			FreeGlyphs(Entry);
+		}
+		AllocateGlyphs(Entry, NumGlyphs);
+		bGlyphsDirty = true;
+	}
+
+	if (bGlyphsDirty)
+	{
+		Entry.Revision = InRevision;
+		Entry.NumGlyphs = NumGlyphs;
+		FTextGlyphInstance* Destination = Glyphs.data() + Entry.FirstGlyph;
+		for (uint32 Index = 0; Index < NumGlyphs; ++Index)
+		{
+			Destination[Index] = InGlyphs[Index];
+			Destination[Index].LabelIndex = Entry.LabelIndex;
+		}
+		if (NumGlyphs > 0)
+		{
+			DirtyGlyphRanges.push_back({ Entry.FirstGlyph, NumGlyphs });
+		}
+	}
+
+	// 움직이지 않는 라벨은 행렬을 다시 올리지 않는다
+	FInstanceGPUData& Label = Labels[Entry.LabelIndex];
+	if (bLabelDirty || Label.UUID != InUUID || std::memcmp(&Label.World, &InWorld, sizeof(FMatrix)) != 0)
+	{
+		Label.World = InWorld;
+		Label.Color = FVector4(1, 1, 1, 1);
+		Label.UUID = InUUID;
+		DirtyLabelRanges.push_back({ Entry.LabelIndex, 1 });
+	}
+
+	return { Entry.FirstGlyph, Entry.NumGlyphs };
+}
+
+void FTextGlyphCache::EndFrame()
+{
+	for (auto It = Entries.begin(); It != Entries.end();)
+	{
+		if (It->second.LastFrame != Frame)
+		{
+			// 반납한 구간은 어느 뷰도 참조하지 않으므로 GPU 쪽 내용은 그대로 둔다
+			FreeGlyphs(It->second);
+			FreeLabels.push_back(It->second.LabelIndex);
+			It = Entries.erase(It);
+		}
+		else
+		{
+			++It;
+		}
+	}
+
+	MergeRanges(DirtyGlyphRanges);
+	MergeRanges(DirtyLabelRanges);
+}
+
+void FTextGlyphCache::ClearDirty()
+{
+	DirtyGlyphRanges.clear();
+	DirtyLabelRanges.clear();
+}
+
+void FTextGlyphCache::Clear()
+{
+	Entries.Empty();
+	Glyphs.clear();
+	Labels.clear();
+	FreeGlyphBlocks.Empty();
+	FreeLabels.clear();
+	ClearDirty();
+}
+
+void FTextGlyphCache::AllocateGlyphs(FEntry& InOutEntry, uint32 InNumGlyphs)
+{
+	const uint32 Capacity = GlyphCapacityFor(InNumGlyphs);
+	InOutEntry.Capacity = Capacity;
+
+	if (TArray<uint32>* FreeBlocks = FreeGlyphBlocks.Find(Capacity))
+	{
+		if (!FreeBlocks->empty())
+		{
+			InOutEntry.FirstGlyph = FreeBlocks->back();
+			FreeBlocks->pop_back();
+			return;
+		}
+	}
+
+	InOutEntry.FirstGlyph = static_cast<uint32>(Glyphs.size());
+	Glyphs.resize(Glyphs.size() + Capacity);
+}
+
+void FTextGlyphCache::FreeGlyphs(const FEntry& InEntry)
+{
+	if (InEntry.Capacity > 0)
+	{
+		FreeGlyphBlocks[InEntry.Capacity].push_back(InEntry.FirstGlyph);
+	}
+}
+
+void FTextGlyphCache::MergeRanges(TArray<FTextTableRange>& InOutRanges)
+{
+	if (InOutRanges.size() <= 1)
+	{
+		return;
+	}
+
+	std::sort(InOutRanges.begin(), InOutRanges.end(),
+		[](const FTextTableRange& A, const FTextTableRange& B) { return A.First < B.First; });
+
+	size_t Merged = 0;
+	for (size_t Index = 1; Index < InOutRanges.size(); ++Index)
+	{
+		FTextTableRange& Last = InOutRanges[Merged];
+		const FTextTableRange& Range = InOutRanges[Index];
+		if (Range.First <= Last.First + Last.Count)
+		{
+			Last.Count = std::max(Last.First + Last.Count, Range.First + Range.Count) - Last.First;
+		}
+		else
+		{
+			InOutRanges[++Merged] = Range;
+		}
+	}
+	InOutRanges.resize(Merged + 1);
+}
+
+void FTextBatcher::Reset()
+{
+	// 용량은 유지해서 매 프레임 재할당하지 않는다
+	GlyphSlots.clear();
+}
+
+void FTextBatcher::AddLabel(const FTextTableRange& InGlyphRange)
+{
+	for (uint32 Index = 0; Index < InGlyphRange.Count; ++Index)
+	{
+		GlyphSlots.push_back(InGlyphRange.First + Index);
+	}
+}
@@ -1,5 +1,13 @@
 #include "pch.h"
 #include "Render/UI/Widget/ConsoleWidget.h"
+#include "Render/Renderer/Renderer.h"
+#include "Manager/Overlay/OverlayManager.h"
+#include "Render/Cull/MSOCDebug.h"
+#include "Render/Renderer/DrawList.h"
+#include "Manager/Resource/ResourceManager.h"
+#include "Global/ParallelFor.h"
+#include "Manager/Level/World.h"
+#include "Level/Level.h"
 #include <sstream>
 #include <iostream>
 #include <cstdio>
@@ -332,6 +340,8 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 	HistoryPosition = -1;
 
 	FString Input = InCommand;
+	FString CommandLower = Input;
+	std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower);
 
 	// UE_LOG( 우선 탐색
 	size_t StartPosition = Input.find("UE_LOG(");
@@ -619,17 +629,13 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 	}
 
 	// Clear 명령어 입력
-	else if (FString CommandLower = InCommand;
-		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
-		CommandLower == "clear")
+	else if (CommandLower == "clear")
 	{
 		ClearLog();
 	}
 
 	// Help 명령어 입력
-	else if (FString CommandLower = InCommand;
-		std::transform(CommandLower.begin(), CommandLower.end(), CommandLower.begin(), ::tolower),
-		CommandLower == "help")
+	else if (CommandLower == "help")
 	{
 		AddLog(ELogType::System, "Available Commands:");
 		AddLog(ELogType::Info, "  CLEAR - Clear The Console");
@@ -641,6 +647,23 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::Debug, "    2개 인자 예제: UE_LOG(\"Score: %%d, Lives: %%d\", 2500, 3)");
 		AddLog(ELogType::Warning, "    주의: 포맷 지정자와 인자 개수가 일치해야 합니다!");
 		AddLog(ELogType::Info, "");
+		AddLog(ELogType::System, "Render Variables:");
+		AddLog(ELogType::Info, "  r.Occlusion.Resolution [W]x[H] - 오클루전 버퍼 해상도 (0 = 백버퍼 해상도, 인자 없으면 현재 값)");
+		AddLog(ELogType::Info, "  r.Occlusion.Reprojection 0|1 - 이전 프레임 깊이를 재투영해 오클루전 버퍼 시딩");
+		AddLog(ELogType::Info, "  r.Occlusion.Benchmark - 오클루전 버퍼 해상도별 비용/정확도 측정");
+		AddLog(ELogType::Info, "  r.Occlusion.Dump [Prefix] - 오클루전 버퍼 커버리지/타일 깊이를 PGM으로 저장");
+		AddLog(ELogType::Info, "  r.Occlusion.Scene [File] - 스크립트 장면으로 오클루전 실행 (기대값 검사 + 시간 측정)");
+		AddLog(ELogType::Info, "  r.SIMD.Level [scalar|sse41|avx2|avx512] - SIMD 커널 경로 강제 지정 (인자 없으면 현재 값)");
+		AddLog(ELogType::Info, "  r.SIMD.Benchmark - 지원하는 SIMD 경로별 오클루전/행렬 커널 비용 측정");
+		AddLog(ELogType::Info, "  r.DrawList.Benchmark [N] - 드로우 정렬 키 기수 정렬과 std::sort 비용 비교 (인자 없으면 1K~256K)");
+		AddLog(ELogType::Info, "  obj.Pools - UObject 클래스별 메모리 풀 통계 (살아 있는 수/최대/슬랩/단편화)");
+		AddLog(ELogType::Info, "  tick.Stats - 현재 레벨의 틱 등록/활성/실행 수와 단계별 실행 수, 지난 프레임 틱 시간");
+		AddLog(ELogType::Info, "  obj.Cast.Benchmark [N] - IsA/Cast의 SuperClass 체인 순회와 구간 비교 비용 비교 (인자 없으면 1M)");
+		AddLog(ELogType::Info, "  r.ReloadTextures - 로드된 텍스처를 해제하고 다음 사용 때 다시 로드");
+		AddLog(ELogType::Info, "  stat render - 렌더 통계(드로우/인스턴스/삼각형/바인드/업로드/패스별 CPU 시간) 표시 토글");
+		AddLog(ELogType::Info, "  stat render csv [File] - 프레임마다 렌더 통계를 CSV로 기록 (인자 없으면 기록 중지)");
+		AddLog(ELogType::Info, "  stat memory [dump] - 태그별(Renderer/Assets/Level/UI/Octree) 힙 사용량 표시 토글 (dump: 콘솔에 출력)");
+		AddLog(ELogType::Info, "");
 		AddLog(ELogType::System, "Camera Controls:");
 		AddLog(ELogType::Info, "  우클릭 + WASD - 카메라 이돘");
 		AddLog(ELogType::Info, "  우클릭 + Q/E - 위/아래 이돘");
@@ -655,6 +678,293 @@ void UConsoleWidget::ProcessCommand(const char* InCommand)
 		AddLog(ELogType::Info, "  ping [host] - Network ping");
 		AddLog(ELogType::Info, "  Any Windows command will be executed directly");
 	}
+	// 오클루전 버퍼 해상도 변경 (r.Occlusion.Resolution 512x256)
+	else if (CommandLower.rfind("r.occlusion.resolution", 0) == 0)
+	{
+		USoftwareOcclusionCuller& Culler = URenderer::GetInstance().MSOC;
+		FString Argument = CommandLower.substr(strlen("r.occlusion.resolution"));
+		Argument.erase(0, Argument.find_first_not_of(' '));
+
+		int Width = 0;
+		int Height = 0;
+		if (Argument.empty())
+		{
+			AddLog(ELogType::Info, "r.Occlusion.Resolution = %dx%d (buffer %dx%d)",
+				Culler.GetRequestedBufferWidth(), Culler.GetRequestedBufferHeight(),
+				Culler.GetHiZ().ScreenW, Culler.GetHiZ().ScreenH);
+		}
+		else if (Argument == "0" || sscanf_s(Argument.c_str(), "%dx%d", &Width, &Height) == 2)
+		{
+			Culler.SetBufferResolution(Width, Height);
+			AddLog(ELogType::Success, "r.Occlusion.Resolution = %dx%d (buffer %dx%d)",
+				Width, Height, Culler.GetHiZ().ScreenW, Culler.GetHiZ().ScreenH);
+		}
+		else
+		{
+			AddLog(ELogType::Error, "Usage: r.Occlusion.Resolution [W]x[H] | 0");
+		}
+	}
+	// 이전 프레임 깊이 재투영 시딩 (r.Occlusion.Reprojection 0|1)
+	else if (CommandLower.rfind("r.occlusion.reprojection", 0) == 0)
+	{
+		USoftwareOcclusionCuller& Culler = URenderer::GetInstance().MSOC;
+		FString Argument = CommandLower.substr(strlen("r.occlusion.reprojection"));
+		Argument.erase(0, Argument.find_first_not_of(' '));
+
+		if (Argument == "0" || Argument == "1")
+		{
+			Culler.SetReprojectionSeeding(Argument == "1");
+		}
+		else if (!Argument.empty())
+		{
+			AddLog(ELogType::Error, "Usage: r.Occlusion.Reprojection 0 | 1");
+			return;
+		}
+		AddLog(ELogType::Info, "r.Occlusion.Reprojection = %d", Culler.IsReprojectionSeeding() ? 1 : 0);
+	}
+	else if (CommandLower == "r.occlusion.benchmark")
+	{
+		URenderer::GetInstance().RunOcclusionBenchmark();
+	}
+	// SIMD 커널 경로 (r.SIMD.Level avx2)
+	else if (CommandLower.rfind("r.simd.level", 0) == 0)
+	{
+		FString Argument = CommandLower.substr(strlen("r.simd.level"));
+		Argument.erase(0, Argument.find_first_not_of(' '));
+
+		if (!Argument.empty())
+		{
+			ESIMDLevel Requested;
+			if (!FCPUFeatures::FromString(Argument, Requested))
+			{
+				AddLog(ELogType::Error, "Usage: r.SIMD.Level [scalar | sse41 | avx2 | avx512]");
+				return;
+			}
+			if (FCPUFeatures::SetActiveLevel(Requested) != Requested)
+			{
+				AddLog(ELogType::Warning, "r.SIMD.Level: CPU가 %s를 지원하지 않습니다", FCPUFeatures::ToString(Requested));
+			}
+		}
+		AddLog(ELogType::Info, "r.SIMD.Level = %s (CPU max %s)",
+			FCPUFeatures::ToString(FCPUFeatures::GetActiveLevel()), FCPUFeatures::ToString(FCPUFeatures::Get().MaxLevel));
+	}
+	else if (CommandLower == "r.simd.benchmark")
+	{
+		URenderer::GetInstance().RunSIMDBenchmark();
+	}
+	else if (CommandLower == "r.reloadtextures")
+	{
+		UResourceManager::GetInstance().ReloadTextures();
+		AddLog(ELogType::Success, "r.ReloadTextures: 텍스처 캐시를 비웠습니다");
+	}
+	// 렌더 통계 (stat render, stat render csv RenderStats.csv)
+	else if (CommandLower.rfind("stat render", 0) == 0)
+	{
+		FString Argument = FString(InCommand).substr(strlen("stat render"));
+		Argument.erase(0, Argument.find_first_not_of(' '));
+
+		UOverlayManager& Overlay = UOverlayManager::GetInstance();
+		FRenderStats& RenderStats = URenderer::GetInstance().GetRenderStats();
+		if (Argument.empty())
+		{
+			Overlay.SetRenderStatsVisible(!Overlay.IsRenderStatsVisible());
+			AddLog(ELogType::Info, "stat render = %d", Overlay.IsRenderStatsVisible() ? 1 : 0);
+		}
+		else if (FString ArgumentLower = CommandLower.substr(strlen("stat render"));
+			ArgumentLower.erase(0, ArgumentLower.find_first_not_of(' ')), ArgumentLower.rfind("csv", 0) == 0)
+		{
+			FString FilePath = Argument.substr(strlen("csv"));
+			FilePath.erase(0, FilePath.find_first_not_of(' '));
+
+			if (FilePath.empty())
+			{
+				if (RenderStats.IsCapturingCsv())
+				{
+					RenderStats.StopCsvCapture();
+					AddLog(ELogType::Success, "stat render csv: %s (%llu frames)", RenderStats.GetCsvFilePath().c_str(),
+						static_cast<unsigned long long>(RenderStats.GetNumCsvRows()));
+				}
+				else
+				{
+					AddLog(ELogType::Error, "Usage: stat render csv <File>");
+				}
+			}
+			else if (RenderStats.StartCsvCapture(FilePath))
+			{
+				AddLog(ELogType::Success, "stat render csv: %s 기록 시작 (stat render csv 로 중지)", FilePath.c_str());
+			}
+			else
+			{
+				AddLog(ELogType::Error, "stat render csv: %s 를 열 수 없습니다", FilePath.c_str());
+			}
+		}
+		else
+		{
+			AddLog(ELogType::Error, "Usage: stat render [csv [File]]");
+		}
+	}
+	// 태그별 힙 사용량 (stat memory, stat memory dump)
+	else if (CommandLower.rfind("stat memory", 0) == 0)
+	{
+		FString Argument = CommandLower.substr(strlen("stat memory"));
+		Argument.erase(0, Argument.find_first_not_of(' '));
+
+		if (Argument.empty())
+		{
+			UOverlayManager& Overlay = UOverlayManager::GetInstance();
+			Overlay.SetMemoryStatsVisible(!Overlay.IsMemoryStatsVisible());
+			AddLog(ELogType::Info, "stat memory = %d", Overlay.IsMemoryStatsVisible() ? 1 : 0);
+		}
+		else if (Argument == "dump")
+		{
+			FMemoryStats MemoryStats;
+			FMemoryTracker::GetStats(MemoryStats);
+			TArray<FString> Lines;
+			FMemoryTracker::FormatLines(MemoryStats, Lines);
+			for (const FString& Line : Lines)
+			{
+				AddLog(ELogType::Info, "%s", Line.c_str());
+			}
+		}
+		else
+		{
+			AddLog(ELogType::Error, "Usage: stat memory [dump]");
+		}
+	}
+	// 드로우 리스트 정렬 비용 (r.DrawList.Benchmark 100000)
+	else if (CommandLower.rfind("r.drawlist.benchmark", 0) == 0)
+	{
+		FString Argument = CommandLower.substr(strlen("r.drawlist.benchmark"));
+		Argument.erase(0, Argument.find_first_not_of(' '));
+
+		TArray<int32> Sizes = { 1024, 16384, 65536, 262144 };
+		if (!Argument.empty())
+		{
+			int Count = 0;
+			if (sscanf_s(Argument.c_str(), "%d", &Count) != 1 || Count <= 0)
+			{
+				AddLog(ELogType::Error, "Usage: r.DrawList.Benchmark [N]");
+				return;
+			}
+			Sizes = { Count };
+		}
+
+		UE_LOG("DrawList Benchmark: %d threads", GetParallelForThreadCount());
+		for (int32 Size : Sizes)
+		{
+			FDrawListBenchmarkResult Result;
+			FDrawList::Benchmark(Size, Result);
+			UE_LOG("  %7d cmds  build %.3f ms  radix %.3f ms (1 thread %.3f ms)  std::stable_sort %.3f ms  %s",
+				Result.NumCommands, Result.BuildMs, Result.RadixSortMs, Result.RadixSortSingleThreadMs, Result.StdSortMs,
+				Result.bMatchesStdSort ? "match" : "MISMATCH");
+		}
+	}
+	// UObject 풀 통계
+	else if (CommandLower == "obj.pools")
+	{
+		TArray<FObjectPoolStats> Stats;
+		FObjectPool::GatherStats(Stats);
+		std::sort(Stats.begin(), Stats.end(),
+			[](const FObjectPoolStats& A, const FObjectPoolStats& B) { return A.ReservedBytes > B.ReservedBytes; });
+
+		uint64 TotalReserved = 0;
+		uint32 TotalLive = 0;
+		UE_LOG("UObject Pools: %zu", Stats.size());
+		for (const FObjectPoolStats& Pool : Stats)
+		{
+			UE_LOG("  %-28s %5u B  live %6u  peak %6u  slabs %4u  %8.1f KB  frag %5.1f%%",
+				Pool.Name.c_str(), Pool.ObjectSize, Pool.NumLive, Pool.PeakLive, Pool.NumSlabs,
+				Pool.ReservedBytes / 1024.0, Pool.GetFragmentation() * 100.0f);
+			TotalReserved += Pool.ReservedBytes;
+			TotalLive += Pool.NumLive;
+		}
+		UE_LOG("  total live %u  reserved %.1f KB", TotalLive, TotalReserved / 1024.0);
+	}
+	// 틱 매니저 통계 (tick.Stats)
+	else if (CommandLower == "tick.stats")
+	{
+		ULevel* Level = GWorld ? GWorld->GetCurrentLevel() : nullptr;
+		if (!Level)
+		{
+			AddLog(ELogType::Error, "tick.Stats: 현재 레벨이 없습니다");
+		}
+		else
+		{
+			const FTickStats& Stats = Level->GetTickManager().GetStats();
+			AddLog(ELogType::Info, "Tick: registered %u  enabled %u  ticked %u (parallel %u)  waves %u  %.3f ms",
+				Stats.NumRegistered, Stats.NumEnabled, Stats.NumTicked, Stats.NumTickedParallel, Stats.NumWaves,
+				Stats.TickMilliseconds);
+			AddLog(ELogType::Info, "  PrePhysics %u  DuringPhysics %u  PostUpdateWork %u",
+				Stats.NumTickedPerGroup[static_cast<uint8>(ETickGroup::PrePhysics)],
+				Stats.NumTickedPerGroup[static_cast<uint8>(ETickGroup::DuringPhysics)],
+				Stats.NumTickedPerGroup[static_cast<uint8>(ETickGroup::PostUpdateWork)]);
+		}
+	}
+	// IsA/Cast 비용 (obj.Cast.Benchmark 1000000)
+	else if (CommandLower.rfind("obj.cast.benchmark", 0) == 0)
+	{
+		FString Argument = CommandLower.substr(strlen("obj.cast.benchmark"));
+		Argument.erase(0, Argument.find_first_not_of(' '));
+
+		int Count = 1000000;
+		if (!Argument.empty() && (sscanf_s(Argument.c_str(), "%d", &Count) != 1 || Count <= 0))
+		{
+			AddLog(ELogType::Error, "Usage: obj.Cast.Benchmark [N]");
+			return;
+		}
+
+		FCastBenchmarkResult Result;
+		UClass::BenchmarkCast(Count, Result);
+		const double ChainRate = Result.ChainWalkMs > 0.0 ? Result.NumQueries / (Result.ChainWalkMs * 1000.0) : 0.0;
+		const double IntervalRate = Result.IntervalMs > 0.0 ? Result.NumQueries / (Result.IntervalMs * 1000.0) : 0.0;
+		UE_LOG("Cast Benchmark: %d queries over %d classes", Result.NumQueries, Result.NumClasses);
+		UE_LOG("  chain walk %.3f ms (%.1f M/s)  interval %.3f ms (%.1f M/s)  %s",
+			Result.ChainWalkMs, ChainRate, Result.IntervalMs, IntervalRate,
+			Result.bMatchesChainWalk ? "match" : "MISMATCH");
+	}
+	// 현재 오클루전 버퍼를 PGM으로 덤프 (r.Occlusion.Dump [Prefix])
+	else if (CommandLower.rfind("r.occlusion.dump", 0) == 0)
+	{
+		FString Prefix = FString(InCommand).substr(strlen("r.occlusion.dump"));
+		Prefix.erase(0, Prefix.find_first_not_of(' '));
+		if (Prefix.empty())
+		{
+			Prefix = "MSOC";
+		}
+
+		if (FOcclusionHarness::DumpBuffer(URenderer::GetInstance().MSOC.GetHiZ(), Prefix))
+		{
+			AddLog(ELogType::Success, "r.Occlusion.Dump: %s_coverage.pgm, %s_z0.pgm, %s_z1.pgm",
+				Prefix.c_str(), Prefix.c_str(), Prefix.c_str());
+		}
+		else
+		{
+			AddLog(ELogType::Error, "r.Occlusion.Dump: 덤프 실패");
+		}
+	}
+	// 스크립트 장면을 GPU 없이 실행 (r.Occlusion.Scene <File>)
+	else if (CommandLower.rfind("r.occlusion.scene", 0) == 0)
+	{
+		FString ScenePath = FString(InCommand).substr(strlen("r.occlusion.scene"));
+		ScenePath.erase(0, ScenePath.find_first_not_of(' '));
+
+		FOcclusionScene Scene;
+		if (ScenePath.empty() || !FOcclusionHarness::LoadScene(ScenePath, Scene))
+		{
+			AddLog(ELogType::Error, "Usage: r.Occlusion.Scene <File>");
+			return;
+		}
+
+		USoftwareOcclusionCuller Culler;
+		FOcclusionHarnessReport Report;
+		FOcclusionHarness::Run(Scene, Culler, Report);
+		FOcclusionHarness::DumpBuffer(Culler.GetHiZ(), ScenePath);
+
+		AddLog(Report.NumMismatched == 0 ? ELogType::Success : ELogType::Error,
+			"r.Occlusion.Scene: buffer %dx%d, raster %.3f ms, test %.3f ms, occluded %d/%d, mismatched %d",
+			Culler.GetHiZ().ScreenW, Culler.GetHiZ().ScreenH, Report.RasterizeMs, Report.TestMs,
+			Report.NumOccluded, static_cast<int32>(Scene.Occludees.size()), Report.NumMismatched);
+	}
 	else
 	{
 		// 실제 터미널 명령어 실행
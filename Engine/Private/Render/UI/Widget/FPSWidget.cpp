@@ -3,6 +3,8 @@
 #include "Render/UI/Widget/FPSWidget.h"
 
 #include "Manager/Time/TimeManager.h"
+#include "Manager/Overlay/OverlayManager.h"
+#include "Render/Renderer/Renderer.h"
 
 constexpr float REFRESH_INTERVAL = 0.1f;
 
@@ -72,11 +74,45 @@ void UFPSWidget::RenderWidget()
 
 	// Game Time 출력
 	ImGui::Text("Game Time: %.1f s", TotalGameTime);
-	ImGui::Text("Total Allocation Count: %s", to_string(TotalAllocationCount).c_str());
-	ImGui::Text("Total Allocation Memory Byte: %s", to_string(TotalAllocationBytes).c_str());
-	ImGui::Text("Total UObject Count: %s", to_string(GUObjectArray.size()).c_str());
+	FMemoryStats MemoryStats;
+	FMemoryTracker::GetStats(MemoryStats);
+	ImGui::Text("Total Allocation Count: %s", to_string(MemoryStats.Total.LiveCount).c_str());
+	ImGui::Text("Total Allocation Memory Byte: %s", to_string(MemoryStats.Total.LiveBytes).c_str());
+	ImGui::Text("Total UObject Count: %s", to_string(GUObjectArray.Num()).c_str());
+	ImGui::Text("SIMD Path: %s (CPU max %s)", FCPUFeatures::ToString(FCPUFeatures::GetActiveLevel()),
+		FCPUFeatures::ToString(FCPUFeatures::Get().MaxLevel));
 	ImGui::Separator();
 
+	// stat render: 지난 프레임 렌더 통계
+	if (UOverlayManager::GetInstance().IsRenderStatsVisible())
+	{
+		const FRenderStats& RenderStats = URenderer::GetInstance().GetRenderStats();
+		TArray<FString> Lines;
+		FRenderStats::FormatLines(RenderStats.GetLastFrame(), Lines);
+		for (const FString& Line : Lines)
+		{
+			ImGui::TextUnformatted(Line.c_str());
+		}
+		if (RenderStats.IsCapturingCsv())
+		{
+			ImGui::Text("CSV: %s (%llu frames)", RenderStats.GetCsvFilePath().c_str(),
+				static_cast<unsigned long long>(RenderStats.GetNumCsvRows()));
+		}
+		ImGui::Separator();
+	}
+
+	// stat memory: 태그별 힙 사용량과 지난 프레임 할당 수
+	if (UOverlayManager::GetInstance().IsMemoryStatsVisible())
+	{
+		TArray<FString> Lines;
+		FMemoryTracker::FormatLines(MemoryStats, Lines);
+		for (const FString& Line : Lines)
+		{
+			ImGui::TextUnformatted(Line.c_str());
+		}
+		ImGui::Separator();
+	}
+
 	ImGui::Checkbox("Show Details", &bShowGraph);
 
 	// Details
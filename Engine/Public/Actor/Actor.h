@@ -5,6 +5,19 @@
 
 class ULevel;
 class UStaticMesh;
+class AActor;
+
+/**
+ * @brief 액터의 Tick을 부르는 틱 함수
+ */
+class FActorTickFunction : public FTickFunction
+{
+public:
+	AActor* Target = nullptr;
+
+	void ExecuteTick(float InDeltaTime) override;
+};
+
 /**
  * @brief Level에서 렌더링되는 UObject 클래스
  * UWorld로부터 업데이트 함수가 호출되면 component들을 순회하며 위치, 애니메이션, 상태 처리
@@ -31,7 +44,7 @@ public:
 
 	virtual void BeginPlay();
 	virtual void EndPlay();
-	virtual void Tick();
+	virtual void Tick(float DeltaTime);
 
 	// ----- Components -----
 	// Getter & Setter
@@ -47,8 +60,16 @@ public:
 	{
 		RootComponent = InOwnedComponents;
 	}
-	bool IsActorTickEnabled() { return bIsTickEnabled; };
-	bool IsTickInEditor() { return bTickInEditor; };
+	bool IsActorTickEnabled() const { return PrimaryActorTick.IsTickFunctionEnabled(); }
+	void SetActorTickEnabled(bool bInEnabled) { PrimaryActorTick.SetTickFunctionEnable(bInEnabled); }
+	bool IsTickInEditor() const { return PrimaryActorTick.bTickInEditor; }
+	void SetActorTickInterval(float InInterval) { PrimaryActorTick.TickInterval = InInterval; }
+
+	/**
+	 * 레벨에 들어갈 때 bCanEverTick이면 레벨 틱 매니저에 등록된다.
+	 * 기본은 틱하지 않는다: 틱이 필요한 액터는 생성자에서 bCanEverTick을 켠다 (SetInitPos는 자동으로 켠다)
+	 */
+	FActorTickFunction PrimaryActorTick;
 
 	// ----- Actor state -----
 	const FVector& GetActorLocation() const;
@@ -68,6 +89,14 @@ public:
 		OwnerLevel = InLevel;
 	}
 
+	// ----- Level slot (레벨에서만 설정) -----
+	// LevelActors 안의 위치. 레벨이 교체 삭제로 옮길 때 갱신하며, 레벨에 없으면 -1
+	int32 GetLevelActorIndex() const { return LevelActorIndex; }
+	void SetLevelActorIndex(int32 InIndex) { LevelActorIndex = InIndex; }
+	// 삭제 대기 (MarkActorForDeletion ~ 다음 프레임 실제 삭제 사이)
+	bool IsPendingKill() const { return bPendingKill; }
+	void SetPendingKill(bool bInPendingKill) { bPendingKill = bInPendingKill; }
+
 	//테스트용
 	FString GetStaticMeshName();
 	void SetStaticMesh(UStaticMesh* InStaticMesh);
@@ -80,15 +109,15 @@ public:
 	virtual AActor* DuplicateForTest(class ULevel* NewOuter, AActor* OldActor) const;
 	virtual void CopyShallow(UObject* Src) override;
 
-	void SetInitPos(FVector Pos) { InitPos = Pos; }
+	void SetInitPos(FVector Pos);
 	FVector GetInitPos() { return InitPos; }
 private:
 	USceneComponent* RootComponent = nullptr;
 	TSet<UActorComponent*> OwnedComponents;
 	ULevel* OwnerLevel = nullptr; 	// 현재 자신이 속한 레벨(비소유, 생명주기 소유권 없음)
+	int32 LevelActorIndex = -1;
+	bool bPendingKill = false;
 
-	bool bIsTickEnabled;
-	bool bTickInEditor;
 
 	FVector InitPos; 
 };
@@ -1,7 +1,21 @@
 #pragma once
 #include "Core/Object.h"
+#include "Core/TickManager.h"
 
 class AActor;
+class UActorComponent;
+
+/**
+ * @brief 컴포넌트의 TickComponent를 부르는 틱 함수
+ * 소유 액터의 틱이 있으면 그 뒤에 실행된다 (ULevel::RegisterActorTickFunctions에서 선행으로 건다)
+ */
+class FActorComponentTickFunction : public FTickFunction
+{
+public:
+	UActorComponent* Target = nullptr;
+
+	void ExecuteTick(float InDeltaTime) override;
+};
 
 class UActorComponent : public UObject
 {
@@ -16,7 +30,7 @@ public:
 	}*/
 
 	virtual void BeginPlay();
-	virtual void TickComponent();
+	virtual void TickComponent(float DeltaTime);
 	virtual void EndPlay();
 	virtual void Destroy();
 
@@ -27,7 +41,11 @@ public:
 
 	EComponentType GetComponentType() const { return ComponentType; }
 
-	bool IsComponentTickEnabled() { return bIsComponentTickEnabled; }
+	bool IsComponentTickEnabled() const { return PrimaryComponentTick.IsTickFunctionEnabled(); }
+	void SetComponentTickEnabled(bool bInEnabled) { PrimaryComponentTick.SetTickFunctionEnable(bInEnabled); }
+
+	/** 기본은 틱하지 않는다. 틱이 필요한 컴포넌트는 생성자에서 bCanEverTick을 켠다 */
+	FActorComponentTickFunction PrimaryComponentTick;
 
 	//Duplicate
 	virtual void DuplicateSubObjects() override;
@@ -37,6 +55,5 @@ public:
 protected:
 	EComponentType ComponentType;
 private:
-	AActor* Owner;
-	bool bIsComponentTickEnabled; 
+	AActor* Owner = nullptr;
 };
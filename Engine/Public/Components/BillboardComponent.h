@@ -40,7 +40,7 @@ public:
     ID3D11ShaderResourceView* GetSpriteSRV() const { return SpriteSRV; }
 
     // UPrimitiveComponent 인터페이스 구현
-    void AddToRenderList(ULevel* Level) override;    // 현재는 렌더 큐에 올리지 않음
+    void AddToRenderList(ULevel* Level) override;
     bool IsRayCollided(const FRay& WorldRay, float& ShortestDistance) const override;
     FAABB GetWorldBounds() const override;
 
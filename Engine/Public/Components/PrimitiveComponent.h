@@ -11,13 +11,13 @@ class UPrimitiveComponent : public USceneComponent
 
 public:
 	UPrimitiveComponent();
-	virtual ~UPrimitiveComponent() = default;
+	virtual ~UPrimitiveComponent();
 	virtual bool IsRayCollided(const FRay& WorldRay, float& ShortestDistance) const  = 0;
 	virtual FAABB GetWorldBounds() const = 0;
 
 	FVector4 GetColor() const { return Color; }
 
-	void SetVisibility(bool bVisibility) { bVisible = bVisibility; }
+	void SetVisibility(bool bVisibility);
 	void SetColor(const FVector4& InColor) { Color = InColor; }
 	int32 GetOctreeIndex() const { return OctreeIndex; }
 	void SetOctreeIndex(int32 Index) { OctreeIndex = Index; }
@@ -26,6 +26,11 @@ public:
 	//StaticMesh가 구현되면 주석 해제(09/19 13:05)
 	//자식 Component들이 본인의 타입에 맞게 알아서 RenderList에 저장하도록 하기 위해 가상함수 선언
 	virtual void AddToRenderList(ULevel* Level) = 0;
+
+	// 등록된 레벨 렌더 리스트와 그 안의 인덱스 (ULevel만 갱신한다)
+	ULevel* GetRenderLevel() const { return RenderLevel; }
+	int32 GetRenderListIndex() const { return RenderListIndex; }
+	void SetRenderListSlot(ULevel* InLevel, int32 InIndex) { RenderLevel = InLevel; RenderListIndex = InIndex; }
 	///////////////////////////////////////////////////
 	
 	//FAABB GetWorldBounds() const;
@@ -46,6 +51,9 @@ protected:
 	bool bVisible = true;
 	int32 OctreeIndex = -1;
 
+	ULevel* RenderLevel = nullptr;
+	int32 RenderListIndex = -1;
+
 	//TEST
 	float DepthKey;
 };
@@ -1,6 +1,7 @@
 #pragma once
 #include "Components/ActorComponent.h"
 #include "Public/Manager/Resource/ResourceManager.h"
+#include "Components/TransformStore.h"
 #include "Math/AABB.h"
 #include "Global/Quat.h"
 
@@ -12,6 +13,10 @@ public:
 	USceneComponent();
 	virtual ~USceneComponent();
 
+	// 핸들을 나눠 갖지 않도록 복사 금지
+	USceneComponent(const USceneComponent&) = delete;
+	USceneComponent& operator=(const USceneComponent&) = delete;
+
 	void SetParentAttachment(USceneComponent* SceneComponent);
 	void RemoveChild(USceneComponent* ChildDeleted);
 
@@ -19,27 +24,30 @@ public:
 
 	void SetRelativeLocation(const FVector& Location);
     void SetRelativeRotation(const FVector& Rotation);
-    void SetRelativeRotation(const FQuat& Rotation) { RelativeRotationQuat = Rotation; RelativeRotation = FQuat::ToEulerXYZ(Rotation); MarkAsDirty(); }
+    void SetRelativeRotation(const FQuat& Rotation);
 	void SetRelativeScale3D(const FVector& Scale);
 	void SetUniformScale(bool bIsUniform);
 
-	void NotMove() { bIsMoved = false; }
+	void NotMove() { FTransformStore::GetInstance().ClearFlags(TransformHandle, FTransformStore::Moved); }
 	bool IsUniformScale() const;
-	bool IsMoved() const { return bIsMoved; }
+	bool IsMoved() const { return FTransformStore::GetInstance().GetFlags(TransformHandle) & FTransformStore::Moved; }
 
 	const FVector& GetRelativeLocation() const;
 	const FVector& GetRelativeRotation() const;
-	const FQuat&   GetRelativeRotationQuat() const { return RelativeRotationQuat; }
+	const FQuat&   GetRelativeRotationQuat() const { return FTransformStore::GetInstance().GetRotation(TransformHandle); }
 	const FVector& GetRelativeScale3D() const;
 	TArray<USceneComponent*>& GetChildComponents()  { return Children; }
 	const USceneComponent* GetParentComponent() const {	return ParentAttachment;}
 
-    const FVector& GetWorldLocation() const;
+    FVector GetWorldLocation() const;
 
     const FMatrix& GetWorldTransformMatrix() const;
     const FMatrix& GetWorldTransformMatrixInverse() const;
     USceneComponent* GetParentAttachment() const { return ParentAttachment; }
 
+	/** FTransformStore 슬롯 (로컬 TRS와 월드 행렬은 모두 저장소에 있다) */
+	uint32 GetTransformHandle() const { return TransformHandle; }
+
 	virtual void DuplicateSubObjects() override;
 	virtual UObject* Duplicate() override;
 	virtual void CopyShallow(UObject* Src) override;
@@ -47,24 +55,17 @@ public:
 	void ChildComponentTransformToParent(USceneComponent* Parent);
 
 protected:
-	mutable bool bIsTransformDirty = true;
-	mutable bool bIsTransformDirtyInverse = true;
-private:
-	mutable FMatrix WorldTransformMatrix;
-	mutable FMatrix WorldTransformMatrixInverse;
-
+	/** 월드 행렬/역행렬/이동 플래그가 모두 서 있으면 자손도 모두 더티다 (MarkAsDirty 조기 종료 조건) */
+	bool IsMarkedDirty() const { return FTransformStore::GetInstance().HasAllFlags(TransformHandle, FTransformStore::AllDirty); }
 
+private:
+	uint32 TransformHandle = FTransformStore::InvalidHandle;
 
 	USceneComponent* ParentAttachment = nullptr;
 	//OwnedComponent는 빠른 탐색/ 제거/고유성이 보장되야 하므로 TSet이지만
 	//Children은 빠른 순회가 목적이므로 TArray
 	TArray<USceneComponent*> Children;
-	FVector RelativeLocation = FVector{ 0,0,0.f };
-	FVector RelativeRotation = FVector{ 0,0,0.f };
-	FQuat   RelativeRotationQuat = FQuat::Identity;
-	FVector RelativeScale3D = FVector{ 1.0f,1.0f,1.0f };
 	bool bIsUniformScale = false;
-	bool bIsMoved = false;
 	const float MinScale = 0.01f;
 };
 
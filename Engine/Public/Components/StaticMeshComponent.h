@@ -15,7 +15,7 @@ public:
 	UStaticMeshComponent();
 	//StaticMesh가 구현되면 주석 해제(09/19 13:05)
 	//자식 StaticMeshComponent가 본인 타입에 맞는 렌더 리스트에 알아서 추가
-	void AddToRenderList(ULevel* Level) override {};
+	void AddToRenderList(ULevel* Level) override;
 	bool IsRayCollided(const FRay& WorldRay, float& ShortestDistance) const override;
 	FAABB GetWorldBounds() const override;
 	///////////////////////////////////////////////////
@@ -25,7 +25,7 @@ public:
 	const UMaterial* GetMaterial(int Index) const { if (Index < MaterialList.Num() && Index >= 0) return MaterialList[Index]; else return nullptr; }
 	const TArray<UMaterial*>& GetMaterialList(){ return MaterialList; }
 
-	void SetMaterial(UMaterial* Material, int Index) { if (Index < MaterialList.Num() && Index>=0) MaterialList[Index] = Material; else return; }
+	void SetMaterial(UMaterial* Material, int Index);
 	void SetStaticMesh(UStaticMesh* InStaticMesh);
 	   
 	//TODO: Serialize 구현
@@ -1,5 +1,6 @@
 #pragma once
 #include "Components/PrimitiveComponent.h"
+#include "Render/Renderer/TextBatcher.h"
 
 class ULevel;
 
@@ -8,22 +9,25 @@ class UTextRenderComponent : public UPrimitiveComponent
 public:
 	DECLARE_CLASS(UTextRenderComponent, UPrimitiveComponent)
 	UTextRenderComponent();
-	~UTextRenderComponent();
 
-	void SetInstanceData(const FWstring& Characters);
+	/** 글자가 바뀐 경우에만 글자 인스턴스를 다시 만들고 리비전을 올린다 (렌더러는 리비전이 바뀐 라벨만 다시 올린다) */
 	void SetText(const FWstring& InText);
 
 	FWstring GetText() const { return Text; }
-	ID3D11Buffer* GetVertexBuffer() const { return VertexBuffer; }
-	uint32 GetVertexNum() const { return VertexNum; }
+	const TArray<FTextGlyphInstance>& GetGlyphs() const { return Glyphs; }
+	uint64 GetGlyphRevision() const { return GlyphRevision; }
 
 	void AddToRenderList(ULevel* Level) override;
 	bool IsRayCollided(const FRay& WorldRay, float& Distance) const override { return false; }
 	FAABB GetWorldBounds() const override { return FAABB(); }
 
 private:
+	void BuildGlyphs();
+
 	FWstring Text;
-	ID3D11Buffer* VertexBuffer = nullptr;
-	uint32 VertexNum = 0;
+	TArray<FTextGlyphInstance> Glyphs;
+
+	// 모든 컴포넌트에서 겹치지 않는 값 (같은 주소에 새로 만든 컴포넌트도 이전 라벨로 착각하지 않는다)
+	uint64 GlyphRevision = 0;
 };
 
@@ -0,0 +1,118 @@
+#pragma once
+#include <thread>
+
+class USceneComponent;
+
+/**
+ * @brief 모든 USceneComponent의 로컬 TRS와 월드 행렬을 한 곳에 모은 SoA 저장소
+ *
+ * 컴포넌트는 슬롯 번호(핸들)만 들고, 실제 값은 필드별 연속 배열(Dense)에 있다.
+ * 계층이 바뀌면 Dense 배열을 부모가 자식보다 앞에 오는 DFS 전위 순서로 다시 정렬하므로
+ * 프레임당 한 번의 UpdateWorldMatrices()가 앞에서부터 훑으며 더티 월드 행렬을 일괄 계산할 수 있다.
+ * 루트 하나의 서브트리는 연속 구간이라 서브트리 단위로 병렬 처리한다.
+ *
+ * 역행렬도 같은 일괄 계산에서 채운다. 프레임 중간에 값을 바꾸고 바로 읽는 경우(기즈모 등)를 위해
+ * 게임 스레드에서는 GetWorldMatrix()/GetWorldMatrixInverse()가 여전히 지연 계산한다.
+ * 쓰기는 게임 스레드(저장소를 만든 스레드) 전용이며, UpdateWorldMatrices() 이후에는 여러 스레드가 읽기만 해도 안전하다.
+ * 게임 스레드 밖에서 더티 항목을 읽으면 assert하고, 릴리스에서는 계산하지 않고 마지막 값을 돌려준다.
+ * Get*()이 돌려주는 참조는 다음 Allocate()/UpdateWorldMatrices() 전까지만 유효하다.
+ */
+class FTransformStore
+{
+	DECLARE_SINGLETON(FTransformStore);
+
+public:
+	static constexpr uint32 InvalidHandle = 0xFFFFFFFFu;
+
+	enum ETransformFlags : uint8
+	{
+		WorldDirty = 1 << 0,
+		InverseDirty = 1 << 1,
+		Moved = 1 << 2,
+		AllDirty = WorldDirty | InverseDirty | Moved,
+	};
+
+	uint32 Allocate(USceneComponent* InOwner);
+	void Free(uint32 InHandle);
+
+	/** 부모를 바꾸고 다음 UpdateWorldMatrices()에서 순서를 다시 잡는다 (더티 표시는 호출 쪽 MarkAsDirty가 한다) */
+	void SetParent(uint32 InHandle, uint32 InParentHandle);
+
+	const FVector& GetLocation(uint32 InHandle) const { return Locations[DenseIndex(InHandle)]; }
+	const FQuat& GetRotation(uint32 InHandle) const { return Rotations[DenseIndex(InHandle)]; }
+	const FVector& GetRotationEuler(uint32 InHandle) const { return RotationEulers[DenseIndex(InHandle)]; }
+	const FVector& GetScale(uint32 InHandle) const { return Scales[DenseIndex(InHandle)]; }
+
+	void SetLocation(uint32 InHandle, const FVector& InLocation) { Locations[DenseIndex(InHandle)] = InLocation; }
+	void SetRotation(uint32 InHandle, const FQuat& InRotation, const FVector& InRotationEuler);
+	void SetScale(uint32 InHandle, const FVector& InScale) { Scales[DenseIndex(InHandle)] = InScale; }
+
+	uint8 GetFlags(uint32 InHandle) const { return Flags[DenseIndex(InHandle)]; }
+	bool HasAllFlags(uint32 InHandle, uint8 InFlags) const { return (Flags[DenseIndex(InHandle)] & InFlags) == InFlags; }
+	void SetFlags(uint32 InHandle, uint8 InFlags) { Flags[DenseIndex(InHandle)] |= InFlags; }
+	void ClearFlags(uint32 InHandle, uint8 InFlags) { Flags[DenseIndex(InHandle)] &= ~InFlags; }
+
+	/** 더티면 부모부터 지연 계산한다 (게임 스레드에서만, 그 밖에서는 마지막으로 계산된 값) */
+	const FMatrix& GetWorldMatrix(uint32 InHandle);
+	const FMatrix& GetWorldMatrixInverse(uint32 InHandle);
+
+	/**
+	 * @brief 더티 월드 행렬을 Dense 순서대로 일괄 계산한다 (렌더 직전 1회)
+	 * 연속된 더티 구간은 FMatrix::ComposeTRSArray로 로컬 행렬을 만들고,
+	 * 같은 부모를 둔 형제 구간은 FMatrix::MultiplyArray로 부모 월드 행렬을 곱한다. 더티 역행렬도 같은 순서로 채운다.
+	 */
+	void UpdateWorldMatrices();
+
+	int32 GetNum() const { return static_cast<int32>(Owners.size()) - NumFreeDense; }
+
+	bool IsInGameThread() const { return std::this_thread::get_id() == GameThreadId; }
+
+	/** 이 수 이상이면 루트 서브트리 단위로 ParallelFor */
+	static constexpr int32 ParallelThreshold = 8192;
+
+private:
+	int32 DenseIndex(uint32 InHandle) const { return SlotToDense[InHandle]; }
+
+	void ResolveWorld(int32 InDense);
+	void ResolveWorldInverse(int32 InDense);
+
+	/** 부모 역행렬이 이미 깨끗할 때 InDense의 역행렬을 계산 */
+	void StoreWorldInverse(int32 InDense);
+
+	/** [InBegin, InEnd) 구간의 더티 월드 행렬/역행렬 계산, 부모는 구간 앞쪽이나 이미 깨끗한 곳에 있어야 한다 */
+	void UpdateRange(int32 InBegin, int32 InEnd);
+
+	/** 빈 자리를 걷어내고 부모 → 자식 DFS 전위 순서로 재배치, 루트 서브트리 구간을 다시 만든다 */
+	void SortParentFirst();
+
+	// Dense 배열 (같은 인덱스 = 같은 컴포넌트)
+	TArray<FVector> Locations;
+	TArray<FQuat> Rotations;
+	TArray<FVector> RotationEulers;		// UI 표기용 (도 단위)
+	TArray<FVector> Scales;
+	TArray<FMatrix> WorldMatrices;
+	TArray<FMatrix> WorldMatrixInverses;
+	TArray<int32> ParentDense;			// 루트는 -1
+	TArray<uint8> Flags;
+	TArray<uint32> DenseToSlot;
+	TArray<USceneComponent*> Owners;	// 빈 자리는 nullptr
+
+	std::thread::id GameThreadId;
+
+	// 슬롯 → Dense (핸들은 정렬과 무관하게 고정)
+	TArray<int32> SlotToDense;
+	TArray<uint32> FreeSlots;
+	int32 NumFreeDense = 0;
+
+	// 루트 서브트리 구간 [Begin, End), SortParentFirst()가 채운다
+	// 순환 등으로 루트에서 닿지 않는 항목은 [NumSorted, 끝)에 남아 지연 계산만 된다
+	TArray<std::pair<int32, int32>> RootRanges;
+	int32 NumSorted = 0;
+	bool bOrderDirty = false;
+
+	// SortParentFirst() 임시 버퍼 (용량 재사용)
+	TArray<int32> SortOrder;
+	TArray<int32> SortStack;
+	TArray<int32> ChildStart;
+	TArray<int32> ChildList;
+};
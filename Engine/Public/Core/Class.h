@@ -1,10 +1,20 @@
 #pragma once
 #include "Global/CoreTypes.h"
+#include "Core/ObjectPool.h"
 
 // 전방 선언
 class UObject;
 class UClass;
 
+struct FCastBenchmarkResult
+{
+	int32  NumQueries = 0;
+	int32  NumClasses = 0;
+	double ChainWalkMs = 0.0;		// SuperClass 체인 순회 (이전 방식)
+	double IntervalMs = 0.0;		// 전위 순서 구간 비교
+	bool   bMatchesChainWalk = false;
+};
+
 /**
  * @brief 언리얼엔진의 UClass를 모방한 클래스 메타데이터 시스템
  *
@@ -13,6 +23,10 @@ class UClass;
  * - 부모 클래스 정보
  * - 클래스 크기
  * - 생성자 함수 포인터
+ *
+ * 등록된 모든 클래스는 상속 트리의 전위 순서 번호(ClassIndex)와 서브트리 끝 번호(SubtreeEnd)를 가진다.
+ * 자식 클래스는 항상 부모의 [ClassIndex, SubtreeEnd) 구간 안에 번호가 매겨지므로
+ * IsChildOf는 부모 체인을 거슬러 올라가지 않고 비교 두 번으로 끝난다.
  */
 class UClass
 {
@@ -27,9 +41,30 @@ public:
 	UClass* GetSuperClass() const { return SuperClass; }
 	size_t GetClassSize() const { return ClassSize; }
 
-	bool IsChildOf(const UClass* OtherClass) const;
+	/**
+	 * @brief 이 클래스가 OtherClass이거나 그 하위 클래스인지 확인 (O(1))
+	 */
+	bool IsChildOf(const UClass* OtherClass) const
+	{
+		return OtherClass && OtherClass->ClassIndex <= ClassIndex && ClassIndex < OtherClass->SubtreeEnd;
+	}
+
+	/** 구간 번호 없이 SuperClass 체인을 거슬러 올라가며 확인 (검증/벤치마크 기준값) */
+	bool IsChildOfByChainWalk(const UClass* OtherClass) const;
+
 	UObject* CreateDefaultObject() const;
 
+	uint32 GetClassIndex() const { return ClassIndex; }
+	uint32 GetSubtreeEnd() const { return SubtreeEnd; }
+
+	static const TArray<UClass*>& GetAllClasses() { return GetClassRegistry(); }
+
+	/** 이 클래스 인스턴스 전용 메모리 풀 (NewObject가 여기서 할당한다) */
+	FObjectPool& GetInstancePool() { return InstancePool; }
+
+	/** 등록된 클래스 쌍을 무작위로 InNum번 질의해 체인 순회와 구간 비교의 비용을 잰다 */
+	static void BenchmarkCast(int32 InNum, FCastBenchmarkResult& OutResult);
+
 	//static UClass* FindClass(const FString& InClassName);
 	//static void SignUpClass(UClass* InClass);
 	//static void PrintAllClasses();
@@ -40,8 +75,18 @@ private:
 	size_t ClassSize; // 클래스 크기
 	ClassConstructorType Constructor; // 생성자 함수 포인터
 
-	// 전역 클래스 레지스트리
-	static TArray<UClass*> AllClasses;
+	TArray<UClass*> ChildClasses; // 직계 자식 클래스 (등록 순서)
+	uint32 ClassIndex = 0; // 상속 트리 전위 순서 번호
+	uint32 SubtreeEnd = 0; // 마지막 하위 클래스 번호 + 1
+
+	FObjectPool InstancePool; // 같은 클래스 인스턴스를 연속 슬랩에 모은다
+
+	/** 새 클래스가 등록될 때마다 전체 번호를 다시 매긴다 (클래스 수십 개, 정적 초기화 시점에만 발생) */
+	static void RebuildClassIndices();
+	static void AssignClassIndices(UClass* InClass, uint32& InOutNextIndex);
+
+	// 전역 클래스 레지스트리 (다른 번역 단위의 정적 초기화에서도 쓰이므로 함수 지역 정적 변수로 둔다)
+	static TArray<UClass*>& GetClassRegistry();
 };
 
 /**
@@ -69,6 +114,7 @@ public: \
     static UObject* CreateDefaultObject##ClassName();
 
 // 클래스 구현부에 사용하는 매크로
+// 마지막 줄의 정적 변수는 main() 전에 모든 클래스를 등록해 두어 IsChildOf 구간 번호가 실행 중에 바뀌지 않게 한다
 #define IMPLEMENT_CLASS(ClassName, SuperClassName) \
     UClass* ClassName::StaticClass() \
     { \
@@ -87,8 +133,9 @@ public: \
     } \
     UObject* ClassName::CreateDefaultObject##ClassName() \
     { \
-        return new ClassName(); \
-    }
+        return new (ClassName::StaticClass()) ClassName(); \
+    } \
+    static UClass* const ClassName##RegisteredClass = ClassName::StaticClass();
 
 
 // 추상 클래스에 사용하는 매크로 (기본 객체를 생성하지 않음)
@@ -106,7 +153,8 @@ public: \
     UClass* ClassName::GetClass() const \
     { \
         return ClassName::StaticClass(); \
-    }
+    } \
+    static UClass* const ClassName##RegisteredClass = ClassName::StaticClass();
 
 // UObject의 기본 매크로 (다른 클래스들의 베이스)
 #define IMPLEMENT_CLASS_BASE(ClassName) \
@@ -126,5 +174,6 @@ public: \
     } \
     UObject* ClassName::CreateDefaultObject##ClassName() \
     { \
-        return new ClassName(); \
-    }
+        return new (ClassName::StaticClass()) ClassName(); \
+    } \
+    static UClass* const ClassName##RegisteredClass = ClassName::StaticClass();
@@ -1,5 +1,6 @@
 #pragma once
 #include "Class.h"
+#include "Core/ObjectArray.h"
 #include "Global/Memory.h"
 
 
@@ -15,6 +16,16 @@ public:
 	explicit UObject(const FString& InString);
 	virtual ~UObject();
 
+	/**
+	 * @brief UObject 메모리는 모두 FObjectPool 슬랩에서 나온다
+	 * NewObject/CreateDefaultObject는 new (T::StaticClass()) T()로 클래스 풀을 쓰고,
+	 * 클래스를 넘기지 않은 new UFoo(...)는 크기별 풀을 쓴다. delete는 어느 쪽이든 슬랩 헤더로 풀을 찾는다.
+	 */
+	static void* operator new(size_t InSize);
+	static void* operator new(size_t InSize, UClass* InClass);
+	static void operator delete(void* InMemory);
+	static void operator delete(void* InMemory, UClass* InClass);
+
 	virtual void DuplicateSubObjects();
 	virtual UObject* Duplicate();
 	virtual void CopyShallow(UObject* Src);
@@ -55,16 +66,28 @@ public:
 		return AllocatedCounts;
 	}
 
-	bool IsA(const UClass* InClass) const;
+	bool IsA(const UClass* InClass) const
+	{
+		return GetClass()->IsChildOf(InClass);
+	}
 	// (선택) 내부 인덱스 확인용
 	uint32 GetInternalIndex() const
 	{
-		return InternalIndex;
+		return ObjectHandle.Index;
+	}
+	FObjectHandle GetObjectHandle() const
+	{
+		return ObjectHandle;
+	}
+	// ID 버퍼에 쓰는 피킹 ID (GUObjectArray.ResolvePickId로 되찾는다)
+	uint32 GetPickId() const
+	{
+		return ObjectHandle.ToPickId();
 	}
 
 private:
 	uint32 UUID = UINT32_MAX;
-	uint32 InternalIndex = UINT32_MAX;
+	FObjectHandle ObjectHandle;
 	FName Name;
 	// 소유자(컨테이너) 의미. 어떤 UObject가 다른 UObject 안에 속해있다는 것을 표현함.
 	UObject* Outer = nullptr;
@@ -79,16 +102,12 @@ private:
 
 	uint64 AllocatedBytes = 0;
 	uint32 AllocatedCounts = 0;
-
-	friend void RemoveFromGlobalObjectArray(UObject* Obj);
 };
 
-extern TArray<UObject*> GUObjectArray;
-
 template <typename T>
 T* NewObject()
 {
-	T* NewObject = new T();
+	T* NewObject = new (T::StaticClass()) T();
 	NewObject->SetName(FNameTable::GetInstance().GetUniqueName(NewObject->GetClass()->GetName()));
 
 	return NewObject;
@@ -0,0 +1,95 @@
+#pragma once
+
+class UObject;
+
+/**
+ * @brief 전역 오브젝트 배열의 슬롯 번호 + 세대
+ * 슬롯이 해제될 때마다 세대가 올라가므로, 같은 슬롯에 새 오브젝트가 들어와도 예전 핸들은 무효로 판별된다.
+ * 슬롯 0은 비워 두므로 Index == 0은 항상 무효 핸들이다.
+ */
+struct FObjectHandle
+{
+	uint32 Index = 0;
+	uint32 Generation = 0;
+
+	bool IsValid() const { return Index != 0; }
+
+	bool operator==(const FObjectHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+	bool operator!=(const FObjectHandle& Other) const { return !(*this == Other); }
+
+	// ID 버퍼(R32_UINT)에 쓰는 값: 하위 24비트 슬롯 + 상위 8비트 세대
+	static constexpr uint32 PickIndexBits = 24;
+	static constexpr uint32 PickIndexMask = (1u << PickIndexBits) - 1;
+
+	/** 0은 배경(클리어 값)이고, 슬롯 0을 쓰지 않으므로 유효한 핸들은 0이 되지 않는다 */
+	uint32 ToPickId() const { return (Generation << PickIndexBits) | (Index & PickIndexMask); }
+};
+
+/**
+ * @brief 청크 단위로 늘어나는 전역 UObject 배열
+ *
+ * 청크는 한 번 할당하면 옮기지 않으므로 배열이 커져도 기존 항목의 주소와 슬롯 번호가 바뀌지 않는다.
+ * 해제된 슬롯은 자유 목록으로 재사용하고 세대를 올린다 (생성/삭제 모두 O(1)).
+ * 예전처럼 마지막 원소를 빈 자리로 옮기지 않으므로 ID 버퍼에 써 둔 슬롯 번호가 다른 오브젝트를 가리키게 되지 않는다.
+ * 게임 스레드 전용이다.
+ */
+class FUObjectArray
+{
+public:
+	static constexpr uint32 ChunkSize = 64 * 1024;
+	static constexpr uint32 MaxChunks = (FObjectHandle::PickIndexMask + 1) / ChunkSize;	// 슬롯 번호가 ID 버퍼 24비트에 들어가도록
+	static constexpr uint32 MaxObjects = ChunkSize * MaxChunks;
+
+	FUObjectArray() = default;
+	~FUObjectArray();
+
+	FUObjectArray(const FUObjectArray&) = delete;
+	FUObjectArray& operator=(const FUObjectArray&) = delete;
+
+	FObjectHandle Allocate(UObject* InObject);
+	void Free(const FObjectHandle& InHandle);
+
+	/** 세대가 다르거나 비어 있으면 nullptr */
+	UObject* Resolve(const FObjectHandle& InHandle) const
+	{
+		if (InHandle.Index == 0 || InHandle.Index >= NextIndex)
+		{
+			return nullptr;
+		}
+		const FObjectItem& Item = GetItem(InHandle.Index);
+		return Item.Generation == InHandle.Generation ? Item.Object : nullptr;
+	}
+
+	/** ID 버퍼 값으로 찾는다. 세대는 하위 8비트만 비교한다 */
+	UObject* ResolvePickId(uint32 InPickId) const;
+
+	/** 빈 슬롯이면 nullptr (순회용) */
+	UObject* GetObjectAt(uint32 InIndex) const
+	{
+		return InIndex != 0 && InIndex < NextIndex ? GetItem(InIndex).Object : nullptr;
+	}
+
+	/** 한 번이라도 쓰인 슬롯 번호의 끝 (순회 범위) */
+	uint32 GetMaxIndex() const { return NextIndex; }
+
+	/** 살아 있는 오브젝트 수 */
+	uint32 Num() const { return NumObjects; }
+
+private:
+	struct FObjectItem
+	{
+		UObject* Object = nullptr;
+		uint32 Generation = 0;
+	};
+
+	const FObjectItem& GetItem(uint32 InIndex) const { return Chunks[InIndex / ChunkSize][InIndex % ChunkSize]; }
+	FObjectItem& GetItem(uint32 InIndex) { return Chunks[InIndex / ChunkSize][InIndex % ChunkSize]; }
+
+	// 청크 포인터 표도 고정 크기라 늘어날 때 옮겨지지 않는다
+	FObjectItem* Chunks[MaxChunks] = {};
+	TArray<uint32> FreeIndices;
+	uint32 NextIndex = 1;	// 슬롯 0은 무효 핸들용으로 비워 둔다
+	uint32 NumObjects = 0;
+};
+
+extern FUObjectArray GUObjectArray;
@@ -35,9 +35,9 @@ public:
 	// 현재 가리키는 객체 TObject*로 반환
 	TObject* operator*() const
 	{
-		const int32 Count = static_cast<int32>(GUObjectArray.size());
+		const int32 Count = static_cast<int32>(GUObjectArray.GetMaxIndex());
 		return (CurrentIndex >= 0 && CurrentIndex < Count)
-			? static_cast<TObject*>(GUObjectArray[CurrentIndex])
+			? static_cast<TObject*>(GUObjectArray.GetObjectAt(CurrentIndex))
 			: nullptr;
 	}
 	// 내부 접근자
@@ -46,7 +46,7 @@ public:
 	// while(It) 사용 가능하도록 변환 연산자
 	explicit operator bool() const
 	{
-		const int32 Count = static_cast<int32>(GUObjectArray.size());
+		const int32 Count = static_cast<int32>(GUObjectArray.GetMaxIndex());
 		return CurrentIndex >= 0 && CurrentIndex < Count;
 	}
 	int32 GetIndex() const { return CurrentIndex; }
@@ -62,14 +62,15 @@ private:
 	// 유효한 타입이 나올 때까지 전진
 	void AdvanceToNextValidObject()
 	{
-		const int32 Count = static_cast<int32>(GUObjectArray.size());
+		const int32 Count = static_cast<int32>(GUObjectArray.GetMaxIndex());
 
 		while (true)
 		{
 			if (CurrentIndex < 0) { CurrentIndex = 0; }
 			if (CurrentIndex >= Count) break;
 
-			UObject* Obj = GUObjectArray[CurrentIndex];
+			// 해제된 슬롯은 nullptr이므로 건너뛴다
+			UObject* Obj = GUObjectArray.GetObjectAt(CurrentIndex);
 			if (Obj && Obj->IsA(TObject::StaticClass()))
 			{
 				// 유효 타입 발견
@@ -0,0 +1,89 @@
+#pragma once
+
+struct FObjectPoolStats
+{
+	FString Name;
+	uint32 ObjectSize = 0;			// 슬롯 간격 (16바이트 정렬)
+	uint32 NumLive = 0;
+	uint32 PeakLive = 0;
+	uint32 NumSlabs = 0;
+	uint32 Capacity = 0;			// 슬랩 전체 슬롯 수
+	uint64 ReservedBytes = 0;		// 슬랩 메모리 합
+	uint64 TotalAllocations = 0;
+
+	/** 확보한 슬롯 중 비어 있는 비율 (0 = 꽉 참) */
+	float GetFragmentation() const { return Capacity > 0 ? 1.0f - static_cast<float>(NumLive) / Capacity : 0.0f; }
+};
+
+/**
+ * @brief 같은 크기의 UObject를 64KB 슬랩에 연속으로 담는 풀
+ *
+ * 슬랩은 자기 크기(64KB)로 정렬해 할당하고 맨 앞에 헤더를 둔다. 그래서 해제할 때 포인터의 하위 비트만 지우면
+ * 소속 슬랩과 풀을 찾을 수 있어 오브젝트마다 헤더를 붙이지 않는다.
+ * 해제된 슬롯은 슬랩별 자유 목록으로 재사용하고, 빈 슬랩은 하나만 남기고 돌려준다.
+ * UClass마다 하나씩 있으며(UClass::GetInstancePool), 크기만 아는 경로용으로 크기별 풀도 있다.
+ * GUObjectArray와 마찬가지로 게임 스레드 전용이다.
+ */
+class FObjectPool
+{
+public:
+	static constexpr size_t SlabSize = 64 * 1024;
+	static constexpr size_t ObjectAlignment = 16;
+
+	FObjectPool(const FString& InName, size_t InObjectSize);
+	~FObjectPool();
+
+	FObjectPool(const FObjectPool&) = delete;
+	FObjectPool& operator=(const FObjectPool&) = delete;
+
+	void* Allocate();
+
+	/** Allocate()로 받은 포인터를 소속 풀에 돌려준다 (어느 풀이든 상관없다) */
+	static void Free(void* InMemory);
+
+	FObjectPoolStats GetStats() const;
+
+	/** 클래스를 모르고 크기만 아는 할당(new UFoo(...))용 풀 */
+	static FObjectPool& GetSizedPool(size_t InSize);
+
+	/** 한 번이라도 할당한 풀의 통계를 모은다 */
+	static void GatherStats(TArray<FObjectPoolStats>& OutStats);
+
+private:
+	struct alignas(64) FSlab
+	{
+		FObjectPool* Pool = nullptr;
+		FSlab* PrevPartial = nullptr;
+		FSlab* NextPartial = nullptr;
+		void* FreeList = nullptr;	// 해제된 슬롯 (슬롯 앞 8바이트에 다음 슬롯)
+		uint32 NumLive = 0;
+		uint32 NumBumped = 0;		// 한 번이라도 나간 슬롯 수 (아직 안 쓴 슬롯은 앞에서부터 잘라 준다)
+		bool bInPartialList = false;
+	};
+
+	FSlab* CreateSlab();
+	void ReleaseSlab(FSlab* InSlab);
+	void LinkPartial(FSlab* InSlab);
+	void UnlinkPartial(FSlab* InSlab);
+	void FreeInSlab(FSlab* InSlab, void* InMemory);
+
+	uint8* GetSlot(FSlab* InSlab, uint32 InIndex) const
+	{
+		return reinterpret_cast<uint8*>(InSlab) + sizeof(FSlab) + static_cast<size_t>(InIndex) * ObjectStride;
+	}
+
+	static TArray<FObjectPool*>& GetPoolRegistry();
+
+	FString Name;
+	size_t ObjectStride = 0;
+	uint32 ObjectsPerSlab = 0;
+	size_t SlabBytes = 0;		// 큰 클래스는 슬랩 하나에 하나만 담고 SlabSize 배수로 키운다
+
+	FSlab* PartialSlabs = nullptr;	// 빈 슬롯이 있는 슬랩
+	uint32 NumEmptySlabs = 0;
+
+	uint32 NumLive = 0;
+	uint32 PeakLive = 0;
+	uint32 NumSlabs = 0;
+	uint64 TotalAllocations = 0;
+};
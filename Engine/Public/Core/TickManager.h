@@ -0,0 +1,139 @@
+#pragma once
+
+class FTickManager;
+
+/**
+ * @brief 틱 단계. 한 단계의 틱이 모두 끝나야 다음 단계가 시작된다
+ */
+enum class ETickGroup : uint8
+{
+	PrePhysics,
+	DuringPhysics,
+	PostUpdateWork,
+	Num
+};
+
+/**
+ * @brief 틱 매니저에 등록되는 실행 단위
+ *
+ * 액터/컴포넌트가 멤버로 하나씩 들고 있고, 레벨에 들어갈 때 레벨의 FTickManager에 등록된다.
+ * bCanEverTick이 false이거나 꺼진(SetTickFunctionEnable(false)) 틱은 매 프레임 훑는 목록에 없으므로 비용이 없다.
+ * 선행 틱(AddPrerequisite)은 같은 단계라면 먼저 실행되고, 더 늦은 단계에 있으면 이 틱도 그 단계로 밀린다.
+ * bRunOnAnyThread인 틱은 같은 차례의 다른 틱과 워커 스레드에서 병렬로 실행되므로 게임 스레드 전용 상태
+ * (트랜스폼 저장소, 오브젝트 배열, 레벨 목록)를 건드리면 안 된다. 기본값은 꺼져 있고, 지금의 액터/컴포넌트 틱은
+ * 트랜스폼을 옮기므로 켜지 않는다.
+ */
+class FTickFunction
+{
+public:
+	ETickGroup TickGroup = ETickGroup::PrePhysics;
+	float TickInterval = 0.0f;		// 초 단위, 0이면 매 프레임
+	bool bCanEverTick = false;		// 등록 여부 (등록 전에 정한다)
+	bool bTickInEditor = false;		// 에디터 월드에서도 실행
+	bool bRunOnAnyThread = false;
+
+	FTickFunction() = default;
+	virtual ~FTickFunction();
+
+	FTickFunction(const FTickFunction&) = delete;
+	FTickFunction& operator=(const FTickFunction&) = delete;
+
+	/** @param InDeltaTime 지난 실행 이후 흐른 시간 (TickInterval이 있으면 그 사이 프레임 합) */
+	virtual void ExecuteTick(float InDeltaTime) = 0;
+
+	void RegisterTickFunction(FTickManager& InManager);
+	void UnRegisterTickFunction();
+	bool IsTickFunctionRegistered() const { return Manager != nullptr; }
+
+	void SetTickFunctionEnable(bool bInEnabled);
+	bool IsTickFunctionEnabled() const { return bEnabled; }
+
+	void AddPrerequisite(FTickFunction* InPrerequisite);
+	void RemovePrerequisite(FTickFunction* InPrerequisite);
+
+	/** 설정(단계/간격/플래그/켜짐)만 복사한다. 등록과 선행 관계는 복사하지 않는다 (PIE 복제용) */
+	void CopyTickSettings(const FTickFunction& InOther);
+
+private:
+	friend class FTickManager;
+
+	FTickManager* Manager = nullptr;
+	int32 RegisteredIndex = -1;		// FTickManager 배열 안의 위치 (교체 삭제용)
+	int32 EnabledIndex = -1;
+	bool bEnabled = true;
+
+	TArray<FTickFunction*> Prerequisites;
+	TArray<FTickFunction*> Dependents;	// 역방향 (소멸 시 끊기용)
+
+	// 간격 처리
+	float TimeUntilNextTick = 0.0f;
+	float AccumulatedDeltaTime = 0.0f;
+
+	// 프레임 스케줄 (FTickManager::Tick 안에서만 쓴다)
+	uint32 DueFrame = 0;
+	uint32 ScheduledFrame = 0;
+	int32 ScheduleIndex = -1;
+	float ScheduledDeltaTime = 0.0f;
+	uint8 ScheduledGroup = 0;
+	uint16 ScheduledWave = 0;
+	bool bScheduling = false;
+};
+
+struct FTickStats
+{
+	uint32 NumRegistered = 0;
+	uint32 NumEnabled = 0;
+	uint32 NumTicked = 0;			// 지난 Tick()에서 실행된 수
+	uint32 NumTickedParallel = 0;
+	uint32 NumWaves = 0;			// 단계별 차례 수의 합
+	uint32 NumTickedPerGroup[static_cast<uint8>(ETickGroup::Num)] = {};
+	double TickMilliseconds = 0.0;
+};
+
+/**
+ * @brief 레벨 하나의 틱 함수 목록과 프레임 스케줄러
+ *
+ * 켜진 틱만 조밀한 배열에 두고(교체 삭제), 매 프레임 간격이 된 틱을 골라 (단계, 차례)로 나눈다.
+ * 차례(wave)는 같은 단계 안에서 선행 틱이 몇 겹인지로, 같은 차례끼리는 서로 기다릴 일이 없다.
+ * 한 차례 안에서 bRunOnAnyThread 틱은 ParallelFor로, 나머지는 게임 스레드에서 순서대로 실행한다.
+ * 실행 중에 해제된 틱(액터 삭제 등)은 남은 스케줄에서 빠지고, 실행 중에 등록된 틱은 다음 프레임부터 돈다.
+ * 등록/해제/Tick은 게임 스레드에서만 호출한다.
+ */
+class FTickManager
+{
+public:
+	FTickManager() = default;
+	~FTickManager();
+
+	FTickManager(const FTickManager&) = delete;
+	FTickManager& operator=(const FTickManager&) = delete;
+
+	/** @param bInEditorWorld true면 bTickInEditor인 틱만 실행 */
+	void Tick(float InDeltaTime, bool bInEditorWorld);
+
+	const FTickStats& GetStats() const { return Stats; }
+
+private:
+	friend class FTickFunction;
+
+	void AddRegistered(FTickFunction* InFunction);
+	void RemoveRegistered(FTickFunction* InFunction);
+	void AddEnabled(FTickFunction* InFunction);
+	void RemoveEnabled(FTickFunction* InFunction);
+
+	void ScheduleTickFunction(FTickFunction* InFunction);
+	void RunWave(int32 InBegin, int32 InEnd);
+
+	TArray<FTickFunction*> RegisteredTickFunctions;
+	TArray<FTickFunction*> EnabledTickFunctions;	// 매 프레임 훑는 것은 이쪽뿐
+
+	// 프레임 스케줄 (멤버로 두어 매 프레임 재할당하지 않는다)
+	TArray<FTickFunction*> DueTickFunctions;
+	TArray<FTickFunction*> Schedule;		// (단계, 차례) 순으로 정렬된 실행 목록
+	TArray<int32> WaveOffsets;
+	TArray<FTickFunction*> ParallelBatch;
+	uint32 FrameCounter = 0;
+	bool bTicking = false;
+
+	FTickStats Stats;
+};
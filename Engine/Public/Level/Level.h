@@ -5,6 +5,8 @@
 #include "Utility/Metadata.h"
 #include "Math/Octree.h"
 #include "Components/StaticMeshComponent.h"
+#include "Core/TickManager.h"
+#include "Level/LevelActorList.h"
 class AAxis;
 class AGizmo;
 class AGrid;
@@ -46,12 +48,12 @@ public:
 	virtual void Render();
 	virtual void Cleanup();
 
-	void UpdateComponentsToRender(AActor* Actor);
 	void AddToOctree(UPrimitiveComponent* Component);
 	UPrimitiveComponent* GetPrimitiveCollided(const FRay& WorldRay, float& ShortestDistance);
-	TArray<AActor*> GetLevelActors() const
+	// 빈 칸 없는 배열이고, 삭제는 마지막 액터를 빈 자리로 옮기므로 순서는 보장하지 않는다
+	const TArray<AActor*>& GetLevelActors() const
 	{
-		return LevelActors;
+		return LevelActors.GetActors();
 	}
 	TArray<UStaticMeshComponent*>& GetStaticMeshComponentsToRender()
 	{
@@ -64,6 +66,24 @@ public:
     void AddTextComponentToRender(UTextRenderComponent* Component);
     const TArray<UBillboardComponent*>& GetBillboardComponentsToRender() const { return BillboardComponentsToRender; }
     void AddBillboardComponentToRender(UBillboardComponent* Component);
+	void AddStaticMeshComponentToRender(UStaticMeshComponent* Component);
+
+	/**
+	 * @brief 렌더 리스트 등록/해제 (컴포넌트가 생성, 부착, 표시, 삭제될 때만 호출)
+	 * 리스트는 빈 칸 없는 배열이고 컴포넌트가 자기 인덱스를 들고 있어 해제는 마지막 원소와 바꿔 지우는 O(1)이다.
+	 * 그래서 Update()는 매 프레임 액터를 훑어 리스트를 다시 만들지 않는다.
+	 */
+	void RegisterComponentForRender(UPrimitiveComponent* Component);
+	void UnregisterComponentForRender(UPrimitiveComponent* Component);
+	void RegisterActorComponentsForRender(AActor* InActor);
+
+	/**
+	 * @brief 액터와 컴포넌트의 틱 함수를 이 레벨의 틱 매니저에 등록/해제 (bCanEverTick인 것만, 여러 번 불러도 된다)
+	 * 컴포넌트 틱은 액터 틱을 선행으로 건다. 액터가 삭제되면 틱 함수 소멸자가 스스로 해제한다.
+	 */
+	void RegisterActorTickFunctions(AActor* InActor);
+	void UnregisterActorTickFunctions(AActor* InActor);
+	FTickManager& GetTickManager() { return TickManager; }
 
     // Add an already-created actor to this level (used by PIE duplication)
     void AddActor(AActor* InActor);
@@ -71,10 +91,18 @@ public:
 	template<typename T, typename... Args>
 	T* SpawnActor(const FString& InName = "");
 
+	// 액터가 들고 있는 슬롯 인덱스로 확인하므로 O(1)
 	bool IsActorValid(AActor* InActor) const;
 	// 선택된 액터 설정
 	// Actor 삭제
 	bool DestroyActor(AActor* InActor);
+	/**
+	 * @brief 여러 액터를 한 번에 즉시 삭제 (렌더 리스트, 틱, 옥트리, 선택 해제, LevelActors 교체 삭제)
+	 * 옥트리는 노드마다 한 번만 압축하고 선택 해제도 한 번만 하므로 액터 수에 선형이다.
+	 * 이 레벨에 없거나 중복된 항목은 무시하며, 삭제 대기 중인 액터도 여기서 바로 지운다.
+	 * @return 실제로 삭제한 액터 수
+	 */
+	int32 DestroyActors(const TArray<AActor*>& InActors);
 	// 지연 삭제를 위한 마킹
 	void MarkActorForDeletion(AActor* InActor);
 
@@ -116,9 +144,8 @@ private:
 	bool IsPendingDeletion(AActor* InActor) const;
 private:
 	AActor* SelectedActor = nullptr;
-	TArray<AActor*> LevelActors;
-	// 지연 삭제를 위한 리스트
-	TArray<AActor*> ActorsToDelete;
+	// 액터 슬롯과 지연 삭제 대기 목록 (대기 중인 액터도 실제 삭제 전까지는 목록에 남아 있다)
+	TLevelActorList<AActor> LevelActors;
 
 
 	UCamera* Camera = nullptr;          // 비소유
@@ -131,6 +158,8 @@ private:
 	TArray<UTextRenderComponent*> TextComponentsToRender;
     TArray<UBillboardComponent*> BillboardComponentsToRender;
 
+	FTickManager TickManager;
+
 
 	// 빌보드는 처음에 표시 안하는 게 좋다는 의견이 있어 빌보드만 꺼놓고 출력
 	uint64 ShowFlags = static_cast<uint64>(EEngineShowFlags::SF_Primitives) |
@@ -141,6 +170,8 @@ private:
 template <typename T, typename ... Args>
 T* ULevel::SpawnActor(const FString& InName)
 {
+	MEMORY_TAG_SCOPE(Level);
+
 	T* NewActor = NewObject<T>();
 
 	///////////////////////////////////////////
@@ -149,7 +180,10 @@ T* ULevel::SpawnActor(const FString& InName)
 	NewActor->SetOuter(this);
 	//Outer 설정 시 Outer의 메모리 카운트에 자신의 메모리 합산 작업 수행
 	NewActor->SetLevel(this);
-	LevelActors.push_back(NewActor);
+	LevelActors.Add(NewActor);
+	// 생성자에서 만든 컴포넌트는 레벨이 정해지기 전이라 여기서 렌더 리스트에 올린다
+	RegisterActorComponentsForRender(NewActor);
+	RegisterActorTickFunctions(NewActor);
 	if (!InName.empty())
 	{
 		//NewActor->SetName(InName);
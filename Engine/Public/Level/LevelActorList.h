@@ -0,0 +1,133 @@
+#pragma once
+
+/**
+ * @brief 레벨의 액터 목록과 지연 삭제 대기 목록
+ *
+ * 액터 목록은 빈 칸 없는 배열이고 액터가 자기 슬롯 인덱스를 들고 있어 포함 여부 확인과 삭제가 O(1)이다.
+ * 삭제는 마지막 액터를 빈 자리로 옮기므로 순서는 보장하지 않는다.
+ * 지연 삭제 대기 중인 액터는 실제로 지울 때까지 액터 목록에도 남아 있고, 삭제 대기 플래그로 구분한다.
+ * TActor는 GetLevelActorIndex/SetLevelActorIndex/IsPendingKill/SetPendingKill을 가져야 한다.
+ * 액터 메모리는 이 목록이 소유하지 않는다 (ULevel이 해제한다).
+ */
+template<typename TActor>
+class TLevelActorList
+{
+public:
+	const TArray<TActor*>& GetActors() const { return Actors; }
+	int32 Num() const { return Actors.Num(); }
+	int32 NumPendingKill() const { return PendingKill.Num(); }
+
+	bool Contains(const TActor* InActor) const
+	{
+		if (!InActor)
+		{
+			return false;
+		}
+		const int32 Index = InActor->GetLevelActorIndex();
+		return Index >= 0 && Index < Actors.Num() && Actors[Index] == InActor;
+	}
+
+	/** 목록에 있고 삭제 대기 중이 아니면 유효 */
+	bool IsValid(const TActor* InActor) const
+	{
+		return Contains(InActor) && !InActor->IsPendingKill();
+	}
+
+	/** 끝에 붙이고 액터에 슬롯 인덱스를 기록한다 (이미 있으면 무시) */
+	void Add(TActor* InActor)
+	{
+		if (!InActor || Contains(InActor))
+		{
+			return;
+		}
+		InActor->SetLevelActorIndex(Actors.Num());
+		InActor->SetPendingKill(false);
+		Actors.push_back(InActor);
+	}
+
+	/** 마지막 액터를 빈 자리로 옮기고 줄인다. 옮긴 액터의 인덱스만 바뀐다 */
+	void Remove(TActor* InActor)
+	{
+		if (!Contains(InActor))
+		{
+			return;
+		}
+
+		const int32 Index = InActor->GetLevelActorIndex();
+		TActor* Last = Actors.back();
+		Actors[Index] = Last;
+		Last->SetLevelActorIndex(Index);
+		Actors.pop_back();
+		InActor->SetLevelActorIndex(-1);
+	}
+
+	/**
+	 * @brief 삭제 대기로 표시하고 대기 목록에 넣는다
+	 * @return 목록에 없거나 이미 대기 중이면 false
+	 */
+	bool MarkPendingKill(TActor* InActor)
+	{
+		if (!Contains(InActor) || InActor->IsPendingKill())
+		{
+			return false;
+		}
+		InActor->SetPendingKill(true);
+		PendingKill.push_back(InActor);
+		return true;
+	}
+
+	/** 대기 목록을 꺼내고 비운다 (액터는 아직 목록에 있다) */
+	TArray<TActor*> TakePendingKill()
+	{
+		TArray<TActor*> Taken = std::move(PendingKill);
+		PendingKill.clear();
+		return Taken;
+	}
+
+	/**
+	 * @brief 여러 액터를 한 번에 교체 삭제한다
+	 * 목록에 없거나 중복된 항목은 건너뛴다 (빠진 액터는 인덱스가 -1이 되므로 두 번째는 Contains에서 걸러진다).
+	 * 삭제 대기 중이던 액터는 대기 목록에서도 뺀다.
+	 * @param OutRemoved 실제로 뺀 액터 (입력 순서)
+	 */
+	void RemoveBatch(const TArray<TActor*>& InActors, TArray<TActor*>& OutRemoved)
+	{
+		OutRemoved.clear();
+		OutRemoved.reserve(InActors.Num());
+		bool bHadPendingKill = false;
+		for (TActor* Actor : InActors)
+		{
+			if (!Contains(Actor))
+			{
+				continue;
+			}
+			bHadPendingKill |= Actor->IsPendingKill();
+			Remove(Actor);
+			OutRemoved.push_back(Actor);
+		}
+
+		// 아직 해제 전이라 인덱스를 읽을 수 있다
+		if (bHadPendingKill)
+		{
+			PendingKill.erase(std::remove_if(PendingKill.begin(), PendingKill.end(),
+				[](const TActor* Actor) { return Actor->GetLevelActorIndex() < 0; }), PendingKill.end());
+		}
+	}
+
+	/** 전부 꺼내고 비운다. 대기 목록도 비우며 (대기 액터도 목록에 있으므로) 액터 인덱스는 -1이 된다 */
+	TArray<TActor*> ReleaseAll()
+	{
+		PendingKill.clear();
+		for (TActor* Actor : Actors)
+		{
+			Actor->SetLevelActorIndex(-1);
+		}
+		TArray<TActor*> Released = std::move(Actors);
+		Actors.clear();
+		return Released;
+	}
+
+private:
+	TArray<TActor*> Actors;
+	TArray<TActor*> PendingKill;
+};
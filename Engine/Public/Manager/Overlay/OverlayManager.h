@@ -31,6 +31,14 @@ public:
 
     void SetOverlayType(EOverlayType InType);
 
+    /** "stat render": 렌더 통계 블록 표시 (FPS 위젯에도 같은 값이 나온다) */
+    void SetRenderStatsVisible(bool bInVisible);
+    bool IsRenderStatsVisible() const { return bShowRenderStats; }
+
+    /** "stat memory": 태그별 힙 사용량 블록 표시 */
+    void SetMemoryStatsVisible(bool bInVisible);
+    bool IsMemoryStatsVisible() const { return bShowMemoryStats; }
+
     void UpdateFPS();
 
     // Release only resources that hold references to the swap-chain backbuffer
@@ -43,6 +51,8 @@ public:
 
 private:
 	EOverlayType CurrentOverlayType = EOverlayType::FPS;
+	bool bShowRenderStats = false;
+	bool bShowMemoryStats = false;
 
 	// Direct2D resource
 	ID2D1Factory* D2DFactory = nullptr;
@@ -59,7 +69,9 @@ private:
 
 	// Render Overlay Property 
 	void RenderFPSOverlay() const;
-	///void RenderMemoryOverlay() const;
+	float RenderStatsOverlay(float InStartY) const;	// 다음 줄의 Y를 돌려준다
+	float RenderMemoryOverlay(float InStartY) const;
+	float DrawLines(const TArray<FString>& InLines, float InStartY) const;
 	void DrawText(const wchar_t* InText, float InX, float InY, uint32 InColor = 0xFFFFFFFF) const;
 
 	// FPS variable
@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Object.h"
+#include "Manager/Resource/ShaderCache.h"
 class UStaticMesh;
 
 class UResourceManager : public UObject
@@ -23,6 +24,18 @@ public:
 	ID3D11ShaderResourceView* LoadTexture(const FString& Path);
 	ID3D11ShaderResourceView* GetTexture(const FString& Path);
 
+	/** 텍스처가 없는 머티리얼에 쓰는 "Data/None.dds" (처음 한 번만 조회) */
+	ID3D11ShaderResourceView* GetDefaultTexture();
+
+	/**
+	 * @brief 로드된 텍스처를 모두 해제하고 세대를 올린다
+	 * 캐시된 핸들(UMaterial 등)은 세대가 달라진 것을 보고 다음 사용 때 다시 조회한다.
+	 */
+	void ReloadTextures();
+
+	/** 텍스처 핸들 캐시 유효성 확인용 (0은 "아직 조회 안 함"으로 쓰도록 1부터 시작) */
+	uint32 GetTextureGeneration() const { return TextureGeneration; }
+
 	ID3D11SamplerState* GetSamplerState(ESamplerType Type);
 	const FShader& GetShader(EShaderType Type) { return Shaders[Type]; }
 
@@ -34,16 +47,30 @@ private:
 	void CreateStaticMeshShader();
 	void CreateDefaultShader();
 	void CreateTextShader();
+	void CreateTextureShader();
+
+	/**
+	 * @brief 셰이더 바이트코드를 캐시에서 읽거나, 없으면 컴파일해서 캐시에 넣는다
+	 * @return 컴파일 실패 시 false (오류는 로그로 남긴다)
+	 */
+	bool LoadShaderBytecode(const FString& InSourcePath, const FString& InEntryPoint, const FString& InProfile,
+		TArray<uint8>& OutBytecode);
 
 	void ReleaseShaders();
+	void ReleaseTextures();
 
 	TArray<FString> DefaultAssetPaths = { "Data/cube-tex.obj", "Data/triangle.obj", "Data/square.obj", "Data/sphere.obj", "Data/minion.obj", "Data/trees9.obj"};
 	TMap<FString, UStaticMesh*> StaticMeshes;
 
 	TMap<FString, ID3D11ShaderResourceView*> ShaderResourceViews;
+	ID3D11ShaderResourceView* DefaultTexture = nullptr;
+	uint32 TextureGeneration = 1;
 	TMap<ESamplerType, ID3D11SamplerState*> SamplerStates;
 	
 	TMap<EShaderType, FShader> Shaders;
+	FShaderCache ShaderCache{ "Intermediate/ShaderCache" };
+	uint32 NumShaderCacheHits = 0;
+	uint32 NumShaderCompiles = 0;
 
 
 
@@ -0,0 +1,64 @@
+#pragma once
+#include "Global/CoreMinimal.h"
+
+/**
+ * @brief 셰이더 한 단계(VS/PS 등)를 컴파일하는 데 필요한 입력 전부
+ * 이 값과 소스/인클루드 파일 내용이 같으면 컴파일 결과도 같다고 본다.
+ */
+struct FShaderCompileRequest
+{
+	FString SourcePath;		// "Asset/Shader/StaticMeshShader.hlsl"
+	FString EntryPoint;		// "MainVS"
+	FString Profile;		// "vs_5_0"
+	TArray<std::pair<FString, FString>> Defines;
+	uint32 Flags = 0;			// D3DCOMPILE_* 플래그
+	uint32 CompilerVersion = 0;	// 컴파일러가 바뀌면 캐시도 무효
+};
+
+/**
+ * @brief 컴파일된 셰이더 바이트코드를 소스 해시로 찾는 디스크 캐시
+ *
+ * 키는 소스 파일, 그 파일이 #include "..."로 끌어오는 파일들(재귀), 엔트리, 프로파일, 디파인, 플래그를
+ * 모두 해시한 값이다. 키가 같은 블롭이 캐시 디렉토리에 있으면 컴파일하지 않고 그대로 쓴다.
+ * 파일 입출력과 해시만 하고 D3D는 모르므로 pch 없이 빌드되며 렌더러 없이 단독으로 검증할 수 있다.
+ *
+ * 사용 순서: ComputeKey() → Load() 실패 시 컴파일 → Store()
+ */
+class FShaderCache
+{
+public:
+	explicit FShaderCache(const FString& InCacheDirectory);
+
+	/** 64비트 FNV-1a. InSeed에 이전 결과를 넘기면 이어서 해시한다 */
+	static uint64 HashBytes(const void* InData, size_t InSize, uint64 InSeed = HashSeed);
+	static uint64 HashString(const FString& InString, uint64 InSeed = HashSeed);
+
+	/**
+	 * @brief 소스와 인클루드 파일을 읽어 캐시 키를 만든다
+	 * @return 소스 파일을 읽을 수 없으면 false (찾을 수 없는 인클루드는 이름만 해시하고 컴파일러가 오류를 내게 둔다)
+	 */
+	static bool ComputeKey(const FShaderCompileRequest& InRequest, uint64& OutKey);
+
+	/**
+	 * @brief <캐시 디렉토리>/<소스 이름>_<엔트리>_<프로파일>_<퍼뮤테이션 8자리>_<키 16자리>.cso
+	 * 퍼뮤테이션은 디파인과 플래그의 해시라서, 같은 소스의 다른 퍼뮤테이션 블롭은 이름 앞부분부터 다르다.
+	 */
+	FString GetBlobPath(const FShaderCompileRequest& InRequest, uint64 InKey) const;
+
+	/** 키가 일치하는 블롭을 읽는다. 없거나 헤더가 맞지 않으면 false */
+	bool Load(const FShaderCompileRequest& InRequest, uint64 InKey, TArray<uint8>& OutBytecode) const;
+
+	/** 블롭을 쓰고, 같은 소스/엔트리/프로파일/퍼뮤테이션의 이전 키 블롭만 지운다 */
+	bool Store(const FShaderCompileRequest& InRequest, uint64 InKey, const void* InBytecode, size_t InSize) const;
+
+	const FString& GetCacheDirectory() const { return CacheDirectory; }
+
+	static constexpr uint64 HashSeed = 0xcbf29ce484222325ull;
+	static constexpr uint32 FormatVersion = 1;
+
+private:
+	/** 블롭 파일 이름에서 키를 뺀 앞부분 (같은 퍼뮤테이션의 이전 키 블롭을 찾을 때 쓴다) */
+	static FString GetBlobPrefix(const FShaderCompileRequest& InRequest);
+
+	FString CacheDirectory;
+};
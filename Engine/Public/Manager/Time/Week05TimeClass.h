@@ -31,9 +31,14 @@ public:
 	}
 	static uint64 GetFrequency()
 	{
+#if defined(_WIN32)
 		LARGE_INTEGER Frequency;
 		QueryPerformanceFrequency(&Frequency);
 		return Frequency.QuadPart;
+#else
+		// 헤드리스 빌드(테스트)에서는 steady_clock 틱을 사이클로 쓴다
+		return static_cast<uint64>(std::chrono::steady_clock::period::den / std::chrono::steady_clock::period::num);
+#endif
 	}
 	static double ToMilliseconds(uint64 CycleDiff)
 	{
@@ -46,9 +51,13 @@ public:
 
 	static uint64 Cycles64()
 	{
+#if defined(_WIN32)
 		LARGE_INTEGER CycleCount;
 		QueryPerformanceCounter(&CycleCount);
 		return (uint64)CycleCount.QuadPart;
+#else
+		return static_cast<uint64>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
 	}
 };
 
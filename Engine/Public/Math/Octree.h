@@ -42,11 +42,9 @@ public:
 	//사이즈를 지정하고 싶을때는 무조건 NewOctree로 지정 후 사용
 	void NewOctree(const FAABB& OctreeSize)
 	{
+		//clear가 기본 크기 루트를 넣어 두므로 그 루트의 크기만 바꿈
 		clear();
-		FOctreeNode RootNode;
-		RootNode.AABB = OctreeSize;
-		OctreeNodes.Add(RootNode);
-
+		OctreeNodes[0].AABB = OctreeSize;
 	}
 
 
@@ -100,6 +98,56 @@ public:
 			OctreeNodes[CurrentNodeIndex].TemporalElements.RemoveAt(ElementIndex);
 		}
 	}
+	//여러 element를 한 번에 제거 (액터 일괄 삭제용)
+	//지울 element의 OctreeIndex를 RemovedMark로 표시해 두고, 걸린 노드마다 한 번씩만 압축함.
+	//RemoveElement를 반복하면 한 노드에 몰린 element를 지울 때 노드 크기의 제곱이 되지만 이건 element 수에 선형
+	//제거된 element의 OctreeIndex는 -1이 됨
+	void RemoveElements(const TArray<T*>& InElements)
+	{
+		TArray<int32> TouchedNodes;
+		TouchedNodes.reserve(InElements.Num());
+		bool bTouchedOutside = false;
+		for (T* Element : InElements)
+		{
+			const int32 NodeIndex = TTrait::GetOctreeIndex(Element);
+			//같은 element가 두 번 들어온 경우
+			if (NodeIndex == RemovedMark)
+			{
+				continue;
+			}
+			if (NodeIndex == -1)
+			{
+				bTouchedOutside = true;
+			}
+			else
+			{
+				TouchedNodes.Add(NodeIndex);
+			}
+			TTrait::SetOctreeIndex(Element, RemovedMark);
+		}
+		std::sort(TouchedNodes.begin(), TouchedNodes.end());
+		TouchedNodes.erase(std::unique(TouchedNodes.begin(), TouchedNodes.end()), TouchedNodes.end());
+
+		auto IsRemoved = [](T* Element) { return TTrait::GetOctreeIndex(Element) == RemovedMark; };
+		for (int32 NodeIndex : TouchedNodes)
+		{
+			FOctreeNode& Node = OctreeNodes[NodeIndex];
+			//노드 구간 안에서 남는 것만 앞으로 당김. 구간 뒤에 남는 칸은 RemoveElement처럼 다음 재정렬 때 정리됨
+			auto RangeBegin = Elements.begin() + Node.ElementStartIndex;
+			auto RangeEnd = std::remove_if(RangeBegin, RangeBegin + Node.ElementCount, IsRemoved);
+			Node.ElementCount = static_cast<uint32>(RangeEnd - RangeBegin);
+			Node.TemporalElements.erase(std::remove_if(Node.TemporalElements.begin(), Node.TemporalElements.end(), IsRemoved), Node.TemporalElements.end());
+		}
+		if (bTouchedOutside)
+		{
+			ElementsOutsideOctree.erase(std::remove_if(ElementsOutsideOctree.begin(), ElementsOutsideOctree.end(), IsRemoved), ElementsOutsideOctree.end());
+		}
+
+		for (T* Element : InElements)
+		{
+			TTrait::SetOctreeIndex(Element, -1);
+		}
+	}
 	void UpdateElement(T* Element)
 	{
 		/*UE_LOG("InOctree : %d, OutsizeOctree : %d, TempNum : %d", Elements.Num(), ElementsOutsideOctree.Num(), TemporalElementNum);
@@ -207,12 +255,13 @@ public:
 
 	//노드를 add할때 그냥 ElementIndex 신경 안 쓰고 삽입했기 때문에
 	//노드의 element들이 연속된 메모리에 위치하도록 재정렬하는 함수
-	void Rearrange()
+	//InDeltaTime : TemporalElement 수를 다시 세는 주기(2초) 계산용
+	void Rearrange(float InDeltaTime)
 	{
 		if (bIsElementsDirty)
 		{
 			static float TimeAfterCal;
-			TimeAfterCal += DT;
+			TimeAfterCal += InDeltaTime;
 			if (TimeAfterCal >= 2)
 			{
 				TemporalElementNum = 0;
@@ -251,7 +300,7 @@ public:
 			NextNode.push({ NewDistance, 0});
 		}
 		
-		ShortestDistance = D3D11_FLOAT32_MAX;
+		ShortestDistance = FLT_MAX;
 
 		while (!NextNode.empty())
 		{
@@ -538,4 +587,6 @@ private:
 	const int MaxDepth = 8;
 	//TemporalElement가 100개 넘으면 재정렬
 	const int MaxTemporalElementNum = 100;
+	//RemoveElements에서 지울 element 표시용 OctreeIndex
+	static constexpr int32 RemovedMark = -2;
 };
@@ -20,6 +20,16 @@ void UMaterial::SetMaterialInfo(const FObjMaterialInfo& InFObjMaterial)
 {
 	MaterialInfo = InFObjMaterial;
 
+	// 경로가 바뀌었을 수 있으므로 다음 사용 때 다시 조회
+	KdTexture = nullptr;
+	ResolvedTextureGeneration = 0;
+}
+
+void UMaterial::ResolveTextures() const
+{
+	UResourceManager& ResourceManager = UResourceManager::GetInstance();
+	KdTexture = MaterialInfo.Map_Kd.empty() ? nullptr : ResourceManager.GetTexture(MaterialInfo.Map_Kd);
+	ResolvedTextureGeneration = ResourceManager.GetTextureGeneration();
 }
 
 
@@ -1,5 +1,6 @@
 #pragma once
 #include "Core/Object.h"
+#include "Manager/Resource/ResourceManager.h"
 
 class UMaterial : public UObject
 {
@@ -18,6 +19,25 @@ public:
 	const FString& GetKsTextureFilePath() const { return MaterialInfo.Map_Ks; }
 	const FString& GetBumpTextureFilePath() const { return MaterialInfo.Map_bump; }
 
+	/**
+	 * @brief 경로 문자열로 텍스처를 찾아 핸들을 캐시 (메시에 머티리얼을 지정할 때 호출)
+	 * 로드가 필요하면 여기서 동기 로드가 일어난다.
+	 */
+	void ResolveTextures() const;
+
+	/**
+	 * @brief 캐시된 Map_Kd 텍스처 (없거나 로드 실패면 nullptr)
+	 * 문자열 조회 없이 반환하며, 텍스처가 다시 로드된 뒤 처음 호출될 때만 ResolveTextures()를 거친다.
+	 */
+	ID3D11ShaderResourceView* GetKdTexture() const
+	{
+		if (ResolvedTextureGeneration != UResourceManager::GetInstance().GetTextureGeneration())
+		{
+			ResolveTextures();
+		}
+		return KdTexture;
+	}
+
 private:
 	UMaterial();
 	UMaterial(const FObjMaterialInfo& InFObjMaterial);
@@ -26,4 +46,8 @@ private:
 	friend class FObjManager;
 	friend class FMtlParser;
 	FObjMaterialInfo MaterialInfo;
+
+	// 텍스처 핸들 캐시 (UResourceManager가 소유, 세대가 다르면 무효)
+	mutable ID3D11ShaderResourceView* KdTexture = nullptr;
+	mutable uint32 ResolvedTextureGeneration = 0;
 };
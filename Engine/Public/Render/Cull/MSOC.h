@@ -1,14 +1,22 @@
 #pragma once
 
-#include <d3d11.h>
-#if defined(__AVX2__)
-#include <immintrin.h>
-#endif
+#include <emmintrin.h>
+#include "Render/Cull/MSOCKernels.h"
 
 // 논문 기본 타일 크기
 static constexpr int MSOC_TILE_W = 32;
 static constexpr int MSOC_TILE_H = 8;
 
+// 커버리지 커널이 한 번에 평가하는 볼록 다각형의 최대 에지 수 (박스 실루엣은 최대 6각형)
+static constexpr int MSOC_MAX_COVERAGE_EDGES = 8;
+
+// 보수적 래스터에서 에지 공유로 묶어 볼 연속 삼각형 최대 수
+static constexpr int MSOC_PATCH_TRIS = 16;
+
+// 오클루전 버퍼 기본 해상도 (백버퍼와 분리, 종횡비는 백버퍼를 따름)
+static constexpr int MSOC_DEFAULT_BUFFER_W = 512;
+static constexpr int MSOC_DEFAULT_BUFFER_H = 256;
+
 struct alignas(32) FMaskedTile
 {
 	// 8개의 scanline => 32bit * 8 => 256bit
@@ -18,6 +26,20 @@ struct alignas(32) FMaskedTile
 	bool     bFullCovered; // 마스크가 모두 1인 상태인거 확인용
 };
 
+/**
+ * @brief 오클루전 버퍼 기준 뷰포트 (필드는 D3D11_VIEWPORT와 같음)
+ * 렌더러 없이 헤드리스로도 돌릴 수 있도록 D3D 헤더에 의존하지 않는다.
+ */
+struct FOcclusionViewport
+{
+	float TopLeftX = 0.0f;
+	float TopLeftY = 0.0f;
+	float Width = 0.0f;
+	float Height = 0.0f;
+	float MinDepth = 0.0f;
+	float MaxDepth = 1.0f;
+};
+
 struct FSoftwareTri
 {
 	FVector P0;
@@ -36,155 +58,50 @@ struct FProjectedTri
 	int   minX, minY, maxX, maxY;
 };
 
-struct FScreenRect { int x0, y0, x1, y1; float zmin; };
-
+/**
+ * @brief 커버리지 커널이 평가하는 볼록 다각형 (삼각형 또는 에지를 공유하는 삼각형 묶음의 외곽)
+ * E(P) = A*x + B*y + C >= 0 (모든 에지) 이면 P가 안쪽
+ */
+struct FCoverageEdges
+{
+	int   NumEdges;
+	float A[MSOC_MAX_COVERAGE_EDGES], B[MSOC_MAX_COVERAGE_EDGES], C[MSOC_MAX_COVERAGE_EDGES];
 
+	// AABB
+	int   minX, minY, maxX, maxY;
+};
 
-static inline void PerspectiveDivide8_AVX2(
-	const __m256 Hx, const __m256 Hy, const __m256 Hz, const __m256 Hw,
-	__m256& x_ndc, __m256& y_ndc, __m256& z_ndc)
-{
-	__m256 invw = _mm256_rcp_ps(Hw);                  // 1/w (근사)
-	// 뉴튼-랩슨 1회 보정: invw = invw * (2 - Hw*invw)
-	const __m256 two = _mm256_set1_ps(2.0f);
-	invw = _mm256_mul_ps(invw, _mm256_sub_ps(two, _mm256_mul_ps(Hw, invw)));
-
-	x_ndc = _mm256_mul_ps(Hx, invw);
-	y_ndc = _mm256_mul_ps(Hy, invw);
-	z_ndc = _mm256_mul_ps(Hz, invw);
-}
+struct FScreenRect { int x0, y0, x1, y1; float zmin; };
 
-static inline void NDCToViewport8_AVX2(
-	const __m256 x_ndc, const __m256 y_ndc, const __m256 z_ndc,
-	float topLeftX, float topLeftY, float width, float height,
-	__m256& sx, __m256& sy, __m256& sz)
+// 배치 오클루전 테스트 입력 (SoA), 8개씩 묶어서 코너를 한 번에 투영한다
+struct FAABBSoA
 {
-	const __m256 half = _mm256_set1_ps(0.5f);
-	const __m256 vTX = _mm256_set1_ps(topLeftX);
-	const __m256 vTY = _mm256_set1_ps(topLeftY);
-	const __m256 vW = _mm256_set1_ps(width);
-	const __m256 vH = _mm256_set1_ps(height);
-
-	// x = tX + (x_ndc*0.5 + 0.5) * W
-	sx = _mm256_add_ps(vTX, _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(x_ndc, half), half), vW));
-	// y = tY + (-y_ndc*0.5 + 0.5) * H
-	sy = _mm256_add_ps(vTY, _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(0.0f), y_ndc), half), half), vH));
-	// z = z_ndc*0.5 + 0.5
-	sz = _mm256_add_ps(half, _mm256_mul_ps(z_ndc, half));
+	TArray<float> MinX, MinY, MinZ;
+	TArray<float> MaxX, MaxY, MaxZ;
 
-}
+	int32 Num() const { return static_cast<int32>(MinX.size()); }
 
-static inline void MulPointsByMatrix8_AVX2(
-	const float* __restrict px,  // 8개 x
-	const float* __restrict py,  // 8개 y
-	const float* __restrict pz,  // 8개 z
-	const FMatrix& M,
-	__m256& Hx, __m256& Hy, __m256& Hz, __m256& Hw)
-{
-	__m256 X = _mm256_loadu_ps(px);
-	__m256 Y = _mm256_loadu_ps(py);
-	__m256 Z = _mm256_loadu_ps(pz);
-	__m256 O = _mm256_set1_ps(1.0f);
-
-	// Hx = x*m00 + y*m10 + z*m20 + 1*m30  (열0)
-	Hx = _mm256_add_ps(
-		_mm256_add_ps(_mm256_mul_ps(X, _mm256_set1_ps(M.Data[0][0])),
-			_mm256_mul_ps(Y, _mm256_set1_ps(M.Data[1][0]))),
-		_mm256_add_ps(_mm256_mul_ps(Z, _mm256_set1_ps(M.Data[2][0])),
-			_mm256_mul_ps(O, _mm256_set1_ps(M.Data[3][0]))));
-
-	Hy = _mm256_add_ps(
-		_mm256_add_ps(_mm256_mul_ps(X, _mm256_set1_ps(M.Data[0][1])),
-			_mm256_mul_ps(Y, _mm256_set1_ps(M.Data[1][1]))),
-		_mm256_add_ps(_mm256_mul_ps(Z, _mm256_set1_ps(M.Data[2][1])),
-			_mm256_mul_ps(O, _mm256_set1_ps(M.Data[3][1]))));
-
-	Hz = _mm256_add_ps(
-		_mm256_add_ps(_mm256_mul_ps(X, _mm256_set1_ps(M.Data[0][2])),
-			_mm256_mul_ps(Y, _mm256_set1_ps(M.Data[1][2]))),
-		_mm256_add_ps(_mm256_mul_ps(Z, _mm256_set1_ps(M.Data[2][2])),
-			_mm256_mul_ps(O, _mm256_set1_ps(M.Data[3][2]))));
-
-	Hw = _mm256_add_ps(
-		_mm256_add_ps(_mm256_mul_ps(X, _mm256_set1_ps(M.Data[0][3])),
-			_mm256_mul_ps(Y, _mm256_set1_ps(M.Data[1][3]))),
-		_mm256_add_ps(_mm256_mul_ps(Z, _mm256_set1_ps(M.Data[2][3])),
-			_mm256_mul_ps(O, _mm256_set1_ps(M.Data[3][3]))));
+	void Reserve(int32 InCount)
+	{
+		MinX.reserve(InCount); MinY.reserve(InCount); MinZ.reserve(InCount);
+		MaxX.reserve(InCount); MaxY.reserve(InCount); MaxZ.reserve(InCount);
+	}
 
-}
+	void Add(const FAABB& Box)
+	{
+		MinX.push_back(Box.Min.X); MinY.push_back(Box.Min.Y); MinZ.push_back(Box.Min.Z);
+		MaxX.push_back(Box.Max.X); MaxY.push_back(Box.Max.Y); MaxZ.push_back(Box.Max.Z);
+	}
 
-inline bool ProjectToScreen(const FVector& P, const FMatrix& ViewProj, const D3D11_VIEWPORT& VP, float& outX, float& outY, float& outZ, float& outW)
-{ 
-
-#if defined(__AVX2__)
-	// (x,y,z,1) 브로드캐스트
-	const __m256 vx = _mm256_set1_ps(P.X);
-	const __m256 vy = _mm256_set1_ps(P.Y);
-	const __m256 vz = _mm256_set1_ps(P.Z);
-	const __m256 vo = _mm256_set1_ps(1.0f);
-
-	// ViewProj(row-major) 요소 브로드캐스트
-	const __m256 m00 = _mm256_set1_ps(ViewProj.Data[0][0]);
-	const __m256 m01 = _mm256_set1_ps(ViewProj.Data[0][1]);
-	const __m256 m02 = _mm256_set1_ps(ViewProj.Data[0][2]);
-	const __m256 m03 = _mm256_set1_ps(ViewProj.Data[0][3]);
-
-	const __m256 m10 = _mm256_set1_ps(ViewProj.Data[1][0]);
-	const __m256 m11 = _mm256_set1_ps(ViewProj.Data[1][1]);
-	const __m256 m12 = _mm256_set1_ps(ViewProj.Data[1][2]);
-	const __m256 m13 = _mm256_set1_ps(ViewProj.Data[1][3]);
-
-	const __m256 m20 = _mm256_set1_ps(ViewProj.Data[2][0]);
-	const __m256 m21 = _mm256_set1_ps(ViewProj.Data[2][1]);
-	const __m256 m22 = _mm256_set1_ps(ViewProj.Data[2][2]);
-	const __m256 m23 = _mm256_set1_ps(ViewProj.Data[2][3]);
-
-	const __m256 m30 = _mm256_set1_ps(ViewProj.Data[3][0]);
-	const __m256 m31 = _mm256_set1_ps(ViewProj.Data[3][1]);
-	const __m256 m32 = _mm256_set1_ps(ViewProj.Data[3][2]);
-	const __m256 m33 = _mm256_set1_ps(ViewProj.Data[3][3]);
-
-	// H = (x,y,z,1) * M
-	const __m256 Hx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m00), _mm256_mul_ps(vy, m10)),
-		_mm256_add_ps(_mm256_mul_ps(vz, m20), _mm256_mul_ps(vo, m30)));
-	const __m256 Hy = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m01), _mm256_mul_ps(vy, m11)),
-		_mm256_add_ps(_mm256_mul_ps(vz, m21), _mm256_mul_ps(vo, m31)));
-	const __m256 Hz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m02), _mm256_mul_ps(vy, m12)),
-		_mm256_add_ps(_mm256_mul_ps(vz, m22), _mm256_mul_ps(vo, m32)));
-	const __m256 Hw = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, m03), _mm256_mul_ps(vy, m13)),
-		_mm256_add_ps(_mm256_mul_ps(vz, m23), _mm256_mul_ps(vo, m33)));
-
-	// w 체크(모든 lane 동일), scalar로 추출
-	outW = _mm_cvtss_f32(_mm256_castps256_ps128(Hw));
-	if (outW <= 0.0f) return false;
-
-	// perspective divide (rcp + Newton 1회)
-	__m256 invw = _mm256_rcp_ps(Hw);
-	invw = _mm256_mul_ps(invw, _mm256_sub_ps(_mm256_set1_ps(2.0f), _mm256_mul_ps(Hw, invw)));
-
-	const __m256 x_ndc = _mm256_mul_ps(Hx, invw);
-	const __m256 y_ndc = _mm256_mul_ps(Hy, invw);
-	const __m256 z_ndc = _mm256_mul_ps(Hz, invw);
-
-	// viewport 변환
-	const __m256 half = _mm256_set1_ps(0.5f);
-	const __m256 vTX = _mm256_set1_ps(VP.TopLeftX);
-	const __m256 vTY = _mm256_set1_ps(VP.TopLeftY);
-	const __m256 vW = _mm256_set1_ps(VP.Width);
-	const __m256 vH = _mm256_set1_ps(VP.Height);
-
-	const __m256 SX = _mm256_add_ps(vTX, _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(x_ndc, half), half), vW));
-	const __m256 SY = _mm256_add_ps(vTY, _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(0.0f), y_ndc), half), half), vH));
-	const __m256 SZ = _mm256_add_ps(half, _mm256_mul_ps(z_ndc, half));
-
-	// 모든 lane 동일하므로 첫 lane만 사용
-	outX = _mm_cvtss_f32(_mm256_castps256_ps128(SX));
-	outY = _mm_cvtss_f32(_mm256_castps256_ps128(SY));
-	outZ = _mm_cvtss_f32(_mm256_castps256_ps128(SZ));
-	return true;
+	void Clear()
+	{
+		MinX.clear(); MinY.clear(); MinZ.clear();
+		MaxX.clear(); MaxY.clear(); MaxZ.clear();
+	}
+};
 
-#else
-	// 스칼라 경로(기존)
+inline bool ProjectToScreen(const FVector& P, const FMatrix& ViewProj, const FOcclusionViewport& VP, float& outX, float& outY, float& outZ, float& outW)
+{
 	const FVector4 H = FVector4(P, 1.0f) * ViewProj;
 	outW = H.W;
 	if (outW <= 0.f) return false;
@@ -198,97 +115,21 @@ inline bool ProjectToScreen(const FVector& P, const FMatrix& ViewProj, const D3D
 	outY = VP.TopLeftY + (-y_ndc * 0.5f + 0.5f) * VP.Height;
 	outZ = z_ndc * 0.5f + 0.5f;
 	return true;
-#endif
-}
-
-inline bool ProjectAABB_ToScreen_AVX2(const FAABB& Box, const FMatrix& VP, const D3D11_VIEWPORT& Vp,
-	int ScreenW, int ScreenH, FScreenRect& Out)
-{
-	const FVector mn = Box.Min, mx = Box.Max;
-	const FVector P[8] = {
-		{mn.X,mn.Y,mn.Z},{mx.X,mn.Y,mn.Z},{mn.X,mx.Y,mn.Z},{mx.X,mx.Y,mn.Z},
-		{mn.X,mn.Y,mx.Z},{mx.X,mn.Y,mx.Z},{mn.X,mx.Y,mx.Z},{mx.X,mx.Y,mx.Z},
-	};
-
-	float x[8], y[8], z[8];
-	for (int i = 0; i < 8; ++i) { x[i] = P[i].X; y[i] = P[i].Y; z[i] = P[i].Z; }
-
-	__m256 Hx, Hy, Hz, Hw;
-	MulPointsByMatrix8_AVX2(x, y, z, VP, Hx, Hy, Hz, Hw);
-
-	// w <= 0 → 실패
-	if (_mm256_movemask_ps(_mm256_cmp_ps(Hw, _mm256_set1_ps(0.0f), _CMP_LE_OQ)) != 0)
-		return false;
-
-	__m256 xn, yn, zn;
-	PerspectiveDivide8_AVX2(Hx, Hy, Hz, Hw, xn, yn, zn);
-
-	__m256 sx, sy, sz;
-	NDCToViewport8_AVX2(xn, yn, zn, Vp.TopLeftX, Vp.TopLeftY, Vp.Width, Vp.Height, sx, sy, sz);
-
-	// 스칼라 축약
-	alignas(32) float X[8], Y[8], Z[8];
-	_mm256_store_ps(X, sx);
-	_mm256_store_ps(Y, sy);
-	_mm256_store_ps(Z, sz);
-
-	float minx = X[0], maxx = X[0], miny = Y[0], maxy = Y[0], zmin = Z[0];
-	auto acc = [&](float a, float b, float c) { if (a < minx)minx = a; if (a > maxx)maxx = a; if (b < miny)miny = b; if (b > maxy)maxy = b; if (c < zmin)zmin = c; };
-	for (int i = 1; i < 8; ++i) acc(X[i], Y[i], Z[i]);
-
-	Out.x0 = std::clamp((int)std::floor(minx), 0, ScreenW - 1);
-	Out.x1 = std::clamp((int)std::ceil(maxx), 0, ScreenW - 1);
-	Out.y0 = std::clamp((int)std::floor(miny), 0, ScreenH - 1);
-	Out.y1 = std::clamp((int)std::ceil(maxy), 0, ScreenH - 1);
-	Out.zmin = std::clamp(zmin, 0.0f, 1.0f);
-
-	return Out.x0 <= Out.x1 && Out.y0 <= Out.y1;
 }
 
 inline bool ProjectAABB_ToScreen(const FAABB& Box,
 	const FMatrix& ViewProj,
-	const D3D11_VIEWPORT& VP,
+	const FOcclusionViewport& VP,
 	int ScreenW, int ScreenH,
 	FScreenRect& OutRect)
 {
-#if defined(__AVX2__)
-	// 네가 만든 AVX2 구현을 그대로 호출
-	return ProjectAABB_ToScreen_AVX2(Box, ViewProj, VP, ScreenW, ScreenH, OutRect);
-#else
-	// 기존 스칼라 본문 그대로 붙이기 (혹은 기존 구현 호출)
-	float sx[8], sy[8], sz[8], sw[8];
-	const FVector mn = Box.Min, mx = Box.Max;
-	const FVector corners[8] = {
-		{mn.X, mn.Y, mn.Z}, {mx.X, mn.Y, mn.Z},
-		{mn.X, mx.Y, mn.Z}, {mx.X, mx.Y, mn.Z},
-		{mn.X, mn.Y, mx.Z}, {mx.X, mn.Y, mx.Z},
-		{mn.X, mx.Y, mx.Z}, {mx.X, mx.Y, mx.Z},
-	};
-	for (int i = 0; i < 8; ++i)
-		if (!ProjectToScreen(corners[i], ViewProj, VP, sx[i], sy[i], sz[i], sw[i])) return false;
-
-	float minx = sx[0], maxx = sx[0], miny = sy[0], maxy = sy[0], zmin = sz[0];
-	for (int i = 1; i < 8; ++i) {
-		minx = std::min(minx, sx[i]); maxx = std::max(maxx, sx[i]);
-		miny = std::min(miny, sy[i]); maxy = std::max(maxy, sy[i]);
-		zmin = std::min(zmin, sz[i]);
-	}
-	OutRect.x0 = std::clamp((int)std::floor(minx), 0, ScreenW - 1);
-	OutRect.x1 = std::clamp((int)std::ceil(maxx), 0, ScreenW - 1);
-	OutRect.y0 = std::clamp((int)std::floor(miny), 0, ScreenH - 1);
-	OutRect.y1 = std::clamp((int)std::ceil(maxy), 0, ScreenH - 1);
-	OutRect.zmin = std::clamp(zmin, 0.0f, 1.0f);
-	return (OutRect.x0 <= OutRect.x1) && (OutRect.y0 <= OutRect.y1);
-#endif
+	// 활성 SIMD 레벨의 커널 (배치 테스트와 같은 경로)
+	return GetOcclusionKernels().ProjectAABB(Box, ViewProj, VP, ScreenW, ScreenH, OutRect);
 }
 
-inline bool ProjectTriangle(const FSoftwareTri& T, const FMatrix& ViewProj, const D3D11_VIEWPORT& VP, FProjectedTri& Out, int ScreenW, int ScreenH)
+// 스크린 좌표가 채워진 삼각형의 면적 컬링 + 스크린 AABB 계산
+inline bool FinalizeProjectedTri(FProjectedTri& Out, int ScreenW, int ScreenH)
 {
-	float w0, w1, w2;
-	if (!ProjectToScreen(T.P0, ViewProj, VP, Out.x0, Out.y0, Out.z0, w0)) return false;
-	if (!ProjectToScreen(T.P1, ViewProj, VP, Out.x1, Out.y1, Out.z1, w1)) return false;
-	if (!ProjectToScreen(T.P2, ViewProj, VP, Out.x2, Out.y2, Out.z2, w2)) return false;
-
 	// 삼각형의 면적으로 culling, pseuedo cross product
 	const float area2 = (Out.x1 - Out.x0) * (Out.y2 - Out.y0) - (Out.y1 - Out.y0) * (Out.x2 - Out.x0);
 	if (area2 <= 0) return false;
@@ -299,6 +140,10 @@ inline bool ProjectTriangle(const FSoftwareTri& T, const FMatrix& ViewProj, cons
 	const float miny = std::min({ Out.y0, Out.y1, Out.y2 });
 	const float maxy = std::max({ Out.y0, Out.y1, Out.y2 });
 
+	// 화면 밖 삼각형은 clamp 전에 거른다 (근평면 클리핑 후 큰 삼각형이 많아짐)
+	if (maxx < 0.0f || maxy < 0.0f || minx > static_cast<float>(ScreenW - 1) || miny > static_cast<float>(ScreenH - 1))
+		return false;
+
 	// (0.1, 2.2) => (0, 3)
 	Out.minX = std::clamp((int)std::floor(minx), 0, ScreenW - 1);
 	Out.maxX = std::clamp((int)std::ceil(maxx), 0, ScreenW - 1);
@@ -308,73 +153,211 @@ inline bool ProjectTriangle(const FSoftwareTri& T, const FMatrix& ViewProj, cons
 	return (Out.minX <= Out.maxX) && (Out.minY <= Out.maxY);
 }
 
-// 픽셀 중심에서 (half-space) edge test (스칼라 폴백에서 사용)
-inline bool PointInTri(float px, float py, float a[2], float b[2], float c[2])
+inline bool ProjectTriangle(const FSoftwareTri& T, const FMatrix& ViewProj, const FOcclusionViewport& VP, FProjectedTri& Out, int ScreenW, int ScreenH)
 {
-	auto edge = [](const float p[2], const float v0[2], const float v1[2])
+	float w0, w1, w2;
+	if (!ProjectToScreen(T.P0, ViewProj, VP, Out.x0, Out.y0, Out.z0, w0)) return false;
+	if (!ProjectToScreen(T.P1, ViewProj, VP, Out.x1, Out.y1, Out.z1, w1)) return false;
+	if (!ProjectToScreen(T.P2, ViewProj, VP, Out.x2, Out.y2, Out.z2, w2)) return false;
+
+	return FinalizeProjectedTri(Out, ScreenW, ScreenH);
+}
+
+/**
+ * @brief CCW 스크린 다각형(3 ~ MSOC_MAX_COVERAGE_EDGES 정점)의 에지 함수 (AABB는 호출한 쪽이 채운다)
+ * @param bConservative true면 에지를 텍셀 반 칸만큼 안쪽으로 밀어, 텍셀 중심 테스트가 텍셀 전체가 안쪽일 때만 참이 되게 한다
+ *   (0.5 * (|A| + |B|) = 텍셀 중심과 가장 바깥 코너의 에지 함수 차이)
+ */
+inline void SetupCoverageEdges(const float* Xs, const float* Ys, int NumVerts, bool bConservative, FCoverageEdges& Out)
+{
+	Out.NumEdges = NumVerts;
+	for (int e = 0; e < NumVerts; ++e)
+	{
+		const int n = (e + 1) % NumVerts;
+		Out.A[e] = Ys[e] - Ys[n];
+		Out.B[e] = Xs[n] - Xs[e];
+		Out.C[e] = Xs[e] * Ys[n] - Ys[e] * Xs[n];
+		if (bConservative)
 		{
-			return (p[1] - v0[1]) * (v1[0] - v0[0]) - (p[0] - v0[0]) * (v1[1] - v0[1]);
-		};
-	float p[2] = { px, py };
-	const float e0 = edge(p, a, b);
-	const float e1 = edge(p, b, c);
-	const float e2 = edge(p, c, a);
+			Out.C[e] -= 0.5f * (std::fabs(Out.A[e]) + std::fabs(Out.B[e]));
+		}
+	}
+}
 
-	return (e0 >= 0 && e1 >= 0 && e2 >= 0);
+inline void SetupTriCoverageEdges(const FProjectedTri& T, bool bConservative, FCoverageEdges& Out)
+{
+	const float Xs[3] = { T.x0, T.x1, T.x2 };
+	const float Ys[3] = { T.y0, T.y1, T.y2 };
+	SetupCoverageEdges(Xs, Ys, 3, bConservative, Out);
+	Out.minX = T.minX; Out.minY = T.minY;
+	Out.maxX = T.maxX; Out.maxY = T.maxY;
 }
 
-// --- AVX2 유틸: 32픽셀(한 행) 커버리지 마스크 생성 ------------------------------------
-#if defined(__AVX2__)
-static FORCEINLINE uint32 BuildRowCoverageMask32_AVX2(
-	float PxStart, float Py,
-	float A0, float B0, float C0,
-	float A1, float B1, float C1,
-	float A2, float B2, float C2)
+/**
+ * @brief 보수적 래스터에서 에지 공유로 묶어 볼 연속 삼각형
+ * 같은 월드 정점은 같은 투영 결과가 나오므로 스크린 좌표가 정확히 같은 정점을 같은 ID로 본다.
+ */
+struct FOccluderPatchBatch
 {
-	// 32픽셀 = 8픽셀 × 4블록
-	const __m256 idx = _mm256_set_ps(7.f, 6.f, 5.f, 4.f, 3.f, 2.f, 1.f, 0.f);
-	const __m256 yv = _mm256_set1_ps(Py);
-	const __m256 z = _mm256_setzero_ps();
+	struct FVertex { float X, Y, Z; };
 
-	const __m256 A0v = _mm256_set1_ps(A0), B0v = _mm256_set1_ps(B0), C0v = _mm256_set1_ps(C0);
-	const __m256 A1v = _mm256_set1_ps(A1), B1v = _mm256_set1_ps(B1), C1v = _mm256_set1_ps(C1);
-	const __m256 A2v = _mm256_set1_ps(A2), B2v = _mm256_set1_ps(B2), C2v = _mm256_set1_ps(C2);
+	FProjectedTri Tris[MSOC_PATCH_TRIS];
+	int           VertexIds[MSOC_PATCH_TRIS][3];
+	FVertex       Vertices[MSOC_PATCH_TRIS * 3];
+	int           NumTris = 0;
+	int           NumVertices = 0;
 
-	uint32 mask32 = 0;
+	void Reset() { NumTris = NumVertices = 0; }
 
-	auto eval_edge = [&](const __m256& A, const __m256& B, const __m256& C, const __m256& x) -> __m256
+	/**
+	 * @brief 삼각형을 추가
+	 * @return 묶음이 가득 찼거나 이미 있는 정점을 하나도 공유하지 않으면(다른 메시) 추가하지 않고 false
+	 */
+	bool Add(const FProjectedTri& T)
 	{
-#if defined(__FMA__)
-		__m256 t = _mm256_fmadd_ps(A, x, C);      // A*x + C
-		return _mm256_fmadd_ps(B, yv, t);         // B*y + (A*x + C)
-#else
-		__m256 t = _mm256_add_ps(_mm256_mul_ps(A, x), C);
-		return _mm256_add_ps(_mm256_mul_ps(B, yv), t);
-#endif
-	};
+		if (NumTris == MSOC_PATCH_TRIS) return false;
+
+		const FVertex Verts[3] = { { T.x0, T.y0, T.z0 }, { T.x1, T.y1, T.z1 }, { T.x2, T.y2, T.z2 } };
+		int Ids[3];
+		bool bConnected = NumTris == 0;
+		for (int k = 0; k < 3; ++k)
+		{
+			Ids[k] = -1;
+			for (int v = 0; v < NumVertices && Ids[k] < 0; ++v)
+			{
+				if (Vertices[v].X == Verts[k].X && Vertices[v].Y == Verts[k].Y && Vertices[v].Z == Verts[k].Z) Ids[k] = v;
+			}
+			bConnected |= Ids[k] >= 0;
+		}
+		if (!bConnected) return false;
+
+		for (int k = 0; k < 3; ++k)
+		{
+			if (Ids[k] < 0)
+			{
+				Ids[k] = NumVertices;
+				Vertices[NumVertices++] = Verts[k];
+			}
+			VertexIds[NumTris][k] = Ids[k];
+		}
+		Tris[NumTris++] = T;
+		return true;
+	}
+};
 
-	for (int block = 0; block < 4; ++block)
+// 클립 공간 정점 (H = (x,y,z,1) * ViewProj)
+struct FClipVertex { float X, Y, Z, W; };
+
+// D3D 클립 공간 근평면은 z = 0, 이 값보다 작은 w는 나눗셈 안정성을 위해 추가로 거른다
+static constexpr float MSOC_CLIP_MIN_W = 1e-5f;
+
+/**
+ * @brief 삼각형을 근평면(z >= 0)으로 클리핑 (Sutherland-Hodgman, 평면 1개)
+ * @return 결과 볼록 다각형의 정점 수 (0, 3, 4)
+ */
+inline int ClipTriangleNearPlane(const FClipVertex In[3], FClipVertex Out[4])
+{
+	int Count = 0;
+	for (int i = 0; i < 3; ++i)
 	{
-		const __m256 base = _mm256_set1_ps(PxStart + float(block * 8));
-		const __m256 px = _mm256_add_ps(idx, base);
+		const FClipVertex& A = In[i];
+		const FClipVertex& B = In[(i + 1) % 3];
+		const bool bAIn = A.Z >= 0.0f;
+		const bool bBIn = B.Z >= 0.0f;
+
+		if (bAIn)
+		{
+			Out[Count++] = A;
+		}
+		if (bAIn != bBIn)
+		{
+			// 선분 A-B와 z = 0 평면의 교점
+			const float t = A.Z / (A.Z - B.Z);
+			Out[Count++] = {
+				A.X + (B.X - A.X) * t,
+				A.Y + (B.Y - A.Y) * t,
+				0.0f,
+				A.W + (B.W - A.W) * t };
+		}
+	}
+	return Count;
+}
+
+inline bool ClipToScreen(const FClipVertex& H, const FOcclusionViewport& VP, float& outX, float& outY, float& outZ)
+{
+	if (H.W <= MSOC_CLIP_MIN_W) return false;
 
-		const __m256 e0 = eval_edge(A0v, B0v, C0v, px);
-		const __m256 e1 = eval_edge(A1v, B1v, C1v, px);
-		const __m256 e2 = eval_edge(A2v, B2v, C2v, px);
+	const float invW = 1.0f / H.W;
+	outX = VP.TopLeftX + (H.X * invW * 0.5f + 0.5f) * VP.Width;
+	outY = VP.TopLeftY + (-H.Y * invW * 0.5f + 0.5f) * VP.Height;
+	outZ = H.Z * invW * 0.5f + 0.5f;
+	return true;
+}
 
-		const __m256 ge0 = _mm256_cmp_ps(e0, z, _CMP_GE_OQ);
-		const __m256 ge1 = _mm256_cmp_ps(e1, z, _CMP_GE_OQ);
-		const __m256 ge2 = _mm256_cmp_ps(e2, z, _CMP_GE_OQ);
+/**
+ * @brief 근평면 클리핑을 포함한 오클루더 삼각형 셋업
+ * 카메라에 붙어 근평면을 가로지르는 큰 벽/바닥도 버리지 않고 잘라서 사용한다.
+ * 클리핑 결과(최대 사각형)는 팬으로 최대 2개의 삼각형이 된다.
+ * @return Out에 채워진 삼각형 수 (0 ~ 2)
+ */
+inline int ProjectTriangleClipped(const FSoftwareTri& T, const FMatrix& ViewProj, const FOcclusionViewport& VP,
+	FProjectedTri Out[2], int ScreenW, int ScreenH)
+{
+	FClipVertex H[3];
 
-		const __m256 ok = _mm256_and_ps(ge0, _mm256_and_ps(ge1, ge2));
-		const uint32 m8 = static_cast<uint32>(_mm256_movemask_ps(ok)) & 0xFFu;
+	GetOcclusionKernels().TransformTriangle(T, ViewProj, H);
 
-		mask32 |= (m8 << (block * 8));
+	FClipVertex Poly[4];
+	int NumVerts = 3;
+	if (H[0].Z >= 0.0f && H[1].Z >= 0.0f && H[2].Z >= 0.0f)
+	{
+		// 대부분의 삼각형: 클리핑 불필요
+		Poly[0] = H[0];
+		Poly[1] = H[1];
+		Poly[2] = H[2];
 	}
-	return mask32;
+	else
+	{
+		NumVerts = ClipTriangleNearPlane(H, Poly);
+		if (NumVerts < 3) return 0;
+	}
+
+	float Sx[4], Sy[4], Sz[4];
+	for (int i = 0; i < NumVerts; ++i)
+	{
+		if (!ClipToScreen(Poly[i], VP, Sx[i], Sy[i], Sz[i])) return 0;
+	}
+
+	int NumTris = 0;
+	for (int i = 1; i + 1 < NumVerts; ++i)
+	{
+		FProjectedTri& PT = Out[NumTris];
+		PT.x0 = Sx[0];     PT.y0 = Sy[0];     PT.z0 = Sz[0];
+		PT.x1 = Sx[i];     PT.y1 = Sy[i];     PT.z1 = Sz[i];
+		PT.x2 = Sx[i + 1]; PT.y2 = Sy[i + 1]; PT.z2 = Sz[i + 1];
+		if (FinalizeProjectedTri(PT, ScreenW, ScreenH))
+		{
+			++NumTris;
+		}
+	}
+	return NumTris;
 }
-#endif
-// --------------------------------------------------------------------------------------
+
+// 픽셀 중심에서 (half-space) edge test (스칼라 폴백에서 사용)
+inline bool PointInTri(float px, float py, float a[2], float b[2], float c[2])
+{
+	auto edge = [](const float p[2], const float v0[2], const float v1[2])
+		{
+			return (p[1] - v0[1]) * (v1[0] - v0[0]) - (p[0] - v0[0]) * (v1[1] - v0[1]);
+		};
+	float p[2] = { px, py };
+	const float e0 = edge(p, a, b);
+	const float e1 = edge(p, b, c);
+	const float e2 = edge(p, c, a);
+
+	return (e0 >= 0 && e1 >= 0 && e2 >= 0);
+}
+
 
 // 타일 내 32 x 8 coverage
 //TODO SIMD
@@ -474,35 +457,6 @@ inline void BuildConverageMask_Conservative(const FProjectedTri& tri, int tileX,
 	const int lx1 = std::min(MSOC_TILE_W - 1, tri.maxX - x0);
 	const int ly1 = std::min(MSOC_TILE_H - 1, tri.maxY - y0);
 
-#if defined(__AVX2__)
-	// Edge 계수 (반시계 half-space: (x2-x1, y2-y1) × (P - v1) >= 0)
-	// E(P) = A*x + B*y + C,   A = (y1 - y2), B = (x2 - x1), C = x1*y2 - y1*x2
-	const float Ax0 = (A[1] - B[1]), Bx0 = (B[0] - A[0]), Cx0 = (A[0] * B[1] - A[1] * B[0]);
-	const float Ax1 = (B[1] - C[1]), Bx1 = (C[0] - B[0]), Cx1 = (B[0] * C[1] - B[1] * C[0]);
-	const float Ax2 = (C[1] - A[1]), Bx2 = (A[0] - C[0]), Cx2 = (C[0] * A[1] - C[1] * A[0]);
-
-	for (int ry = ly0; ry <= ly1; ++ry)
-	{
-		const float py = float(y0 + ry) + 0.5f;
-		// PxStart = (타일 절대 x 시작 + 0.5)
-		const float PxStart = float(x0) + 0.5f;
-
-		// 32비트 행 마스크 생성 후, [lx0..lx1] 범위만 남김
-		uint32_t rowMask = BuildRowCoverageMask32_AVX2(
-			PxStart, py,
-			Ax0, Bx0, Cx0,
-			Ax1, Bx1, Cx1,
-			Ax2, Bx2, Cx2
-		);
-
-		const uint32_t left = (lx0 == 0) ? 0xFFFFFFFFu : (~0u << lx0);
-		const uint32_t right = (lx1 == 31) ? 0xFFFFFFFFu : (~0u >> (31 - lx1));
-		rowMask &= (left & right);
-
-		outMask[ry] |= rowMask;
-	}
-#else
-	// 스칼라 폴백
 	for (int ry = ly0; ry <= ly1; ++ry)
 	{
 		const float py = (float)(y0 + ry) + 0.5f;
@@ -519,7 +473,6 @@ inline void BuildConverageMask_Conservative(const FProjectedTri& tri, int tileX,
 
 		outMask[ry] |= rowMask;
 	}
-#endif
 }
 
 inline bool IsFullMask(const uint32_t cov[MSOC_TILE_H])
@@ -546,52 +499,32 @@ inline void UpdateTileWithTri(FMaskedTile& tile, const uint32_t cov[MSOC_TILE_H]
 	if (dist1t > dist01)
 	{
 		tile.Z1max = 0.0f;
-#if defined(__AVX2__)
-		// CoverageMask[8] = 0
-		_mm256_store_si256(reinterpret_cast<__m256i*>(tile.CoverageMask), _mm256_setzero_si256());
-#else
 		for (int r = 0; r < MSOC_TILE_H; ++r) tile.CoverageMask[r] = 0u;
-#endif
 		tile.bFullCovered = false;
 	}
 
 	// working 레이어 Z 갱신
 	tile.Z1max = std::max(tile.Z1max, ZtriMax);
 
-#if defined(__AVX2__)
-	// cov(unaligned) | tile.CoverageMask(aligned) → merged
-	const __m256i oldCov = _mm256_load_si256(reinterpret_cast<const __m256i*>(tile.CoverageMask)); // FMaskedTile가 alignas(32)면 OK
-	const __m256i addCov = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cov));               // cov는 로컬 배열 → loadu
-	const __m256i merged = _mm256_or_si256(oldCov, addCov);
-
-	// 저장
-	_mm256_store_si256(reinterpret_cast<__m256i*>(tile.CoverageMask), merged);
+	// cov | tile.CoverageMask → merged (SSE2, 4행씩)
+	__m128i* TileMask = reinterpret_cast<__m128i*>(tile.CoverageMask); // FMaskedTile는 alignas(32)
+	const __m128i merged0 = _mm_or_si128(_mm_load_si128(TileMask), _mm_loadu_si128(reinterpret_cast<const __m128i*>(cov)));
+	const __m128i merged1 = _mm_or_si128(_mm_load_si128(TileMask + 1), _mm_loadu_si128(reinterpret_cast<const __m128i*>(cov + 4)));
+	_mm_store_si128(TileMask, merged0);
+	_mm_store_si128(TileMask + 1, merged1);
 
 	// full mask? (각 lane == 0xFFFFFFFF)
-	const __m256i fullOnes = _mm256_set1_epi32(-1);
-	const __m256i eqFull = _mm256_cmpeq_epi32(merged, fullOnes);
-	const int     allBytes = _mm256_movemask_epi8(eqFull);
+	const __m128i fullOnes = _mm_set1_epi32(-1);
+	const int fullBytes = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi32(merged0, fullOnes), _mm_cmpeq_epi32(merged1, fullOnes)));
 
-	if (allBytes == -1) // 32바이트 전부 0xFF → 8행 모두 full
+	if (fullBytes == 0xFFFF) // 8행 모두 full
 	{
 		tile.Z0max = tile.Z1max;
 		tile.Z1max = 0.0f;
-		_mm256_store_si256(reinterpret_cast<__m256i*>(tile.CoverageMask), _mm256_setzero_si256());
-		tile.bFullCovered = true;
-	}
-#else
-	// 스칼라 폴백
-	for (int r = 0; r < MSOC_TILE_H; ++r)
-		tile.CoverageMask[r] |= cov[r];
-
-	if (IsFullMask(tile.CoverageMask))
-	{
-		tile.Z0max = tile.Z1max;
-		tile.Z1max = 0.f;
-		for (int r = 0; r < MSOC_TILE_H; ++r) tile.CoverageMask[r] = 0u;
+		_mm_store_si128(TileMask, _mm_setzero_si128());
+		_mm_store_si128(TileMask + 1, _mm_setzero_si128());
 		tile.bFullCovered = true;
 	}
-#endif
 }
 
 inline bool RectFullyCoversTile(const FScreenRect& r, int tx, int ty)
@@ -618,7 +551,7 @@ inline uint32_t RowRangeMask_InTile(const FScreenRect& r, int tx)
 	return left & right;
 }
 
-static void AppendAABBAsTris(const FAABB& B, TArray<FSoftwareTri>& Out)
+inline void AppendAABBAsTris(const FAABB& B, TArray<FSoftwareTri>& Out)
 {
 	const FVector mn = B.Min, mx = B.Max;
 
@@ -649,6 +582,30 @@ static void AppendAABBAsTris(const FAABB& B, TArray<FSoftwareTri>& Out)
 	tri(p010, p110, p111); tri(p010, p111, p011);
 }
 
+/**
+ * @brief 백버퍼 해상도와 요청 해상도로부터 오클루전 버퍼 크기를 계산
+ * 요청 박스(InRequestW x InRequestH) 안에 들어가면서 백버퍼 종횡비를 유지하고, 백버퍼보다 커지지는 않는다
+ * @param InRequestW, InRequestH 0 이하이면 백버퍼 해상도를 그대로 사용
+ */
+inline void ComputeOcclusionBufferSize(int InBackBufferW, int InBackBufferH, int InRequestW, int InRequestH,
+	int& OutW, int& OutH)
+{
+	OutW = std::max(1, InBackBufferW);
+	OutH = std::max(1, InBackBufferH);
+	if (InRequestW <= 0 || InRequestH <= 0)
+	{
+		return;
+	}
+
+	const float Scale = std::min({ 1.0f,
+		static_cast<float>(InRequestW) / static_cast<float>(OutW),
+		static_cast<float>(InRequestH) / static_cast<float>(OutH) });
+
+	// 한 타일보다 작아지면 의미가 없으므로 최소 한 타일은 유지
+	OutW = std::max(MSOC_TILE_W, static_cast<int>(std::ceil(OutW * Scale)));
+	OutH = std::max(MSOC_TILE_H, static_cast<int>(std::ceil(OutH * Scale)));
+}
+
 struct FMaskedHiZBuffer
 {
 	int ScreenW = 0, ScreenH = 0;
@@ -680,38 +637,160 @@ struct FMaskedHiZBuffer
 	}
 };
 
+struct FOcclusionBenchmarkResult
+{
+	int    BufferW = 0;
+	int    BufferH = 0;
+	int32  NumTiles = 0;
+	double RasterizeMs = 0.0;
+	// 백버퍼 해상도(기준) 래스터라이즈 시간 / 이 해상도의 래스터라이즈 시간
+	double RasterSpeedup = 1.0;
+	double TestMs = 0.0;
+	double TestBatchMs = 0.0;
+	int32  NumOccluded = 0;
+	// 이 해상도에서만 가려진 박스 수. 타일 층 병합 결과가 해상도마다 달라 생기며,
+	// 보수적 커버리지라 실제로 보이는 박스는 아니다 (MSOCGoldenTests가 정확한 깊이로 확인)
+	int32  NumExtraOccluded = 0;
+	// 백버퍼 해상도에서는 가려지지만 이 해상도에서는 보이는 박스 수 (해상도를 낮춘 대가)
+	int32  NumMissedOccluded = 0;
+};
+
+struct FOcclusionKernelBenchmarkResult
+{
+	ESIMDLevel Level = ESIMDLevel::Scalar;
+	double RasterizeMs = 0.0;
+	double TestBatchMs = 0.0;
+	int32  NumOccluded = 0;
+	// 스칼라 경로와 판정이 다른 박스 수
+	int32  NumMismatched = 0;
+};
+
 class USoftwareOcclusionCuller
 {
 public:
 	void Init(int ScreenW, int ScreenH)
 	{
-		HiZ.Allocate(ScreenW, ScreenH);
-		HiZ.Clear();
+		Resize(ScreenW, ScreenH);
 	}
 
 	void Resize(int ScreenW, int ScreenH)
 	{
-		HiZ.Allocate(ScreenW, ScreenH);
+		BackBufferW = ScreenW;
+		BackBufferH = ScreenH;
+		bRecordCurrentView = false;
+		ReprojectionHistory.Empty();
+
+		int BufferW, BufferH;
+		ComputeOcclusionBufferSize(BackBufferW, BackBufferH, RequestedBufferW, RequestedBufferH, BufferW, BufferH);
+		HiZ.Allocate(BufferW, BufferH);
 		HiZ.Clear();
 	}
 
-	void BeginFrame(const FMatrix& InViewProj, const D3D11_VIEWPORT& InVP)
+	/**
+	 * @brief 오클루전 버퍼 해상도를 백버퍼와 분리해서 지정 (예: 512x256, 1024x512)
+	 * 백버퍼보다 작으면 오클루더를 그 해상도로 보수적으로 래스터라이즈한다 (텍셀을 통째로 덮어야 커버).
+	 * @param InWidth, InHeight 0 이하이면 백버퍼 해상도를 그대로 사용
+	 */
+	void SetBufferResolution(int InWidth, int InHeight)
 	{
-		ViewProj = InViewProj;
-		VP = InVP;
-		HiZ.Clear();
+		RequestedBufferW = InWidth;
+		RequestedBufferH = InHeight;
+		Resize(BackBufferW, BackBufferH);
 	}
 
+	int GetRequestedBufferWidth() const { return RequestedBufferW; }
+	int GetRequestedBufferHeight() const { return RequestedBufferH; }
+
+	// 버퍼가 백버퍼보다 작으면 한 텍셀이 여러 픽셀을 대표하므로 픽셀 중심 샘플 대신 보수적 커버리지를 쓴다
+	bool IsDownsampled() const { return HiZ.ScreenW < BackBufferW || HiZ.ScreenH < BackBufferH; }
+
+	/**
+	 * @param InVP 백버퍼 픽셀 기준 뷰포트 (버퍼 해상도로 스케일해서 쓴다)
+	 * 재투영 이력을 남기지도 쓰지도 않는 단발 프레임 (벤치마크, 장면 하네스)
+	 */
+	void BeginFrame(const FMatrix& InViewProj, const FOcclusionViewport& InVP);
+
+	/**
+	 * @brief 뷰 하나의 프레임 시작
+	 * 재투영 시딩이 켜져 있으면 같은 InViewKey로 그린 직전 프레임의 FULL 타일 깊이를 현재 뷰로 재투영해 버퍼를 미리 채운다.
+	 * 뷰포트마다 다른 키를 쓰면 컬러 하나를 여러 뷰가 번갈아 써도 다른 뷰의 깊이로 시딩하지 않는다.
+	 * @param InInvViewProj InViewProj의 역행렬 (UCamera::GetFViewProjConstantsInverse()의 Projection * View)
+	 */
+	void BeginFrame(const FMatrix& InViewProj, const FMatrix& InInvViewProj, const FOcclusionViewport& InVP, uint32 InViewKey);
+
 	void RasterizeOcculuderTriangles(const TArray<FSoftwareTri>& Tris);
 	bool TestAABB(const FAABB& Box) const;
 
+	/**
+	 * @brief N개의 박스를 한 번에 테스트 (투영은 FCPUFeatures가 고른 SIMD 커널로 4/8/16박스 단위 벡터화)
+	 * @param OutVisibleBits (N + 63) / 64 워드, i번 비트 = 1 이면 i번 박스가 보임(가려지지 않음)
+	 * 래스터라이즈가 끝난 뒤라면 여러 스레드에서 동시에 불러도 된다 (스크래치는 스레드별)
+	 */
+	void TestAABBBatch(const FAABBSoA& Boxes, TArray<uint64>& OutVisibleBits) const;
+
+	/**
+	 * @brief 같은 장면을 여러 버퍼 해상도로 래스터라이즈/테스트하여 비용과 컬링 정확도를 비교
+	 * 첫 결과는 항상 백버퍼 해상도(기준)이며, 나머지는 InSizes 순서를 따른다.
+	 * 래스터라이즈 시간은 여러 번 잰 최솟값이고, RasterSpeedup은 기준 대비 배율이다.
+	 * 모든 박스를 오클루더이자 오클루디로 사용한다.
+	 */
+	static void BenchmarkResolutions(const TArray<FAABB>& Boxes, const FMatrix& InViewProj, const FOcclusionViewport& InVP,
+		int InBackBufferW, int InBackBufferH, const TArray<TPair<int, int>>& InSizes,
+		TArray<FOcclusionBenchmarkResult>& OutResults);
+
+	/**
+	 * @brief 같은 장면을 CPU가 지원하는 SIMD 경로마다 래스터라이즈/배치 테스트
+	 * 끝나면 원래 경로로 되돌린다. 결과의 BufferW/H는 현재 요청 해상도다.
+	 */
+	static void BenchmarkKernels(const TArray<FAABB>& Boxes, const FMatrix& InViewProj, const FOcclusionViewport& InVP,
+		int InBackBufferW, int InBackBufferH, TArray<FOcclusionKernelBenchmarkResult>& OutResults);
+
+	/**
+	 * @brief 이전 프레임 깊이로 버퍼를 시딩할지 여부
+	 * 오클루더를 그리기 전부터 가림이 유지되지만, 급격한 카메라 이동 시 드러난 영역을 잘못 가릴 수 있다.
+	 */
+	void SetReprojectionSeeding(bool bInEnable)
+	{
+		bReprojectionSeeding = bInEnable;
+		bRecordCurrentView = false;
+		ReprojectionHistory.Empty();
+	}
+	bool IsReprojectionSeeding() const { return bReprojectionSeeding; }
+
 	void DebugOverlay() const {}
 
 	const FMaskedHiZBuffer& GetHiZ() const { return HiZ; }
 
 private:
-	FMaskedHiZBuffer HiZ;
-	FMatrix          ViewProj;
-	D3D11_VIEWPORT   VP{};
-};
+	FMaskedHiZBuffer   HiZ;
+	FMatrix            ViewProj;
+	FOcclusionViewport VP; // 버퍼 해상도 기준
+
+	int BackBufferW = 0;
+	int BackBufferH = 0;
+	int RequestedBufferW = MSOC_DEFAULT_BUFFER_W;
+	int RequestedBufferH = MSOC_DEFAULT_BUFFER_H;
+
+	void RasterizeCoverage(const FCoverageEdges& Edges, float ZMax);
+	void RasterizePatchBatch(const FOccluderPatchBatch& Batch);
+	bool TestScreenRect(const FScreenRect& R) const;
 
+	// 재투영 시딩: 뷰별 직전 프레임 결과
+	struct FReprojectionHistory
+	{
+		FMatrix            InvViewProj;
+		FOcclusionViewport VP;    // 버퍼 해상도 기준
+		TArray<float>      TileZ; // 타일별 Z0max (FULL이 아닌 타일은 1.0)
+	};
+
+	bool    bReprojectionSeeding = false;
+	// 현재 버퍼를 다음 BeginFrame에서 CurrentViewKey의 이력으로 남길지
+	bool    bRecordCurrentView = false;
+	uint32  CurrentViewKey = 0;
+	FMatrix CurrentInvViewProj;
+	TMap<uint32, FReprojectionHistory> ReprojectionHistory;
+
+	void SetupView(const FMatrix& InViewProj, const FOcclusionViewport& InVP);
+	void SaveReprojectionHistory();
+	void SeedFromHistory(const FReprojectionHistory& InHistory);
+};
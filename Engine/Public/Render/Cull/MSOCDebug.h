@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Render/Cull/MSOC.h"
+
+/**
+ * @brief GPU 없이 MSOC를 돌려보기 위한 스크립트 장면
+ * 텍스트 형식 (한 줄에 하나, '#' 이후는 주석):
+ *   camera   <x y z> <pitch yaw roll(deg)> <fovY(deg)> <near> <far>
+ *   screen   <W> <H>                  백버퍼 해상도
+ *   buffer   <W> <H>                  오클루전 버퍼 해상도 (0 0 = 백버퍼)
+ *   occluder <minX minY minZ> <maxX maxY maxZ>
+ *   occludee <minX minY minZ> <maxX maxY maxZ> [visible|occluded]   기대값이 있으면 회귀 검사에 사용
+ */
+struct FOcclusionScene
+{
+	FVector CameraLocation = FVector(0.0f, 0.0f, 0.0f);
+	FVector CameraRotation = FVector(0.0f, 0.0f, 0.0f);
+	float   FovY = 90.0f;
+	float   NearZ = 0.1f;
+	float   FarZ = 100.0f;
+
+	int32 ScreenW = 1280;
+	int32 ScreenH = 720;
+	int32 BufferW = MSOC_DEFAULT_BUFFER_W;
+	int32 BufferH = MSOC_DEFAULT_BUFFER_H;
+
+	TArray<FAABB> Occluders;
+	TArray<FAABB> Occludees;
+	// 0 = 기대값 없음, 1 = 보여야 함, 2 = 가려져야 함
+	TArray<uint8> Expected;
+
+	/** UCamera::UpdateMatrixByPers와 같은 규칙으로 ViewProj 생성 */
+	FMatrix BuildViewProj() const;
+	/** UCamera::GetFViewProjConstantsInverse와 같은 규칙으로 ViewProj의 역행렬 생성 (재투영 시딩용) */
+	FMatrix BuildViewProjInverse() const;
+};
+
+struct FOcclusionHarnessReport
+{
+	double RasterizeMs = 0.0;
+	double TestMs = 0.0;
+	int32  NumOccluded = 0;
+	// 기대값과 다르게 판정된 오클루디 수
+	int32  NumMismatched = 0;
+	TArray<uint8> Occluded;
+};
+
+/**
+ * @brief MSOC 튜닝/회귀 확인용 헤드리스 하니스와 버퍼 덤프
+ * 덤프는 8bit PGM(P5)으로 기록하며 크기는 오클루전 버퍼 해상도다.
+ */
+class FOcclusionHarness
+{
+public:
+	static bool LoadScene(const FString& InFilePath, FOcclusionScene& OutScene);
+
+	/** 장면의 오클루더를 래스터라이즈하고 오클루디를 테스트, 단계별 시간을 측정 */
+	static void Run(const FOcclusionScene& InScene, USoftwareOcclusionCuller& OutCuller, FOcclusionHarnessReport& OutReport);
+
+	/** 255 = FULL 타일(Reference 레이어), 128 = Working 레이어 커버 픽셀, 0 = 빈 픽셀 */
+	static bool WriteCoveragePGM(const FMaskedHiZBuffer& InHiZ, const FString& InFilePath);
+
+	/** 타일별 Z0max(bWorkingLayer=false) 또는 Z1max를 0~255로 기록, 가까울수록 어둡다 */
+	static bool WriteTileDepthPGM(const FMaskedHiZBuffer& InHiZ, const FString& InFilePath, bool bWorkingLayer);
+
+	/** <Prefix>_coverage.pgm, <Prefix>_z0.pgm, <Prefix>_z1.pgm */
+	static bool DumpBuffer(const FMaskedHiZBuffer& InHiZ, const FString& InPrefix);
+
+private:
+	static bool WritePGM(const FString& InFilePath, int32 InWidth, int32 InHeight, const TArray<uint8>& InPixels);
+};
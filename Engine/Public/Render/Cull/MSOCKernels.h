@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Global/CPUFeatures.h"
+
+struct FAABB;
+struct FSoftwareTri;
+struct FCoverageEdges;
+struct FClipVertex;
+struct FScreenRect;
+struct FAABBSoA;
+struct FOcclusionViewport;
+
+/**
+ * @brief MSOC 핫 루프 커널 테이블
+ * ESIMDLevel마다 하나씩 있고, FCPUFeatures::GetActiveLevel()로 고른다.
+ * 상위 명령어 집합 커널은 해당 플래그로만 컴파일한 TU에 있으므로 엔진의 나머지는 기본 명령어 집합(SSE2)으로 빌드된다.
+ */
+struct FOcclusionKernels
+{
+	ESIMDLevel Level;
+
+	/** 타일(32x8) 하나의 픽셀 중심 커버리지 마스크 (볼록 다각형, 에지 InEdges.NumEdges개) */
+	void (*BuildCoverageMask)(const FCoverageEdges& InEdges, int InTileX, int InTileY, uint32 OutMask[8]);
+
+	/**
+	 * @brief 박스 전체의 스크린 사각형과 최소 깊이를 계산
+	 * OutValid[i] == 0 이면 투영 실패(카메라 뒤로 걸침) 또는 빈 사각형
+	 */
+	void (*ProjectAABBs)(const FAABBSoA& InBoxes, const FMatrix& InViewProj, const FOcclusionViewport& InVP,
+		int InScreenW, int InScreenH, FScreenRect* OutRects, uint8* OutValid);
+
+	/** 박스 하나의 ProjectAABBs, 같은 경로의 배치 결과와 비트 단위로 같다 */
+	bool (*ProjectAABB)(const FAABB& InBox, const FMatrix& InViewProj, const FOcclusionViewport& InVP,
+		int InScreenW, int InScreenH, FScreenRect& OutRect);
+
+	/** 삼각형 세 정점을 클립 공간으로 변환 (행 벡터 * InViewProj) */
+	void (*TransformTriangle)(const FSoftwareTri& InTri, const FMatrix& InViewProj, FClipVertex OutVerts[3]);
+};
+
+const FOcclusionKernels& GetOcclusionKernels();
+const FOcclusionKernels& GetOcclusionKernels(ESIMDLevel InLevel);
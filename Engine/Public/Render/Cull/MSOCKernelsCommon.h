@@ -0,0 +1,118 @@
+#pragma once
+#include "Render/Cull/MSOC.h"
+#include "Render/Cull/MSOCKernels.h"
+
+#include <immintrin.h>
+
+/**
+ * MSOC 커널 TU 공용 헬퍼와 명령어 집합별 커널 선언
+ * SSE4.1/AVX2/AVX-512 커널은 각자 해당 명령어 집합 플래그로 컴파일되는 TU(MSOCKernels*.cpp)에 있고,
+ * MSOCKernels.cpp의 테이블이 이들을 모은다. 커널 TU에서 만든 inline 함수 사본을 링커가 다른 TU에 쓸 수 있으므로
+ * 커널 TU는 pch 없이 빌드하고, 헬퍼는 아래처럼 익명 네임스페이스(TU 전용)에 둔다.
+ */
+
+static_assert(MSOC_TILE_W == 32 && MSOC_TILE_H == 8, "커버리지 커널은 32x8 타일을 가정한다");
+
+// ─────────────────────────────────────────────────────────────
+// 공통 셋업
+//   E(P) = A*x + B*y + C >= 0 (모든 에지) 이면 픽셀 중심이 다각형 안
+//   에지 계수는 다각형마다 한 번 SetupCoverageEdges(MSOC.h)로 만들고, 여기서는 타일 범위만 계산
+// ─────────────────────────────────────────────────────────────
+namespace
+{
+	struct FCoverageSetup
+	{
+		int X0, Y0;
+		int LX0, LY0, LX1, LY1;
+		uint32 RangeMask;
+	};
+
+	FORCEINLINE void SetupCoverage(const FCoverageEdges& Edges, int TileX, int TileY, FCoverageSetup& S)
+	{
+		S.X0 = TileX * MSOC_TILE_W;
+		S.Y0 = TileY * MSOC_TILE_H;
+
+		// 다각형 AABB와 타일 경계의 교집합 (타일 로컬 좌표)
+		S.LX0 = std::max(0, Edges.minX - S.X0);
+		S.LY0 = std::max(0, Edges.minY - S.Y0);
+		S.LX1 = std::min(MSOC_TILE_W - 1, Edges.maxX - S.X0);
+		S.LY1 = std::min(MSOC_TILE_H - 1, Edges.maxY - S.Y0);
+
+		const uint32 Left = (S.LX0 <= 0) ? 0xFFFFFFFFu : (~0u << S.LX0);
+		const uint32 Right = (S.LX1 >= 31) ? 0xFFFFFFFFu : (~0u >> (31 - S.LX1));
+		S.RangeMask = (S.LX0 <= S.LX1) ? (Left & Right) : 0u;
+	}
+
+	// 8개 코너 = (Min/Max)^3 조합
+	FORCEINLINE void CornerOfBox(int Corner, const float Lo[3], const float Hi[3], float& X, float& Y, float& Z)
+	{
+		X = (Corner & 1) ? Hi[0] : Lo[0];
+		Y = (Corner & 2) ? Hi[1] : Lo[1];
+		Z = (Corner & 4) ? Hi[2] : Lo[2];
+	}
+
+	/** SIMD 폭만큼 박스 SoA를 복사 (끝 묶음은 0 패딩) */
+	template <int Width>
+	FORCEINLINE const float* const* GatherBoxLanes(const FAABBSoA& Boxes, int32 Base, int32 Count,
+		float (&Scratch)[6][Width], const float* (&Src)[6])
+	{
+		Src[0] = Boxes.MinX.data() + Base; Src[1] = Boxes.MinY.data() + Base; Src[2] = Boxes.MinZ.data() + Base;
+		Src[3] = Boxes.MaxX.data() + Base; Src[4] = Boxes.MaxY.data() + Base; Src[5] = Boxes.MaxZ.data() + Base;
+		if (Count < Width)
+		{
+			for (int k = 0; k < 6; ++k)
+			{
+				for (int i = 0; i < Width; ++i) Scratch[k][i] = (i < Count) ? Src[k][i] : 0.0f;
+				Src[k] = Scratch[k];
+			}
+		}
+		return Src;
+	}
+
+	/** 4 lane 최솟값/최댓값을 모든 lane에 (SSE2) */
+	FORCEINLINE __m128 HorizontalMin(__m128 V)
+	{
+		V = _mm_min_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_min_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+
+	FORCEINLINE __m128 HorizontalMax(__m128 V)
+	{
+		V = _mm_max_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_max_ps(V, _mm_shuffle_ps(V, V, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+
+	/** 벡터 경로가 저장한 lane 결과를 FScreenRect로 기록 */
+	FORCEINLINE void WriteRects(int32 Base, int32 Count, const int32* X0, const int32* Y0, const int32* X1, const int32* Y1,
+		const float* ZMin, uint32 BehindMask, FScreenRect* OutRects, uint8* OutValid)
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FScreenRect& R = OutRects[Base + i];
+			R = { X0[i], Y0[i], X1[i], Y1[i], ZMin[i] };
+			OutValid[Base + i] = !(BehindMask & (1u << i)) && R.x0 <= R.x1 && R.y0 <= R.y1;
+		}
+	}
+}
+
+// ─────────────────────────────────────────────────────────────
+// 명령어 집합별 커널
+// ─────────────────────────────────────────────────────────────
+void BuildCoverageMask_SSE41(const FCoverageEdges& Edges, int TileX, int TileY, uint32 OutMask[8]);
+void ProjectAABBs_SSE41(const FAABBSoA& Boxes, const FMatrix& Mat, const FOcclusionViewport& VP,
+	int ScreenW, int ScreenH, FScreenRect* OutRects, uint8* OutValid);
+bool ProjectAABB_SSE41(const FAABB& Box, const FMatrix& Mat, const FOcclusionViewport& VP,
+	int ScreenW, int ScreenH, FScreenRect& OutRect);
+void TransformTriangle_SSE41(const FSoftwareTri& Tri, const FMatrix& Mat, FClipVertex OutVerts[3]);
+
+void BuildCoverageMask_AVX2(const FCoverageEdges& Edges, int TileX, int TileY, uint32 OutMask[8]);
+void ProjectAABBs_AVX2(const FAABBSoA& Boxes, const FMatrix& Mat, const FOcclusionViewport& VP,
+	int ScreenW, int ScreenH, FScreenRect* OutRects, uint8* OutValid);
+bool ProjectAABB_AVX2(const FAABB& Box, const FMatrix& Mat, const FOcclusionViewport& VP,
+	int ScreenW, int ScreenH, FScreenRect& OutRect);
+
+void BuildCoverageMask_AVX512(const FCoverageEdges& Edges, int TileX, int TileY, uint32 OutMask[8]);
+void ProjectAABBs_AVX512(const FAABBSoA& Boxes, const FMatrix& Mat, const FOcclusionViewport& VP,
+	int ScreenW, int ScreenH, FScreenRect* OutRects, uint8* OutValid);
+bool ProjectAABB_AVX512(const FAABB& Box, const FMatrix& Mat, const FOcclusionViewport& VP,
+	int ScreenW, int ScreenH, FScreenRect& OutRect);
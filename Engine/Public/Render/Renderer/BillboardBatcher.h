@@ -0,0 +1,75 @@
+#pragma once
+#include "Global/Vector.h"
+
+/**
+ * @brief TextureShader 정점 한 개 (빌보드 한 장 = 삼각형 2개 = 6개)
+ * UV는 스프라이트 UV 사각형을 이미 적용한 값이고, 색/UUID도 정점에 넣어 상수 버퍼 없이 그린다.
+ */
+struct FBillboardVertex
+{
+	FVector Position;
+	FVector2 UV;
+	FVector4 Color;
+	uint32 UUID = 0;
+};
+
+static_assert(sizeof(FBillboardVertex) == 40, "FBillboardVertex는 TextureShader 입력 레이아웃(40바이트)과 같아야 합니다");
+
+/**
+ * @brief 같은 스프라이트 텍스처를 쓰는 빌보드 묶음 = Draw 1회
+ */
+struct FBillboardBatch
+{
+	ID3D11ShaderResourceView* Texture = nullptr;
+	uint32 FirstVertex = 0;	// GetVertices() 기준
+	uint32 NumVertices = 0;
+};
+
+/**
+ * @brief 뷰포트 하나의 빌보드를 텍스처별로 묶어 하나의 정점 배열로 펼치는 CPU 전용 모듈
+ * 디바이스를 참조하지 않으므로 렌더러 없이 단독으로 검증할 수 있다.
+ *
+ * 뒤→앞으로 정렬된 순서대로 AddSprite()를 부르면, 텍스처 안에서는 그 순서가 유지되고
+ * 텍스처끼리는 처음 등장한(가장 먼) 순서로 놓인다. 서로 다른 텍스처가 겹치는 곳의 블렌딩 순서는
+ * 드로우 수와 맞바꾼 것이다 (에디터 아이콘은 대부분 겹치지 않는다).
+ *
+ * 사용 순서: Reset() → AddSprite() 반복 → Build() → GetBatches()/GetVertices()
+ */
+class FBillboardBatcher
+{
+public:
+	void Reset();
+
+	/**
+	 * @param InRight/InUp 카메라를 향한 평면의 단위 축
+	 * @param InUVRect     (U, V, UL, VL)
+	 */
+	void AddSprite(ID3D11ShaderResourceView* InTexture, const FVector& InCenter, const FVector& InRight, const FVector& InUp,
+		float InHalfWidth, float InHalfHeight, const FVector4& InUVRect, const FVector4& InColor, uint32 InUUID);
+
+	void Build();
+
+	const TArray<FBillboardBatch>& GetBatches() const { return Batches; }
+	const TArray<FBillboardVertex>& GetVertices() const { return Vertices; }
+
+	int32 GetNumSprites() const { return static_cast<int32>(Sprites.size()); }
+
+	static constexpr uint32 VerticesPerSprite = 6;
+
+private:
+	struct FPendingSprite
+	{
+		ID3D11ShaderResourceView* Texture;
+		uint32 BatchIndex;
+		FVector Corners[4];		// 좌하, 우하, 우상, 좌상
+		FVector4 UVRect;
+		FVector4 Color;
+		uint32 UUID;
+	};
+
+	TArray<FPendingSprite> Sprites;
+	TMap<ID3D11ShaderResourceView*, uint32> BatchIndexByTexture;
+
+	TArray<FBillboardBatch> Batches;
+	TArray<FBillboardVertex> Vertices;
+};
@@ -25,7 +25,6 @@ public:
 	ID3D11RenderTargetView* GetRenderTargetView() const { return FrameBufferRTV; }
 	ID3D11RenderTargetView* GetIdBufferRTV() const { return IdBufferRTV; }
 	ID3D11Texture2D* GetIdBuffer() const { return IdBuffer; }
-	ID3D11Texture2D* GetIdStagingBuffer() const { return IdStagingBuffer; }
 	ID3D11DepthStencilView* GetDepthStencilView() const { return DepthStencilView; }
 	const D3D11_VIEWPORT& GetViewportInfo() const { return ViewportInfo; }
 	void UpdateViewport();
@@ -38,7 +37,6 @@ private:
 	ID3D11Texture2D* FrameBuffer = nullptr;
 	ID3D11RenderTargetView* FrameBufferRTV = nullptr;
 	ID3D11Texture2D* IdBuffer = nullptr;
-	ID3D11Texture2D* IdStagingBuffer = nullptr;
 	ID3D11RenderTargetView* IdBufferRTV = nullptr;
 
 	ID3D11Texture2D* DepthBuffer = nullptr;
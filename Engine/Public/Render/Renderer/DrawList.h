@@ -0,0 +1,129 @@
+#pragma once
+#include "Global/CoreMinimal.h"
+
+/**
+ * @brief 드로우 리스트의 패스 순서 (정렬 키 최상위 비트)
+ */
+enum class EDrawPass : uint8
+{
+	Opaque = 0,
+	Billboard = 1,
+	Text = 2,
+};
+
+/**
+ * @brief 정렬 키 + 호출자 정의 페이로드(보통 원본 배열 인덱스)
+ */
+struct FDrawCommand
+{
+	uint64 SortKey = 0;
+	uint32 Payload = 0;
+};
+
+/**
+ * @brief 64비트 정렬 키 레이아웃
+ *
+ * 불투명 (상태 우선, 같은 상태 안에서 앞→뒤)
+ *   [63:62 Pass][61:56 Pipeline][55:42 Mesh][41:36 Section][35:24 Material][23:0 Depth]
+ *
+ * 반투명 (뒤→앞 우선, 같은 깊이 안에서 상태)
+ *   [63:62 Pass][61:38 ~Depth][37:32 Pipeline][31:18 Mesh][17:12 Section][11:0 Material]
+ *
+ * Mesh/Material은 FDrawList가 필드마다 따로 프레임마다 발급하는 조밀한 번호다.
+ * MakeOpaque/MakeTranslucent는 범위를 넘는 값을 최댓값으로 자른다. 잘린 키끼리는 상태가 섞이므로
+ * FDrawList는 넘침을 기록해 두었다가 Sort()에서 잘리지 않은 값으로 비교하는 정렬로 바꾼다.
+ */
+namespace DrawSortKey
+{
+	constexpr uint32 PipelineBits = 6;
+	constexpr uint32 MeshBits = 14;
+	constexpr uint32 SectionBits = 6;
+	constexpr uint32 MaterialBits = 12;
+	constexpr uint32 DepthBits = 24;
+
+	/**
+	 * @brief 양수 float의 비트 패턴은 크기 순서와 같으므로 상위 24비트를 깊이로 쓴다
+	 * 음수(카메라 뒤)는 0으로 잘린다. 거리 제곱을 넣어도 순서는 같다.
+	 */
+	uint32 QuantizeDepth(float InDepth);
+
+	uint64 MakeOpaque(uint32 InPipeline, uint32 InMesh, uint32 InSection, uint32 InMaterial, float InDepth);
+	uint64 MakeTranslucent(EDrawPass InPass, uint32 InPipeline, uint32 InMesh, uint32 InSection, uint32 InMaterial, float InDepth);
+
+	inline EDrawPass GetPass(uint64 InKey) { return static_cast<EDrawPass>(InKey >> 62); }
+}
+
+/**
+ * @brief 정렬 키 배열을 오름차순으로 안정 정렬 (8비트씩 LSD 기수 정렬)
+ * 모든 키에서 같은 바이트는 건너뛰며, 개수가 많으면 히스토그램/분배를 ParallelFor로 나눠 처리한다.
+ * @param InOutCommands 정렬 대상 (결과도 여기에)
+ * @param InScratch     InOutCommands와 같은 크기로 맞춰 쓰는 임시 버퍼
+ */
+void RadixSortDrawCommands(TArray<FDrawCommand>& InOutCommands, TArray<FDrawCommand>& InScratch, bool bInForceSingleThread = false);
+
+struct FDrawListBenchmarkResult
+{
+	int32  NumCommands = 0;
+	double BuildMs = 0.0;
+	double RadixSortMs = 0.0;
+	double RadixSortSingleThreadMs = 0.0;
+	double StdSortMs = 0.0;
+	bool   bMatchesStdSort = false;
+};
+
+/**
+ * @brief 한 패스의 드로우 명령을 모아 정렬 키 순서로 돌려주는 빌더
+ * 디바이스를 참조하지 않으므로 렌더러 없이 단독으로 검증할 수 있다.
+ *
+ * 사용 순서: Reset() → AddOpaque()/AddTranslucent() 반복 → Sort() → GetCommands() 순회
+ */
+class FDrawList
+{
+public:
+	void Reset();
+
+	/** 메시 포인터마다 이번 프레임에서 처음 본 순서대로 1부터 번호를 준다 (nullptr은 0) */
+	uint32 GetMeshId(const void* InMesh);
+
+	/** 머티리얼(텍스처 등) 포인터 번호. 메시와 따로 세므로 각 필드가 자기 비트 수를 온전히 쓴다 */
+	uint32 GetMaterialId(const void* InMaterial);
+
+	/** 이번 프레임에 키 필드 범위를 넘은 값이 있었는지 (true면 Sort()가 느린 비교 정렬을 쓴다) */
+	bool HasFieldOverflow() const { return bFieldOverflow; }
+
+	void AddOpaque(uint32 InPipeline, const void* InMesh, uint32 InSection, const void* InMaterial, float InDepth, uint32 InPayload);
+	void AddTranslucent(EDrawPass InPass, uint32 InPipeline, const void* InMesh, uint32 InSection, const void* InMaterial,
+		float InDepth, uint32 InPayload);
+
+	void Sort();
+
+	const TArray<FDrawCommand>& GetCommands() const { return Commands; }
+	int32 Num() const { return static_cast<int32>(Commands.size()); }
+
+	/** 무작위 상태/깊이를 가진 명령 InNum개로 빌드와 정렬(기수 정렬 vs std::sort) 비용을 잰다 */
+	static void Benchmark(int32 InNum, FDrawListBenchmarkResult& OutResult);
+
+private:
+	/** 키에 잘려 들어가기 전의 상태 값 (Commands와 같은 순서) */
+	struct FFullState
+	{
+		uint32 Pipeline;
+		uint32 Mesh;
+		uint32 Section;
+		uint32 Material;
+	};
+
+	static uint32 GetStateId(TMap<const void*, uint32>& InOutIds, const void* InState);
+	void AddCommand(uint64 InSortKey, const FFullState& InState, uint32 InPayload);
+
+	/** 넘친 필드가 있을 때: 키 대신 FullStates로 같은 순서 규칙을 따라 안정 정렬 */
+	void SortWithFullStates();
+
+	TArray<FDrawCommand> Commands;
+	TArray<FDrawCommand> Scratch;
+	TArray<FFullState> FullStates;
+	TArray<uint32> SortOrder;
+	TMap<const void*, uint32> MeshIds;
+	TMap<const void*, uint32> MaterialIds;
+	bool bFieldOverflow = false;
+};
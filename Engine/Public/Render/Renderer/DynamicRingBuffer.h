@@ -0,0 +1,41 @@
+#pragma once
+
+/**
+ * @brief 매 프레임 CPU가 채우는 동적 정점 버퍼를 링처럼 이어서 쓰는 버퍼
+ *
+ * 앞에서부터 D3D11_MAP_WRITE_NO_OVERWRITE로 덧붙이고, 끝에 닿으면 WRITE_DISCARD로 처음부터 다시 쓴다.
+ * 같은 프레임의 여러 뷰포트가 한 버퍼를 나눠 쓰므로 업로드마다 버퍼 이름 바꾸기(DISCARD)가 일어나지 않는다.
+ * 한 번에 쓸 양이 용량보다 크면 두 배 이상으로 다시 만든다.
+ */
+class FDynamicRingBuffer
+{
+public:
+	FDynamicRingBuffer() = default;
+	~FDynamicRingBuffer() { Release(); }
+
+	FDynamicRingBuffer(const FDynamicRingBuffer&) = delete;
+	FDynamicRingBuffer& operator=(const FDynamicRingBuffer&) = delete;
+
+	void Release();
+
+	/**
+	 * @brief InData를 링에 복사하고 시작 위치를 InStride 단위 원소 번호로 돌려준다 (Draw의 StartVertexLocation 등)
+	 * @return 버퍼 생성/Map 실패 시 false
+	 */
+	bool Write(ID3D11Device* InDevice, ID3D11DeviceContext* InContext, const void* InData, uint32 InCount, uint32 InStride,
+		uint32& OutFirstElement);
+
+	ID3D11Buffer* GetBuffer() const { return Buffer; }
+	uint32 GetCapacityBytes() const { return CapacityBytes; }
+
+	/** 마지막 Write가 DISCARD였는지 (링이 한 바퀴 돌았거나 버퍼를 새로 만든 경우) */
+	bool WasLastWriteDiscard() const { return bLastWriteDiscard; }
+
+private:
+	bool EnsureCapacity(ID3D11Device* InDevice, uint32 InRequiredBytes);
+
+	ID3D11Buffer* Buffer = nullptr;
+	uint32 CapacityBytes = 0;
+	uint32 CursorBytes = 0;
+	bool bLastWriteDiscard = false;
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+/**
+ * @brief 피킹용 ID 버퍼를 CPU로 읽어오는 모듈
+ *
+ * 전체 화면을 CopyResource → 즉시 Map(READ) 하면 CPU가 GPU를 기다리며 멈춘다. 대신
+ * 1) 매 프레임 커서 주변 RegionSize x RegionSize 영역만 CopySubresourceRegion으로 스테이징 링에 복사하고,
+ * 2) 이전 프레임들에 복사한 슬롯을 D3D11_MAP_FLAG_DO_NOT_WAIT로 수거한다 (1~2 프레임 지연).
+ * 피킹 지점이 수거된 영역 안이면 CPU 배열 조회로 끝나고, 밖이면(커서가 크게 튄 경우) 그 지점 주변만 복사해 기다린다.
+ */
+class FIdReadback
+{
+public:
+	static constexpr uint32 NumStagingSlots = 3;
+	static constexpr int32 RegionSize = 32;
+
+	FIdReadback() = default;
+	~FIdReadback() { Release(); }
+
+	FIdReadback(const FIdReadback&) = delete;
+	FIdReadback& operator=(const FIdReadback&) = delete;
+
+	void Release();
+
+	/** ID 버퍼를 다시 만든 뒤(리사이즈) 호출: 이전 크기 기준의 결과를 버린다 */
+	void Invalidate();
+
+	/**
+	 * @brief 프레임 끝(ID 버퍼 렌더링 이후)에 호출
+	 * 끝난 복사를 기다리지 않고 수거한 뒤, 커서 주변 영역 복사를 새로 요청한다
+	 */
+	void Tick(ID3D11Device* InDevice, ID3D11DeviceContext* InContext, ID3D11Texture2D* InIdBuffer, int32 InCursorX, int32 InCursorY);
+
+	/** 마지막으로 수거한 영역 안이면 ID를 돌려준다 (GPU 접근 없음) */
+	bool TryGetId(int32 InX, int32 InY, uint32& OutId) const;
+
+	/** 요청 시 모드: InX, InY 주변 영역만 복사하고 결과를 기다린다 (전체 화면 대비 수 KB) */
+	bool ReadIdImmediate(ID3D11Device* InDevice, ID3D11DeviceContext* InContext, ID3D11Texture2D* InIdBuffer,
+		int32 InX, int32 InY, uint32& OutId);
+
+private:
+	struct FStagingSlot
+	{
+		ID3D11Texture2D* Staging = nullptr;
+		D3D11_BOX Region = {};
+		bool bPending = false;
+	};
+
+	static bool MakeRegion(ID3D11Texture2D* InIdBuffer, int32 InCenterX, int32 InCenterY, D3D11_BOX& OutRegion);
+	bool EnsureStaging(ID3D11Device* InDevice, ID3D11Texture2D*& InOutStaging);
+	void Resolve(const D3D11_MAPPED_SUBRESOURCE& InMapped, const D3D11_BOX& InRegion);
+
+	FStagingSlot Slots[NumStagingSlots];
+	uint32 WriteSlot = 0;
+
+	// ReadIdImmediate 전용 (링 슬롯의 순서를 흐트리지 않도록 분리)
+	ID3D11Texture2D* ImmediateStaging = nullptr;
+
+	// 마지막으로 수거한 영역 (ID 버퍼 픽셀 좌표)
+	TArray<uint32> ResolvedIds;
+	D3D11_BOX ResolvedRegion = {};
+	bool bHasResolved = false;
+};
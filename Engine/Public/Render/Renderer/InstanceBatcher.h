@@ -0,0 +1,102 @@
+#pragma once
+#include "Global/CoreMinimal.h"
+#include "Render/Renderer/DrawList.h"
+
+class UStaticMesh;
+class UMaterial;
+
+/**
+ * @brief StaticMeshShader의 StructuredBuffer<FInstanceData> 한 원소
+ * HLSL 쪽 레이아웃과 같아야 한다 (16바이트 단위).
+ */
+struct FInstanceGPUData
+{
+	FMatrix World;
+	FVector4 Color;
+	uint32 UUID = 0;
+	uint32 Pad[3] = {};
+};
+
+static_assert(sizeof(FInstanceGPUData) % 16 == 0, "FInstanceGPUData는 16바이트 배수여야 합니다");
+
+/**
+ * @brief 같은 (메시, 섹션, 머티리얼)을 쓰는 인스턴스 묶음 = DrawIndexedInstanced 1회
+ */
+struct FInstanceBatch
+{
+	UStaticMesh* Mesh = nullptr;
+	int32 SectionIndex = 0;
+	const UMaterial* Material = nullptr;
+
+	uint32 IndexStart = 0;
+	uint32 IndexCount = 0;
+
+	/** 메시별 인스턴스 배열 안에서의 시작 위치 (셰이더의 InstanceOffset) */
+	uint32 FirstInstance = 0;
+	uint32 NumInstances = 0;
+};
+
+/**
+ * @brief 한 메시의 인스턴스 데이터 구간
+ * 메시마다 구조화 버퍼가 하나이므로 업로드는 이 단위로 한 번씩 한다.
+ */
+struct FInstanceMeshRange
+{
+	UStaticMesh* Mesh = nullptr;
+	uint32 FirstInstance = 0;	// GetInstanceData() 기준
+	uint32 NumInstances = 0;
+	int32 FirstBatch = 0;		// GetBatches() 기준
+	int32 NumBatches = 0;
+};
+
+/**
+ * @brief 보이는 스태틱 메시 섹션을 (메시, 섹션, 머티리얼)로 묶고 인스턴스 데이터를 채우는 CPU 전용 모듈
+ * 디바이스를 참조하지 않으므로 렌더러 없이 단독으로 검증할 수 있다.
+ *
+ * 사용 순서: Reset() → AddInstance() 반복 → Build() → GetMeshRanges()/GetBatches()/GetInstanceData()
+ */
+class FInstanceBatcher
+{
+public:
+	void Reset();
+
+	/**
+	 * @param InViewDepth 카메라 전방 축 기준 깊이. 같은 배치 안의 인스턴스를 앞→뒤로 놓는 데만 쓴다
+	 */
+	void AddInstance(UStaticMesh* InMesh, int32 InSectionIndex, const UMaterial* InMaterial,
+		uint32 InIndexStart, uint32 InIndexCount, const FMatrix& InWorld, uint32 InUUID, float InViewDepth,
+		const FVector4& InColor = FVector4(1.0f, 1.0f, 1.0f, 1.0f));
+
+	/**
+	 * @brief 불투명 정렬 키로 기수 정렬해 메시 → 섹션 → 머티리얼 → 깊이 순으로 연속된 인스턴스 배열과 배치 목록을 만든다
+	 * 키의 상태 번호가 범위를 넘어 겹쳐도 묶기는 실제 포인터로 비교하므로 배치가 나뉠 뿐 잘못 합쳐지지 않는다.
+	 */
+	void Build();
+
+	const TArray<FInstanceMeshRange>& GetMeshRanges() const { return MeshRanges; }
+	const TArray<FInstanceBatch>& GetBatches() const { return Batches; }
+	const TArray<FInstanceGPUData>& GetInstanceData() const { return InstanceData; }
+
+	int32 GetNumPendingInstances() const { return static_cast<int32>(Pending.size()); }
+
+private:
+	struct FPendingInstance
+	{
+		UStaticMesh* Mesh;
+		const UMaterial* Material;
+		int32 SectionIndex;
+		uint32 IndexStart;
+		uint32 IndexCount;
+		uint32 UUID;
+		float ViewDepth;
+		FMatrix World;
+		FVector4 Color;
+	};
+
+	TArray<FPendingInstance> Pending;
+	FDrawList DrawList;
+
+	TArray<FInstanceMeshRange> MeshRanges;
+	TArray<FInstanceBatch> Batches;
+	TArray<FInstanceGPUData> InstanceData;
+};
@@ -1,4 +1,38 @@
 #pragma once
+#include "Global/PipelineType.h"
+#include "Render/Renderer/PipelineStateCache.h"
+
+/**
+ * @brief IPipelineContext의 D3D11 구현 (핸들을 D3D 타입으로 되돌려 ID3D11DeviceContext로 그대로 전달)
+ */
+class FD3D11PipelineContext : public IPipelineContext
+{
+public:
+	explicit FD3D11PipelineContext(ID3D11DeviceContext* InDeviceContext) : DeviceContext(InDeviceContext) {}
+
+	void SetPrimitiveTopology(EPipelineTopology InTopology) override;
+	void SetInputLayout(FInputLayoutHandle InInputLayout) override;
+	void SetVertexShader(FVertexShaderHandle InVertexShader) override;
+	void SetPixelShader(FPixelShaderHandle InPixelShader) override;
+	void SetRasterizerState(FRasterizerStateHandle InRasterizerState) override;
+	void SetDepthStencilState(FDepthStencilStateHandle InDepthStencilState) override;
+	void SetBlendState(FBlendStateHandle InBlendState) override;
+
+	void SetVertexBuffer(uint32 InSlot, FBufferHandle InBuffer, uint32 InStride, uint32 InOffset) override;
+	void SetIndexBuffer(FBufferHandle InBuffer, uint32 InFormat, uint32 InOffset) override;
+	void SetConstantBuffer(uint32 InSlot, bool bInIsVS, FBufferHandle InBuffer) override;
+	void SetShaderResourceView(uint32 InSlot, bool bInIsVS, FShaderResourceHandle InView) override;
+	void SetSamplerState(uint32 InSlot, bool bInIsVS, FSamplerHandle InSampler) override;
+
+	void Draw(uint32 InVertexCount, uint32 InStartVertex) override;
+	void DrawInstanced(uint32 InVertexCountPerInstance, uint32 InInstanceCount, uint32 InStartVertex, uint32 InStartInstance) override;
+	void DrawIndexed(uint32 InIndexCount, uint32 InStartIndex, int32 InBaseVertex) override;
+	void DrawIndexedInstanced(uint32 InIndexCountPerInstance, uint32 InInstanceCount, uint32 InStartIndex,
+		int32 InBaseVertex, uint32 InStartInstance) override;
+
+private:
+	ID3D11DeviceContext* DeviceContext;
+};
 
 
 class UPipeline
@@ -29,6 +63,15 @@ public:
 
 	void DrawIndexed(uint32 IndexCount, uint32 StartIndexLocation, int32 BaseVertexLocation);
 	void DrawIndexedInstanced(uint32 IndexCountPerInstance, uint32 InstanceCount, uint32 StartIndexLocation, int32 BaseVertexLocation, uint32 StartInstanceLocation);
+
+	/** 프레임 시작: 바인딩 통계를 넘기고 상태 캐시를 비운다 */
+	void BeginFrame() { StateCache.BeginFrame(); }
+
+	/** UPipeline을 거치지 않고 컨텍스트 상태를 바꾼 뒤에 호출 */
+	void InvalidateStateCache() { StateCache.Invalidate(); }
+
+	const FPipelineStats& GetStats() const { return StateCache.GetStats(); }
+	const FPipelineStats& GetLastFrameStats() const { return StateCache.GetLastFrameStats(); }
 private:
 	ID3D11RasterizerState* GetOrCreateRasterizerState(const FRasterizerKey& InRenderState);
 
@@ -39,6 +82,10 @@ private:
 
 	ID3D11Device* Device = nullptr;
 
+	// 선언 순서 유지: StateCache가 ContextAdapter를 참조한다
+	FD3D11PipelineContext ContextAdapter;
+	FPipelineStateCache StateCache;
+
 	TMap<FPipelineDescKey, FPipelineInfo, FPipelineDescHasher> Pipelines;
 	TMap<EDepthStencilType, ID3D11DepthStencilState*> DepthStencilStates;
 	TMap<FRasterizerKey, ID3D11RasterizerState*, FRasterizerKeyHasher> RasterizerStates;
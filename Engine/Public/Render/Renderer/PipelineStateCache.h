@@ -0,0 +1,220 @@
+#pragma once
+#include "Global/CoreMinimal.h"
+
+/**
+ * @brief 상태 캐시가 다루는 디바이스 객체의 불투명 핸들
+ * 캐시는 주소가 같은지만 비교하므로 D3D 헤더 없이 빌드된다. 원래 타입으로 되돌리는 건 IPipelineContext 구현의 몫이다.
+ */
+template<typename TTag>
+struct TPipelineHandle
+{
+	void* Ptr = nullptr;
+
+	TPipelineHandle() = default;
+	explicit TPipelineHandle(void* InPtr) : Ptr(InPtr) {}
+
+	explicit operator bool() const { return Ptr != nullptr; }
+	bool operator==(const TPipelineHandle& Other) const { return Ptr == Other.Ptr; }
+	bool operator!=(const TPipelineHandle& Other) const { return Ptr != Other.Ptr; }
+};
+
+using FInputLayoutHandle = TPipelineHandle<struct FInputLayoutHandleTag>;
+using FVertexShaderHandle = TPipelineHandle<struct FVertexShaderHandleTag>;
+using FPixelShaderHandle = TPipelineHandle<struct FPixelShaderHandleTag>;
+using FRasterizerStateHandle = TPipelineHandle<struct FRasterizerStateHandleTag>;
+using FDepthStencilStateHandle = TPipelineHandle<struct FDepthStencilStateHandleTag>;
+using FBlendStateHandle = TPipelineHandle<struct FBlendStateHandleTag>;
+using FBufferHandle = TPipelineHandle<struct FBufferHandleTag>;
+using FShaderResourceHandle = TPipelineHandle<struct FShaderResourceHandleTag>;
+using FSamplerHandle = TPipelineHandle<struct FSamplerHandleTag>;
+
+/** D3D11_PRIMITIVE_TOPOLOGY와 같은 값 (Pipeline.cpp에서 static_assert로 확인) */
+enum class EPipelineTopology : uint32
+{
+	Undefined = 0,
+	PointList = 1,
+	LineList = 2,
+	LineStrip = 3,
+	TriangleList = 4,
+	TriangleStrip = 5,
+};
+
+/** FPipelineInfo의 핸들 버전, nullptr인 항목은 이전 바인딩을 유지한다 */
+struct FPipelineStateDesc
+{
+	FInputLayoutHandle InputLayout;
+	FVertexShaderHandle VertexShader;
+	FRasterizerStateHandle RasterizerState;
+	FDepthStencilStateHandle DepthStencilState;
+	FPixelShaderHandle PixelShader;
+	FBlendStateHandle BlendState;
+	EPipelineTopology Topology = EPipelineTopology::TriangleList;
+};
+
+/**
+ * @brief UPipeline이 실제로 호출하는 디바이스 컨텍스트 기능만 뽑은 인터페이스
+ * D3D11 구현은 FD3D11PipelineContext(Pipeline.h), 헤드리스 테스트는 호출을 기록하는 목 구현을 끼워 넣는다.
+ * 인덱스 포맷은 DXGI_FORMAT 값을 그대로 넘긴다.
+ */
+class IPipelineContext
+{
+public:
+	virtual ~IPipelineContext() = default;
+
+	virtual void SetPrimitiveTopology(EPipelineTopology InTopology) = 0;
+	virtual void SetInputLayout(FInputLayoutHandle InInputLayout) = 0;
+	virtual void SetVertexShader(FVertexShaderHandle InVertexShader) = 0;
+	virtual void SetPixelShader(FPixelShaderHandle InPixelShader) = 0;
+	virtual void SetRasterizerState(FRasterizerStateHandle InRasterizerState) = 0;
+	virtual void SetDepthStencilState(FDepthStencilStateHandle InDepthStencilState) = 0;
+	virtual void SetBlendState(FBlendStateHandle InBlendState) = 0;
+
+	virtual void SetVertexBuffer(uint32 InSlot, FBufferHandle InBuffer, uint32 InStride, uint32 InOffset) = 0;
+	virtual void SetIndexBuffer(FBufferHandle InBuffer, uint32 InFormat, uint32 InOffset) = 0;
+	virtual void SetConstantBuffer(uint32 InSlot, bool bInIsVS, FBufferHandle InBuffer) = 0;
+	virtual void SetShaderResourceView(uint32 InSlot, bool bInIsVS, FShaderResourceHandle InView) = 0;
+	virtual void SetSamplerState(uint32 InSlot, bool bInIsVS, FSamplerHandle InSampler) = 0;
+
+	virtual void Draw(uint32 InVertexCount, uint32 InStartVertex) = 0;
+	virtual void DrawInstanced(uint32 InVertexCountPerInstance, uint32 InInstanceCount, uint32 InStartVertex, uint32 InStartInstance) = 0;
+	virtual void DrawIndexed(uint32 InIndexCount, uint32 InStartIndex, int32 InBaseVertex) = 0;
+	virtual void DrawIndexedInstanced(uint32 InIndexCountPerInstance, uint32 InInstanceCount, uint32 InStartIndex,
+		int32 InBaseVertex, uint32 InStartInstance) = 0;
+};
+
+/**
+ * @brief 한 프레임 동안 컨텍스트로 내려간(Issued) 호출과 캐시에서 걸러진(Skipped) 호출 수
+ * 바인드는 상태 하나(셰이더, 슬롯 하나 등)를 1회로 센다. 드로우는 개수가 0이면 건너뛴다.
+ * Instances/Triangles는 내려간 드로우만 센다 (삼각형은 TRIANGLELIST/STRIP 토폴로지일 때만).
+ */
+struct FPipelineStats
+{
+	uint32 IssuedBinds = 0;
+	uint32 SkippedBinds = 0;
+	uint32 IssuedDraws = 0;
+	uint32 SkippedDraws = 0;
+	uint64 Instances = 0;
+	uint64 Triangles = 0;
+};
+
+/**
+ * @brief 마지막으로 바인딩한 상태를 기억해서 같은 값의 재바인딩을 컨텍스트에 보내지 않는 캐시
+ *
+ * 컨텍스트는 바인딩된 객체의 참조를 쥐고 있으므로, 바인딩 중인 객체의 주소가 다른 객체에 재사용될 일은 없다.
+ * 다만 이 캐시를 거치지 않고 컨텍스트를 건드리는 코드가 있으면 그 뒤에 Invalidate()를 불러야 한다.
+ */
+class FPipelineStateCache
+{
+public:
+	static constexpr uint32 MaxVertexStreams = 2;
+	static constexpr uint32 MaxConstantBuffers = 14;	// D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT
+	static constexpr uint32 MaxShaderResources = 16;	// 추적하는 슬롯 수 (넘으면 항상 바인딩)
+	static constexpr uint32 MaxSamplers = 16;			// D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT
+
+	explicit FPipelineStateCache(IPipelineContext& InContext);
+
+	/** 모든 슬롯을 "모름"으로 돌려 다음 바인딩은 반드시 내려가게 한다 */
+	void Invalidate();
+
+	/** 현재 통계를 지난 프레임 통계로 넘기고 0으로 초기화 (캐시도 무효화) */
+	void BeginFrame();
+
+	/** InputLayout 등 nullptr인 항목은 기존처럼 이전 값을 유지한다 */
+	void SetPipeline(const FPipelineStateDesc& InDesc);
+
+	void SetVertexBuffer(uint32 InSlot, FBufferHandle InBuffer, uint32 InStride, uint32 InOffset = 0);
+	void SetIndexBuffer(FBufferHandle InBuffer, uint32 InFormat, uint32 InOffset = 0);
+	void SetConstantBuffer(uint32 InSlot, bool bInIsVS, FBufferHandle InBuffer);
+	void SetShaderResourceView(uint32 InSlot, bool bInIsVS, FShaderResourceHandle InView);
+	void SetSamplerState(uint32 InSlot, bool bInIsVS, FSamplerHandle InSampler);
+
+	void Draw(uint32 InVertexCount, uint32 InStartVertex);
+	void DrawInstanced(uint32 InVertexCountPerInstance, uint32 InInstanceCount, uint32 InStartVertex, uint32 InStartInstance);
+	void DrawIndexed(uint32 InIndexCount, uint32 InStartIndex, int32 InBaseVertex);
+	void DrawIndexedInstanced(uint32 InIndexCountPerInstance, uint32 InInstanceCount, uint32 InStartIndex,
+		int32 InBaseVertex, uint32 InStartInstance);
+
+	const FPipelineStats& GetStats() const { return Stats; }
+	const FPipelineStats& GetLastFrameStats() const { return LastFrameStats; }
+
+private:
+	/** 값 + "컨텍스트 상태를 알고 있는가" 플래그 */
+	template<typename T>
+	struct TShadowSlot
+	{
+		T Value{};
+		bool bValid = false;
+
+		/** 바뀌었으면(또는 모르면) 값을 갱신하고 true */
+		bool Update(const T& InValue)
+		{
+			if (bValid && Value == InValue)
+			{
+				return false;
+			}
+			Value = InValue;
+			bValid = true;
+			return true;
+		}
+	};
+
+	struct FVertexStream
+	{
+		FBufferHandle Buffer;
+		uint32 Stride = 0;
+		uint32 Offset = 0;
+
+		bool operator==(const FVertexStream& Other) const
+		{
+			return Buffer == Other.Buffer && Stride == Other.Stride && Offset == Other.Offset;
+		}
+	};
+
+	struct FIndexStream
+	{
+		FBufferHandle Buffer;
+		uint32 Format = 0;
+		uint32 Offset = 0;
+
+		bool operator==(const FIndexStream& Other) const
+		{
+			return Buffer == Other.Buffer && Format == Other.Format && Offset == Other.Offset;
+		}
+	};
+
+	/** 슬롯이 바뀌었으면 Issued, 아니면 Skipped를 세고 바인딩 여부를 돌려준다 */
+	template<typename T>
+	bool ShouldBind(TShadowSlot<T>& InOutSlot, const T& InValue)
+	{
+		if (InOutSlot.Update(InValue))
+		{
+			++Stats.IssuedBinds;
+			return true;
+		}
+		++Stats.SkippedBinds;
+		return false;
+	}
+
+	bool ShouldDraw(uint32 InCount, uint32 InInstanceCount = 1);
+
+	IPipelineContext& Context;
+
+	TShadowSlot<EPipelineTopology> Topology;
+	TShadowSlot<FInputLayoutHandle> InputLayout;
+	TShadowSlot<FVertexShaderHandle> VertexShader;
+	TShadowSlot<FPixelShaderHandle> PixelShader;
+	TShadowSlot<FRasterizerStateHandle> RasterizerState;
+	TShadowSlot<FDepthStencilStateHandle> DepthStencilState;
+	TShadowSlot<FBlendStateHandle> BlendState;
+
+	TShadowSlot<FVertexStream> VertexStreams[MaxVertexStreams];
+	TShadowSlot<FIndexStream> IndexStream;
+
+	// [0] = PS, [1] = VS
+	TShadowSlot<FBufferHandle> ConstantBuffers[2][MaxConstantBuffers];
+	TShadowSlot<FShaderResourceHandle> ShaderResources[2][MaxShaderResources];
+	TShadowSlot<FSamplerHandle> Samplers[2][MaxSamplers];
+
+	FPipelineStats Stats;
+	FPipelineStats LastFrameStats;
+};
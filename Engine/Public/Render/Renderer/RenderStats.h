@@ -0,0 +1,108 @@
+#pragma once
+#include "Render/Renderer/PipelineStateCache.h"
+#include <fstream>
+
+/**
+ * @brief CPU 시간을 따로 재는 렌더 패스 (뷰포트가 여럿이면 합산)
+ */
+enum class ERenderStatPass : uint8
+{
+	Visibility,		// 뷰별 가시성/정렬 (병렬 구간 전체)
+	Level,			// 스태틱 메시 제출
+	Billboards,
+	Text,
+	EditorLines,
+	UI,
+	Num
+};
+
+/**
+ * @brief 한 프레임의 렌더 통계
+ * 드로우/바인드/인스턴스/삼각형은 UPipeline(FPipelineStats)에서, 업로드와 패스 시간은 URenderer에서 모은다.
+ */
+struct FRenderFrameStats
+{
+	uint64 FrameNumber = 0;
+	uint32 NumViews = 0;
+
+	FPipelineStats Pipeline;
+
+	// Map으로 CPU가 GPU 버퍼에 쓴 횟수와 바이트 (상수/정점/인스턴스/구조화 버퍼)
+	uint32 NumUploads = 0;
+	uint64 UploadBytes = 0;
+
+	double PassMs[static_cast<uint8>(ERenderStatPass::Num)] = {};
+	double FrameMs = 0.0;
+};
+
+/**
+ * @brief URenderer가 프레임마다 채우는 렌더 통계와 CSV 기록
+ *
+ * 사용 순서: BeginFrame() → AddUpload()/AddPassCycles() → EndFrame(파이프라인 통계)
+ * 화면 표시는 지난 프레임(GetLastFrame) 값을 쓴다. CSV는 켜져 있는 동안 EndFrame마다 한 줄씩 쓴다.
+ */
+class FRenderStats
+{
+public:
+	void BeginFrame();
+	void EndFrame(const FPipelineStats& InPipelineStats, uint32 InNumViews);
+
+	void AddUpload(uint64 InBytes)
+	{
+		++Current.NumUploads;
+		Current.UploadBytes += InBytes;
+	}
+
+	void AddPassCycles(ERenderStatPass InPass, uint64 InCycles);
+
+	const FRenderFrameStats& GetLastFrame() const { return LastFrame; }
+
+	bool StartCsvCapture(const FString& InFilePath);
+	void StopCsvCapture();
+	bool IsCapturingCsv() const { return CsvFile.is_open(); }
+	const FString& GetCsvFilePath() const { return CsvFilePath; }
+	uint64 GetNumCsvRows() const { return NumCsvRows; }
+
+	static const char* GetPassName(ERenderStatPass InPass);
+
+	static void WriteCsvHeader(std::ostream& InStream);
+	static void WriteCsvRow(std::ostream& InStream, const FRenderFrameStats& InStats);
+
+	/** 오버레이/위젯용 여러 줄 요약 */
+	static void FormatLines(const FRenderFrameStats& InStats, TArray<FString>& OutLines);
+
+private:
+	FRenderFrameStats Current;
+	FRenderFrameStats LastFrame;
+	uint64 FrameCounter = 0;
+	uint64 FrameStartCycles = 0;
+
+	std::ofstream CsvFile;
+	FString CsvFilePath;
+	uint64 NumCsvRows = 0;
+};
+
+/**
+ * @brief 스코프 동안의 CPU 시간을 패스에 더한다
+ */
+class FRenderStatScope
+{
+public:
+	FRenderStatScope(FRenderStats& InStats, ERenderStatPass InPass)
+		: Stats(InStats), Pass(InPass), StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FRenderStatScope()
+	{
+		Stats.AddPassCycles(Pass, FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	FRenderStatScope(const FRenderStatScope&) = delete;
+	FRenderStatScope& operator=(const FRenderStatScope&) = delete;
+
+private:
+	FRenderStats& Stats;
+	ERenderStatPass Pass;
+	uint64 StartCycles;
+};
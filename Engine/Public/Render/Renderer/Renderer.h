@@ -9,13 +9,19 @@
 #include "Math/Octree.h"
 
 #include "Render/Cull/MSOC.h"
+#include "Render/Renderer/ViewVisibility.h"
+#include "Render/Renderer/DynamicRingBuffer.h"
+#include "Render/Renderer/IdReadback.h"
+#include "Render/Renderer/RenderStats.h"
 class UPipeline;
 class UDeviceResources;
 class UPrimitiveComponent;
 class UStaticMesh;
+class UMaterial;
 class AActor;
 class AGizmo;
 class UEditor;
+class ULevel;
 struct FPipelineInfo;
 /**
  * @brief Rendering Pipeline 전반을 처리하는 클래스
@@ -75,9 +81,9 @@ public:
 
 	void Update(UEditor* Editor);
 	void RenderBegin();
-	void RenderLevel();
-	void RenderBillboards(const FVector& CameraLocation);
-	void RenderText(const FVector& CameraLocation);
+	void RenderLevel(const FViewVisibility& InView);
+	void RenderBillboards(const FViewVisibility& InView);
+	void RenderText(const FViewVisibility& InView);
 	void RenderEditorPrimitive(FEditorPrimitive& Primitive, const FPipelineDescKey PipelineDescKey);
 	void RenderEnd() const;
 
@@ -166,7 +172,6 @@ public:
 	void UpdateConstant(const FVector& InPosition, const FVector& InRotation, const FVector& InScale) const;
 	void UpdateConstant(const FViewProjConstants& InViewProjConstants) const;
 	void UpdateConstant(const FVector4& Color) const;
-	void UpdateBillboardConstant(const FVector4& UVRect, const FVector4& Color) const;
 
 	void SetViewMode(EViewModeIndex InViewMode) { CurrentViewMode = InViewMode; }
 	void SetOrthoWorldWidthConst(float InWidth) { OrthoWidthConst = InWidth; }
@@ -183,20 +188,27 @@ public:
 	IDXGISwapChain* GetSwapChain() const { return DeviceResources->GetSwapChain(); }
 	ID3D11RenderTargetView* GetRenderTargetView() const { return DeviceResources->GetRenderTargetView(); }
 	UDeviceResources* GetDeviceResources() const { return DeviceResources; }
-	UPrimitiveComponent* GetCollidedPrimitive(int MouseX, int MouseY) const;
+	UPrimitiveComponent* GetCollidedPrimitive(int MouseX, int MouseY);
 
 	/** LineBatchRenderer에서 사용할 공개 메서드 */
 	UPipeline* GetPipeline() const { return Pipeline; }
+
+	/** 렌더 통계 (stat render, CSV 기록). 업로드는 const 업데이트 함수에서도 센다 */
+	FRenderStats& GetRenderStats() const { return RenderStats; }
 	float GetOrthoWorldWidthConst(){ return OrthoWidthConst; }
 
 	USoftwareOcclusionCuller MSOC;
 
+	/** 현재 레벨을 대상으로 오클루전 버퍼 해상도별 비용/정확도를 측정해 로그로 출력 */
+	void RunOcclusionBenchmark();
+
+	/** CPU가 지원하는 SIMD 경로마다 MSOC 커널/행렬 일괄 곱 비용을 측정해 로그로 출력 */
+	void RunSIMDBenchmark();
+
 	void RenderVisibleSort(TArray<UPrimitiveComponent*>& PrimToRender);
 
 
 	void ReadbackIdBuffer();
-	bool UploadBillboardVertices(const void* VertexData, uint32 VertexCount, uint32 Stride);
-	void EnsureBillboardVertexBuffer(uint32 VertexCount, uint32 Stride);
 
 private:
 	//MSOC viewprot
@@ -204,6 +216,10 @@ private:
 private:
 	void UpdateSplitDrag();
 
+	/** 벤치마크 공통 입력: 첫 원근 뷰포트 카메라, 레벨 스태틱 메시 바운드, 백버퍼 크기 */
+	bool GatherBenchmarkScene(const char* InLogTag, FMatrix& OutViewProj, FOcclusionViewport& OutViewport,
+		TArray<FAABB>& OutBoxes, int& OutBackBufferW, int& OutBackBufferH);
+
 private:
 	UPipeline* Pipeline = nullptr;
 	UDeviceResources* DeviceResources = nullptr;
@@ -251,13 +267,16 @@ private:
 	ID3D11Buffer* ConstantBufferPerFrame = nullptr;
 	ID3D11Buffer* ConstantBufferColor = nullptr;
 	ID3D11Buffer* ConstantBufferCharTable = nullptr;
-	ID3D11Buffer* ConstantBufferBillboard = nullptr;
+	ID3D11Buffer* ConstantBufferInstanceBatch = nullptr;
+
+	// 빌보드: 뷰포트마다 텍스처별로 묶어 링 버퍼에 한 번 업로드
+	FDynamicRingBuffer BillboardVertexRing;
 
-	ID3D11Buffer* BillboardVertexBuffer = nullptr;
-	uint32 BillboardVertexBufferVertexCount = 0;
-	uint32 BillboardVertexBufferStride = 0;
+	// 피킹: 커서 주변 ID 영역을 스테이징 링으로 비동기 읽기
+	FIdReadback IdReadback;
 
-	std::vector<uint32> CachedIdBuffer;
+	// 프레임 통계 (UpdateConstant 등 const 함수에서도 업로드를 센다)
+	mutable FRenderStats RenderStats;
 	/////////////////////////////////////
 	FLOAT ClearColor[4] = { 0.025f, 0.025f, 0.025f, 1.0f };
 
@@ -266,7 +285,6 @@ private:
 	uint32 StrideStaticMesh = sizeof(FNormalVertex);
 
 	uint32 Stride = sizeof(FVertex);
-	uint32 StrideTextVertex = sizeof(FTextVertex);
 
 
 
@@ -278,12 +296,43 @@ private:
 	};
 
 	TMap<UStaticMesh*, FStructuredBufferResource> StaticMeshStructuredBuffers;
+
+	// 텍스트: 라벨마다 고정 구간을 가진 글자 표(t2)/라벨 표(t1)를 프레임마다 한 번 더티 구간만 올리고,
+	// 뷰포트마다 뒤→앞 순서의 글자 번호(4바이트)만 인스턴스 링 버퍼에 올린다
+	FTextGlyphCache TextGlyphCache;
+	TArray<FTextTableRange> TextLabelRanges;	// 레벨의 텍스트 목록과 같은 순서, 이번 프레임 값
+	FStructuredBufferResource TextGlyphBuffer;
+	FStructuredBufferResource TextLabelBuffer;
+	FDynamicRingBuffer TextGlyphRing;
+
+	// 폰트 텍스처 캐시 (UResourceManager가 소유, 세대가 다르면 다시 조회)
+	ID3D11ShaderResourceView* FontTexture = nullptr;
+	uint32 FontTextureGeneration = 0;
+
+	// 활성 뷰포트마다 가시성 단계 결과 (프레임마다 재구성, 용량은 유지)
+	TArray<FViewVisibility> ViewVisibilities;
 private:
+	/** 가시성 단계: 워커 스레드에서 호출, GPU 리소스를 건드리지 않는다 */
+	void ComputeViewVisibility(FViewVisibility& InOutView, ULevel* InLevel) const;
+	void GatherStaticMeshes(FViewVisibility& InOutView, ULevel* InLevel) const;
+	void GatherBillboards(FViewVisibility& InOutView, ULevel* InLevel) const;
+	void GatherText(FViewVisibility& InOutView, ULevel* InLevel) const;
+
+	/** 가시성 단계 전에 렌더 스레드에서 한 번: 텍스트 라벨 구간을 갱신하고 바뀐 구간만 GPU 표에 올린다 */
+	void UpdateTextTables(ULevel* InLevel);
+	ID3D11ShaderResourceView* GetFontTexture();
 
 	FStructuredBufferResource& GetOrCreateStructuredBuffer(UStaticMesh* InKey);
 	void EnsureStructuredBufferCapacity(FStructuredBufferResource& InResource, uint32 InRequiredInstanceCount);
 	void UploadStructuredBufferData(FStructuredBufferResource& InResource, const void* InData, uint32 InInstanceCount);
+	/** CPU가 구간만 고쳐 쓰는(DEFAULT) 구조화 버퍼. 새로 만들었으면 true (내용이 비었으므로 전부 다시 올려야 한다) */
+	bool EnsureTableBufferCapacity(FStructuredBufferResource& InResource, uint32 InRequiredCount, uint32 InStride);
+	void UploadTableBufferRanges(FStructuredBufferResource& InResource, const void* InData, uint32 InStride,
+		const TArray<FTextTableRange>& InRanges);
+	void ReleaseStructuredBuffer(FStructuredBufferResource& InResource);
 	void ReleasePrimitiveInstanceBuffers();
+	void UpdateInstanceBatchConstant(uint32 InInstanceOffset) const;
+	void BindStaticMeshMaterial(const UMaterial* InMaterial);
 	void OctreeFrustumCulling(const TArray<TOctree<UPrimitiveComponent, PrimitiveComponentTrait>::FOctreeNode>& OctreeNodeList,
 		const TArray<UPrimitiveComponent*>& OctreeElementList,
 		TArray<UPrimitiveComponent*>& PrimitiveComponentsToRender,
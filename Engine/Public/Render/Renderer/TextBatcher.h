@@ -0,0 +1,111 @@
+#pragma once
+#include "Render/Renderer/InstanceBatcher.h"
+
+/**
+ * @brief 글자 표(StructuredBuffer) 원소 한 개 = 글자 한 개
+ * 글자 사각형은 셰이더가 SV_VertexID로 만들고, 라벨의 월드 행렬/UUID는 LabelIndex로 라벨 표에서 읽는다.
+ */
+struct FTextGlyphInstance
+{
+	FVector2 Offset;		// 라벨 로컬 평면(Y, Z)에서 글자 왼쪽 아래 위치, 글자 한 칸 = 1
+	uint32 CharId = 0;		// CharTable 인덱스
+	FVector4 Color = FVector4(1, 1, 1, 1);
+	uint32 LabelIndex = 0;	// FTextGlyphCache가 라벨 표의 자리로 채운다
+};
+
+static_assert(sizeof(FTextGlyphInstance) == 32, "FTextGlyphInstance는 TextShader 글자 표 구조체(32바이트)와 같아야 합니다");
+
+/** 글자 표/라벨 표 안의 연속 구간 (원소 단위) */
+struct FTextTableRange
+{
+	uint32 First = 0;
+	uint32 Count = 0;
+};
+
+/**
+ * @brief 라벨별 글자와 월드 행렬을 프레임을 넘어 유지하는 CPU 사본 (GPU 글자 표/라벨 표와 같은 배치)
+ * 라벨마다 글자 표에 고정 구간(2의 거듭제곱 용량)과 라벨 표 한 자리를 잡아 두고,
+ * 글자 리비전이나 행렬/UUID가 바뀐 라벨만 더티 구간으로 남긴다. 렌더러는 프레임마다 한 번 더티 구간만 올린다.
+ * 이번 프레임에 UpdateLabel()되지 않은 라벨은 EndFrame()에서 자리를 반납한다.
+ *
+ * 사용 순서: BeginFrame() → UpdateLabel() 반복 → EndFrame() → GetDirty*Ranges()로 업로드 → ClearDirty()
+ */
+class FTextGlyphCache
+{
+public:
+	void BeginFrame();
+
+	/**
+	 * @brief 라벨의 글자 표 구간을 돌려준다 (처음 보거나 글자 수가 용량을 넘으면 새로 잡는다)
+	 * @param InKey      라벨을 구분하는 값 (보통 컴포넌트 포인터)
+	 * @param InRevision 글자가 바뀔 때마다 달라지는 값. 같으면 InGlyphs를 다시 복사하지 않는다
+	 */
+	FTextTableRange UpdateLabel(const void* InKey, uint64 InRevision, const TArray<FTextGlyphInstance>& InGlyphs,
+		const FMatrix& InWorld, uint32 InUUID);
+
+	/** 이번 프레임에 나오지 않은 라벨의 자리를 반납하고 더티 구간을 정렬/병합한다 */
+	void EndFrame();
+
+	void ClearDirty();
+
+	/** 모든 라벨을 잊는다 (GPU 표를 새로 만들 때 등). 다음 프레임에 전부 다시 올라간다 */
+	void Clear();
+
+	const TArray<FTextGlyphInstance>& GetGlyphs() const { return Glyphs; }
+	const TArray<FInstanceGPUData>& GetLabels() const { return Labels; }
+
+	/** 겹치지 않고 시작 순으로 정렬된 더티 구간 (이웃한 구간은 합쳐져 있다) */
+	const TArray<FTextTableRange>& GetDirtyGlyphRanges() const { return DirtyGlyphRanges; }
+	const TArray<FTextTableRange>& GetDirtyLabelRanges() const { return DirtyLabelRanges; }
+
+	int32 NumLabels() const { return static_cast<int32>(Entries.size()); }
+
+private:
+	struct FEntry
+	{
+		uint32 LabelIndex = 0;
+		uint32 FirstGlyph = 0;
+		uint32 Capacity = 0;
+		uint32 NumGlyphs = 0;
+		uint64 Revision = 0;
+		uint32 LastFrame = 0;
+	};
+
+	void AllocateGlyphs(FEntry& InOutEntry, uint32 InNumGlyphs);
+	void FreeGlyphs(const FEntry& InEntry);
+	static void MergeRanges(TArray<FTextTableRange>& InOutRanges);
+
+	TMap<const void*, FEntry> Entries;
+	TArray<FTextGlyphInstance> Glyphs;
+	TArray<FInstanceGPUData> Labels;
+
+	// 용량별 반납된 글자 구간 시작 위치, 반납된 라벨 자리
+	TMap<uint32, TArray<uint32>> FreeGlyphBlocks;
+	TArray<uint32> FreeLabels;
+
+	TArray<FTextTableRange> DirtyGlyphRanges;
+	TArray<FTextTableRange> DirtyLabelRanges;
+	uint32 Frame = 0;
+};
+
+/**
+ * @brief 뷰포트 하나의 텍스트 라벨을 그리기 순서대로 글자 표 번호 배열로 이어 붙이는 CPU 전용 모듈
+ * 글자 데이터는 FTextGlyphCache가 프레임마다 한 번 올려 두고, 뷰포트는 4바이트 번호만 올린다.
+ * 인스턴스 순서 = 래스터 순서이므로 뒤→앞 순서로 AddLabel()을 부르면 DrawInstanced 1회로 블렌딩 순서가 유지된다.
+ *
+ * 사용 순서: Reset() → AddLabel() 반복 → GetGlyphSlots()
+ */
+class FTextBatcher
+{
+public:
+	void Reset();
+
+	void AddLabel(const FTextTableRange& InGlyphRange);
+
+	const TArray<uint32>& GetGlyphSlots() const { return GlyphSlots; }
+
+	static constexpr uint32 VerticesPerGlyph = 6;
+
+private:
+	TArray<uint32> GlyphSlots;
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include "Render/Renderer/InstanceBatcher.h"
+#include "Render/Renderer/BillboardBatcher.h"
+#include "Render/Renderer/TextBatcher.h"
+
+class FViewport;
+class UCamera;
+
+/**
+ * @brief 뷰포트(카메라) 하나의 가시성 단계 결과
+ *
+ * 프레임은 두 단계로 나뉜다.
+ * 1) 가시성 단계: 뷰마다 보이는 목록과 정렬된 드로우 목록을 만든다. 워커 스레드에서 뷰끼리 병렬로 실행하며
+ *    디바이스/컨텍스트와 렌더러의 GPU 리소스는 건드리지 않는다 (뷰끼리 공유하는 쓰기 상태가 없다).
+ * 2) 제출 단계: 렌더 스레드가 뷰 순서대로 이 결과를 업로드하고 드로우를 기록한다.
+ *
+ * 배열 용량을 유지하도록 렌더러가 뷰 개수만큼 들고 재사용한다.
+ */
+struct FViewVisibility
+{
+	FViewport* Viewport = nullptr;
+	UCamera* Camera = nullptr;
+
+	D3D11_VIEWPORT LocalViewport = {};
+	D3D11_RECT ScissorRect = {};
+
+	FVector ViewLocation;
+	FVector ViewForward;
+
+	// 불투명: (메시, 섹션, 머티리얼) 묶음, 묶음 안은 앞→뒤
+	FInstanceBatcher InstanceBatcher;
+
+	// 반투명: 뒤→앞으로 정렬된 순서 그대로
+	FBillboardBatcher BillboardBatcher;
+	FTextBatcher TextBatcher;
+
+	// 빌보드/텍스트 정렬용 임시 목록 (패스마다 Reset 후 재사용)
+	FDrawList TranslucentDrawList;
+};
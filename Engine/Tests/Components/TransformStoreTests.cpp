@@ -0,0 +1,222 @@
+#include "pch.h"
+#include "Components/TransformStore.h"
+#include "TestHarness.h"
+
+#include <cmath>
+#include <random>
+#include <thread>
+
+/**
+ * @brief FTransformStore 헤드리스 테스트
+ * 소유 컴포넌트는 포인터 값으로만 "살아 있음"을 판단하므로 가짜 주소를 쓴다.
+ */
+namespace
+{
+	USceneComponent* FakeOwner(uintptr_t InId) { return reinterpret_cast<USceneComponent*>(0x1000 + InId * 64); }
+
+	bool NearlyEqual(const FMatrix& A, const FMatrix& B, float InTolerance)
+	{
+		for (int Row = 0; Row < 4; ++Row)
+		{
+			for (int Col = 0; Col < 4; ++Col)
+			{
+				if (std::fabs(A.Data[Row][Col] - B.Data[Row][Col]) > InTolerance)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	struct FTestNode
+	{
+		uint32 Handle;
+		int32 Parent;	// Nodes 인덱스, 루트는 -1
+	};
+
+	/** 루트 InNumRoots개에 자식/손자를 무작위로 붙인 계층 */
+	TArray<FTestNode> BuildHierarchy(FTransformStore& Store, uint32 InSeed, int32 InNum, int32 InNumRoots)
+	{
+		std::mt19937 Random(InSeed);
+		std::uniform_real_distribution<float> LocationDist(-50.0f, 50.0f);
+		std::uniform_real_distribution<float> AngleDist(-180.0f, 180.0f);
+		std::uniform_real_distribution<float> ScaleDist(0.5f, 2.0f);
+
+		TArray<FTestNode> Nodes;
+		for (int32 Index = 0; Index < InNum; ++Index)
+		{
+			const uint32 Handle = Store.Allocate(FakeOwner(Index));
+			const int32 Parent = Index < InNumRoots ? -1 : static_cast<int32>(Random() % Index);
+			if (Parent >= 0)
+			{
+				Store.SetParent(Handle, Nodes[Parent].Handle);
+			}
+
+			const FVector Euler(AngleDist(Random), AngleDist(Random), AngleDist(Random));
+			Store.SetLocation(Handle, FVector(LocationDist(Random), LocationDist(Random), LocationDist(Random)));
+			Store.SetRotation(Handle, FQuat::FromEulerXYZ(Euler), Euler);
+			Store.SetScale(Handle, FVector(ScaleDist(Random), ScaleDist(Random), ScaleDist(Random)));
+			Store.SetFlags(Handle, FTransformStore::AllDirty);
+			Nodes.push_back({ Handle, Parent });
+		}
+		return Nodes;
+	}
+
+	/** 부모 체인을 따라 직접 곱한 기대값 */
+	FMatrix ExpectedWorld(FTransformStore& Store, const TArray<FTestNode>& InNodes, int32 InIndex)
+	{
+		const uint32 Handle = InNodes[InIndex].Handle;
+		FMatrix World = FMatrix::GetModelMatrix(Store.GetLocation(Handle), Store.GetRotation(Handle), Store.GetScale(Handle));
+		if (InNodes[InIndex].Parent >= 0)
+		{
+			World *= ExpectedWorld(Store, InNodes, InNodes[InIndex].Parent);
+		}
+		return World;
+	}
+
+	void FreeAll(FTransformStore& Store, const TArray<FTestNode>& InNodes)
+	{
+		for (const FTestNode& Node : InNodes)
+		{
+			Store.Free(Node.Handle);
+		}
+		Store.UpdateWorldMatrices();
+	}
+}
+
+void TestBatchedPassCleansWorldAndInverse()
+{
+	FTransformStore& Store = FTransformStore::GetInstance();
+	const TArray<FTestNode> Nodes = BuildHierarchy(Store, 1, 300, 20);
+
+	Store.UpdateWorldMatrices();
+
+	bool bAllClean = true;
+	bool bWorldMatches = true;
+	bool bInverseMatches = true;
+	for (int32 Index = 0; Index < static_cast<int32>(Nodes.size()); ++Index)
+	{
+		const uint32 Handle = Nodes[Index].Handle;
+		bAllClean &= (Store.GetFlags(Handle) & (FTransformStore::WorldDirty | FTransformStore::InverseDirty)) == 0;
+
+		const FMatrix& World = Store.GetWorldMatrix(Handle);
+		bWorldMatches &= NearlyEqual(World, ExpectedWorld(Store, Nodes, Index), 1e-2f);
+		bInverseMatches &= NearlyEqual(World * Store.GetWorldMatrixInverse(Handle), FMatrix::Identity, 1e-3f);
+	}
+	TEST_CHECK(bAllClean);
+	TEST_CHECK(bWorldMatches);
+	TEST_CHECK(bInverseMatches);
+
+	FreeAll(Store, Nodes);
+	TEST_CHECK(Store.GetNum() == 0);
+}
+
+void TestLazyPathMatchesBatchedPass()
+{
+	FTransformStore& Store = FTransformStore::GetInstance();
+	const TArray<FTestNode> Nodes = BuildHierarchy(Store, 2, 64, 4);
+	Store.UpdateWorldMatrices();
+
+	TArray<FMatrix> Batched, BatchedInverse;
+	for (const FTestNode& Node : Nodes)
+	{
+		Batched.push_back(Store.GetWorldMatrix(Node.Handle));
+		BatchedInverse.push_back(Store.GetWorldMatrixInverse(Node.Handle));
+	}
+
+	// 게임 스레드에서는 더티 항목을 읽는 즉시 부모부터 지연 계산한다
+	for (const FTestNode& Node : Nodes)
+	{
+		Store.SetFlags(Node.Handle, FTransformStore::AllDirty);
+	}
+	bool bMatches = true;
+	for (int32 Index = static_cast<int32>(Nodes.size()) - 1; Index >= 0; --Index)
+	{
+		bMatches &= NearlyEqual(Store.GetWorldMatrix(Nodes[Index].Handle), Batched[Index], 1e-3f);
+		bMatches &= NearlyEqual(Store.GetWorldMatrixInverse(Nodes[Index].Handle), BatchedInverse[Index], 1e-3f);
+		bMatches &= (Store.GetFlags(Nodes[Index].Handle) & (FTransformStore::WorldDirty | FTransformStore::InverseDirty)) == 0;
+	}
+	TEST_CHECK(bMatches);
+
+	FreeAll(Store, Nodes);
+}
+
+void TestWorkerReadsAreReadOnly()
+{
+	FTransformStore& Store = FTransformStore::GetInstance();
+	const TArray<FTestNode> Nodes = BuildHierarchy(Store, 3, 200, 10);
+	TEST_CHECK(Store.IsInGameThread());
+
+	Store.UpdateWorldMatrices();
+
+	// 일괄 계산 뒤에는 워커가 월드/역행렬을 읽어도 아무것도 쓰지 않는다
+	TArray<uint8> FlagsBefore;
+	for (const FTestNode& Node : Nodes)
+	{
+		FlagsBefore.push_back(Store.GetFlags(Node.Handle));
+	}
+
+	bool bWorkerIsGameThread = true;
+	bool bWorkerMatches = true;
+	std::thread Worker([&]()
+	{
+		bWorkerIsGameThread = Store.IsInGameThread();
+		for (const FTestNode& Node : Nodes)
+		{
+			const FMatrix& World = Store.GetWorldMatrix(Node.Handle);
+			bWorkerMatches &= NearlyEqual(World * Store.GetWorldMatrixInverse(Node.Handle), FMatrix::Identity, 1e-3f);
+		}
+	});
+	Worker.join();
+
+	TEST_CHECK(!bWorkerIsGameThread);
+	TEST_CHECK(bWorkerMatches);
+	bool bFlagsUnchanged = true;
+	for (int32 Index = 0; Index < static_cast<int32>(Nodes.size()); ++Index)
+	{
+		bFlagsUnchanged &= Store.GetFlags(Nodes[Index].Handle) == FlagsBefore[Index];
+	}
+	TEST_CHECK(bFlagsUnchanged);
+
+	FreeAll(Store, Nodes);
+}
+
+void TestParentCycleTerminates()
+{
+	FTransformStore& Store = FTransformStore::GetInstance();
+	const uint32 A = Store.Allocate(FakeOwner(1));
+	const uint32 B = Store.Allocate(FakeOwner(2));
+	const uint32 Root = Store.Allocate(FakeOwner(3));
+	Store.SetParent(A, B);
+	Store.SetParent(B, A);
+	Store.SetLocation(Root, FVector(1.0f, 2.0f, 3.0f));
+
+	// 순환 항목은 정렬 구간 밖에 남지만, 일괄 계산과 지연 계산 모두 끝나야 한다
+	Store.UpdateWorldMatrices();
+	TEST_CHECK((Store.GetFlags(A) & (FTransformStore::WorldDirty | FTransformStore::InverseDirty)) == 0);
+	TEST_CHECK((Store.GetFlags(B) & (FTransformStore::WorldDirty | FTransformStore::InverseDirty)) == 0);
+	TEST_CHECK(Store.GetWorldMatrix(Root).Data[3][0] == 1.0f && Store.GetWorldMatrix(Root).Data[3][2] == 3.0f);
+
+	Store.SetFlags(A, FTransformStore::AllDirty);
+	Store.SetFlags(B, FTransformStore::AllDirty);
+	Store.GetWorldMatrix(A);
+	Store.GetWorldMatrixInverse(B);
+	TEST_CHECK((Store.GetFlags(A) & FTransformStore::WorldDirty) == 0);
+	TEST_CHECK((Store.GetFlags(B) & FTransformStore::InverseDirty) == 0);
+
+	Store.Free(A);
+	Store.Free(B);
+	Store.Free(Root);
+	Store.UpdateWorldMatrices();
+	TEST_CHECK(Store.GetNum() == 0);
+}
+
+int main()
+{
+	RUN_TEST(TestBatchedPassCleansWorldAndInverse);
+	RUN_TEST(TestLazyPathMatchesBatchedPass);
+	RUN_TEST(TestWorkerReadsAreReadOnly);
+	RUN_TEST(TestParentCycleTerminates);
+	return TEST_RESULT();
+}
@@ -0,0 +1,357 @@
+#include "pch.h"
+#include "Core/TickManager.h"
+#include "Global/ParallelFor.h"
+#include "TestHarness.h"
+
+#include <atomic>
+#include <string>
+
+/**
+ * @brief FTickManager 헤드리스 테스트
+ * 실행될 때마다 이름을 공용 로그에 남기는 틱으로 단계/선행/순환/간격/도중 해제를 확인한다.
+ */
+namespace
+{
+	TArray<std::string> GTickLog;
+
+	class FTestTick : public FTickFunction
+	{
+	public:
+		explicit FTestTick(const char* InName, ETickGroup InGroup = ETickGroup::PrePhysics)
+			: Name(InName)
+		{
+			TickGroup = InGroup;
+			bCanEverTick = true;
+		}
+
+		void ExecuteTick(float InDeltaTime) override
+		{
+			++NumTicks;
+			LastDeltaTime = InDeltaTime;
+			if (!bRunOnAnyThread)
+			{
+				// 워커에서 도는 틱은 공용 로그를 쓰지 않는다
+				GTickLog.push_back(Name);
+			}
+			if (OnTick)
+			{
+				OnTick();
+			}
+		}
+
+		std::string Name;
+		int32 NumTicks = 0;
+		float LastDeltaTime = 0.0f;
+		std::function<void()> OnTick;
+	};
+
+	/** 로그에서 A가 B보다 먼저 나왔는지 */
+	bool RanBefore(const char* InA, const char* InB)
+	{
+		const auto A = std::find(GTickLog.begin(), GTickLog.end(), InA);
+		const auto B = std::find(GTickLog.begin(), GTickLog.end(), InB);
+		return A != GTickLog.end() && B != GTickLog.end() && A < B;
+	}
+
+	void TickOnce(FTickManager& InManager, float InDeltaTime = 0.016f, bool bInEditorWorld = false)
+	{
+		GTickLog.clear();
+		InManager.Tick(InDeltaTime, bInEditorWorld);
+	}
+}
+
+void TestGroupsRunInOrder()
+{
+	FTickManager Manager;
+	FTestTick Late("Late", ETickGroup::PostUpdateWork);
+	FTestTick During("During", ETickGroup::DuringPhysics);
+	FTestTick Early("Early", ETickGroup::PrePhysics);
+
+	// 등록 순서와 무관하게 단계 순서로 돈다
+	Late.RegisterTickFunction(Manager);
+	During.RegisterTickFunction(Manager);
+	Early.RegisterTickFunction(Manager);
+
+	TickOnce(Manager);
+	TEST_CHECK(GTickLog.size() == 3);
+	TEST_CHECK(RanBefore("Early", "During") && RanBefore("During", "Late"));
+
+	const FTickStats& Stats = Manager.GetStats();
+	TEST_CHECK(Stats.NumRegistered == 3 && Stats.NumEnabled == 3 && Stats.NumTicked == 3);
+	TEST_CHECK(Stats.NumWaves == 3);
+	TEST_CHECK(Stats.NumTickedPerGroup[0] == 1 && Stats.NumTickedPerGroup[1] == 1 && Stats.NumTickedPerGroup[2] == 1);
+}
+
+void TestRegistrationAndEnable()
+{
+	FTickManager Manager;
+	FTestTick Never("Never");
+	Never.bCanEverTick = false;
+	FTestTick Toggled("Toggled");
+
+	Never.RegisterTickFunction(Manager);
+	Toggled.RegisterTickFunction(Manager);
+	Toggled.RegisterTickFunction(Manager);
+	TEST_CHECK(!Never.IsTickFunctionRegistered());
+	TEST_CHECK(Toggled.IsTickFunctionRegistered());
+
+	TickOnce(Manager);
+	TEST_CHECK(GTickLog.size() == 1 && Toggled.NumTicks == 1);
+
+	// 꺼진 틱은 등록은 유지하지만 훑는 목록에서 빠진다
+	Toggled.SetTickFunctionEnable(false);
+	TickOnce(Manager);
+	TEST_CHECK(GTickLog.empty());
+	TEST_CHECK(Manager.GetStats().NumRegistered == 1 && Manager.GetStats().NumEnabled == 0);
+
+	Toggled.SetTickFunctionEnable(true);
+	TickOnce(Manager);
+	TEST_CHECK(Toggled.NumTicks == 2);
+
+	Toggled.UnRegisterTickFunction();
+	TickOnce(Manager);
+	TEST_CHECK(GTickLog.empty() && Manager.GetStats().NumRegistered == 0);
+
+	// 에디터 월드에서는 bTickInEditor인 틱만 돈다
+	FTestTick Editor("Editor");
+	Editor.bTickInEditor = true;
+	Editor.RegisterTickFunction(Manager);
+	Toggled.RegisterTickFunction(Manager);
+	TickOnce(Manager, 0.016f, true);
+	TEST_CHECK(GTickLog.size() == 1 && GTickLog[0] == "Editor");
+}
+
+void TestPrerequisitesWithinGroup()
+{
+	FTickManager Manager;
+	FTestTick A("A"), B("B"), C("C"), D("D");
+
+	// C → B → A 순으로 기다린다. D는 A만 기다린다
+	C.AddPrerequisite(&B);
+	B.AddPrerequisite(&A);
+	D.AddPrerequisite(&A);
+	C.AddPrerequisite(&B);
+
+	C.RegisterTickFunction(Manager);
+	D.RegisterTickFunction(Manager);
+	B.RegisterTickFunction(Manager);
+	A.RegisterTickFunction(Manager);
+
+	TickOnce(Manager);
+	TEST_CHECK(GTickLog.size() == 4);
+	TEST_CHECK(RanBefore("A", "B") && RanBefore("B", "C") && RanBefore("A", "D"));
+	TEST_CHECK(Manager.GetStats().NumWaves == 3);
+
+	// 선행 관계를 끊으면 같은 차례로 돌아간다
+	C.RemovePrerequisite(&B);
+	B.RemovePrerequisite(&A);
+	D.RemovePrerequisite(&A);
+	TickOnce(Manager);
+	TEST_CHECK(GTickLog.size() == 4 && Manager.GetStats().NumWaves == 1);
+}
+
+void TestPrerequisiteInLaterGroup()
+{
+	FTickManager Manager;
+	FTestTick Early("Early", ETickGroup::PrePhysics);
+	FTestTick Waiting("Waiting", ETickGroup::PrePhysics);
+	FTestTick During("During", ETickGroup::DuringPhysics);
+	FTestTick Late("Late", ETickGroup::PostUpdateWork);
+
+	// 더 늦은 단계의 선행 틱은 이 틱을 그 단계의 다음 차례로 민다
+	Waiting.AddPrerequisite(&Late);
+	Waiting.RegisterTickFunction(Manager);
+	Late.RegisterTickFunction(Manager);
+	During.RegisterTickFunction(Manager);
+	Early.RegisterTickFunction(Manager);
+
+	TickOnce(Manager);
+	TEST_CHECK(GTickLog.size() == 4);
+	TEST_CHECK(RanBefore("Early", "During") && RanBefore("During", "Late") && RanBefore("Late", "Waiting"));
+	TEST_CHECK(Manager.GetStats().NumTickedPerGroup[static_cast<uint8>(ETickGroup::PostUpdateWork)] == 2);
+
+	// 이번 프레임에 돌지 않는 선행 틱은 무시하고 원래 단계에서 돈다
+	Late.SetTickFunctionEnable(false);
+	TickOnce(Manager);
+	TEST_CHECK(GTickLog.size() == 3);
+	TEST_CHECK(RanBefore("Early", "During") && RanBefore("Waiting", "During"));
+}
+
+void TestCyclesAreBroken()
+{
+	FTickManager Manager;
+	FTestTick A("A"), B("B"), C("C"), After("After");
+
+	// A → B → C → A 순환, After는 순환 안의 C를 기다린다
+	A.AddPrerequisite(&B);
+	B.AddPrerequisite(&C);
+	C.AddPrerequisite(&A);
+	After.AddPrerequisite(&C);
+
+	After.RegisterTickFunction(Manager);
+	A.RegisterTickFunction(Manager);
+	B.RegisterTickFunction(Manager);
+	C.RegisterTickFunction(Manager);
+
+	for (int32 Frame = 0; Frame < 3; ++Frame)
+	{
+		TickOnce(Manager);
+		TEST_CHECK(GTickLog.size() == 4);
+		TEST_CHECK(RanBefore("C", "After"));
+	}
+	TEST_CHECK(A.NumTicks == 3 && B.NumTicks == 3 && C.NumTicks == 3 && After.NumTicks == 3);
+
+	// 두 틱이 서로를 기다리는 경우도 한 번씩만 돈다
+	FTickManager PairManager;
+	FTestTick X("X"), Y("Y");
+	X.AddPrerequisite(&Y);
+	Y.AddPrerequisite(&X);
+	X.RegisterTickFunction(PairManager);
+	Y.RegisterTickFunction(PairManager);
+	TickOnce(PairManager);
+	TEST_CHECK(GTickLog.size() == 2 && X.NumTicks == 1 && Y.NumTicks == 1);
+	TEST_CHECK(PairManager.GetStats().NumWaves == 2);
+}
+
+void TestTickInterval()
+{
+	FTickManager Manager;
+	FTestTick EveryFrame("EveryFrame");
+	FTestTick Slow("Slow");
+	Slow.TickInterval = 0.1f;
+
+	EveryFrame.RegisterTickFunction(Manager);
+	Slow.RegisterTickFunction(Manager);
+
+	// 등록 직후 바로 돌고, 그 뒤에는 0.1초 간격(0.1, 0.2, ...)이 지난 첫 프레임에 쌓인 시간을 받는다
+	TickOnce(Manager, 0.04f);
+	TEST_CHECK(Slow.NumTicks == 1 && std::fabs(Slow.LastDeltaTime - 0.04f) < 1e-5f);
+	TickOnce(Manager, 0.04f);
+	TEST_CHECK(Slow.NumTicks == 1);
+	TickOnce(Manager, 0.04f);
+	TEST_CHECK(Slow.NumTicks == 2 && std::fabs(Slow.LastDeltaTime - 0.08f) < 1e-5f);
+	TickOnce(Manager, 0.04f);
+	TEST_CHECK(Slow.NumTicks == 2);
+
+	// 크게 밀려도 한 프레임에 한 번만 돌고, 밀린 횟수만큼 몰아서 돌지 않는다
+	TickOnce(Manager, 1.0f);
+	TEST_CHECK(Slow.NumTicks == 3 && std::fabs(Slow.LastDeltaTime - 1.04f) < 1e-5f);
+	TickOnce(Manager, 0.04f);
+	TEST_CHECK(Slow.NumTicks == 4 && std::fabs(Slow.LastDeltaTime - 0.04f) < 1e-5f);
+	TickOnce(Manager, 0.04f);
+	TEST_CHECK(Slow.NumTicks == 4);
+
+	TEST_CHECK(EveryFrame.NumTicks == 7 && std::fabs(EveryFrame.LastDeltaTime - 0.04f) < 1e-5f);
+}
+
+void TestRemovalDuringTick()
+{
+	FTickManager Manager;
+	FTestTick Killer("Killer"), Victim("Victim"), Dependent("Dependent"), Survivor("Survivor");
+
+	// Killer가 먼저 돌며 같은 프레임의 뒤 차례 틱을 지운다 (액터 삭제와 같은 상황)
+	Victim.AddPrerequisite(&Killer);
+	Dependent.AddPrerequisite(&Victim);
+	Survivor.AddPrerequisite(&Killer);
+	Killer.OnTick = [&Victim]() { Victim.UnRegisterTickFunction(); };
+
+	Dependent.RegisterTickFunction(Manager);
+	Victim.RegisterTickFunction(Manager);
+	Survivor.RegisterTickFunction(Manager);
+	Killer.RegisterTickFunction(Manager);
+
+	TickOnce(Manager);
+	TEST_CHECK(Victim.NumTicks == 0);
+	TEST_CHECK(Killer.NumTicks == 1 && Survivor.NumTicks == 1 && Dependent.NumTicks == 1);
+	TEST_CHECK(!Victim.IsTickFunctionRegistered() && Manager.GetStats().NumRegistered == 3);
+
+	// 실행 중에 등록된 틱은 다음 프레임부터 돈다
+	FTestTick Late("Late");
+	Killer.OnTick = [&Late, &Manager]() { Late.RegisterTickFunction(Manager); };
+	TickOnce(Manager);
+	TEST_CHECK(Late.NumTicks == 0);
+	TickOnce(Manager);
+	TEST_CHECK(Late.NumTicks == 1);
+}
+
+void TestDestroyedTickUnlinks()
+{
+	FTickManager Manager;
+	FTestTick Dependent("Dependent");
+	Dependent.RegisterTickFunction(Manager);
+	{
+		FTestTick Prerequisite("Prerequisite", ETickGroup::PostUpdateWork);
+		Dependent.AddPrerequisite(&Prerequisite);
+		Prerequisite.RegisterTickFunction(Manager);
+		TickOnce(Manager);
+		TEST_CHECK(RanBefore("Prerequisite", "Dependent"));
+	}
+
+	// 소멸한 선행 틱은 등록과 선행 관계에서 모두 빠진다
+	TickOnce(Manager);
+	TEST_CHECK(GTickLog.size() == 1 && Manager.GetStats().NumRegistered == 1);
+	TEST_CHECK(Manager.GetStats().NumTickedPerGroup[static_cast<uint8>(ETickGroup::PrePhysics)] == 1);
+
+	// 매니저가 먼저 사라져도 틱은 등록이 풀린 상태가 된다
+	FTestTick Orphan("Orphan");
+	{
+		FTickManager ShortLived;
+		Orphan.RegisterTickFunction(ShortLived);
+	}
+	TEST_CHECK(!Orphan.IsTickFunctionRegistered());
+}
+
+void TestAnyThreadTicksRunBeforeGameThreadTicks()
+{
+	FTickManager Manager;
+	std::atomic<int32> NumAnyThreadTicks{ 0 };
+	int32 AnyThreadTicksSeenByGameThread = -1;
+
+	TArray<std::unique_ptr<FTestTick>> Ticks;
+	for (int32 Index = 0; Index < 16; ++Index)
+	{
+		Ticks.push_back(std::make_unique<FTestTick>("GameThread"));
+		FTestTick& Tick = *Ticks.back();
+		if (Index % 2 == 0)
+		{
+			Tick.bRunOnAnyThread = true;
+			Tick.OnTick = [&NumAnyThreadTicks]() { NumAnyThreadTicks.fetch_add(1); };
+		}
+		else if (Index == 1)
+		{
+			Tick.OnTick = [&]() { AnyThreadTicksSeenByGameThread = NumAnyThreadTicks.load(); };
+		}
+		Tick.RegisterTickFunction(Manager);
+	}
+
+	TickOnce(Manager);
+
+	// 같은 차례에서는 워커 가능 틱이 모두 끝난 뒤 게임 스레드 틱이 돈다
+	TEST_CHECK(NumAnyThreadTicks.load() == 8);
+	TEST_CHECK(AnyThreadTicksSeenByGameThread == 8);
+	TEST_CHECK(GTickLog.size() == 8);
+	TEST_CHECK(Manager.GetStats().NumTicked == 16);
+	if (GetParallelForThreadCount() > 1)
+	{
+		TEST_CHECK(Manager.GetStats().NumTickedParallel == 8);
+	}
+	else
+	{
+		TEST_CHECK(Manager.GetStats().NumTickedParallel == 0);
+		std::printf("  note: 1 worker thread, the ParallelFor path ran inline\n");
+	}
+}
+
+int main()
+{
+	RUN_TEST(TestGroupsRunInOrder);
+	RUN_TEST(TestRegistrationAndEnable);
+	RUN_TEST(TestPrerequisitesWithinGroup);
+	RUN_TEST(TestPrerequisiteInLaterGroup);
+	RUN_TEST(TestCyclesAreBroken);
+	RUN_TEST(TestTickInterval);
+	RUN_TEST(TestRemovalDuringTick);
+	RUN_TEST(TestDestroyedTickUnlinks);
+	RUN_TEST(TestAnyThreadTicksRunBeforeGameThreadTicks);
+	return TEST_RESULT();
+}
@@ -0,0 +1,149 @@
+#include "pch.h"
+#include "TestHarness.h"
+
+#include <thread>
+
+/**
+ * @brief FMemoryTracker 헤드리스 테스트
+ * 이 실행 파일만 Memory.cpp를 링크해 전역 operator new/delete를 교체한다.
+ * 다른 할당과 섞이지 않도록 검사하는 할당은 Level 태그로만 한다.
+ */
+namespace
+{
+	constexpr size_t SlabSize = 64 * 1024;
+
+	struct alignas(64) FCacheLineBlock
+	{
+		uint8 Bytes[100];
+	};
+
+	FMemoryTagStats GetLevelStats()
+	{
+		FMemoryStats Stats;
+		FMemoryTracker::GetStats(Stats);
+		return Stats.Tags[static_cast<uint8>(EMemoryTag::Level)];
+	}
+
+	bool IsAligned(const void* InMemory, size_t InAlignment)
+	{
+		return (reinterpret_cast<uintptr_t>(InMemory) & (InAlignment - 1)) == 0;
+	}
+}
+
+void TestDefaultAlignmentIsTagged()
+{
+	const FMemoryTagStats Before = GetLevelStats();
+
+	int32* Value = nullptr;
+	{
+		MEMORY_TAG_SCOPE(Level);
+		Value = new int32(7);
+	}
+	TEST_CHECK(IsAligned(Value, 16));
+	TEST_CHECK(GetLevelStats().LiveBytes == Before.LiveBytes + sizeof(int32));
+	TEST_CHECK(GetLevelStats().LiveCount == Before.LiveCount + 1);
+
+	// 태그 스코프 밖에서 해제해도 할당한 태그로 돌아간다
+	delete Value;
+	TEST_CHECK(GetLevelStats().LiveBytes == Before.LiveBytes);
+	TEST_CHECK(GetLevelStats().LiveCount == Before.LiveCount);
+}
+
+void TestSlabAlignmentAndSizedDelete()
+{
+	const FMemoryTagStats Before = GetLevelStats();
+
+	// ObjectPool과 같은 호출: 64KB 정렬 64KB 슬랩, 크기를 넘기는 정렬 delete
+	void* Slab = nullptr;
+	{
+		MEMORY_TAG_SCOPE(Level);
+		Slab = ::operator new(SlabSize, std::align_val_t(SlabSize));
+	}
+	TEST_CHECK(IsAligned(Slab, SlabSize));
+	TEST_CHECK(GetLevelStats().LiveBytes == Before.LiveBytes + SlabSize);
+
+	static_cast<uint8*>(Slab)[0] = 1;
+	static_cast<uint8*>(Slab)[SlabSize - 1] = 1;
+	::operator delete(Slab, SlabSize, std::align_val_t(SlabSize));
+	TEST_CHECK(GetLevelStats().LiveBytes == Before.LiveBytes);
+	TEST_CHECK(GetLevelStats().LiveCount == Before.LiveCount);
+}
+
+void TestOverAlignedTypes()
+{
+	const FMemoryTagStats Before = GetLevelStats();
+
+	// 표가 여러 번 커지고 지운 칸이 섞이도록 많이 만들고 절반씩 지운다
+	TArray<FCacheLineBlock*> Blocks;
+	bool bAllAligned = true;
+	{
+		MEMORY_TAG_SCOPE(Level);
+		Blocks.reserve(3000);
+		for (int32 Index = 0; Index < 3000; ++Index)
+		{
+			Blocks.push_back(new FCacheLineBlock());
+			bAllAligned &= IsAligned(Blocks.back(), alignof(FCacheLineBlock));
+		}
+	}
+	TEST_CHECK(bAllAligned);
+	const uint64 VectorBytes = Blocks.capacity() * sizeof(FCacheLineBlock*);
+	TEST_CHECK(GetLevelStats().LiveBytes == Before.LiveBytes + VectorBytes + 3000 * sizeof(FCacheLineBlock));
+
+	for (int32 Index = 0; Index < 3000; Index += 2)
+	{
+		delete Blocks[Index];
+		Blocks[Index] = nullptr;
+	}
+	{
+		MEMORY_TAG_SCOPE(Level);
+		for (int32 Index = 0; Index < 3000; Index += 2)
+		{
+			Blocks[Index] = new FCacheLineBlock();
+		}
+	}
+	for (FCacheLineBlock* Block : Blocks)
+	{
+		delete Block;
+	}
+	TEST_CHECK(GetLevelStats().LiveBytes == Before.LiveBytes + VectorBytes);
+
+	TArray<FCacheLineBlock*>().swap(Blocks);
+	TEST_CHECK(GetLevelStats().LiveBytes == Before.LiveBytes);
+	TEST_CHECK(GetLevelStats().LiveCount == Before.LiveCount);
+}
+
+void TestFreeOnOtherThread()
+{
+	const FMemoryTagStats Before = GetLevelStats();
+
+	void* Slab = nullptr;
+	FCacheLineBlock* Block = nullptr;
+	int32* Value = nullptr;
+	{
+		MEMORY_TAG_SCOPE(Level);
+		Slab = ::operator new(SlabSize, std::align_val_t(SlabSize));
+		Block = new FCacheLineBlock();
+		Value = new int32(3);
+	}
+
+	// 다른 스레드 블록의 해제 카운터로 올라가도 합산하면 Level로 되돌아온다
+	std::thread Worker([&]()
+	{
+		::operator delete(Slab, std::align_val_t(SlabSize));
+		delete Block;
+		delete Value;
+	});
+	Worker.join();
+
+	TEST_CHECK(GetLevelStats().LiveBytes == Before.LiveBytes);
+	TEST_CHECK(GetLevelStats().LiveCount == Before.LiveCount);
+}
+
+int main()
+{
+	RUN_TEST(TestDefaultAlignmentIsTagged);
+	RUN_TEST(TestSlabAlignmentAndSizedDelete);
+	RUN_TEST(TestOverAlignedTypes);
+	RUN_TEST(TestFreeOnOtherThread);
+	return TEST_RESULT();
+}
@@ -0,0 +1,239 @@
+#include "pch.h"
+#include "TestHarness.h"
+
+#include <atomic>
+#include <set>
+#include <thread>
+
+/**
+ * @brief FNameTable 헤드리스 테스트
+ * 싱글턴을 모든 테스트가 같이 쓰므로 테스트마다 다른 접두사의 이름만 만든다.
+ * 스레드 테스트는 코어가 하나여도 선점으로 섞이도록 작업 중간에 양보한다.
+ */
+namespace
+{
+	constexpr int32 NumThreads = 4;
+
+	FString MakeName(const char* InPrefix, int32 InIndex)
+	{
+		return FString(InPrefix) + to_string(InIndex);
+	}
+}
+
+void TestCaseInsensitiveComparison()
+{
+	FNameTable& Table = FNameTable::GetInstance();
+
+	const TPair<int32, int32> Upper = Table.FindOrAddName("Case_StaticMesh");
+	const TPair<int32, int32> Lower = Table.FindOrAddName("case_staticmesh");
+	const TPair<int32, int32> Again = Table.FindOrAddName("Case_StaticMesh");
+
+	TEST_CHECK(Upper.first == Upper.second);
+	TEST_CHECK(Lower.first == Upper.first);
+	TEST_CHECK(Lower.second != Upper.second);
+	TEST_CHECK(Again == Upper);
+	TEST_CHECK(Table.GetDisplayString(Lower.second) == "case_staticmesh");
+
+	TEST_CHECK(FName("Case_StaticMesh") == FName("CASE_STATICMESH"));
+	TEST_CHECK(!(FName("Case_StaticMesh") == FName("Case_StaticMesh2")));
+	TEST_CHECK(FName(FString("Case_StaticMesh")).ToString() == "Case_StaticMesh");
+	TEST_CHECK(Table.GetDisplayString(-1).empty() && Table.GetDisplayString(Table.Num()).empty());
+}
+
+void TestUniqueNameNumbering()
+{
+	FNameTable& Table = FNameTable::GetInstance();
+
+	TEST_CHECK(Table.GetUniqueName("Unique_Actor").ToString() == "Unique_Actor_0");
+	TEST_CHECK(Table.GetUniqueName("Unique_Actor").ToString() == "Unique_Actor_1");
+	TEST_CHECK(Table.GetUniqueName("Unique_Other").ToString() == "Unique_Other_0");
+
+	// 넘버링은 원문 기준이고, 되돌리면 0부터 다시 시작한다
+	TEST_CHECK(Table.GetUniqueName("unique_actor").ToString() == "unique_actor_0");
+	Table.ResetNumber("Unique_Actor");
+	TEST_CHECK(Table.GetUniqueName("Unique_Actor").ToString() == "Unique_Actor_0");
+	TEST_CHECK(Table.GetUniqueName("Unique_Other").ToString() == "Unique_Other_1");
+
+	const int32 NumBefore = Table.Num();
+	Table.ResetNumber("Unique_Missing");
+	TEST_CHECK(Table.Num() == NumBefore);
+}
+
+void TestConcurrentFindOrAdd()
+{
+	FNameTable& Table = FNameTable::GetInstance();
+	constexpr int32 NumNames = 3000;
+	const int32 NumBefore = Table.Num();
+
+	// 모든 스레드가 같은 이름들을 서로 다른 순서와 대소문자로 동시에 추가한다
+	TArray<TArray<TPair<int32, int32>>> Results(NumThreads, TArray<TPair<int32, int32>>(NumNames));
+	TArray<std::thread> Threads;
+	for (int32 Thread = 0; Thread < NumThreads; ++Thread)
+	{
+		Threads.emplace_back([&Table, &Results, Thread]()
+		{
+			for (int32 Step = 0; Step < NumNames; ++Step)
+			{
+				const int32 Index = (Thread % 2 == 0) ? Step : NumNames - 1 - Step;
+				const char* Prefix = (Index + Thread) % 2 == 0 ? "Concurrent_Name_" : "CONCURRENT_NAME_";
+				const TPair<int32, int32> Indices = Table.FindOrAddName(MakeName(Prefix, Index));
+				Results[Thread][Index] = Indices;
+				if (Step % 128 == 0)
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+
+	// 같은 원문은 한 엔트리, 대소문자만 다르면 같은 ComparisonIndex
+	bool bConsistent = true;
+	for (int32 Index = 0; Index < NumNames; ++Index)
+	{
+		const TPair<int32, int32> Mixed = Table.FindOrAddName(MakeName("Concurrent_Name_", Index));
+		const TPair<int32, int32> Upper = Table.FindOrAddName(MakeName("CONCURRENT_NAME_", Index));
+		bConsistent &= Mixed.first == Upper.first && Mixed.second != Upper.second;
+		for (int32 Thread = 0; Thread < NumThreads; ++Thread)
+		{
+			const TPair<int32, int32>& Expected = (Index + Thread) % 2 == 0 ? Mixed : Upper;
+			bConsistent &= Results[Thread][Index] == Expected;
+		}
+		bConsistent &= Table.GetDisplayString(Mixed.second) == MakeName("Concurrent_Name_", Index);
+	}
+	TEST_CHECK(bConsistent);
+	TEST_CHECK_MSG(Table.Num() == NumBefore + 2 * NumNames, "%d entries added", Table.Num() - NumBefore);
+}
+
+void TestLookupsDuringGrowth()
+{
+	FNameTable& Table = FNameTable::GetInstance();
+	constexpr int32 NumExisting = 2000;
+	// 슬롯 배열이 여러 번 두 배가 되고 엔트리 청크(16K) 경계도 넘는다
+	constexpr int32 NumAdded = 40000;
+
+	TArray<TPair<int32, int32>> Existing(NumExisting);
+	for (int32 Index = 0; Index < NumExisting; ++Index)
+	{
+		Existing[Index] = Table.FindOrAddName(MakeName("Growth_Existing_", Index));
+	}
+	const int32 NumBefore = Table.Num();
+
+	// 쓰는 스레드는 추가한 인덱스를 적은 뒤 진행 수를 공개한다
+	TArray<TPair<int32, int32>> Added(NumAdded);
+	std::atomic<int32> NumPublished{ 0 };
+	std::atomic<int32> NumReadersStarted{ 0 };
+	std::atomic<int32> Mismatches{ 0 };
+	std::atomic<int64> NumLookups{ 0 };
+
+	TArray<std::thread> Readers;
+	for (int32 Reader = 0; Reader < NumThreads - 1; ++Reader)
+	{
+		Readers.emplace_back([&, Reader]()
+		{
+			NumReadersStarted.fetch_add(1);
+			int64 Lookups = 0;
+			for (int32 Step = Reader; NumPublished.load(std::memory_order_acquire) < NumAdded; ++Step)
+			{
+				const int32 ExistingIndex = Step % NumExisting;
+				if (Table.FindOrAddName(MakeName("Growth_Existing_", ExistingIndex)) != Existing[ExistingIndex])
+				{
+					Mismatches.fetch_add(1);
+				}
+
+				// 방금 공개된 이름도 새 배열/옛 배열 어느 쪽에서든 같은 엔트리로 찾아야 한다
+				const int32 Published = NumPublished.load(std::memory_order_acquire);
+				if (Published > 0)
+				{
+					const int32 AddedIndex = Published - 1 - (Step % std::min(Published, 64));
+					if (Table.FindOrAddName(MakeName("Growth_Added_", AddedIndex)) != Added[AddedIndex])
+					{
+						Mismatches.fetch_add(1);
+					}
+				}
+				Lookups += 2;
+			}
+			NumLookups.fetch_add(Lookups);
+		});
+	}
+
+	while (NumReadersStarted.load() < NumThreads - 1)
+	{
+		std::this_thread::yield();
+	}
+	for (int32 Index = 0; Index < NumAdded; ++Index)
+	{
+		Added[Index] = Table.FindOrAddName(MakeName("Growth_Added_", Index));
+		NumPublished.store(Index + 1, std::memory_order_release);
+		if (Index % 256 == 0)
+		{
+			std::this_thread::yield();
+		}
+	}
+	for (std::thread& Reader : Readers)
+	{
+		Reader.join();
+	}
+
+	TEST_CHECK_MSG(Mismatches.load() == 0, "%d mismatches in %lld lookups", Mismatches.load(), static_cast<long long>(NumLookups.load()));
+	TEST_CHECK(NumLookups.load() > 0);
+	TEST_CHECK_MSG(Table.Num() == NumBefore + NumAdded, "%d entries added", Table.Num() - NumBefore);
+
+	bool bAllFound = true;
+	for (int32 Index = 0; Index < NumAdded; ++Index)
+	{
+		bAllFound &= Table.FindOrAddName(MakeName("Growth_Added_", Index)) == Added[Index];
+		bAllFound &= Table.GetDisplayString(Added[Index].second) == MakeName("Growth_Added_", Index);
+	}
+	TEST_CHECK(bAllFound);
+}
+
+void TestConcurrentUniqueNames()
+{
+	FNameTable& Table = FNameTable::GetInstance();
+	constexpr int32 NumPerThread = 5000;
+
+	// 이미 있는 이름의 번호 증가는 잠그지 않지만 번호가 겹치거나 빠지면 안 된다
+	TArray<TArray<FString>> Names(NumThreads);
+	TArray<std::thread> Threads;
+	for (int32 Thread = 0; Thread < NumThreads; ++Thread)
+	{
+		Threads.emplace_back([&Table, &Names, Thread]()
+		{
+			for (int32 Step = 0; Step < NumPerThread; ++Step)
+			{
+				Names[Thread].push_back(Table.GetUniqueName("Unique_Concurrent").ToString());
+				if (Step % 128 == 0)
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+
+	std::set<FString> Unique;
+	for (const TArray<FString>& ThreadNames : Names)
+	{
+		Unique.insert(ThreadNames.begin(), ThreadNames.end());
+	}
+	TEST_CHECK(Unique.size() == static_cast<size_t>(NumThreads * NumPerThread));
+	TEST_CHECK(Unique.count("Unique_Concurrent_0") == 1);
+	TEST_CHECK(Unique.count(MakeName("Unique_Concurrent_", NumThreads * NumPerThread - 1)) == 1);
+}
+
+int main()
+{
+	RUN_TEST(TestCaseInsensitiveComparison);
+	RUN_TEST(TestUniqueNameNumbering);
+	RUN_TEST(TestConcurrentFindOrAdd);
+	RUN_TEST(TestLookupsDuringGrowth);
+	RUN_TEST(TestConcurrentUniqueNames);
+	return TEST_RESULT();
+}
@@ -0,0 +1,222 @@
+#include "pch.h"
+#include "Level/LevelActorList.h"
+#include "TestHarness.h"
+
+/**
+ * @brief TLevelActorList 헤드리스 테스트
+ * AActor 대신 슬롯 인덱스와 삭제 대기 플래그만 가진 가짜 액터를 쓴다.
+ */
+namespace
+{
+	struct FTestActor
+	{
+		int32 Id = 0;
+		int32 LevelActorIndex = -1;
+		bool bPendingKill = false;
+
+		int32 GetLevelActorIndex() const { return LevelActorIndex; }
+		void SetLevelActorIndex(int32 InIndex) { LevelActorIndex = InIndex; }
+		bool IsPendingKill() const { return bPendingKill; }
+		void SetPendingKill(bool bInPendingKill) { bPendingKill = bInPendingKill; }
+	};
+
+	/** 모든 액터의 인덱스가 자기 슬롯을 가리키는지 */
+	bool SlotsAreConsistent(const TLevelActorList<FTestActor>& InList)
+	{
+		for (int32 Index = 0; Index < InList.Num(); ++Index)
+		{
+			if (InList.GetActors()[Index]->GetLevelActorIndex() != Index)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	TArray<FTestActor> MakeActors(int32 InNum)
+	{
+		TArray<FTestActor> Actors(InNum);
+		for (int32 Index = 0; Index < InNum; ++Index)
+		{
+			Actors[Index].Id = Index;
+		}
+		return Actors;
+	}
+}
+
+void TestSwapRemoveFixesMovedIndex()
+{
+	TArray<FTestActor> Actors = MakeActors(5);
+	TLevelActorList<FTestActor> List;
+	for (FTestActor& Actor : Actors)
+	{
+		List.Add(&Actor);
+	}
+	List.Add(&Actors[2]);
+	TEST_CHECK(List.Num() == 5);
+	TEST_CHECK(SlotsAreConsistent(List));
+
+	// 가운데를 지우면 마지막 액터가 그 자리로 오고 인덱스도 따라간다
+	List.Remove(&Actors[1]);
+	TEST_CHECK(List.Num() == 4);
+	TEST_CHECK(List.GetActors()[1] == &Actors[4]);
+	TEST_CHECK(Actors[4].LevelActorIndex == 1);
+	TEST_CHECK(Actors[1].LevelActorIndex == -1);
+	TEST_CHECK(!List.Contains(&Actors[1]));
+	TEST_CHECK(SlotsAreConsistent(List));
+
+	// 마지막 액터를 지우면 자기 자신과 바뀐다
+	List.Remove(&Actors[3]);
+	TEST_CHECK(List.Num() == 3 && List.GetActors().back() == &Actors[2]);
+	TEST_CHECK(SlotsAreConsistent(List));
+
+	// 이미 빠진 액터와 nullptr은 무시
+	List.Remove(&Actors[1]);
+	List.Remove(nullptr);
+	TEST_CHECK(List.Num() == 3);
+
+	// 다른 목록의 액터는 같은 인덱스를 들고 있어도 포함되지 않는다
+	FTestActor Stranger;
+	Stranger.LevelActorIndex = 0;
+	TEST_CHECK(!List.Contains(&Stranger));
+	List.Remove(&Stranger);
+	TEST_CHECK(List.Num() == 3 && List.GetActors()[0] == &Actors[0]);
+
+	// 다시 넣으면 끝에 붙는다
+	List.Add(&Actors[1]);
+	TEST_CHECK(List.Num() == 4 && Actors[1].LevelActorIndex == 3);
+	TEST_CHECK(SlotsAreConsistent(List));
+}
+
+void TestPendingKillFlag()
+{
+	TArray<FTestActor> Actors = MakeActors(4);
+	TLevelActorList<FTestActor> List;
+	for (FTestActor& Actor : Actors)
+	{
+		List.Add(&Actor);
+	}
+
+	TEST_CHECK(List.IsValid(&Actors[0]));
+	TEST_CHECK(List.MarkPendingKill(&Actors[0]));
+	TEST_CHECK(Actors[0].bPendingKill);
+	// 삭제 대기 중인 액터는 실제 삭제 전까지 목록에 남지만 유효하지 않다
+	TEST_CHECK(List.Contains(&Actors[0]) && !List.IsValid(&Actors[0]));
+	TEST_CHECK(List.Num() == 4 && List.NumPendingKill() == 1);
+
+	// 중복 표시와 목록 밖의 액터는 거부한다
+	TEST_CHECK(!List.MarkPendingKill(&Actors[0]));
+	FTestActor Stranger;
+	TEST_CHECK(!List.MarkPendingKill(&Stranger));
+	TEST_CHECK(!List.MarkPendingKill(nullptr));
+	TEST_CHECK(List.NumPendingKill() == 1 && !Stranger.bPendingKill);
+
+	TEST_CHECK(List.MarkPendingKill(&Actors[2]));
+	const TArray<FTestActor*> Pending = List.TakePendingKill();
+	TEST_CHECK(Pending.size() == 2 && Pending[0] == &Actors[0] && Pending[1] == &Actors[2]);
+	TEST_CHECK(List.NumPendingKill() == 0 && List.Num() == 4);
+
+	// 다시 넣으면 플래그가 풀린다 (PIE 복제 등으로 같은 액터를 다시 등록하는 경우)
+	List.Remove(&Actors[0]);
+	List.Add(&Actors[0]);
+	TEST_CHECK(!Actors[0].bPendingKill && List.IsValid(&Actors[0]));
+}
+
+void TestRemoveBatch()
+{
+	TArray<FTestActor> Actors = MakeActors(10);
+	TLevelActorList<FTestActor> List;
+	for (FTestActor& Actor : Actors)
+	{
+		List.Add(&Actor);
+	}
+	List.MarkPendingKill(&Actors[3]);
+	List.MarkPendingKill(&Actors[7]);
+
+	// 중복, nullptr, 목록 밖 액터는 건너뛰고, 삭제 대기 액터는 대기 목록에서도 빠진다
+	FTestActor Stranger;
+	const TArray<FTestActor*> Batch = { &Actors[9], &Actors[3], nullptr, &Actors[0], &Actors[9], &Stranger, &Actors[5] };
+	TArray<FTestActor*> Removed;
+	List.RemoveBatch(Batch, Removed);
+
+	TEST_CHECK(Removed.size() == 4 &&Removed[0] == &Actors[9] && Removed[1] == &Actors[3] && Removed[2] == &Actors[0] && Removed[3] == &Actors[5]);
+	TEST_CHECK(List.Num() == 6);
+	TEST_CHECK(SlotsAreConsistent(List));
+	for (FTestActor* Actor : Removed)
+	{
+		TEST_CHECK(Actor->LevelActorIndex == -1 && !List.Contains(Actor));
+	}
+
+	const TArray<FTestActor*> Pending = List.TakePendingKill();
+	TEST_CHECK(Pending.size() == 1 && Pending[0] == &Actors[7]);
+
+	// 목록 전체를 지우는 배치
+	TArray<FTestActor*> All(List.GetActors().begin(), List.GetActors().end());
+	List.RemoveBatch(All, Removed);
+	TEST_CHECK(Removed.size() == 6 && List.Num() == 0);
+
+	List.RemoveBatch({}, Removed);
+	TEST_CHECK(Removed.empty());
+}
+
+void TestLargeBatchKeepsSlotsConsistent()
+{
+	// 무작위 순서로 절반을 지워도 남은 액터의 인덱스가 모두 맞아야 한다
+	TArray<FTestActor> Actors = MakeActors(5000);
+	TLevelActorList<FTestActor> List;
+	for (FTestActor& Actor : Actors)
+	{
+		List.Add(&Actor);
+	}
+
+	TArray<FTestActor*> Batch;
+	uint32 Seed = 12345;
+	for (int32 Index = 0; Index < 2500; ++Index)
+	{
+		Seed = Seed * 1664525u + 1013904223u;
+		Batch.push_back(&Actors[Seed % Actors.Num()]);
+	}
+	TArray<FTestActor*> Removed;
+	List.RemoveBatch(Batch, Removed);
+
+	TEST_CHECK(List.Num() + Removed.Num() == 5000);
+	TEST_CHECK(SlotsAreConsistent(List));
+	int32 NumInList = 0;
+	for (const FTestActor& Actor : Actors)
+	{
+		NumInList += List.Contains(&Actor) ? 1 : 0;
+	}
+	TEST_CHECK(NumInList == List.Num());
+}
+
+void TestReleaseAll()
+{
+	TArray<FTestActor> Actors = MakeActors(3);
+	TLevelActorList<FTestActor> List;
+	for (FTestActor& Actor : Actors)
+	{
+		List.Add(&Actor);
+	}
+	List.MarkPendingKill(&Actors[1]);
+
+	// 대기 액터도 목록에 있으므로 한 번만 나온다 (두 번 해제하지 않도록)
+	const TArray<FTestActor*> Released = List.ReleaseAll();
+	TEST_CHECK(Released.size() == 3);
+	TEST_CHECK(List.Num() == 0 && List.NumPendingKill() == 0);
+	bool bIndicesCleared = true;
+	for (const FTestActor& Actor : Actors)
+	{
+		bIndicesCleared &= Actor.LevelActorIndex == -1;
+	}
+	TEST_CHECK(bIndicesCleared);
+}
+
+int main()
+{
+	RUN_TEST(TestSwapRemoveFixesMovedIndex);
+	RUN_TEST(TestPendingKillFlag);
+	RUN_TEST(TestRemoveBatch);
+	RUN_TEST(TestLargeBatchKeepsSlotsConsistent);
+	RUN_TEST(TestReleaseAll);
+	return TEST_RESULT();
+}
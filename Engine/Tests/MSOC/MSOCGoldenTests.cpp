@@ -0,0 +1,404 @@
+#include "pch.h"
+#include "Render/Cull/MSOCDebug.h"
+#include "TestHarness.h"
+
+
+#include <random>
+
+/**
+ * @brief MSOC 골든 버퍼 테스트
+ * Scenes/의 장면을 CPU가 지원하는 SIMD 경로마다 래스터라이즈하고, 덤프한 PGM을 Golden/과 바이트 단위로 비교한다.
+ * 의도한 변경이면 --update-golden으로 다시 만든 뒤 이미지를 확인하고 커밋한다.
+ */
+namespace
+{
+	const FString SceneDir = FString(MSOC_TEST_DATA_DIR) + "/Scenes/";
+	const FString GoldenDir = FString(MSOC_TEST_DATA_DIR) + "/Golden/";
+	const FString OutputDir = "MSOCTestOutput/";
+
+	const char* const SceneNames[] = { "WallAndFloor", "Seam", "Overlap" };
+	const char* const DumpSuffixes[] = { "_coverage.pgm", "_z0.pgm", "_z1.pgm" };
+
+	bool bUpdateGolden = false;
+
+	bool ReadBytes(const FString& InFilePath, TArray<uint8>& OutBytes)
+	{
+		ifstream File(InFilePath, std::ios::binary);
+		if (!File.is_open())
+		{
+			return false;
+		}
+		OutBytes.assign(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+		return true;
+	}
+
+	TArray<FAABB> MakeBoxField(uint32 InSeed, int32 InCount)
+	{
+		std::mt19937 Random(InSeed);
+		std::uniform_real_distribution<float> Lateral(-30.0f, 30.0f);
+		std::uniform_real_distribution<float> Forward(3.0f, 80.0f);
+		std::uniform_real_distribution<float> Size(0.2f, 5.0f);
+
+		TArray<FAABB> Boxes;
+		for (int32 Index = 0; Index < InCount; ++Index)
+		{
+			const FVector Center(Forward(Random), Lateral(Random), Lateral(Random) * 0.3f);
+			const FVector Extent(Size(Random), Size(Random), Size(Random) * 0.5f);
+			Boxes.push_back(FAABB(Center - Extent, Center + Extent));
+		}
+		return Boxes;
+	}
+
+	void TestGoldenScenes()
+	{
+		create_directories(OutputDir);
+		const ESIMDLevel PreviousLevel = FCPUFeatures::GetActiveLevel();
+
+		for (const char* SceneName : SceneNames)
+		{
+			FOcclusionScene Scene;
+			TEST_CHECK_MSG(FOcclusionHarness::LoadScene(SceneDir + SceneName + ".txt", Scene), "%s", SceneName);
+
+			for (int32 LevelIndex = 0; LevelIndex <= static_cast<int32>(FCPUFeatures::Get().MaxLevel); ++LevelIndex)
+			{
+				const ESIMDLevel Level = static_cast<ESIMDLevel>(LevelIndex);
+				FCPUFeatures::SetActiveLevel(Level);
+
+				USoftwareOcclusionCuller Culler;
+				FOcclusionHarnessReport Report;
+				FOcclusionHarness::Run(Scene, Culler, Report);
+
+				std::printf("  %-12s %-7s buffer %dx%d  raster %.3f ms  test %.3f ms  occluded %d/%d\n",
+					SceneName, FCPUFeatures::ToString(Level), Culler.GetHiZ().ScreenW, Culler.GetHiZ().ScreenH,
+					Report.RasterizeMs, Report.TestMs, Report.NumOccluded, static_cast<int32>(Scene.Occludees.size()));
+				TEST_CHECK_MSG(Report.NumMismatched == 0, "%s/%s: %d occludees differ from the scene expectation",
+					SceneName, FCPUFeatures::ToString(Level), Report.NumMismatched);
+
+				const FString Prefix = OutputDir + SceneName + "_" + FCPUFeatures::ToString(Level);
+				TEST_CHECK(FOcclusionHarness::DumpBuffer(Culler.GetHiZ(), Prefix));
+
+				for (const char* Suffix : DumpSuffixes)
+				{
+					TArray<uint8> Actual;
+					TEST_CHECK(ReadBytes(Prefix + Suffix, Actual));
+
+					const FString GoldenPath = GoldenDir + SceneName + Suffix;
+					if (bUpdateGolden && Level == ESIMDLevel::Scalar)
+					{
+						ofstream(GoldenPath, std::ios::binary).write(reinterpret_cast<const char*>(Actual.data()),
+							static_cast<streamsize>(Actual.size()));
+					}
+
+					TArray<uint8> Golden;
+					TEST_CHECK_MSG(ReadBytes(GoldenPath, Golden), "missing golden %s", GoldenPath.c_str());
+					TEST_CHECK_MSG(Actual == Golden, "%s%s differs from %s", Prefix.c_str(), Suffix, GoldenPath.c_str());
+				}
+			}
+		}
+
+		FCPUFeatures::SetActiveLevel(PreviousLevel);
+	}
+
+	/**
+	 * @brief 백버퍼 해상도의 정확한 깊이 버퍼 (픽셀 중심마다 보간한 가장 가까운 오클루더 깊이)
+	 * MSOC는 해상도마다 타일 층을 다르게 병합하므로 백버퍼 해상도 MSOC 결과가 아니라 이것을 기준으로 보수성을 확인한다.
+	 */
+	struct FReferenceDepth
+	{
+		int32 W = 0, H = 0;
+		TArray<float> Depth;
+
+		void Rasterize(const TArray<FSoftwareTri>& InTris, const FMatrix& InViewProj, const FOcclusionViewport& InVP)
+		{
+			Depth.assign(static_cast<size_t>(W) * H, 1.0f);
+			for (const FSoftwareTri& T : InTris)
+			{
+				FProjectedTri Clipped[2];
+				const int NumClipped = ProjectTriangleClipped(T, InViewProj, InVP, Clipped, W, H);
+				for (int i = 0; i < NumClipped; ++i)
+				{
+					const FProjectedTri& P = Clipped[i];
+					const float Area = (P.x1 - P.x0) * (P.y2 - P.y0) - (P.y1 - P.y0) * (P.x2 - P.x0);
+					for (int y = P.minY; y <= P.maxY; ++y)
+					{
+						for (int x = P.minX; x <= P.maxX; ++x)
+						{
+							const float Px = x + 0.5f, Py = y + 0.5f;
+							const float W0 = (P.x2 - P.x1) * (Py - P.y1) - (P.y2 - P.y1) * (Px - P.x1);
+							const float W1 = (P.x0 - P.x2) * (Py - P.y2) - (P.y0 - P.y2) * (Px - P.x2);
+							const float W2 = (P.x1 - P.x0) * (Py - P.y0) - (P.y1 - P.y0) * (Px - P.x0);
+							if (W0 < 0.0f || W1 < 0.0f || W2 < 0.0f) continue;
+
+							float& Z = Depth[static_cast<size_t>(y) * W + x];
+							Z = std::min(Z, (W0 * P.z0 + W1 * P.z1 + W2 * P.z2) / Area);
+						}
+					}
+				}
+			}
+		}
+
+		/** 투영 사각형 안의 픽셀 중심 중 하나라도 박스의 최소 깊이보다 가까운 오클루더가 없으면 보인다 */
+		bool IsVisible(const FAABB& InBox, const FMatrix& InViewProj, const FOcclusionViewport& InVP) const
+		{
+			float MinX = FLT_MAX, MinY = FLT_MAX, MaxX = -FLT_MAX, MaxY = -FLT_MAX, MinZ = FLT_MAX;
+			for (int Corner = 0; Corner < 8; ++Corner)
+			{
+				const FVector P((Corner & 1) ? InBox.Max.X : InBox.Min.X, (Corner & 2) ? InBox.Max.Y : InBox.Min.Y,
+					(Corner & 4) ? InBox.Max.Z : InBox.Min.Z);
+				float X, Y, Z, HW;
+				if (!ProjectToScreen(P, InViewProj, InVP, X, Y, Z, HW))
+				{
+					return true; // 컬러도 카메라 뒤로 걸친 박스는 보이는 것으로 처리한다
+				}
+				MinX = std::min(MinX, X); MaxX = std::max(MaxX, X);
+				MinY = std::min(MinY, Y); MaxY = std::max(MaxY, Y);
+				MinZ = std::min(MinZ, Z);
+			}
+
+			const int x0 = std::max(0, static_cast<int>(std::ceil(MinX - 0.5f)));
+			const int x1 = std::min(W - 1, static_cast<int>(std::floor(MaxX - 0.5f)));
+			const int y0 = std::max(0, static_cast<int>(std::ceil(MinY - 0.5f)));
+			const int y1 = std::min(H - 1, static_cast<int>(std::floor(MaxY - 0.5f)));
+			for (int y = y0; y <= y1; ++y)
+			{
+				for (int x = x0; x <= x1; ++x)
+				{
+					if (!(std::clamp(MinZ, 0.0f, 1.0f) > Depth[static_cast<size_t>(y) * W + x]))
+					{
+						return true;
+					}
+				}
+			}
+			return false;
+		}
+	};
+
+	void TestDownsampledNeverFalselyOccludes()
+	{
+		// 어느 버퍼 해상도에서든 가려졌다고 판정한 박스는 백버퍼 해상도의 정확한 깊이에서도 가려져야 한다
+		const TPair<int, int> BackBuffers[] = { { 1920, 1080 }, { 1366, 768 }, { 333, 201 } };
+		const TArray<TPair<int, int>> Sizes = { { 1024, 512 }, { 512, 256 }, { 301, 97 }, { 64, 32 } };
+
+		uint32 Seed = 1;
+		for (const TPair<int, int>& BackBuffer : BackBuffers)
+		{
+			FOcclusionScene Scene;
+			Scene.ScreenW = BackBuffer.first;
+			Scene.ScreenH = BackBuffer.second;
+			const FOcclusionViewport Viewport = {
+				0.0f, 0.0f, static_cast<float>(Scene.ScreenW), static_cast<float>(Scene.ScreenH), 0.0f, 1.0f };
+			const FMatrix ViewProj = Scene.BuildViewProj();
+			const TArray<FAABB> Boxes = MakeBoxField(Seed++, 1500);
+
+			TArray<FSoftwareTri> Tris;
+			for (const FAABB& Box : Boxes)
+			{
+				AppendAABBAsTris(Box, Tris);
+			}
+			FReferenceDepth Reference;
+			Reference.W = Scene.ScreenW;
+			Reference.H = Scene.ScreenH;
+			Reference.Rasterize(Tris, ViewProj, Viewport);
+
+			TArray<FOcclusionBenchmarkResult> Results;
+			USoftwareOcclusionCuller::BenchmarkResolutions(Boxes, ViewProj, Viewport, Scene.ScreenW, Scene.ScreenH, Sizes, Results);
+			TEST_CHECK(Results.size() == Sizes.size() + 1);
+			TEST_CHECK(Results[0].NumOccluded > 0);
+
+			for (const FOcclusionBenchmarkResult& Result : Results)
+			{
+				USoftwareOcclusionCuller Culler;
+				Culler.SetBufferResolution(Result.BufferW, Result.BufferH);
+				Culler.Init(Scene.ScreenW, Scene.ScreenH);
+				Culler.BeginFrame(ViewProj, Viewport);
+				Culler.RasterizeOcculuderTriangles(Tris);
+
+				int32 NumFalseOccluded = 0;
+				for (const FAABB& Box : Boxes)
+				{
+					NumFalseOccluded += (Culler.TestAABB(Box) && Reference.IsVisible(Box, ViewProj, Viewport)) ? 1 : 0;
+				}
+
+				std::printf("  %4dx%-4d -> %4dx%-4d  raster %.3f ms (x%.2f)  occluded %d  missed %d  extra %d  false %d\n",
+					Scene.ScreenW, Scene.ScreenH, Result.BufferW, Result.BufferH, Result.RasterizeMs, Result.RasterSpeedup,
+					Result.NumOccluded, Result.NumMissedOccluded, Result.NumExtraOccluded, NumFalseOccluded);
+				TEST_CHECK(Result.NumTiles <= Results[0].NumTiles);
+				TEST_CHECK(NumFalseOccluded == 0);
+			}
+		}
+	}
+
+	void TestSubTexelSilhouettes()
+	{
+		// 벽 뒤의 박스 가장자리를 벽 외곽 안쪽 몇 텍셀에서 바깥쪽까지 픽셀보다 잘게 훑는다.
+		// 외곽에 걸친 텍셀을 덮은 것으로 치면(보수적 축소 없이) 살짝 삐져나온 박스가 가려진 것으로 잘못 판정된다.
+		const TArray<TPair<int, int>> Sizes = { { 480, 270 }, { 211, 119 }, { 96, 54 } };
+		const float Rolls[] = { 0.0f, 17.0f };
+
+		TArray<FAABB> Occludees;
+		for (int32 Step = -500; Step <= 60; ++Step)
+		{
+			const float Offset = Step * 0.004f;
+			Occludees.push_back(FAABB(FVector(20.0f, -1.0f, -1.0f), FVector(21.0f, 6.0f + Offset, 1.0f)));
+			Occludees.push_back(FAABB(FVector(20.0f, -6.0f - Offset, -1.0f), FVector(21.0f, 1.0f, 1.0f)));
+			Occludees.push_back(FAABB(FVector(20.0f, -1.0f, -1.0f), FVector(21.0f, 1.0f, 4.0f + Offset)));
+			Occludees.push_back(FAABB(FVector(20.0f, -1.0f, -4.0f - Offset), FVector(21.0f, 1.0f, 1.0f)));
+		}
+
+		TArray<FSoftwareTri> Tris;
+		AppendAABBAsTris(FAABB(FVector(10.0f, -3.0f, -2.0f), FVector(11.0f, 3.0f, 2.0f)), Tris);
+
+		for (float Roll : Rolls)
+		{
+			FOcclusionScene Scene;
+			Scene.ScreenW = 1920;
+			Scene.ScreenH = 1080;
+			Scene.CameraRotation = FVector(Roll, 0.0f, 0.0f);
+			const FOcclusionViewport Viewport = {
+				0.0f, 0.0f, static_cast<float>(Scene.ScreenW), static_cast<float>(Scene.ScreenH), 0.0f, 1.0f };
+			const FMatrix ViewProj = Scene.BuildViewProj();
+
+			FReferenceDepth Reference;
+			Reference.W = Scene.ScreenW;
+			Reference.H = Scene.ScreenH;
+			Reference.Rasterize(Tris, ViewProj, Viewport);
+
+			for (const TPair<int, int>& Size : Sizes)
+			{
+				USoftwareOcclusionCuller Culler;
+				Culler.SetBufferResolution(Size.first, Size.second);
+				Culler.Init(Scene.ScreenW, Scene.ScreenH);
+				Culler.BeginFrame(ViewProj, Viewport);
+				Culler.RasterizeOcculuderTriangles(Tris);
+
+				int32 NumOccluded = 0;
+				int32 NumFalseOccluded = 0;
+				for (const FAABB& Box : Occludees)
+				{
+					const bool bOccluded = Culler.TestAABB(Box);
+					NumOccluded += bOccluded ? 1 : 0;
+					NumFalseOccluded += (bOccluded && Reference.IsVisible(Box, ViewProj, Viewport)) ? 1 : 0;
+				}
+				TEST_CHECK_MSG(NumOccluded > 0, "roll %.0f, %dx%d", Roll, Size.first, Size.second);
+				TEST_CHECK_MSG(NumFalseOccluded == 0, "roll %.0f, %dx%d: %d boxes", Roll, Size.first, Size.second,
+					NumFalseOccluded);
+			}
+		}
+	}
+
+	void TestReprojectionKeyedByView()
+	{
+		FOcclusionScene Scene;
+		Scene.CameraLocation = FVector(-2.0f, 1.0f, 0.5f);
+		Scene.CameraRotation = FVector(0.0f, 5.0f, 10.0f);
+		const FOcclusionViewport Viewport = {
+			0.0f, 0.0f, static_cast<float>(Scene.ScreenW), static_cast<float>(Scene.ScreenH), 0.0f, 1.0f };
+		const FMatrix ViewProj = Scene.BuildViewProj();
+		const FMatrix InvViewProj = Scene.BuildViewProjInverse();
+
+		// 카메라 역행렬 규칙으로 만든 역행렬이 실제로 역행렬이어야 재투영 위치가 맞다
+		const FMatrix Product = ViewProj * InvViewProj;
+		float MaxError = 0.0f;
+		for (int r = 0; r < 4; ++r)
+		{
+			for (int c = 0; c < 4; ++c)
+			{
+				MaxError = std::max(MaxError, std::fabs(Product.Data[r][c] - FMatrix::Identity.Data[r][c]));
+			}
+		}
+		TEST_CHECK_MSG(MaxError < 1e-3f, "max error %f", MaxError);
+
+		TArray<FSoftwareTri> Wall;
+		AppendAABBAsTris(FAABB(FVector(10.0f, -8.0f, -6.0f), FVector(11.0f, 8.0f, 6.0f)), Wall);
+		const FAABB Behind(FVector(20.0f, -1.0f, -1.0f), FVector(21.0f, 1.0f, 1.0f));
+
+		USoftwareOcclusionCuller Culler;
+		Culler.SetBufferResolution(0, 0);
+		Culler.Init(Scene.ScreenW, Scene.ScreenH);
+		Culler.SetReprojectionSeeding(true);
+
+		// 뷰 0에서 벽을 그린다
+		Culler.BeginFrame(ViewProj, InvViewProj, Viewport, 0);
+		Culler.RasterizeOcculuderTriangles(Wall);
+		TEST_CHECK(Culler.TestAABB(Behind));
+
+		// 같은 카메라라도 다른 뷰는 뷰 0의 깊이로 시딩하지 않는다
+		Culler.BeginFrame(ViewProj, InvViewProj, Viewport, 1);
+		TEST_CHECK(!Culler.TestAABB(Behind));
+
+		// 뷰 0으로 돌아오면 뷰 0의 직전 프레임으로 시딩한다 (사이에 뷰 1이 그렸어도)
+		Culler.BeginFrame(ViewProj, InvViewProj, Viewport, 0);
+		TEST_CHECK(Culler.TestAABB(Behind));
+
+		// 이력을 남기지 않는 단발 프레임은 시딩하지 않는다
+		Culler.BeginFrame(ViewProj, Viewport);
+		TEST_CHECK(!Culler.TestAABB(Behind));
+
+		// 해상도가 바뀌면 이력은 버린다
+		Culler.BeginFrame(ViewProj, InvViewProj, Viewport, 0);
+		Culler.RasterizeOcculuderTriangles(Wall);
+		Culler.Resize(Scene.ScreenW, Scene.ScreenH);
+		Culler.BeginFrame(ViewProj, InvViewProj, Viewport, 0);
+		TEST_CHECK(!Culler.TestAABB(Behind));
+	}
+
+	void TestBatchMatchesSingle()
+	{
+		const TArray<FAABB> Boxes = MakeBoxField(77, 700);
+		FAABBSoA BoxesSoA;
+		for (const FAABB& Box : Boxes)
+		{
+			BoxesSoA.Add(Box);
+		}
+
+		FOcclusionScene Scene;
+		const FOcclusionViewport Viewport = {
+			0.0f, 0.0f, static_cast<float>(Scene.ScreenW), static_cast<float>(Scene.ScreenH), 0.0f, 1.0f };
+
+		TArray<FSoftwareTri> Tris;
+		for (const FAABB& Box : Boxes)
+		{
+			AppendAABBAsTris(Box, Tris);
+		}
+
+		const ESIMDLevel PreviousLevel = FCPUFeatures::GetActiveLevel();
+		for (int32 LevelIndex = 0; LevelIndex <= static_cast<int32>(FCPUFeatures::Get().MaxLevel); ++LevelIndex)
+		{
+			FCPUFeatures::SetActiveLevel(static_cast<ESIMDLevel>(LevelIndex));
+
+			USoftwareOcclusionCuller Culler;
+			Culler.Init(Scene.ScreenW, Scene.ScreenH);
+			Culler.BeginFrame(Scene.BuildViewProj(), Viewport);
+			Culler.RasterizeOcculuderTriangles(Tris);
+
+			TArray<uint64> VisibleBits;
+			Culler.TestAABBBatch(BoxesSoA, VisibleBits);
+
+			int32 NumDifferent = 0;
+			for (int32 Index = 0; Index < static_cast<int32>(Boxes.size()); ++Index)
+			{
+				// 배치는 보이는 박스에 1, TestAABB는 가려진 박스에 true
+				const bool bBatchOccluded = ((VisibleBits[Index >> 6] >> (Index & 63)) & 1ull) == 0;
+				NumDifferent += (bBatchOccluded != Culler.TestAABB(Boxes[Index])) ? 1 : 0;
+			}
+			TEST_CHECK_MSG(NumDifferent == 0, "%s: %d boxes", FCPUFeatures::ToString(static_cast<ESIMDLevel>(LevelIndex)),
+				NumDifferent);
+		}
+		FCPUFeatures::SetActiveLevel(PreviousLevel);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	for (int Index = 1; Index < argc; ++Index)
+	{
+		bUpdateGolden |= FString(argv[Index]) == "--update-golden";
+	}
+
+	RUN_TEST(TestGoldenScenes);
+	RUN_TEST(TestDownsampledNeverFalselyOccludes);
+	RUN_TEST(TestSubTexelSilhouettes);
+	RUN_TEST(TestReprojectionKeyedByView);
+	RUN_TEST(TestBatchMatchesSingle);
+	return TEST_RESULT();
+}
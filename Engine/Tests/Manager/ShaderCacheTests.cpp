@@ -0,0 +1,195 @@
+#include "Manager/Resource/ShaderCache.h"
+#include "TestHarness.h"
+
+#include <cstring>
+
+/**
+ * @brief FShaderCache 헤드리스 테스트
+ * 임시 디렉토리에 가짜 HLSL 소스/인클루드와 캐시 디렉토리를 만들어 키, 저장/읽기, 블롭 정리를 확인한다.
+ */
+namespace
+{
+	path GetTestRoot() { return filesystem::temp_directory_path() / "EngineShaderCacheTests"; }
+
+	void WriteFile(const path& InPath, const FString& InContents)
+	{
+		create_directories(InPath.parent_path());
+		ofstream File(InPath, std::ios::binary | std::ios::trunc);
+		File << InContents;
+	}
+
+	void ResetTestRoot()
+	{
+		std::error_code Error;
+		filesystem::remove_all(GetTestRoot(), Error);
+		WriteFile(GetTestRoot() / "Shader" / "Common.hlsli", "float4 Tint;\n");
+		WriteFile(GetTestRoot() / "Shader" / "Test.hlsl", "#include \"Common.hlsli\"\nfloat4 MainPS() : SV_Target { return Tint; }\n");
+	}
+
+	FShaderCompileRequest MakeRequest()
+	{
+		FShaderCompileRequest Request;
+		Request.SourcePath = (GetTestRoot() / "Shader" / "Test.hlsl").generic_string();
+		Request.EntryPoint = "MainPS";
+		Request.Profile = "ps_5_0";
+		return Request;
+	}
+
+	uint64 KeyOf(const FShaderCompileRequest& InRequest)
+	{
+		uint64 Key = 0;
+		TEST_CHECK(FShaderCache::ComputeKey(InRequest, Key));
+		return Key;
+	}
+
+	int32 CountBlobs(const FShaderCache& InCache)
+	{
+		int32 Count = 0;
+		std::error_code Error;
+		for (const auto& Entry : filesystem::directory_iterator(InCache.GetCacheDirectory(), Error))
+		{
+			Count += Entry.path().extension() == ".cso" ? 1 : 0;
+		}
+		return Count;
+	}
+
+	const uint8 BytecodeA[] = { 0x44, 0x58, 0x42, 0x43, 1, 2, 3 };
+	const uint8 BytecodeB[] = { 0x44, 0x58, 0x42, 0x43, 9, 8, 7, 6 };
+}
+
+void TestKeyCoversAllInputs()
+{
+	ResetTestRoot();
+	const FShaderCompileRequest Base = MakeRequest();
+	const uint64 BaseKey = KeyOf(Base);
+	TEST_CHECK(KeyOf(Base) == BaseKey);
+
+	FShaderCompileRequest Request = Base;
+	Request.EntryPoint = "OtherPS";
+	TEST_CHECK(KeyOf(Request) != BaseKey);
+
+	Request = Base;
+	Request.Profile = "ps_4_0";
+	TEST_CHECK(KeyOf(Request) != BaseKey);
+
+	Request = Base;
+	Request.Defines.push_back({ "USE_TINT", "1" });
+	const uint64 DefineKey = KeyOf(Request);
+	TEST_CHECK(DefineKey != BaseKey);
+	Request.Defines[0].second = "0";
+	TEST_CHECK(KeyOf(Request) != DefineKey);
+
+	Request = Base;
+	Request.Flags = 1u << 11;
+	TEST_CHECK(KeyOf(Request) != BaseKey);
+
+	Request = Base;
+	Request.CompilerVersion = 47;
+	TEST_CHECK(KeyOf(Request) != BaseKey);
+
+	// 인클루드 내용만 바뀌어도 키가 바뀐다
+	WriteFile(GetTestRoot() / "Shader" / "Common.hlsli", "float4 Tint; float Scale;\n");
+	TEST_CHECK(KeyOf(Base) != BaseKey);
+
+	uint64 Key = 0;
+	FShaderCompileRequest Missing = Base;
+	Missing.SourcePath = (GetTestRoot() / "Shader" / "Missing.hlsl").generic_string();
+	TEST_CHECK(!FShaderCache::ComputeKey(Missing, Key));
+}
+
+void TestStoreAndLoad()
+{
+	ResetTestRoot();
+	const FShaderCache Cache((GetTestRoot() / "Cache").generic_string());
+	const FShaderCompileRequest Request = MakeRequest();
+	const uint64 Key = KeyOf(Request);
+
+	TArray<uint8> Loaded;
+	TEST_CHECK(!Cache.Load(Request, Key, Loaded));
+	TEST_CHECK(!Cache.Store(Request, Key, BytecodeA, 0));
+
+	TEST_CHECK(Cache.Store(Request, Key, BytecodeA, sizeof(BytecodeA)));
+	TEST_CHECK(Cache.Load(Request, Key, Loaded));
+	TEST_CHECK(Loaded.size() == sizeof(BytecodeA) && std::equal(Loaded.begin(), Loaded.end(), BytecodeA));
+	TEST_CHECK(!Cache.Load(Request, Key + 1, Loaded));
+
+	// 헤더의 키가 파일 이름과 다르면 깨진 블롭으로 본다
+	filesystem::copy_file(Cache.GetBlobPath(Request, Key), Cache.GetBlobPath(Request, Key ^ 0xFF));
+	TEST_CHECK(!Cache.Load(Request, Key ^ 0xFF, Loaded));
+
+	// 잘린 블롭
+	WriteFile(Cache.GetBlobPath(Request, Key), "SHDC");
+	TEST_CHECK(!Cache.Load(Request, Key, Loaded));
+}
+
+void TestPermutationsDoNotEvictEachOther()
+{
+	ResetTestRoot();
+	const FShaderCache Cache((GetTestRoot() / "Cache").generic_string());
+
+	const FShaderCompileRequest Plain = MakeRequest();
+	FShaderCompileRequest Tinted = MakeRequest();
+	Tinted.Defines.push_back({ "USE_TINT", "1" });
+	FShaderCompileRequest Debug = MakeRequest();
+	Debug.Flags = 1u << 0;
+
+	TEST_CHECK(Cache.GetBlobPath(Plain, 1) != Cache.GetBlobPath(Tinted, 1));
+	TEST_CHECK(Cache.GetBlobPath(Plain, 1) != Cache.GetBlobPath(Debug, 1));
+
+	TEST_CHECK(Cache.Store(Plain, KeyOf(Plain), BytecodeA, sizeof(BytecodeA)));
+	TEST_CHECK(Cache.Store(Tinted, KeyOf(Tinted), BytecodeB, sizeof(BytecodeB)));
+	TEST_CHECK(Cache.Store(Debug, KeyOf(Debug), BytecodeA, sizeof(BytecodeA)));
+	TEST_CHECK(CountBlobs(Cache) == 3);
+
+	TArray<uint8> Loaded;
+	TEST_CHECK(Cache.Load(Plain, KeyOf(Plain), Loaded) && Loaded.size() == sizeof(BytecodeA));
+	TEST_CHECK(Cache.Load(Tinted, KeyOf(Tinted), Loaded) && Loaded.size() == sizeof(BytecodeB));
+	TEST_CHECK(Cache.Load(Debug, KeyOf(Debug), Loaded) && Loaded.size() == sizeof(BytecodeA));
+
+	// 소스가 바뀌면 다시 저장한 퍼뮤테이션의 이전 키 블롭만 지워진다
+	const uint64 OldPlainKey = KeyOf(Plain);
+	const uint64 OldTintedKey = KeyOf(Tinted);
+	WriteFile(GetTestRoot() / "Shader" / "Common.hlsli", "float4 Tint; // changed\n");
+	const uint64 NewTintedKey = KeyOf(Tinted);
+	TEST_CHECK(NewTintedKey != OldTintedKey);
+	TEST_CHECK(Cache.Store(Tinted, NewTintedKey, BytecodeA, sizeof(BytecodeA)));
+
+	TEST_CHECK(!exists(Cache.GetBlobPath(Tinted, OldTintedKey)));
+	TEST_CHECK(Cache.Load(Tinted, NewTintedKey, Loaded));
+	TEST_CHECK(exists(Cache.GetBlobPath(Plain, OldPlainKey)));
+	TEST_CHECK(CountBlobs(Cache) == 3);
+}
+
+void TestStoreOnlyRemovesMatchingBlobNames()
+{
+	ResetTestRoot();
+	const FShaderCache Cache((GetTestRoot() / "Cache").generic_string());
+	const FShaderCompileRequest Request = MakeRequest();
+	const uint64 Key = KeyOf(Request);
+
+	// 같은 접두사로 시작하지만 블롭 이름 모양이 아닌 파일은 남는다
+	const FString BlobPath = Cache.GetBlobPath(Request, Key);
+	const FString Prefix = BlobPath.substr(0, BlobPath.size() - std::strlen("0123456789abcdef.cso"));
+	WriteFile(Prefix + "notes.txt", "keep");
+	WriteFile(Prefix + "0123456789abcdef_extra.cso", "keep");
+	WriteFile(Prefix + "0123456789abcdef.cso", "stale");
+
+	TEST_CHECK(Cache.Store(Request, Key, BytecodeA, sizeof(BytecodeA)));
+	TEST_CHECK(exists(Prefix + "notes.txt"));
+	TEST_CHECK(exists(Prefix + "0123456789abcdef_extra.cso"));
+	TEST_CHECK(!exists(Prefix + "0123456789abcdef.cso"));
+	TEST_CHECK(exists(BlobPath));
+	TEST_CHECK(!exists(BlobPath + ".tmp"));
+}
+
+int main()
+{
+	RUN_TEST(TestKeyCoversAllInputs);
+	RUN_TEST(TestStoreAndLoad);
+	RUN_TEST(TestPermutationsDoNotEvictEachOther);
+	RUN_TEST(TestStoreOnlyRemovesMatchingBlobNames);
+
+	std::error_code Error;
+	filesystem::remove_all(GetTestRoot(), Error);
+	return TEST_RESULT();
+}
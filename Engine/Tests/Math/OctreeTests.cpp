@@ -0,0 +1,274 @@
+#include "pch.h"
+#include "Math/Octree.h"
+#include "TestHarness.h"
+
+#include <map>
+#include <queue>
+#include <set>
+
+/**
+ * @brief TOctree 헤드리스 테스트
+ * 프리미티브 컴포넌트 대신 위치/크기와 OctreeIndex만 가진 가짜 element를 쓴다.
+ * 같은 배치를 RemoveElements로 한 번에 지운 트리와 RemoveElement로 하나씩 지운 트리가 같은 결과인지 본다.
+ */
+namespace
+{
+	struct FTestElement
+	{
+		int32 Id = 0;
+		FVector Position;
+		float HalfSize = 0.5f;
+		int32 OctreeIndex = -1;
+
+		bool IsRayCollided(const FRay& InRay, float& OutDistance) const { return false; }
+	};
+
+	struct FTestElementTrait
+	{
+		static FAABB GetWorldAABB(const FTestElement* InElement)
+		{
+			const FVector Half(InElement->HalfSize, InElement->HalfSize, InElement->HalfSize);
+			return FAABB(InElement->Position - Half, InElement->Position + Half);
+		}
+		static FVector GetPosition(const FTestElement* InElement) { return InElement->Position; }
+		static int32 GetOctreeIndex(const FTestElement* InElement) { return InElement->OctreeIndex; }
+		static void SetOctreeIndex(FTestElement* InElement, int32 InIndex) { InElement->OctreeIndex = InIndex; }
+		static bool IsRayCollided(const FTestElement* InElement, const FRay& InRay, float& OutDistance) { return false; }
+	};
+
+	using FTestOctree = TOctree<FTestElement, FTestElementTrait>;
+
+	constexpr int32 NumClustered = 400;
+	constexpr int32 NumSpread = 200;
+	constexpr int32 NumOutside = 20;
+	constexpr int32 NumLate = 150;
+	constexpr int32 NumElements = NumClustered + NumSpread + NumOutside + NumLate;
+
+	/** 한 구석에 몰린 element(노드가 여러 번 분할됨), 고르게 퍼진 element, 루트 밖 element, 재정렬 뒤에 넣을 element */
+	TArray<FTestElement> MakeElements()
+	{
+		TArray<FTestElement> Elements(NumElements);
+		uint32 Seed = 7;
+		auto Random = [&Seed](float InMin, float InMax)
+		{
+			Seed = Seed * 1664525u + 1013904223u;
+			return InMin + (InMax - InMin) * static_cast<float>(Seed >> 8) / static_cast<float>(1u << 24);
+		};
+
+		for (int32 Index = 0; Index < NumElements; ++Index)
+		{
+			FTestElement& Element = Elements[Index];
+			Element.Id = Index;
+			if (Index < NumClustered)
+			{
+				Element.Position = FVector(Random(60.0f, 70.0f), Random(60.0f, 70.0f), Random(60.0f, 70.0f));
+				Element.HalfSize = 0.1f;
+			}
+			else if (Index < NumClustered + NumSpread || Index >= NumClustered + NumSpread + NumOutside)
+			{
+				Element.Position = FVector(Random(-90.0f, 90.0f), Random(-90.0f, 90.0f), Random(-90.0f, 90.0f));
+			}
+			else
+			{
+				Element.Position = FVector(Random(150.0f, 200.0f), Random(-10.0f, 10.0f), 0.0f);
+			}
+		}
+		return Elements;
+	}
+
+	/** 재정렬까지 마치고 늦게 넣은 element는 TemporalElements에 남은 트리 */
+	void BuildOctree(FTestOctree& OutOctree, TArray<FTestElement>& InElements)
+	{
+		OutOctree.NewOctree(FAABB(FVector(-100, -100, -100), FVector(100, 100, 100)));
+		for (int32 Index = 0; Index < NumElements - NumLate; ++Index)
+		{
+			OutOctree.AddElement(&InElements[Index], 0);
+		}
+		// 주기(2초)를 넘는 시간을 넘겨 바로 재정렬되게 한다
+		OutOctree.Rearrange(10.0f);
+		for (int32 Index = NumElements - NumLate; Index < NumElements; ++Index)
+		{
+			OutOctree.AddElement(&InElements[Index], 0);
+		}
+	}
+
+	/** 노드별로 트리가 참조하는 element Id (노드 구간 + TemporalElements). 루트 밖은 키 -1 */
+	std::map<int32, std::multiset<int32>> CollectReferenced(FTestOctree& InOctree)
+	{
+		std::map<int32, std::multiset<int32>> Referenced;
+		TArray<FTestOctree::FOctreeNode>& Nodes = InOctree.GetOctreeNodes();
+		TArray<FTestElement*>& Elements = InOctree.GetElementList();
+		for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+		{
+			const FTestOctree::FOctreeNode& Node = Nodes[NodeIndex];
+			for (uint32 Offset = 0; Offset < Node.ElementCount; ++Offset)
+			{
+				Referenced[NodeIndex].insert(Elements[Node.ElementStartIndex + Offset]->Id);
+			}
+			for (const FTestElement* Element : Node.TemporalElements)
+			{
+				Referenced[NodeIndex].insert(Element->Id);
+			}
+		}
+		for (const FTestElement* Element : InOctree.GetElementsOutsideOctree())
+		{
+			Referenced[-1].insert(Element->Id);
+		}
+		return Referenced;
+	}
+
+	/** 트리가 InExpected만 정확히 한 번씩 참조하고, 각 element의 OctreeIndex가 자기를 참조하는 노드인지 */
+	bool MatchesElements(FTestOctree& InOctree, const TArray<FTestElement>& InElements, const std::set<int32>& InExpected)
+	{
+		std::multiset<int32> AllReferenced;
+		for (const auto& [NodeIndex, Ids] : CollectReferenced(InOctree))
+		{
+			for (int32 Id : Ids)
+			{
+				if (InElements[Id].OctreeIndex != NodeIndex)
+				{
+					return false;
+				}
+				AllReferenced.insert(Id);
+			}
+		}
+		return AllReferenced == std::multiset<int32>(InExpected.begin(), InExpected.end());
+	}
+
+	/** 지울 배치: 재정렬된 것, 임시 공간에 있는 것, 루트 밖, 중복, 트리에 없던 것 */
+	TArray<FTestElement*> MakeBatch(TArray<FTestElement>& InElements, FTestElement& InStranger)
+	{
+		TArray<FTestElement*> Batch;
+		for (int32 Index = 0; Index < NumElements; Index += 3)
+		{
+			Batch.push_back(&InElements[Index]);
+		}
+		// 몰린 element는 2/3를 지워 한 노드에서 여러 개가 같이 빠지게 함
+		for (int32 Index = 0; Index < NumClustered; Index += 3)
+		{
+			Batch.push_back(&InElements[Index + 1]);
+		}
+		Batch.push_back(&InElements[0]);
+		Batch.push_back(&InElements[NumClustered + NumSpread + 1]);
+		Batch.push_back(&InStranger);
+		return Batch;
+	}
+}
+
+void TestBuildAndRearrange()
+{
+	TArray<FTestElement> Elements = MakeElements();
+	FTestOctree Octree;
+	BuildOctree(Octree, Elements);
+
+	std::set<int32> All;
+	for (int32 Index = 0; Index < NumElements; ++Index)
+	{
+		All.insert(Index);
+	}
+	TEST_CHECK(Octree.GetOctreeNodes().Num() > 1 + 8);
+	TEST_CHECK(Octree.GetElementsOutsideOctree().Num() == NumOutside);
+	TEST_CHECK(MatchesElements(Octree, Elements, All));
+
+	// 재정렬하면 모든 element가 노드 구간으로 옮겨지고 TemporalElements는 빈다
+	Octree.Rearrange(10.0f);
+	bool bNoTemporal = true;
+	for (const FTestOctree::FOctreeNode& Node : Octree.GetOctreeNodes())
+	{
+		bNoTemporal &= Node.TemporalElements.empty();
+	}
+	TEST_CHECK(bNoTemporal);
+	TEST_CHECK(Octree.GetElementList().Num() == NumElements - NumOutside);
+	TEST_CHECK(MatchesElements(Octree, Elements, All));
+}
+
+void TestBatchRemoveMatchesSingleRemove()
+{
+	TArray<FTestElement> BatchElements = MakeElements();
+	TArray<FTestElement> SingleElements = MakeElements();
+	FTestOctree BatchOctree;
+	FTestOctree SingleOctree;
+	BuildOctree(BatchOctree, BatchElements);
+	BuildOctree(SingleOctree, SingleElements);
+
+	FTestElement BatchStranger;
+	FTestElement SingleStranger;
+	const TArray<FTestElement*> Batch = MakeBatch(BatchElements, BatchStranger);
+	const TArray<FTestElement*> Singles = MakeBatch(SingleElements, SingleStranger);
+
+	std::set<int32> Survivors;
+	for (int32 Index = 0; Index < NumElements; ++Index)
+	{
+		Survivors.insert(Index);
+	}
+	for (const FTestElement* Element : Batch)
+	{
+		if (Element != &BatchStranger)
+		{
+			Survivors.erase(Element->Id);
+		}
+	}
+
+	BatchOctree.RemoveElements(Batch);
+	for (FTestElement* Element : Singles)
+	{
+		SingleOctree.RemoveElement(Element);
+	}
+
+	// 지운 element는 어느 노드 구간, 임시 공간, 루트 밖 목록에도 없고 OctreeIndex가 -1이다
+	TEST_CHECK(MatchesElements(BatchOctree, BatchElements, Survivors));
+	bool bRemovedCleared = true;
+	for (const FTestElement* Element : Batch)
+	{
+		bRemovedCleared &= Element->OctreeIndex == -1;
+	}
+	TEST_CHECK(bRemovedCleared);
+
+	// 노드별 결과가 하나씩 지운 트리와 같다
+	TEST_CHECK(CollectReferenced(BatchOctree) == CollectReferenced(SingleOctree));
+
+	// 재정렬 뒤에도 남은 element만 있다
+	BatchOctree.Rearrange(10.0f);
+	TEST_CHECK(MatchesElements(BatchOctree, BatchElements, Survivors));
+
+	// 지운 element를 다시 넣을 수 있다
+	for (FTestElement* Element : Batch)
+	{
+		if (Element != &BatchStranger && Element->OctreeIndex == -1)
+		{
+			BatchOctree.AddElement(Element, 0);
+			Survivors.insert(Element->Id);
+		}
+	}
+	TEST_CHECK(MatchesElements(BatchOctree, BatchElements, Survivors));
+}
+
+void TestRemoveEmptyAndWholeTree()
+{
+	TArray<FTestElement> Elements = MakeElements();
+	FTestOctree Octree;
+	BuildOctree(Octree, Elements);
+
+	std::set<int32> All;
+	TArray<FTestElement*> Everything;
+	for (int32 Index = 0; Index < NumElements; ++Index)
+	{
+		All.insert(Index);
+		Everything.push_back(&Elements[Index]);
+	}
+
+	Octree.RemoveElements({});
+	TEST_CHECK(MatchesElements(Octree, Elements, All));
+
+	Octree.RemoveElements(Everything);
+	TEST_CHECK(MatchesElements(Octree, Elements, {}));
+	TEST_CHECK(Octree.GetElementsOutsideOctree().empty());
+}
+
+int main()
+{
+	RUN_TEST(TestBuildAndRearrange);
+	RUN_TEST(TestBatchRemoveMatchesSingleRemove);
+	RUN_TEST(TestRemoveEmptyAndWholeTree);
+	return TEST_RESULT();
+}
@@ -0,0 +1,363 @@
+#include "pch.h"
+#include "Render/Renderer/DrawList.h"
+#include "Global/ParallelFor.h"
+#include "TestHarness.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+/**
+ * @brief DrawSortKey / RadixSortDrawCommands 헤드리스 테스트
+ * 기수 정렬 결과는 같은 입력의 std::stable_sort와 페이로드 순서까지 같아야 한다.
+ */
+namespace
+{
+	TArray<FDrawCommand> StableSortReference(TArray<FDrawCommand> InCommands)
+	{
+		std::stable_sort(InCommands.begin(), InCommands.end(),
+			[](const FDrawCommand& A, const FDrawCommand& B) { return A.SortKey < B.SortKey; });
+		return InCommands;
+	}
+
+	/** 단일 스레드/기본 경로 모두 std::stable_sort와 키, 페이로드가 같은지 */
+	void CheckMatchesStableSort(const TArray<FDrawCommand>& InUnsorted, const char* InLabel)
+	{
+		const TArray<FDrawCommand> Reference = StableSortReference(InUnsorted);
+
+		for (const bool bForceSingleThread : { true, false })
+		{
+			TArray<FDrawCommand> Sorted = InUnsorted;
+			// 스크래치 크기가 달라도 정렬이 맞춰 써야 한다
+			TArray<FDrawCommand> Scratch(InUnsorted.size() / 3 + 5);
+			RadixSortDrawCommands(Sorted, Scratch, bForceSingleThread);
+
+			TEST_CHECK_MSG(Sorted.size() == Reference.size(), "%s", InLabel);
+			if (Sorted.size() != Reference.size())
+			{
+				continue;
+			}
+
+			size_t FirstMismatch = Sorted.size();
+			for (size_t Index = 0; Index < Sorted.size(); ++Index)
+			{
+				if (Sorted[Index].SortKey != Reference[Index].SortKey || Sorted[Index].Payload != Reference[Index].Payload)
+				{
+					FirstMismatch = Index;
+					break;
+				}
+			}
+			TEST_CHECK_MSG(FirstMismatch == Sorted.size(), "%s (%s) first mismatch at %zu of %zu",
+				InLabel, bForceSingleThread ? "single" : "default", FirstMismatch, Sorted.size());
+		}
+	}
+
+	/** 키를 InNumDistinct개 값 중에서 뽑아 중복을 많이 만든다, 페이로드는 입력 순서 */
+	TArray<FDrawCommand> MakeCommands(uint32 InSeed, int32 InNum, int32 InNumDistinct)
+	{
+		std::mt19937_64 Random(InSeed);
+		TArray<uint64> Keys(InNumDistinct);
+		for (uint64& Key : Keys)
+		{
+			Key = Random();
+		}
+
+		std::uniform_int_distribution<int32> Pick(0, InNumDistinct - 1);
+		TArray<FDrawCommand> Commands(InNum);
+		for (int32 Index = 0; Index < InNum; ++Index)
+		{
+			Commands[Index].SortKey = Keys[Pick(Random)];
+			Commands[Index].Payload = static_cast<uint32>(Index);
+		}
+		return Commands;
+	}
+
+	uint32 KeyField(uint64 InKey, uint32 InShift, uint32 InBits)
+	{
+		return static_cast<uint32>((InKey >> InShift) & ((1ull << InBits) - 1ull));
+	}
+}
+
+void TestEmptyAndSingle()
+{
+	CheckMatchesStableSort({}, "empty");
+
+	TArray<FDrawCommand> Single(1);
+	Single[0] = { 0xDEADBEEFull, 7u };
+	CheckMatchesStableSort(Single, "single");
+
+	TArray<FDrawCommand> Scratch;
+	RadixSortDrawCommands(Single, Scratch);
+	TEST_CHECK(Single.size() == 1 && Single[0].SortKey == 0xDEADBEEFull && Single[0].Payload == 7u);
+}
+
+void TestDuplicateKeysAreStable()
+{
+	// 전부 같은 키 → 모든 바이트가 건너뛰어져도 입력 순서 그대로
+	TArray<FDrawCommand> AllEqual(1000);
+	for (int32 Index = 0; Index < 1000; ++Index)
+	{
+		AllEqual[Index] = { 0x0123456789ABCDEFull, static_cast<uint32>(Index) };
+	}
+	CheckMatchesStableSort(AllEqual, "all equal");
+
+	CheckMatchesStableSort(MakeCommands(1, 2, 1), "two equal");
+	CheckMatchesStableSort(MakeCommands(2, 1000, 3), "3 distinct");
+	CheckMatchesStableSort(MakeCommands(3, 5000, 64), "64 distinct");
+	CheckMatchesStableSort(MakeCommands(4, 5000, 5000), "mostly unique");
+
+	// 한 바이트만 다름 → 분배 1회(홀수)라 결과가 스크래치 쪽에 남는 경로
+	TArray<FDrawCommand> OneByte(777);
+	std::mt19937 Random(5);
+	for (int32 Index = 0; Index < 777; ++Index)
+	{
+		OneByte[Index] = { 0xAA00000000000000ull | (static_cast<uint64>(Random() & 0xF) << 40), static_cast<uint32>(Index) };
+	}
+	CheckMatchesStableSort(OneByte, "one varying byte");
+
+	// 이미 정렬됨 / 역순
+	TArray<FDrawCommand> Ascending(3000), Descending(3000);
+	for (int32 Index = 0; Index < 3000; ++Index)
+	{
+		Ascending[Index] = { static_cast<uint64>(Index / 4) << 20, static_cast<uint32>(Index) };
+		Descending[Index] = { static_cast<uint64>((3000 - Index) / 4) << 20, static_cast<uint32>(Index) };
+	}
+	CheckMatchesStableSort(Ascending, "ascending");
+	CheckMatchesStableSort(Descending, "descending");
+}
+
+void TestLargeInputs()
+{
+	// 기본 경로는 스레드가 2개 이상일 때만 청크로 나눈다 (1코어 환경에서는 단일 경로와 같다)
+	if (GetParallelForThreadCount() <= 1)
+	{
+		std::printf("  note: ParallelFor has 1 thread, chunked radix path not exercised\n");
+	}
+
+	// 병렬 경로 임계값(16384) 바로 아래/위와 청크가 여러 개로 나뉘는 크기
+	CheckMatchesStableSort(MakeCommands(10, 16383, 200), "16383");
+	CheckMatchesStableSort(MakeCommands(11, 16384, 200), "16384");
+	CheckMatchesStableSort(MakeCommands(12, 100003, 1000), "100003");
+	CheckMatchesStableSort(MakeCommands(13, 262144, 262144), "262144 unique");
+
+	// 실제 키 레이아웃(불투명/반투명 섞임)
+	std::mt19937 Random(14);
+	std::uniform_int_distribution<uint32> StateDist(0, 80);
+	std::uniform_real_distribution<float> DepthDist(-5.0f, 2000.0f);
+	TArray<FDrawCommand> Mixed(50000);
+	for (int32 Index = 0; Index < 50000; ++Index)
+	{
+		const bool bTranslucent = (Random() & 3) == 0;
+		Mixed[Index].SortKey = bTranslucent
+			? DrawSortKey::MakeTranslucent((Random() & 1) ? EDrawPass::Billboard : EDrawPass::Text, StateDist(Random) & 3,
+				StateDist(Random), StateDist(Random) & 7, StateDist(Random), DepthDist(Random))
+			: DrawSortKey::MakeOpaque(StateDist(Random) & 3, StateDist(Random), StateDist(Random) & 7, StateDist(Random), DepthDist(Random));
+		Mixed[Index].Payload = static_cast<uint32>(Index);
+	}
+	CheckMatchesStableSort(Mixed, "mixed layout");
+
+	FDrawListBenchmarkResult Result;
+	FDrawList::Benchmark(40000, Result);
+	TEST_CHECK(Result.NumCommands == 40000);
+	TEST_CHECK(Result.bMatchesStdSort);
+}
+
+void TestOpaqueKeyLayout()
+{
+	using namespace DrawSortKey;
+	TEST_CHECK(PipelineBits + MeshBits + SectionBits + MaterialBits + DepthBits == 62);
+
+	const uint64 Key = MakeOpaque(5, 1234, 17, 999, 42.0f);
+	TEST_CHECK(GetPass(Key) == EDrawPass::Opaque);
+	TEST_CHECK(KeyField(Key, 56, PipelineBits) == 5);
+	TEST_CHECK(KeyField(Key, 42, MeshBits) == 1234);
+	TEST_CHECK(KeyField(Key, 36, SectionBits) == 17);
+	TEST_CHECK(KeyField(Key, 24, MaterialBits) == 999);
+	TEST_CHECK(KeyField(Key, 0, DepthBits) == QuantizeDepth(42.0f));
+
+	// 상태가 깊이보다 우선, 같은 상태 안에서는 앞 → 뒤
+	TEST_CHECK(MakeOpaque(0, 1, 0, 1, 1000.0f) < MakeOpaque(0, 1, 0, 2, 1.0f));
+	TEST_CHECK(MakeOpaque(0, 1, 5, 9, 1000.0f) < MakeOpaque(0, 2, 0, 0, 1.0f));
+	TEST_CHECK(MakeOpaque(1, 0, 0, 0, 0.0f) > MakeOpaque(0, 9999, 63, 4095, 1e30f));
+	TEST_CHECK(MakeOpaque(0, 1, 0, 1, 1.0f) < MakeOpaque(0, 1, 0, 1, 2.0f));
+
+	// 범위를 넘는 필드는 최댓값으로 잘리고 이웃 필드를 건드리지 않는다
+	const uint64 Clamped = MakeOpaque(1000, 1u << 20, 1000, 1u << 20, 0.0f);
+	TEST_CHECK(GetPass(Clamped) == EDrawPass::Opaque);
+	TEST_CHECK(KeyField(Clamped, 56, PipelineBits) == (1u << PipelineBits) - 1);
+	TEST_CHECK(KeyField(Clamped, 42, MeshBits) == (1u << MeshBits) - 1);
+	TEST_CHECK(KeyField(Clamped, 36, SectionBits) == (1u << SectionBits) - 1);
+	TEST_CHECK(KeyField(Clamped, 24, MaterialBits) == (1u << MaterialBits) - 1);
+	TEST_CHECK(KeyField(Clamped, 0, DepthBits) == 0);
+}
+
+void TestTranslucentKeyLayout()
+{
+	using namespace DrawSortKey;
+	const uint32 MaxDepth = (1u << DepthBits) - 1u;
+
+	const uint64 Key = MakeTranslucent(EDrawPass::Billboard, 3, 500, 9, 77, 10.0f);
+	TEST_CHECK(GetPass(Key) == EDrawPass::Billboard);
+	TEST_CHECK(KeyField(Key, 38, DepthBits) == MaxDepth - QuantizeDepth(10.0f));
+	TEST_CHECK(KeyField(Key, 32, PipelineBits) == 3);
+	TEST_CHECK(KeyField(Key, 18, MeshBits) == 500);
+	TEST_CHECK(KeyField(Key, 12, SectionBits) == 9);
+	TEST_CHECK(KeyField(Key, 0, MaterialBits) == 77);
+	TEST_CHECK(GetPass(MakeTranslucent(EDrawPass::Text, 0, 0, 0, 0, 1.0f)) == EDrawPass::Text);
+
+	// 뒤 → 앞이 상태보다 우선, 같은 깊이에서는 상태 순
+	TEST_CHECK(MakeTranslucent(EDrawPass::Billboard, 9, 9, 9, 9, 100.0f) < MakeTranslucent(EDrawPass::Billboard, 0, 0, 0, 0, 10.0f));
+	TEST_CHECK(MakeTranslucent(EDrawPass::Billboard, 0, 1, 0, 0, 10.0f) < MakeTranslucent(EDrawPass::Billboard, 0, 2, 0, 0, 10.0f));
+
+	// 패스 순서: Opaque < Billboard < Text (깊이/상태와 무관)
+	TEST_CHECK(MakeOpaque(63, 99999, 63, 99999, 1e30f) < MakeTranslucent(EDrawPass::Billboard, 0, 0, 0, 0, 1e30f));
+	TEST_CHECK(MakeTranslucent(EDrawPass::Billboard, 63, 99999, 63, 99999, -1.0f) < MakeTranslucent(EDrawPass::Text, 0, 0, 0, 0, 1e30f));
+
+	// 잘린 필드가 패스 비트로 넘치지 않는다
+	const uint64 Clamped = MakeTranslucent(EDrawPass::Billboard, 1000, 1u << 20, 1000, 1u << 20, -1.0f);
+	TEST_CHECK(GetPass(Clamped) == EDrawPass::Billboard);
+	TEST_CHECK(KeyField(Clamped, 38, DepthBits) == MaxDepth);
+	TEST_CHECK(KeyField(Clamped, 32, PipelineBits) == (1u << PipelineBits) - 1);
+	TEST_CHECK(KeyField(Clamped, 18, MeshBits) == (1u << MeshBits) - 1);
+	TEST_CHECK(KeyField(Clamped, 12, SectionBits) == (1u << SectionBits) - 1);
+	TEST_CHECK(KeyField(Clamped, 0, MaterialBits) == (1u << MaterialBits) - 1);
+}
+
+void TestQuantizeDepth()
+{
+	using namespace DrawSortKey;
+	TEST_CHECK(QuantizeDepth(0.0f) == 0u);
+	TEST_CHECK(QuantizeDepth(-0.0f) == 0u);
+	TEST_CHECK(QuantizeDepth(-1.0f) == 0u);
+	TEST_CHECK(QuantizeDepth(-std::numeric_limits<float>::infinity()) == 0u);
+	TEST_CHECK(QuantizeDepth(std::numeric_limits<float>::quiet_NaN()) == 0u);
+	TEST_CHECK(QuantizeDepth(std::numeric_limits<float>::max()) < (1u << DepthBits));
+	TEST_CHECK(QuantizeDepth(std::numeric_limits<float>::denorm_min()) == 0u);
+
+	// 단조 증가 (양자화로 같아질 수는 있어도 뒤집히지 않는다)
+	float Depth = 1e-30f;
+	uint32 Previous = QuantizeDepth(Depth);
+	bool bMonotonic = true;
+	while (Depth < 1e30f)
+	{
+		Depth *= 1.0007f;
+		const uint32 Current = QuantizeDepth(Depth);
+		bMonotonic &= Current >= Previous;
+		Previous = Current;
+	}
+	TEST_CHECK(bMonotonic);
+
+	// 가수 상위 16비트를 쓰므로 상대 오차 2^-16보다 큰 차이는 구분된다
+	TEST_CHECK(QuantizeDepth(100.0f) < QuantizeDepth(100.01f));
+	TEST_CHECK(QuantizeDepth(1.0f) < QuantizeDepth(2.0f));
+}
+
+void TestDrawListSort()
+{
+	FDrawList List;
+	int MeshA = 0, MeshB = 0, Material = 0;
+
+	// 필드마다 따로 센다
+	TEST_CHECK(List.GetMeshId(nullptr) == 0u);
+	TEST_CHECK(List.GetMeshId(&MeshA) == 1u);
+	TEST_CHECK(List.GetMaterialId(&Material) == 1u);
+	TEST_CHECK(List.GetMeshId(&MeshB) == 2u);
+	TEST_CHECK(List.GetMeshId(&MeshA) == 1u);
+	TEST_CHECK(List.GetMaterialId(&MeshA) == 2u);
+	List.Reset();
+
+	// 정렬 결과와 반대 순서로 넣는다
+	List.AddTranslucent(EDrawPass::Text, 0, nullptr, 0, &Material, 1.0f, 0);
+	List.AddTranslucent(EDrawPass::Billboard, 0, &MeshA, 0, &Material, 5.0f, 1);
+	List.AddTranslucent(EDrawPass::Billboard, 0, &MeshA, 0, &Material, 50.0f, 2);
+	List.AddOpaque(0, &MeshB, 0, &Material, 3.0f, 3);
+	List.AddOpaque(0, &MeshA, 0, &Material, 9.0f, 4);
+	List.AddOpaque(0, &MeshA, 0, &Material, 2.0f, 5);
+	List.Sort();
+
+	// 메시 id는 MeshA=1, MeshB=2 → 불투명 MeshA(가까움→멂), MeshB / 빌보드 뒤→앞 / 텍스트
+	const uint32 Expected[] = { 5, 4, 3, 2, 1, 0 };
+	TEST_CHECK(List.Num() == 6);
+	for (int32 Index = 0; Index < List.Num() && Index < 6; ++Index)
+	{
+		TEST_CHECK_MSG(List.GetCommands()[Index].Payload == Expected[Index], "index %d payload %u", Index, List.GetCommands()[Index].Payload);
+	}
+
+	List.Reset();
+	TEST_CHECK(List.Num() == 0);
+	TEST_CHECK(List.GetMeshId(&MeshB) == 1u);
+	TEST_CHECK(!List.HasFieldOverflow());
+}
+
+void TestDrawListFieldOverflow()
+{
+	// 메시 번호가 14비트를 넘으면 키에서는 잘리지만 정렬은 잘리지 않은 번호를 따른다
+	const int32 NumMeshes = (1 << DrawSortKey::MeshBits) + 300;
+	const auto Mesh = [](int32 InId) { return reinterpret_cast<const void*>(static_cast<uintptr_t>(InId + 1) * 16); };
+
+	std::mt19937 Random(21);
+	std::uniform_int_distribution<int32> MeshDist(0, NumMeshes - 1);
+	std::uniform_real_distribution<float> DepthDist(0.5f, 500.0f);
+
+	FDrawList List;
+	TArray<int32> MeshOf;
+	for (int32 Index = 0; Index < NumMeshes; ++Index)
+	{
+		// 모든 메시를 먼저 한 번씩 등록해 번호가 Index + 1이 되게 한다
+		List.AddOpaque(0, Mesh(Index), 0, nullptr, DepthDist(Random), static_cast<uint32>(MeshOf.size()));
+		MeshOf.push_back(Index);
+	}
+	for (int32 Index = 0; Index < 20000; ++Index)
+	{
+		const int32 MeshId = (Index & 1) ? NumMeshes - 1 - (Index % 7) : MeshDist(Random);
+		List.AddOpaque(0, Mesh(MeshId), 0, nullptr, DepthDist(Random), static_cast<uint32>(MeshOf.size()));
+		MeshOf.push_back(MeshId);
+	}
+	TEST_CHECK(List.HasFieldOverflow());
+	List.Sort();
+
+	// 메시는 번호 순으로 한 덩어리씩, 덩어리 안은 앞→뒤
+	TEST_CHECK(List.Num() == static_cast<int32>(MeshOf.size()));
+	bool bOrdered = true;
+	for (int32 Index = 1; Index < List.Num(); ++Index)
+	{
+		const FDrawCommand& Previous = List.GetCommands()[Index - 1];
+		const FDrawCommand& Current = List.GetCommands()[Index];
+		const int32 PreviousMesh = MeshOf[Previous.Payload];
+		const int32 CurrentMesh = MeshOf[Current.Payload];
+		bOrdered &= PreviousMesh < CurrentMesh
+			|| (PreviousMesh == CurrentMesh && (Previous.SortKey & 0xFFFFFF) <= (Current.SortKey & 0xFFFFFF));
+	}
+	TEST_CHECK(bOrdered);
+
+	// 반투명은 넘쳐도 깊이가 우선
+	List.Reset();
+	List.AddTranslucent(EDrawPass::Billboard, 0, nullptr, 0, nullptr, 1.0f, 0);
+	List.AddTranslucent(EDrawPass::Billboard, 100, nullptr, 100, nullptr, 9.0f, 1);
+	List.AddOpaque(70, nullptr, 0, nullptr, 5.0f, 2);
+	List.AddOpaque(64, nullptr, 0, nullptr, 5.0f, 3);
+	TEST_CHECK(List.HasFieldOverflow());
+	List.Sort();
+	const uint32 Expected[] = { 3, 2, 1, 0 };
+	for (int32 Index = 0; Index < List.Num() && Index < 4; ++Index)
+	{
+		TEST_CHECK_MSG(List.GetCommands()[Index].Payload == Expected[Index], "index %d payload %u", Index, List.GetCommands()[Index].Payload);
+	}
+
+	List.Reset();
+	TEST_CHECK(!List.HasFieldOverflow());
+}
+
+int main()
+{
+	RUN_TEST(TestEmptyAndSingle);
+	RUN_TEST(TestDuplicateKeysAreStable);
+	RUN_TEST(TestLargeInputs);
+	RUN_TEST(TestOpaqueKeyLayout);
+	RUN_TEST(TestTranslucentKeyLayout);
+	RUN_TEST(TestQuantizeDepth);
+	RUN_TEST(TestDrawListSort);
+	RUN_TEST(TestDrawListFieldOverflow);
+	return TEST_RESULT();
+}
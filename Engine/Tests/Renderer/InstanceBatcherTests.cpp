@@ -0,0 +1,260 @@
+#include "pch.h"
+#include "Render/Renderer/InstanceBatcher.h"
+#include "TestHarness.h"
+
+#include <cstddef>
+#include <cstring>
+#include <random>
+#include <set>
+#include <tuple>
+
+/**
+ * @brief FInstanceBatcher 헤드리스 테스트
+ * 메시/머티리얼은 포인터 값으로만 비교되므로 가짜 주소를 쓴다.
+ */
+namespace
+{
+	UStaticMesh* FakeMesh(uintptr_t InId) { return reinterpret_cast<UStaticMesh*>(InId * 64); }
+	const UMaterial* FakeMaterial(uintptr_t InId) { return reinterpret_cast<const UMaterial*>(0x100000 + InId * 64); }
+
+	struct FAddedInstance
+	{
+		UStaticMesh* Mesh;
+		int32 Section;
+		const UMaterial* Material;
+		float Depth;
+	};
+
+	/** UUID = 추가 순서로 넣고, 결과 인스턴스의 UUID로 원본을 찾는다 */
+	TArray<FAddedInstance> AddRandomInstances(FInstanceBatcher& Batcher, uint32 InSeed, int32 InCount,
+		int32 InNumMeshes, int32 InNumSections, int32 InNumMaterials)
+	{
+		std::mt19937 Random(InSeed);
+		std::uniform_int_distribution<int32> MeshDist(1, InNumMeshes);
+		std::uniform_int_distribution<int32> SectionDist(0, InNumSections - 1);
+		std::uniform_int_distribution<int32> MaterialDist(1, InNumMaterials);
+		std::uniform_real_distribution<float> DepthDist(0.5f, 500.0f);
+
+		TArray<FAddedInstance> Added;
+		for (int32 Index = 0; Index < InCount; ++Index)
+		{
+			const FAddedInstance Instance = { FakeMesh(MeshDist(Random)), SectionDist(Random), FakeMaterial(MaterialDist(Random)), DepthDist(Random) };
+			Batcher.AddInstance(Instance.Mesh, Instance.Section, Instance.Material, static_cast<uint32>(Instance.Section) * 300, 36,
+				FMatrix::Identity, static_cast<uint32>(Index), Instance.Depth);
+			Added.push_back(Instance);
+		}
+		return Added;
+	}
+
+	/** 메시 구간/배치/인스턴스 배열이 서로 맞물리는지 검사 */
+	void CheckLayout(const FInstanceBatcher& Batcher, const TArray<FAddedInstance>& Added)
+	{
+		const TArray<FInstanceMeshRange>& Ranges = Batcher.GetMeshRanges();
+		const TArray<FInstanceBatch>& Batches = Batcher.GetBatches();
+		const TArray<FInstanceGPUData>& Data = Batcher.GetInstanceData();
+
+		TEST_CHECK(Data.size() == Added.size());
+
+		uint32 NextInstance = 0;
+		int32 NextBatch = 0;
+		for (const FInstanceMeshRange& Range : Ranges)
+		{
+			// 구간은 빈틈 없이 이어지고 배치도 구간 순서대로 놓인다
+			TEST_CHECK(Range.FirstInstance == NextInstance);
+			TEST_CHECK(Range.FirstBatch == NextBatch);
+			TEST_CHECK(Range.NumBatches > 0);
+
+			uint32 NextInRange = 0;
+			for (int32 BatchIndex = Range.FirstBatch; BatchIndex < Range.FirstBatch + Range.NumBatches; ++BatchIndex)
+			{
+				const FInstanceBatch& Batch = Batches[BatchIndex];
+				TEST_CHECK(Batch.Mesh == Range.Mesh);
+				TEST_CHECK(Batch.FirstInstance == NextInRange);
+				TEST_CHECK(Batch.NumInstances > 0);
+
+				uint32 PreviousDepth = 0;
+				for (uint32 Local = 0; Local < Batch.NumInstances; ++Local)
+				{
+					const FAddedInstance& Source = Added[Data[Range.FirstInstance + Batch.FirstInstance + Local].UUID];
+					TEST_CHECK(Source.Mesh == Batch.Mesh);
+					TEST_CHECK(Source.Section == Batch.SectionIndex);
+					TEST_CHECK(Source.Material == Batch.Material);
+					TEST_CHECK(Batch.IndexStart == static_cast<uint32>(Source.Section) * 300 && Batch.IndexCount == 36);
+
+					// 배치 안은 앞→뒤 (정렬 키의 양자화된 깊이 기준)
+					const uint32 Depth = DrawSortKey::QuantizeDepth(Source.Depth);
+					TEST_CHECK(Depth >= PreviousDepth);
+					PreviousDepth = Depth;
+				}
+				NextInRange += Batch.NumInstances;
+			}
+			TEST_CHECK(NextInRange == Range.NumInstances);
+
+			NextInstance += Range.NumInstances;
+			NextBatch += Range.NumBatches;
+		}
+		TEST_CHECK(NextInstance == Data.size());
+		TEST_CHECK(NextBatch == static_cast<int32>(Batches.size()));
+	}
+
+	/** 메시는 한 구간에만, (메시, 섹션, 머티리얼)은 한 배치에만 나온다 */
+	void CheckGroupedOnce(const FInstanceBatcher& Batcher, const TArray<FAddedInstance>& Added)
+	{
+		TSet<const void*> SeenMeshes;
+		bool bMeshesUnique = true;
+		for (const FInstanceMeshRange& Range : Batcher.GetMeshRanges())
+		{
+			bMeshesUnique &= SeenMeshes.insert(Range.Mesh).second;
+		}
+		TEST_CHECK(bMeshesUnique);
+
+		std::set<std::tuple<const void*, int32, const void*>> SeenKeys, AddedKeys;
+		bool bBatchesUnique = true;
+		for (const FInstanceBatch& Batch : Batcher.GetBatches())
+		{
+			bBatchesUnique &= SeenKeys.insert({ Batch.Mesh, Batch.SectionIndex, Batch.Material }).second;
+		}
+		TEST_CHECK(bBatchesUnique);
+		for (const FAddedInstance& Instance : Added)
+		{
+			AddedKeys.insert({ Instance.Mesh, Instance.Section, Instance.Material });
+		}
+		TEST_CHECK(SeenKeys == AddedKeys);
+	}
+
+	void TestGroupsByMeshSectionMaterial()
+	{
+		FInstanceBatcher Batcher;
+		Batcher.Reset();
+		const TArray<FAddedInstance> Added = AddRandomInstances(Batcher, 5, 2000, 8, 3, 6);
+		Batcher.Build();
+
+		CheckLayout(Batcher, Added);
+		CheckGroupedOnce(Batcher, Added);
+	}
+
+	void TestInstanceDataPacking()
+	{
+		// HLSL StructuredBuffer<FInstanceData>와 같은 오프셋
+		TEST_CHECK(sizeof(FInstanceGPUData) == 96);
+		TEST_CHECK(offsetof(FInstanceGPUData, World) == 0);
+		TEST_CHECK(offsetof(FInstanceGPUData, Color) == 64);
+		TEST_CHECK(offsetof(FInstanceGPUData, UUID) == 80);
+
+		FMatrix World;
+		for (int32 Row = 0; Row < 4; ++Row)
+		{
+			for (int32 Col = 0; Col < 4; ++Col)
+			{
+				World.Data[Row][Col] = static_cast<float>(Row * 4 + Col) + 0.25f;
+			}
+		}
+		const FVector4 Color(0.1f, 0.2f, 0.3f, 0.4f);
+
+		FInstanceBatcher Batcher;
+		Batcher.AddInstance(FakeMesh(1), 0, FakeMaterial(1), 0, 6, World, 4242, 10.0f, Color);
+		Batcher.Build();
+
+		TEST_CHECK(Batcher.GetInstanceData().size() == 1);
+		const FInstanceGPUData& Data = Batcher.GetInstanceData()[0];
+		TEST_CHECK(std::memcmp(&Data.World, &World, sizeof(FMatrix)) == 0);
+		TEST_CHECK(Data.Color.X == Color.X && Data.Color.Y == Color.Y && Data.Color.Z == Color.Z && Data.Color.W == Color.W);
+		TEST_CHECK(Data.UUID == 4242);
+		TEST_CHECK(Data.Pad[0] == 0 && Data.Pad[1] == 0 && Data.Pad[2] == 0);
+	}
+
+	void TestBatchBoundaries()
+	{
+		FInstanceBatcher Batcher;
+
+		// 비어 있으면 아무것도 없다
+		Batcher.Build();
+		TEST_CHECK(Batcher.GetMeshRanges().empty() && Batcher.GetBatches().empty() && Batcher.GetInstanceData().empty());
+
+		// 메시가 없거나 인덱스가 0개인 섹션은 버린다
+		Batcher.AddInstance(nullptr, 0, FakeMaterial(1), 0, 6, FMatrix::Identity, 0, 1.0f);
+		Batcher.AddInstance(FakeMesh(1), 0, FakeMaterial(1), 0, 0, FMatrix::Identity, 1, 1.0f);
+		TEST_CHECK(Batcher.GetNumPendingInstances() == 0);
+
+		// 같은 메시: 섹션 경계, 머티리얼 경계에서 각각 배치가 나뉜다
+		Batcher.AddInstance(FakeMesh(1), 0, FakeMaterial(1), 0, 6, FMatrix::Identity, 0, 3.0f);
+		Batcher.AddInstance(FakeMesh(1), 0, FakeMaterial(1), 0, 6, FMatrix::Identity, 1, 1.0f);
+		Batcher.AddInstance(FakeMesh(1), 1, FakeMaterial(1), 6, 6, FMatrix::Identity, 2, 2.0f);
+		Batcher.AddInstance(FakeMesh(1), 1, FakeMaterial(2), 6, 6, FMatrix::Identity, 3, 2.0f);
+		// 다른 메시는 새 구간, 배치의 FirstInstance는 구간 기준으로 다시 0부터
+		Batcher.AddInstance(FakeMesh(2), 0, FakeMaterial(1), 0, 12, FMatrix::Identity, 4, 5.0f);
+		Batcher.AddInstance(FakeMesh(2), 0, FakeMaterial(1), 0, 12, FMatrix::Identity, 5, 5.0f);
+		Batcher.Build();
+
+		const TArray<FInstanceMeshRange>& Ranges = Batcher.GetMeshRanges();
+		const TArray<FInstanceBatch>& Batches = Batcher.GetBatches();
+		const TArray<FInstanceGPUData>& Data = Batcher.GetInstanceData();
+
+		TEST_CHECK(Ranges.size() == 2);
+		TEST_CHECK(Batches.size() == 4);
+		if (Ranges.size() != 2 || Batches.size() != 4)
+		{
+			return;
+		}
+
+		TEST_CHECK(Ranges[0].Mesh == FakeMesh(1) && Ranges[0].FirstInstance == 0 && Ranges[0].NumInstances == 4);
+		TEST_CHECK(Ranges[0].FirstBatch == 0 && Ranges[0].NumBatches == 3);
+		TEST_CHECK(Ranges[1].Mesh == FakeMesh(2) && Ranges[1].FirstInstance == 4 && Ranges[1].NumInstances == 2);
+		TEST_CHECK(Ranges[1].FirstBatch == 3 && Ranges[1].NumBatches == 1);
+
+		TEST_CHECK(Batches[0].SectionIndex == 0 && Batches[0].FirstInstance == 0 && Batches[0].NumInstances == 2);
+		TEST_CHECK(Batches[1].SectionIndex == 1 && Batches[1].Material == FakeMaterial(1) && Batches[1].FirstInstance == 2);
+		TEST_CHECK(Batches[2].SectionIndex == 1 && Batches[2].Material == FakeMaterial(2) && Batches[2].FirstInstance == 3);
+		TEST_CHECK(Batches[2].IndexStart == 6 && Batches[2].IndexCount == 6);
+		TEST_CHECK(Batches[3].FirstInstance == 0 && Batches[3].NumInstances == 2 && Batches[3].IndexCount == 12);
+
+		// 첫 배치는 깊이 순, 같은 깊이는 추가 순서 유지
+		TEST_CHECK(Data[0].UUID == 1 && Data[1].UUID == 0);
+		TEST_CHECK(Data[4].UUID == 4 && Data[5].UUID == 5);
+
+		// Reset 후에는 이전 프레임 내용이 남지 않는다
+		Batcher.Reset();
+		Batcher.Build();
+		TEST_CHECK(Batcher.GetNumPendingInstances() == 0 && Batcher.GetBatches().empty());
+	}
+
+	void TestStateIdOverflowKeepsGroups()
+	{
+		// 메시(14비트)/머티리얼(12비트)/섹션(6비트) 번호가 키 범위를 넘어도 메시 구간과 배치가 나뉘지 않는다
+		const int32 NumMeshes = (1 << DrawSortKey::MeshBits) + 500;
+		const int32 NumMaterials = (1 << DrawSortKey::MaterialBits) + 500;
+
+		FInstanceBatcher Batcher;
+		TArray<FAddedInstance> Added;
+		const auto Add = [&](const FAddedInstance& InInstance)
+		{
+			Batcher.AddInstance(InInstance.Mesh, InInstance.Section, InInstance.Material, static_cast<uint32>(InInstance.Section) * 300, 36,
+				FMatrix::Identity, static_cast<uint32>(Added.size()), InInstance.Depth);
+			Added.push_back(InInstance);
+		};
+
+		// 모든 메시/머티리얼을 한 번씩 먼저 등록해 뒤쪽 번호가 반드시 범위를 넘게 한다
+		for (int32 Index = 0; Index < NumMeshes; ++Index)
+		{
+			Add({ FakeMesh(Index + 1), Index % 70, FakeMaterial(Index % NumMaterials + 1), 500.0f - static_cast<float>(Index % 997) * 0.5f });
+		}
+		// 넘친 메시 몇 개에 섹션/머티리얼/깊이가 섞인 인스턴스를 몰아 넣는다
+		for (int32 Index = 0; Index < 3000; ++Index)
+		{
+			Add({ FakeMesh(NumMeshes - Index % 3), 64 + Index % 5, FakeMaterial(NumMaterials - Index % 4), 1.0f + static_cast<float>(Index % 101) });
+		}
+		Batcher.Build();
+
+		CheckLayout(Batcher, Added);
+		CheckGroupedOnce(Batcher, Added);
+	}
+}
+
+int main()
+{
+	RUN_TEST(TestGroupsByMeshSectionMaterial);
+	RUN_TEST(TestInstanceDataPacking);
+	RUN_TEST(TestBatchBoundaries);
+	RUN_TEST(TestStateIdOverflowKeepsGroups);
+	return TEST_RESULT();
+}
@@ -0,0 +1,205 @@
+#include "pch.h"
+#include "Render/Renderer/PipelineStateCache.h"
+#include "RecordingPipelineContext.h"
+#include "TestHarness.h"
+
+/**
+ * @brief FPipelineStateCache 헤드리스 테스트
+ * 캐시가 컨텍스트로 내려보낸 호출을 FRecordingPipelineContext로 받아 걸러진 바인딩/드로우를 확인한다.
+ */
+namespace
+{
+	template<typename THandle>
+	THandle H(uint32 InId) { return FRecordingPipelineContext::MakeHandle<THandle>(InId); }
+
+	FPipelineStateDesc MakeDesc(uint32 InBase, EPipelineTopology InTopology = EPipelineTopology::TriangleList)
+	{
+		FPipelineStateDesc Desc;
+		Desc.InputLayout = H<FInputLayoutHandle>(InBase + 1);
+		Desc.VertexShader = H<FVertexShaderHandle>(InBase + 2);
+		Desc.RasterizerState = H<FRasterizerStateHandle>(InBase + 3);
+		Desc.DepthStencilState = H<FDepthStencilStateHandle>(InBase + 4);
+		Desc.PixelShader = H<FPixelShaderHandle>(InBase + 5);
+		Desc.BlendState = H<FBlendStateHandle>(InBase + 6);
+		Desc.Topology = InTopology;
+		return Desc;
+	}
+}
+
+void TestRedundantPipelineBindsAreElided()
+{
+	FRecordingPipelineContext Context;
+	FPipelineStateCache Cache(Context);
+
+	const FPipelineStateDesc Desc = MakeDesc(10);
+	Cache.SetPipeline(Desc);
+	TEST_CHECK(Context.Num() == 7);
+	TEST_CHECK(Context.Num() > 0 && Context.Calls[0] == "Topology 4");
+	TEST_CHECK(Cache.GetStats().IssuedBinds == 7 && Cache.GetStats().SkippedBinds == 0);
+
+	Context.Clear();
+	Cache.SetPipeline(Desc);
+	TEST_CHECK(Context.Num() == 0);
+	TEST_CHECK(Cache.GetStats().IssuedBinds == 7 && Cache.GetStats().SkippedBinds == 7);
+
+	// 픽셀 셰이더와 토폴로지만 바뀐 파이프라인 → 그 둘만 내려간다
+	FPipelineStateDesc Changed = Desc;
+	Changed.PixelShader = H<FPixelShaderHandle>(99);
+	Changed.Topology = EPipelineTopology::LineList;
+	Cache.SetPipeline(Changed);
+	TEST_CHECK(Context.Num() == 2);
+	TEST_CHECK(Context.Num() == 2 && Context.Calls[0] == "Topology 2" && Context.Calls[1] == "PS 99");
+
+	// nullptr 항목은 이전 바인딩 유지 → 호출도, 통계도 없다
+	Context.Clear();
+	FPipelineStateDesc Partial;
+	Partial.Topology = EPipelineTopology::LineList;
+	const uint32 SkippedBefore = Cache.GetStats().SkippedBinds;
+	Cache.SetPipeline(Partial);
+	TEST_CHECK(Context.Num() == 0);
+	TEST_CHECK(Cache.GetStats().SkippedBinds == SkippedBefore + 1);
+
+	Cache.SetPipeline(Changed);
+	TEST_CHECK(Context.Num() == 0);
+}
+
+void TestRedundantResourceBindsAreElided()
+{
+	FRecordingPipelineContext Context;
+	FPipelineStateCache Cache(Context);
+
+	// 정점 스트림: 버퍼/스트라이드/오프셋 중 하나라도 다르면 다시 바인딩
+	Cache.SetVertexBuffer(0, H<FBufferHandle>(1), 32);
+	Cache.SetVertexBuffer(0, H<FBufferHandle>(1), 32);
+	Cache.SetVertexBuffer(0, H<FBufferHandle>(1), 48);
+	Cache.SetVertexBuffer(0, H<FBufferHandle>(1), 48, 16);
+	Cache.SetVertexBuffer(1, H<FBufferHandle>(1), 48, 16);
+	TEST_CHECK(Context.Num() == 4);
+	TEST_CHECK(Context.Num() == 4 && Context.Calls[3] == "VB 1 1 48 16");
+
+	// 추적하지 않는 슬롯은 항상 내려간다
+	Context.Clear();
+	Cache.SetVertexBuffer(FPipelineStateCache::MaxVertexStreams, H<FBufferHandle>(2), 16);
+	Cache.SetVertexBuffer(FPipelineStateCache::MaxVertexStreams, H<FBufferHandle>(2), 16);
+	TEST_CHECK(Context.Num() == 2);
+
+	Context.Clear();
+	Cache.SetIndexBuffer(H<FBufferHandle>(3), 42);
+	Cache.SetIndexBuffer(H<FBufferHandle>(3), 42);
+	Cache.SetIndexBuffer(H<FBufferHandle>(3), 57);
+	TEST_CHECK(Context.Num() == 2);
+
+	// 상수 버퍼: VS/PS 슬롯은 따로, nullptr과 범위 밖 슬롯은 무시
+	Context.Clear();
+	Cache.SetConstantBuffer(0, true, H<FBufferHandle>(4));
+	Cache.SetConstantBuffer(0, false, H<FBufferHandle>(4));
+	Cache.SetConstantBuffer(0, true, H<FBufferHandle>(4));
+	Cache.SetConstantBuffer(0, true, FBufferHandle());
+	Cache.SetConstantBuffer(FPipelineStateCache::MaxConstantBuffers, true, H<FBufferHandle>(5));
+	TEST_CHECK(Context.Num() == 2);
+	TEST_CHECK(Context.Num() == 2 && Context.Calls[0] == "VSCB 0 4" && Context.Calls[1] == "PSCB 0 4");
+	Cache.SetConstantBuffer(0, true, H<FBufferHandle>(4));
+	TEST_CHECK(Context.Num() == 2);
+
+	// SRV: nullptr(해제)도 상태로 추적한다
+	Context.Clear();
+	Cache.SetShaderResourceView(0, false, H<FShaderResourceHandle>(6));
+	Cache.SetShaderResourceView(0, false, FShaderResourceHandle());
+	Cache.SetShaderResourceView(0, false, FShaderResourceHandle());
+	Cache.SetShaderResourceView(0, true, FShaderResourceHandle());
+	Cache.SetShaderResourceView(FPipelineStateCache::MaxShaderResources, false, H<FShaderResourceHandle>(6));
+	Cache.SetShaderResourceView(FPipelineStateCache::MaxShaderResources, false, H<FShaderResourceHandle>(6));
+	TEST_CHECK(Context.Num() == 5);
+
+	Context.Clear();
+	Cache.SetSamplerState(2, false, H<FSamplerHandle>(7));
+	Cache.SetSamplerState(2, false, H<FSamplerHandle>(7));
+	Cache.SetSamplerState(2, true, H<FSamplerHandle>(7));
+	Cache.SetSamplerState(FPipelineStateCache::MaxSamplers, true, H<FSamplerHandle>(7));
+	TEST_CHECK(Context.Num() == 2);
+}
+
+void TestInvalidateReissuesEverything()
+{
+	FRecordingPipelineContext Context;
+	FPipelineStateCache Cache(Context);
+
+	auto BindAll = [&Cache]()
+	{
+		Cache.SetPipeline(MakeDesc(20));
+		Cache.SetVertexBuffer(0, H<FBufferHandle>(1), 32);
+		Cache.SetVertexBuffer(1, H<FBufferHandle>(2), 96);
+		Cache.SetIndexBuffer(H<FBufferHandle>(3), 42);
+		Cache.SetConstantBuffer(1, true, H<FBufferHandle>(4));
+		Cache.SetShaderResourceView(3, false, H<FShaderResourceHandle>(5));
+		Cache.SetSamplerState(0, false, H<FSamplerHandle>(6));
+	};
+
+	BindAll();
+	const int32 FullBindCalls = Context.Num();
+	TEST_CHECK(FullBindCalls == 13);
+
+	Context.Clear();
+	BindAll();
+	TEST_CHECK(Context.Num() == 0);
+
+	// 캐시 밖에서 컨텍스트를 건드렸다고 보고 무효화 → 같은 값이어도 전부 다시 내려간다
+	Cache.Invalidate();
+	BindAll();
+	TEST_CHECK(Context.Num() == FullBindCalls);
+
+	// BeginFrame도 무효화하며, 통계를 지난 프레임으로 넘긴다
+	const FPipelineStats Before = Cache.GetStats();
+	Context.Clear();
+	Cache.BeginFrame();
+	TEST_CHECK(Cache.GetLastFrameStats().IssuedBinds == Before.IssuedBinds);
+	TEST_CHECK(Cache.GetLastFrameStats().SkippedBinds == Before.SkippedBinds);
+	TEST_CHECK(Cache.GetStats().IssuedBinds == 0 && Cache.GetStats().SkippedBinds == 0);
+	BindAll();
+	TEST_CHECK(Context.Num() == FullBindCalls);
+}
+
+void TestDrawFilteringAndStats()
+{
+	FRecordingPipelineContext Context;
+	FPipelineStateCache Cache(Context);
+
+	// 토폴로지를 모르면 삼각형은 세지 않는다
+	Cache.Draw(6, 0);
+	TEST_CHECK(Cache.GetStats().IssuedDraws == 1 && Cache.GetStats().Triangles == 0);
+
+	Cache.SetPipeline(MakeDesc(0, EPipelineTopology::TriangleList));
+	Context.Clear();
+	Cache.Draw(0, 0);
+	Cache.DrawInstanced(36, 0, 0, 0);
+	Cache.DrawIndexed(0, 0, 0);
+	Cache.DrawIndexedInstanced(0, 5, 0, 0, 0);
+	TEST_CHECK(Context.Num() == 0);
+	TEST_CHECK(Cache.GetStats().SkippedDraws == 4);
+
+	Cache.Draw(6, 0);
+	Cache.DrawIndexedInstanced(36, 10, 0, 0, 0);
+	TEST_CHECK(Context.Num() == 2);
+	TEST_CHECK(Context.Num() == 2 && Context.Calls[1] == "DrawIndexedInstanced 36 10 0 0 0");
+	TEST_CHECK(Cache.GetStats().IssuedDraws == 3);
+	TEST_CHECK(Cache.GetStats().Instances == 1 + 1 + 10);
+	TEST_CHECK(Cache.GetStats().Triangles == 2 + 12 * 10);
+
+	Cache.SetPipeline(MakeDesc(0, EPipelineTopology::TriangleStrip));
+	Cache.DrawIndexed(5, 0, 0);
+	TEST_CHECK(Cache.GetStats().Triangles == 2 + 120 + 3);
+
+	Cache.SetPipeline(MakeDesc(0, EPipelineTopology::LineList));
+	Cache.Draw(100, 0);
+	TEST_CHECK(Cache.GetStats().Triangles == 125);
+	TEST_CHECK(Cache.GetStats().IssuedDraws == 5);
+}
+
+int main()
+{
+	RUN_TEST(TestRedundantPipelineBindsAreElided);
+	RUN_TEST(TestRedundantResourceBindsAreElided);
+	RUN_TEST(TestInvalidateReissuesEverything);
+	RUN_TEST(TestDrawFilteringAndStats);
+	return TEST_RESULT();
+}
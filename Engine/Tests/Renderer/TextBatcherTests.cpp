@@ -0,0 +1,223 @@
+#include "pch.h"
+#include "Render/Renderer/TextBatcher.h"
+#include "TestHarness.h"
+
+/**
+ * @brief FTextGlyphCache/FTextBatcher 헤드리스 테스트
+ * 라벨 키는 포인터 값으로만 비교되므로 가짜 주소를 쓴다.
+ */
+namespace
+{
+	const void* FakeLabel(uintptr_t InId) { return reinterpret_cast<const void*>(InId * 64); }
+
+	TArray<FTextGlyphInstance> MakeGlyphs(int32 InNum, uint32 InCharBase)
+	{
+		TArray<FTextGlyphInstance> Glyphs(InNum);
+		for (int32 Index = 0; Index < InNum; ++Index)
+		{
+			Glyphs[Index].Offset = FVector2(static_cast<float>(Index - InNum / 2), 0.0f);
+			Glyphs[Index].CharId = InCharBase + static_cast<uint32>(Index);
+		}
+		return Glyphs;
+	}
+
+	FMatrix Translation(float InX)
+	{
+		FMatrix World = FMatrix::Identity;
+		World.Data[3][0] = InX;
+		return World;
+	}
+
+	/** 캐시의 글자 표에서 InRange가 InGlyphs와 같고 모두 InLabelIndex를 가리키는지 */
+	bool RangeHolds(const FTextGlyphCache& InCache, const FTextTableRange& InRange, const TArray<FTextGlyphInstance>& InGlyphs,
+		uint32& OutLabelIndex)
+	{
+		if (InRange.Count != InGlyphs.size() || InRange.First + InRange.Count > InCache.GetGlyphs().size())
+		{
+			return false;
+		}
+		OutLabelIndex = InRange.Count > 0 ? InCache.GetGlyphs()[InRange.First].LabelIndex : 0;
+		for (uint32 Index = 0; Index < InRange.Count; ++Index)
+		{
+			const FTextGlyphInstance& Glyph = InCache.GetGlyphs()[InRange.First + Index];
+			if (Glyph.CharId != InGlyphs[Index].CharId || Glyph.LabelIndex != OutLabelIndex)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool Overlaps(const FTextTableRange& A, const FTextTableRange& B)
+	{
+		return A.First < B.First + B.Count && B.First < A.First + A.Count;
+	}
+}
+
+void TestUnchangedLabelsUploadNothing()
+{
+	FTextGlyphCache Cache;
+	const TArray<FTextGlyphInstance> GlyphsA = MakeGlyphs(5, 10);
+	const TArray<FTextGlyphInstance> GlyphsB = MakeGlyphs(12, 100);
+
+	Cache.BeginFrame();
+	const FTextTableRange RangeA = Cache.UpdateLabel(FakeLabel(1), 1, GlyphsA, Translation(1.0f), 7);
+	const FTextTableRange RangeB = Cache.UpdateLabel(FakeLabel(2), 2, GlyphsB, Translation(2.0f), 8);
+	Cache.EndFrame();
+
+	uint32 LabelA = 0, LabelB = 0;
+	TEST_CHECK(RangeHolds(Cache, RangeA, GlyphsA, LabelA));
+	TEST_CHECK(RangeHolds(Cache, RangeB, GlyphsB, LabelB));
+	TEST_CHECK(!Overlaps(RangeA, RangeB) && LabelA != LabelB);
+	TEST_CHECK(Cache.GetLabels()[LabelA].UUID == 7 && Cache.GetLabels()[LabelB].UUID == 8);
+
+	// 첫 프레임은 두 라벨 모두 더티 (이웃한 라벨 자리는 한 구간으로 합쳐진다)
+	TEST_CHECK(!Cache.GetDirtyGlyphRanges().empty());
+	TEST_CHECK(Cache.GetDirtyLabelRanges().size() == 1 && Cache.GetDirtyLabelRanges()[0].Count == 2);
+	Cache.ClearDirty();
+
+	// 글자도 행렬도 그대로면 구간도 그대로, 올릴 것이 없다
+	Cache.BeginFrame();
+	const FTextTableRange SameA = Cache.UpdateLabel(FakeLabel(1), 1, GlyphsA, Translation(1.0f), 7);
+	const FTextTableRange SameB = Cache.UpdateLabel(FakeLabel(2), 2, GlyphsB, Translation(2.0f), 8);
+	Cache.EndFrame();
+	TEST_CHECK(SameA.First == RangeA.First && SameB.First == RangeB.First);
+	TEST_CHECK(Cache.GetDirtyGlyphRanges().empty() && Cache.GetDirtyLabelRanges().empty());
+
+	// 글자만 바뀌면 그 라벨의 글자 구간만, 움직이기만 하면 라벨 자리만 더티
+	const TArray<FTextGlyphInstance> NewGlyphsA = MakeGlyphs(5, 50);
+	Cache.BeginFrame();
+	Cache.UpdateLabel(FakeLabel(1), 3, NewGlyphsA, Translation(1.0f), 7);
+	Cache.UpdateLabel(FakeLabel(2), 2, GlyphsB, Translation(9.0f), 8);
+	Cache.EndFrame();
+	TEST_CHECK(Cache.GetDirtyGlyphRanges().size() == 1);
+	TEST_CHECK(Cache.GetDirtyGlyphRanges()[0].First == RangeA.First && Cache.GetDirtyGlyphRanges()[0].Count == 5);
+	TEST_CHECK(Cache.GetDirtyLabelRanges().size() == 1 && Cache.GetDirtyLabelRanges()[0].First == LabelB);
+	TEST_CHECK(RangeHolds(Cache, RangeA, NewGlyphsA, LabelA));
+	TEST_CHECK(Cache.GetLabels()[LabelB].World.Data[3][0] == 9.0f);
+}
+
+void TestGrowAndReleaseReuseSlots()
+{
+	FTextGlyphCache Cache;
+	const TArray<FTextGlyphInstance> Short = MakeGlyphs(3, 1);
+	const TArray<FTextGlyphInstance> Long = MakeGlyphs(40, 200);
+
+	Cache.BeginFrame();
+	const FTextTableRange First = Cache.UpdateLabel(FakeLabel(1), 1, Short, Translation(0.0f), 1);
+	const FTextTableRange Other = Cache.UpdateLabel(FakeLabel(2), 2, Short, Translation(0.0f), 2);
+	Cache.EndFrame();
+	Cache.ClearDirty();
+
+	// 용량 안에서 길이가 바뀌면 자리는 그대로
+	const TArray<FTextGlyphInstance> Longer = MakeGlyphs(7, 30);
+	Cache.BeginFrame();
+	FTextTableRange Grown = Cache.UpdateLabel(FakeLabel(1), 3, Longer, Translation(0.0f), 1);
+	Cache.UpdateLabel(FakeLabel(2), 2, Short, Translation(0.0f), 2);
+	Cache.EndFrame();
+	Cache.ClearDirty();
+	TEST_CHECK(Grown.First == First.First && Grown.Count == 7);
+
+	// 용량을 넘으면 새 자리로 옮기고, 다른 라벨 구간을 침범하지 않는다
+	Cache.BeginFrame();
+	Grown = Cache.UpdateLabel(FakeLabel(1), 4, Long, Translation(0.0f), 1);
+	Cache.UpdateLabel(FakeLabel(2), 2, Short, Translation(0.0f), 2);
+	Cache.EndFrame();
+	uint32 LabelIndex = 0;
+	TEST_CHECK(Grown.First != First.First && RangeHolds(Cache, Grown, Long, LabelIndex));
+	TEST_CHECK(!Overlaps(Grown, Other));
+	Cache.ClearDirty();
+
+	// 반납한 예전 구간은 같은 용량의 새 라벨이 다시 쓴다
+	Cache.BeginFrame();
+	Cache.UpdateLabel(FakeLabel(1), 4, Long, Translation(0.0f), 1);
+	Cache.UpdateLabel(FakeLabel(2), 2, Short, Translation(0.0f), 2);
+	const FTextTableRange Reused = Cache.UpdateLabel(FakeLabel(3), 5, Short, Translation(0.0f), 3);
+	Cache.EndFrame();
+	TEST_CHECK(Reused.First == First.First);
+	TEST_CHECK(Cache.NumLabels() == 3);
+	Cache.ClearDirty();
+
+	// 이번 프레임에 나오지 않은 라벨은 자리를 반납하고, 라벨 자리도 다음 라벨이 다시 쓴다
+	const size_t NumGlyphSlots = Cache.GetGlyphs().size();
+	const size_t NumLabelSlots = Cache.GetLabels().size();
+	Cache.BeginFrame();
+	Cache.UpdateLabel(FakeLabel(1), 4, Long, Translation(0.0f), 1);
+	Cache.EndFrame();
+	TEST_CHECK(Cache.NumLabels() == 1);
+
+	Cache.BeginFrame();
+	Cache.UpdateLabel(FakeLabel(1), 4, Long, Translation(0.0f), 1);
+	const FTextTableRange Fresh = Cache.UpdateLabel(FakeLabel(4), 6, Short, Translation(0.0f), 4);
+	Cache.EndFrame();
+	TEST_CHECK(RangeHolds(Cache, Fresh, Short, LabelIndex));
+	TEST_CHECK(Cache.GetGlyphs().size() == NumGlyphSlots && Cache.GetLabels().size() == NumLabelSlots);
+	TEST_CHECK(Cache.GetLabels()[LabelIndex].UUID == 4);
+
+	// 같은 주소라도 리비전이 다르면 다른 글자로 본다
+	Cache.ClearDirty();
+	Cache.BeginFrame();
+	Cache.UpdateLabel(FakeLabel(1), 4, Long, Translation(0.0f), 1);
+	Cache.UpdateLabel(FakeLabel(4), 7, MakeGlyphs(3, 900), Translation(0.0f), 4);
+	Cache.EndFrame();
+	TEST_CHECK(Cache.GetDirtyGlyphRanges().size() == 1 && Cache.GetDirtyGlyphRanges()[0].First == Fresh.First);
+	TEST_CHECK(Cache.GetGlyphs()[Fresh.First].CharId == 900);
+
+	Cache.Clear();
+	TEST_CHECK(Cache.NumLabels() == 0 && Cache.GetGlyphs().empty() && Cache.GetLabels().empty());
+}
+
+void TestDirtyRangesAreMerged()
+{
+	FTextGlyphCache Cache;
+	const TArray<FTextGlyphInstance> Full = MakeGlyphs(8, 0);
+
+	Cache.BeginFrame();
+	for (uintptr_t Id = 1; Id <= 6; ++Id)
+	{
+		Cache.UpdateLabel(FakeLabel(Id), Id, Full, Translation(0.0f), static_cast<uint32>(Id));
+	}
+	Cache.EndFrame();
+	Cache.ClearDirty();
+
+	// 2, 3번(이웃), 5번을 거꾸로 바꾸면 두 구간으로 정렬/병합된다
+	Cache.BeginFrame();
+	for (uintptr_t Id = 6; Id >= 1; --Id)
+	{
+		const bool bChanged = Id == 2 || Id == 3 || Id == 5;
+		Cache.UpdateLabel(FakeLabel(Id), bChanged ? Id + 100 : Id, Full, Translation(0.0f), static_cast<uint32>(Id));
+	}
+	Cache.EndFrame();
+
+	const TArray<FTextTableRange>& Dirty = Cache.GetDirtyGlyphRanges();
+	TEST_CHECK(Dirty.size() == 2);
+	TEST_CHECK(Dirty.size() == 2 && Dirty[0].First == 8 && Dirty[0].Count == 16 && Dirty[1].First == 32 && Dirty[1].Count == 8);
+}
+
+void TestBatcherAppendsSlotsInOrder()
+{
+	FTextBatcher Batcher;
+	Batcher.AddLabel({ 40, 3 });
+	Batcher.AddLabel({ 8, 2 });
+	Batcher.AddLabel({ 100, 0 });
+
+	const uint32 Expected[] = { 40, 41, 42, 8, 9 };
+	const TArray<uint32>& Slots = Batcher.GetGlyphSlots();
+	TEST_CHECK(Slots.size() == 5);
+	for (int32 Index = 0; Index < static_cast<int32>(Slots.size()) && Index < 5; ++Index)
+	{
+		TEST_CHECK_MSG(Slots[Index] == Expected[Index], "index %d slot %u", Index, Slots[Index]);
+	}
+
+	Batcher.Reset();
+	TEST_CHECK(Batcher.GetGlyphSlots().empty());
+}
+
+int main()
+{
+	RUN_TEST(TestUnchangedLabelsUploadNothing);
+	RUN_TEST(TestGrowAndReleaseReuseSlots);
+	RUN_TEST(TestDirtyRangesAreMerged);
+	RUN_TEST(TestBatcherAppendsSlotsInOrder);
+	return TEST_RESULT();
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "Render/Renderer/PipelineStateCache.h"
+
+#include <string>
+
+/**
+ * @brief 컨텍스트로 내려온 호출을 순서대로 기록하는 IPipelineContext 목
+ * 호출 하나가 문자열 하나이며, 핸들은 테스트가 넘긴 주소의 하위 비트 값으로 적는다.
+ */
+class FRecordingPipelineContext : public IPipelineContext
+{
+public:
+	TArray<std::string> Calls;
+
+	void Clear() { Calls.clear(); }
+	int32 Num() const { return static_cast<int32>(Calls.size()); }
+
+	void SetPrimitiveTopology(EPipelineTopology InTopology) override { Record("Topology", static_cast<uint32>(InTopology)); }
+	void SetInputLayout(FInputLayoutHandle InInputLayout) override { Record("InputLayout", Id(InInputLayout.Ptr)); }
+	void SetVertexShader(FVertexShaderHandle InVertexShader) override { Record("VS", Id(InVertexShader.Ptr)); }
+	void SetPixelShader(FPixelShaderHandle InPixelShader) override { Record("PS", Id(InPixelShader.Ptr)); }
+	void SetRasterizerState(FRasterizerStateHandle InRasterizerState) override { Record("Rasterizer", Id(InRasterizerState.Ptr)); }
+	void SetDepthStencilState(FDepthStencilStateHandle InDepthStencilState) override { Record("DepthStencil", Id(InDepthStencilState.Ptr)); }
+	void SetBlendState(FBlendStateHandle InBlendState) override { Record("Blend", Id(InBlendState.Ptr)); }
+
+	void SetVertexBuffer(uint32 InSlot, FBufferHandle InBuffer, uint32 InStride, uint32 InOffset) override
+	{
+		Record("VB", InSlot, Id(InBuffer.Ptr), InStride, InOffset);
+	}
+	void SetIndexBuffer(FBufferHandle InBuffer, uint32 InFormat, uint32 InOffset) override
+	{
+		Record("IB", Id(InBuffer.Ptr), InFormat, InOffset);
+	}
+	void SetConstantBuffer(uint32 InSlot, bool bInIsVS, FBufferHandle InBuffer) override
+	{
+		Record(bInIsVS ? "VSCB" : "PSCB", InSlot, Id(InBuffer.Ptr));
+	}
+	void SetShaderResourceView(uint32 InSlot, bool bInIsVS, FShaderResourceHandle InView) override
+	{
+		Record(bInIsVS ? "VSSRV" : "PSSRV", InSlot, Id(InView.Ptr));
+	}
+	void SetSamplerState(uint32 InSlot, bool bInIsVS, FSamplerHandle InSampler) override
+	{
+		Record(bInIsVS ? "VSSampler" : "PSSampler", InSlot, Id(InSampler.Ptr));
+	}
+
+	void Draw(uint32 InVertexCount, uint32 InStartVertex) override { Record("Draw", InVertexCount, InStartVertex); }
+	void DrawInstanced(uint32 InVertexCountPerInstance, uint32 InInstanceCount, uint32 InStartVertex, uint32 InStartInstance) override
+	{
+		Record("DrawInstanced", InVertexCountPerInstance, InInstanceCount, InStartVertex, InStartInstance);
+	}
+	void DrawIndexed(uint32 InIndexCount, uint32 InStartIndex, int32 InBaseVertex) override
+	{
+		Record("DrawIndexed", InIndexCount, InStartIndex, static_cast<uint32>(InBaseVertex));
+	}
+	void DrawIndexedInstanced(uint32 InIndexCountPerInstance, uint32 InInstanceCount, uint32 InStartIndex,
+		int32 InBaseVertex, uint32 InStartInstance) override
+	{
+		Record("DrawIndexedInstanced", InIndexCountPerInstance, InInstanceCount, InStartIndex, static_cast<uint32>(InBaseVertex), InStartInstance);
+	}
+
+	/** 테스트용 가짜 핸들 (nullptr이 아닌 고유 주소) */
+	template<typename THandle>
+	static THandle MakeHandle(uint32 InId) { return THandle(reinterpret_cast<void*>(static_cast<uintptr_t>(InId) << 4)); }
+
+private:
+	static uint32 Id(const void* InPtr) { return static_cast<uint32>(reinterpret_cast<uintptr_t>(InPtr) >> 4); }
+
+	template<typename... TArgs>
+	void Record(const char* InName, TArgs... InArgs)
+	{
+		std::string Call = InName;
+		((Call += " " + std::to_string(InArgs)), ...);
+		Calls.push_back(Call);
+	}
+};
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdio>
+
+/**
+ * @brief 헤드리스 테스트 공용 검사 매크로
+ * 실패는 파일/줄과 함께 출력하고 GTestFailures에 누적한다. main은 TEST_RESULT()를 종료 코드로 돌려준다.
+ */
+inline int GTestFailures = 0;
+
+#define TEST_CHECK(Expression)                                                        \
+	do                                                                                \
+	{                                                                                 \
+		if (!(Expression))                                                            \
+		{                                                                             \
+			++GTestFailures;                                                          \
+			std::printf("  FAILED %s(%d): %s\n", __FILE__, __LINE__, #Expression);    \
+		}                                                                             \
+	} while (0)
+
+#define TEST_CHECK_MSG(Expression, Format, ...)                                       \
+	do                                                                                \
+	{                                                                                 \
+		if (!(Expression))                                                            \
+		{                                                                             \
+			++GTestFailures;                                                          \
+			std::printf("  FAILED %s(%d): %s - " Format "\n", __FILE__, __LINE__,     \
+				#Expression, ##__VA_ARGS__);                                          \
+		}                                                                             \
+	} while (0)
+
+#define RUN_TEST(Function)                                                            \
+	do                                                                                \
+	{                                                                                 \
+		const int FailuresBefore = GTestFailures;                                     \
+		std::printf("[ RUN  ] %s\n", #Function);                                      \
+		Function();                                                                   \
+		std::printf("[ %s ] %s\n", GTestFailures == FailuresBefore ? " OK " : "FAIL", #Function); \
+	} while (0)
+
+#define TEST_RESULT() (GTestFailures == 0 ? 0 : 1)
@@ -0,0 +1,20 @@
+#pragma once
+
+/**
+ * @brief 헤드리스 테스트용 pch.h
+ * 엔진 소스의 #include "pch.h"가 이 파일로 연결된다. Windows/D3D 없이 빌드되는 CoreMinimal만 포함한다.
+ */
+#include "Global/CoreMinimal.h"
+
+/** UE_LOG 대상. 테스트에서는 UE_LOG의 printf 출력만 남긴다 */
+class UConsoleWindow
+{
+public:
+	static UConsoleWindow& GetInstance()
+	{
+		static UConsoleWindow Instance;
+		return Instance;
+	}
+
+	void AddLog(const char* InFormat, ...) const {}
+};
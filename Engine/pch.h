@@ -10,65 +10,11 @@
 #include <d3dcompiler.h>
 #include "DirectXTK/Inc/DDSTextureLoader.h"
 
-// Standard Library
-#include <cmath>
-#include <cassert>
-#include <string>
-#include <chrono>
-#include <algorithm>
-#include <iostream>
-#include <fstream>
-#include <functional>
-#include <filesystem>
-#include <iterator>
-#include <sstream>
-
-// Global Included
-#include "Global/Types.h"
-#include "Global/Memory.h"
-#include "Global/Constant.h"
-#include "Global/Enum.h"
-#include "Global/Matrix.h"
-#include "Global/Quat.h"
-#include "Global/Vector.h"
+// Engine Core (D3D/Windows 없이도 빌드되는 부분, 헤드리스 테스트와 공유)
+#include "Global/CoreMinimal.h"
 #include "Global/CoreTypes.h"
-#include "Global/Macro.h"
 #include "Global/Function.h"
-#include "Global/Name.h"
-#include "Global/NameTable.h"
 #include "Global/PipelineType.h"
-#include "Math/AABB.h"
-#include "Math/Math.h"
-#include "Global/Traits.h"
-#include "Manager/Time/Week05TimeClass.h"
-
-
-using std::clamp;
-using std::unordered_map;
-using std::to_string;
-using std::function;
-using std::wstring;
-using std::cout;
-using std::cerr;
-using std::min;
-using std::max;
-using std::exception;
-using std::stoul;
-using std::ofstream;
-using std::ifstream;
-using std::setw;
-using std::sort;
-using std::shared_ptr;
-using std::unique_ptr;
-using std::streamsize;
-
-// File System
-namespace filesystem = std::filesystem;
-using filesystem::path;
-using filesystem::exists;
-using filesystem::create_directories;
-
-
 
 // Library Linking
 #pragma comment(lib, "user32")